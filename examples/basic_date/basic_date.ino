@@ -56,7 +56,7 @@ void setup() {
 	if (date.nowLocalString(localNowBuffer, sizeof(localNowBuffer))) {
 		Serial.printf("Now (Local string): %s\n", localNowBuffer);
 	}
-	std::string utcNowString = date.nowUtcString();
+	DateTimeText utcNowString = date.nowUtcString();
 	Serial.printf("Now (UTC string): %s\n", utcNowString.c_str());
 
 	char lastYearLocalBuffer[32];
@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+static constexpr size_t kSamples = 2000;
+
+static DateTime stamps[kSamples];
+static int16_t years[kSamples];
+static uint8_t months[kSamples];
+static uint8_t days[kSamples];
+static uint8_t hours[kSamples];
+static uint8_t minutes[kSamples];
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate batch conversion example");
+
+	date.init(ESPDateConfig{0.0f, 0.0f, "CET-1CEST,M3.5.0/2,M10.5.0/3", nullptr});
+
+	// A sensor log: one sample every 30 seconds, already sorted.
+	const DateTime first = date.fromUtc(2025, 3, 30, 0, 0, 0);
+	for (size_t i = 0; i < kSamples; ++i) {
+		stamps[i] = date.addSeconds(first, static_cast<int64_t>(i) * 30);
+	}
+
+	uint32_t checksum = 0;
+	uint32_t started = micros();
+	for (size_t i = 0; i < kSamples; ++i) {
+		const LocalDateTime local = date.toLocal(stamps[i]);
+		checksum += static_cast<uint32_t>(local.hour + local.minute);
+	}
+	const uint32_t scalarUs = micros() - started;
+
+	// Only the columns the caller needs are filled; the others stay nullptr.
+	DateFieldColumns columns{};
+	columns.year = years;
+	columns.month = months;
+	columns.day = days;
+	columns.hour = hours;
+	columns.minute = minutes;
+	started = micros();
+	const size_t converted = date.toLocalBatch(stamps, kSamples, columns);
+	const uint32_t batchUs = micros() - started;
+	for (size_t i = 0; i < converted; ++i) {
+		checksum -= static_cast<uint32_t>(hours[i] + minutes[i]);
+	}
+
+	Serial.printf(
+	    "toLocal loop:  %lu us (%.2f us/stamp)\n",
+	    static_cast<unsigned long>(scalarUs),
+	    static_cast<double>(scalarUs) / kSamples
+	);
+	Serial.printf(
+	    "toLocalBatch:  %lu us (%.2f us/stamp), %u converted, checksum %s\n",
+	    static_cast<unsigned long>(batchUs),
+	    static_cast<double>(batchUs) / kSamples,
+	    static_cast<unsigned>(converted),
+	    checksum == 0 ? "ok" : "MISMATCH"
+	);
+	Serial.printf(
+	    "Last sample: %04d-%02u-%02u %02u:%02u local\n",
+	    years[kSamples - 1],
+	    months[kSamples - 1],
+	    days[kSamples - 1],
+	    hours[kSamples - 1],
+	    minutes[kSamples - 1]
+	);
+}
+
+void loop() {
+}
@@ -0,0 +1,64 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+ESPDateBusinessCalendar calendar;
+
+static void printLocal(const char *label, const DateTime &dt) {
+	char text[32];
+	date.toLocal(dt).localString(text, sizeof(text));
+	Serial.printf("%-34s %s\n", label, text);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+
+	// Hungarian public holidays: fixed dates plus Easter-relative ones.
+	const uint8_t fixed[][2] =
+	    {{1, 1}, {3, 15}, {5, 1}, {8, 20}, {10, 23}, {11, 1}, {12, 25}, {12, 26}};
+	for (const auto &holiday : fixed) {
+		calendar.addFixedHoliday(holiday[0], holiday[1]);
+	}
+	calendar.addEasterHoliday(-2); // Good Friday
+	calendar.addEasterHoliday(1);  // Easter Monday
+	calendar.addEasterHoliday(50); // Whit Monday
+	calendar.begin(2024, 10);
+	calendar.setBusinessDay(2025, 5, 2, false); // bridge day off...
+	calendar.setBusinessDay(2025, 5, 17, true); // ...worked on a Saturday instead
+
+	const DateTime invoiced = date.fromLocal(2025, 4, 15, 10, 0, 0);
+	DateTime due{};
+	date.addBusinessDays(invoiced, 15, calendar, due);
+	printLocal("Invoice 2025-04-15, due in 15 days", due);
+
+	int32_t days = 0;
+	date.businessDaysBetween(invoiced, date.fromLocal(2025, 12, 31), calendar, days);
+	Serial.printf("%-34s %ld\n", "Working days left in 2025", static_cast<long>(days));
+
+	DateTime window{};
+	date.nextBusinessDayAt(date.fromLocal(2025, 12, 24, 9, 0, 0), 8, 0, calendar, window);
+	printLocal("Maintenance after Christmas Eve", window);
+
+	// Offsets and counts cost the same over a week or a decade.
+	const uint32_t started = micros();
+	int64_t checksum = 0;
+	for (int i = 0; i < 1000; ++i) {
+		date.addBusinessDays(invoiced, 1 + i % 2000, calendar, due);
+		checksum += due.epochSeconds;
+	}
+	const uint32_t elapsedUs = micros() - started;
+	Serial.printf(
+	    "addBusinessDays: %.2f us/call (checksum %ld)\n",
+	    elapsedUs / 1000.0,
+	    static_cast<long>(checksum & 0xffff)
+	);
+}
+
+void loop() {
+	delay(1000);
+}
@@ -0,0 +1,58 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+template <typename Read> static void benchmark(const char *label, Read read) {
+	const int iterations = 20000;
+	uint32_t checksum = 0;
+	const uint32_t started = micros();
+	for (int i = 0; i < iterations; ++i) {
+		checksum += read();
+	}
+	const uint32_t elapsedUs = micros() - started;
+	Serial.printf(
+	    "%-22s %.3f us/call (checksum %lu)\n",
+	    label,
+	    static_cast<double>(elapsedUs) / iterations,
+	    static_cast<unsigned long>(checksum & 0xffff)
+	);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+
+	// A logger or display loop stamps every line; the text only changes once a second.
+	char text[32];
+	benchmark("nowLocalString", [&] {
+		date.nowLocalString(text, sizeof(text));
+		return static_cast<uint32_t>(text[18]);
+	});
+	benchmark("nowLocalStringCached", [&] {
+		date.nowLocalStringCached(text, sizeof(text));
+		return static_cast<uint32_t>(text[18]);
+	});
+	benchmark("nowLocal", [] { return static_cast<uint32_t>(date.nowLocal().second); });
+	benchmark("nowLocalCached", [] { return static_cast<uint32_t>(date.nowLocalCached().second); });
+	benchmark("now", [] { return static_cast<uint32_t>(date.now().epochSeconds); });
+	benchmark("nowCoarse", [] { return static_cast<uint32_t>(date.nowCoarse().epochSeconds); });
+
+	Serial.printf("Cached local time: %s\n", date.nowLocalStringCached().c_str());
+	Serial.printf("Cached UTC time:   %s\n", date.nowUtcStringCached().c_str());
+}
+
+void loop() {
+	// Optional: refresh from a once-a-second tick so no hot-path caller pays for the rebuild.
+	static uint32_t lastTick = 0;
+	if (millis() - lastTick >= 1000) {
+		lastTick = millis();
+		date.refreshCoarseClock();
+		Serial.println(date.nowLocalStringCached().c_str());
+	}
+	delay(10);
+}
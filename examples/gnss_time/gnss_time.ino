@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+// GNSS module on Serial1 (NMEA at 9600 baud) with its PPS output on a GPIO.
+static constexpr int kGnssRxPin = 16;
+static constexpr int kGnssTxPin = 17;
+static constexpr int kPpsPin = 4;
+
+ESPDate date;
+ESPDateGnssClock gnss;
+
+// One second of u-blox output: RMC and ZDA carry the time, the rest is skipped unchecked.
+static const char kBurst[] =
+    "$GNRMC,120000.00,A,4729.73521,N,01902.41310,E,0.012,,300325,,,A*6E\r\n"
+    "$GNVTG,,T,,M,0.012,N,0.022,K,A*3E\r\n"
+    "$GNGGA,120000.00,4729.73521,N,01902.41310,E,1,12,0.79,112.4,M,40.5,M,,*4C\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.37,0.79,1.12*11\r\n"
+    "$GPGSV,3,1,11,05,27,073,38,13,33,126,41,15,65,101,44,18,21,318,35*77\r\n"
+    "$GNGLL,4729.73521,N,01902.41310,E,120000.00,A,A*73\r\n"
+    "$GNZDA,120000.00,30,03,2025,00,00*7E\r\n";
+
+void IRAM_ATTR onPpsEdge() {
+	gnss.onPps(esp_timer_get_time());
+}
+
+static void benchmarkParser() {
+	ESPDateNmeaParser parser;
+	const int rounds = 2000;
+	size_t fixes = 0;
+	const uint32_t started = micros();
+	for (int i = 0; i < rounds; ++i) {
+		fixes += parser.feed(kBurst, sizeof(kBurst) - 1);
+	}
+	const uint32_t elapsedUs = micros() - started;
+	const double bytes = static_cast<double>(rounds) * (sizeof(kBurst) - 1);
+	Serial.printf(
+	    "NMEA parse: %.1f MB/s (%u time sentences; a 9600-baud UART delivers 960 B/s)\n",
+	    bytes / elapsedUs,
+	    static_cast<unsigned>(fixes)
+	);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+	date.addNtpSyncListener([](const DateTime &syncedAt) {
+		Serial.printf("GNSS sync: %s\n", date.dateTimeToStringLocal(syncedAt).c_str());
+	});
+
+	benchmarkParser();
+
+	Serial1.begin(9600, SERIAL_8N1, kGnssRxPin, kGnssTxPin);
+	pinMode(kPpsPin, INPUT);
+	attachInterrupt(digitalPinToInterrupt(kPpsPin), onPpsEdge, RISING);
+}
+
+void loop() {
+	char chunk[64];
+	size_t length = 0;
+	while (length < sizeof(chunk) && Serial1.available() > 0) {
+		chunk[length++] = static_cast<char>(Serial1.read());
+	}
+	if (length > 0 && gnss.feed(chunk, length, esp_timer_get_time())) {
+		const ESPDateGnssSample &sample = gnss.sample();
+		// Sets the system clock and runs the SNTP sync path (discipline, listeners...).
+		date.syncFromReference(sample);
+		Serial.printf(
+		    "  %s, error bound %ld us\n",
+		    sample.ppsAligned ? "PPS-aligned" : "no PPS edge",
+		    static_cast<long>(sample.errorBoundUs)
+		);
+	}
+	delay(5);
+}
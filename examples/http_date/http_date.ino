@@ -0,0 +1,85 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+template <typename Run> static void benchmark(const char *label, Run run) {
+	const int iterations = 20000;
+	uint32_t checksum = 0;
+	const uint32_t started = micros();
+	for (int i = 0; i < iterations; ++i) {
+		checksum += run(i);
+	}
+	const uint32_t elapsedUs = micros() - started;
+	Serial.printf(
+	    "%-28s %.3f us/call (checksum %lu)\n",
+	    label,
+	    static_cast<double>(elapsedUs) / iterations,
+	    static_cast<unsigned long>(checksum & 0xffff)
+	);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+
+	// Response headers: Date, Last-Modified and Expires.
+	char header[ESPDate::kHttpDateLength + 1];
+	const DateTime modified = date.fromUtc(2025, 3, 14, 9, 26, 53);
+	date.formatHttpDate(date.now(), header, sizeof(header));
+	Serial.printf("Date: %s\n", header);
+	date.formatHttpDate(modified, header, sizeof(header));
+	Serial.printf("Last-Modified: %s\n", header);
+	Serial.printf("Expires: %s\n", date.formatHttpDate(date.addHours(1)).c_str());
+	Serial.printf("Mail Date: %s\n", date.formatRfc2822Local(modified).c_str());
+
+	// Conditional request: 304 when the resource has not changed since the client's copy.
+	const char *ifModifiedSince = "Fri, 14 Mar 2025 09:26:53 GMT";
+	const ESPDate::ParseResult since = date.parseHttpDate(ifModifiedSince);
+	Serial.printf(
+	    "If-Modified-Since: %s -> %s\n",
+	    ifModifiedSince,
+	    since.ok && !date.isAfter(modified, since.value) ? "304 Not Modified" : "200 OK"
+	);
+
+	// One stamp per iteration, a little over a day apart, so no cache helps either path.
+	const int64_t base = modified.epochSeconds;
+	char text[64];
+	benchmark("formatWithPatternUtc", [&](int i) {
+		date.formatWithPatternUtc(
+		    DateTime{base + i * 90001LL}, "%a, %d %b %Y %H:%M:%S GMT", text, sizeof(text)
+		);
+		return static_cast<uint32_t>(text[6]);
+	});
+	benchmark("formatHttpDate", [&](int i) {
+		date.formatHttpDate(DateTime{base + i * 90001LL}, text, sizeof(text));
+		return static_cast<uint32_t>(text[6]);
+	});
+	benchmark("formatRfc2822Utc", [&](int i) {
+		date.formatRfc2822Utc(DateTime{base + i * 90001LL}, text, sizeof(text));
+		return static_cast<uint32_t>(text[6]);
+	});
+
+	const int kStamps = 64;
+	char stamps[kStamps][ESPDate::kHttpDateLength + 1];
+	for (int i = 0; i < kStamps; ++i) {
+		date.formatHttpDate(DateTime{base + i * 90001LL}, stamps[i], sizeof(stamps[i]));
+	}
+	benchmark("parseHttpDate", [&](int i) {
+		return static_cast<uint32_t>(date.parseHttpDate(stamps[i % kStamps]).value.epochSeconds);
+	});
+	benchmark("parseRfc2822", [&](int i) {
+		return static_cast<uint32_t>(date.parseRfc2822(stamps[i % kStamps]).value.epochSeconds);
+	});
+	benchmark("parseIso8601Utc (reference)", [&](int i) {
+		static const char *kIso = "2025-03-14T09:26:53Z";
+		return static_cast<uint32_t>(date.parseIso8601Utc(kIso).value.epochSeconds + i);
+	});
+}
+
+void loop() {
+}
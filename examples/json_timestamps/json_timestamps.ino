@@ -0,0 +1,110 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <ESPDateJson.h>
+
+ESPDate date;
+
+static constexpr size_t kStamps = 1000;
+
+static char payload[kStamps * (ESPDateIso8601Codec::kUtcLength + 3) + 32];
+
+static void report(const char *name, uint32_t buildUs, uint32_t serializeUs, uint32_t readUs) {
+	Serial.printf(
+	    "%-22s build %6lu us, serialize %6lu us, deserialize+read %6lu us (%u bytes)\n",
+	    name,
+	    static_cast<unsigned long>(buildUs),
+	    static_cast<unsigned long>(serializeUs),
+	    static_cast<unsigned long>(readUs),
+	    static_cast<unsigned>(strlen(payload))
+	);
+}
+
+static DateTime stampAt(size_t i) {
+	// A sensor log every 15 s, so consecutive stamps never share a formatted string.
+	return DateTime{date.fromUtc(2025, 5, 1, 0, 0, 0).epochSeconds + static_cast<int64_t>(i) * 15};
+}
+
+// Fills one document with kStamps timestamps, serializes it, then parses the payload back and
+// reads every stamp. Returns false if a stamp did not survive the round trip.
+template <typename Add, typename Read>
+static bool runDocument(const char *name, Add add, Read read) {
+	JsonDocument doc;
+	uint32_t started = micros();
+	JsonArray stamps = doc["stamps"].to<JsonArray>();
+	for (size_t i = 0; i < kStamps; ++i) {
+		add(stamps, stampAt(i));
+	}
+	const uint32_t buildUs = micros() - started;
+
+	started = micros();
+	serializeJson(doc, payload, sizeof(payload));
+	const uint32_t serializeUs = micros() - started;
+
+	started = micros();
+	JsonDocument in;
+	const DeserializationError error = deserializeJson(in, payload);
+	bool ok = !error;
+	size_t index = 0;
+	for (JsonVariantConst stamp : in["stamps"].as<JsonArrayConst>()) {
+		ok = ok && read(stamp).epochSeconds == stampAt(index).epochSeconds;
+		++index;
+	}
+	const uint32_t readUs = micros() - started;
+
+	report(name, buildUs, serializeUs, readUs);
+	return ok && index == kStamps;
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate JSON timestamps example");
+
+	// A single reading: DateTime as UTC text, LocalDateTime with the offset it was taken at.
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+	JsonDocument reading;
+	reading["takenAt"] = stampAt(0);
+	reading["takenAtLocal"] = date.toLocal(stampAt(0));
+	reading["celsius"] = 21.5;
+	serializeJson(reading, payload, sizeof(payload));
+	Serial.println(payload);
+	const DateTime takenAt = reading["takenAt"].as<DateTime>();
+	Serial.printf("takenAt read back: %lld\n", static_cast<long long>(takenAt.epochSeconds));
+
+	// strftime-backed text through DateTimeText, parsed back with parseIso8601Utc.
+	bool ok = runDocument(
+	    "dateTimeToStringUtc",
+	    [](JsonArray &stamps, const DateTime &dt) {
+		    stamps.add(date.dateTimeToStringUtc(dt, ESPDateFormat::Iso8601).c_str());
+	    },
+	    [](JsonVariantConst stamp) {
+		    return date.parseIso8601Utc(stamp.as<const char *>()).value;
+	    }
+	);
+
+	// The converters: table-driven ISO text copied once into the document.
+	ESPDateJson::setFormat(ESPDateJsonFormat::Iso8601);
+	ok = runDocument(
+	         "converter (ISO-8601)",
+	         [](JsonArray &stamps, const DateTime &dt) { stamps.add(dt); },
+	         [](JsonVariantConst stamp) { return stamp.as<DateTime>(); }
+	     ) &&
+	     ok;
+
+	// Integers skip text entirely and keep the payload smallest.
+	ESPDateJson::setFormat(ESPDateJsonFormat::EpochSeconds);
+	ok = runDocument(
+	         "converter (epoch s)",
+	         [](JsonArray &stamps, const DateTime &dt) { stamps.add(dt); },
+	         [](JsonVariantConst stamp) { return stamp.as<DateTime>(); }
+	     ) &&
+	     ok;
+	ESPDateJson::setFormat(ESPDateJsonFormat::Iso8601);
+
+	Serial.println(ok ? "All stamps round-tripped" : "Round trip FAILED");
+}
+
+void loop() {
+}
@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDateLogRewriter rewriter;
+
+// A UTC log as written by the device, crossing the spring DST change in Central Europe.
+static char logText[] = "2025-03-30 00:59:58.120 I boot reason=deepsleep\n"
+                        "2025-03-30 00:59:59.870 W wifi rssi=-74\n"
+                        "2025-03-30 01:00:00.015 I mqtt connected\n"
+                        "    continuation lines are left alone\n"
+                        "2025-03-30 01:00:01.500 I sensor temp=4.5\n";
+
+// Room for the four stamps to grow by "+hhmm" each.
+static char isoOut[sizeof(logText) + 4 * ESPDateLogRewriter::kMaxGrowthPerStamp];
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate log rewriter example");
+
+	ESPDateLogRewriterConfig config;
+	config.timeZone = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+	config.columns[0] = 0; // stamps start each line
+	config.columnCount = 1;
+
+	// Iso8601 style appends the offset, so the text grows and needs a second buffer.
+	config.style = ESPDateLogStampStyle::Iso8601;
+	if (rewriter.begin(config)) {
+		const size_t length = sizeof(logText) - 1;
+		ESPDateLogRewriter::Result result =
+		    rewriter.rewrite(logText, length, isoOut, sizeof(isoOut) - 1, true);
+		isoOut[result.written] = '\0';
+		Serial.print(isoOut);
+	}
+
+	// DateTime style keeps every line's length, so the buffer is rewritten in place.
+	config.style = ESPDateLogStampStyle::DateTime;
+	if (rewriter.begin(config)) {
+		const size_t length = sizeof(logText) - 1;
+		rewriter.rewrite(logText, length, logText, length, true);
+		Serial.print(logText);
+	}
+
+	const ESPDateLogRewriteStats &stats = rewriter.stats();
+	Serial.printf(
+	    "%llu lines, %llu stamps rewritten\n",
+	    static_cast<unsigned long long>(stats.lines),
+	    static_cast<unsigned long long>(stats.stamps)
+	);
+}
+
+void loop() {
+	delay(1000);
+}
@@ -0,0 +1,67 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+#if ESPDATE_HAS_FREERTOS_EXECUTOR
+using PoolExecutor = ESPDateFreeRtosExecutor; // helper tasks on the other core(s)
+#else
+using PoolExecutor = ESPDateThreadExecutor; // std::thread pool on host builds
+#endif
+
+static constexpr size_t kSamples = 4000;
+static constexpr int kRounds = 5;
+
+static DateTime stamps[kSamples];
+static uint8_t hours[kSamples];
+static uint8_t minutes[kSamples];
+static int16_t offsets[kSamples];
+
+static uint32_t timeBatch(ESPDateExecutor *executor) {
+	DateFieldColumns columns{};
+	columns.hour = hours;
+	columns.minute = minutes;
+	columns.offsetMinutes = offsets;
+	uint32_t best = UINT32_MAX;
+	for (int round = 0; round < kRounds; ++round) {
+		const uint32_t started = micros();
+		date.toLocalBatch(stamps, kSamples, columns, nullptr, executor);
+		const uint32_t elapsed = micros() - started;
+		best = elapsed < best ? elapsed : best;
+	}
+	return best;
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate parallel batch example");
+
+	date.init(ESPDateConfig{0.0f, 0.0f, "CET-1CEST,M3.5.0/2,M10.5.0/3", nullptr});
+
+	// Scattered stamps over ten years, so every element pays for its own calendar math.
+	uint32_t seed = 1;
+	for (size_t i = 0; i < kSamples; ++i) {
+		seed = seed * 1664525u + 1013904223u;
+		stamps[i] = DateTime{1600000000 + static_cast<int64_t>(seed % 315360000u)};
+	}
+
+	const uint32_t serialUs = timeBatch(nullptr);
+	Serial.printf("serial    : %6lu us\n", static_cast<unsigned long>(serialUs));
+	const size_t maxThreads = PoolExecutor::hardwareThreads();
+	for (size_t threads = 1; threads <= maxThreads && threads <= PoolExecutor::kMaxThreads;
+	     ++threads) {
+		PoolExecutor executor(threads);
+		const uint32_t elapsedUs = timeBatch(&executor);
+		Serial.printf(
+		    "%2u thread%s: %6lu us (%.2fx)\n",
+		    static_cast<unsigned>(executor.concurrency()),
+		    executor.concurrency() == 1 ? " " : "s",
+		    static_cast<unsigned long>(elapsedUs),
+		    elapsedUs > 0 ? static_cast<double>(serialUs) / elapsedUs : 0.0
+		);
+	}
+}
+
+void loop() {
+}
@@ -0,0 +1,53 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+ESPDateSimulatedTimeSource simulated(1735689600LL * 1000000); // 2025-01-01T00:00:00Z
+ESPDateScheduler scheduler;
+ESPDateRecurrence watering("0 6 * * *");
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.latitude = 47.4979f;
+	config.longitude = 19.0402f;
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+	date.setTimeSource(&simulated);
+
+	scheduler.begin(8);
+	scheduler.setTimeZone(config.timeZone);
+	int waterings = 0;
+	int darkWaterings = 0;
+	scheduler.scheduleRecurring(watering, date.now(), [&](uint32_t, const DateTime &due) {
+		++waterings;
+		darkWaterings += date.isDay(due) ? 0 : 1;
+	});
+
+	// One simulated year of a light controller that checks the sun every 10 minutes.
+	const uint32_t started = micros();
+	int lightSwitches = 0;
+	bool lightsOn = false;
+	for (int step = 0; step < 365 * 24 * 6; ++step) {
+		simulated.advanceSeconds(600);
+		scheduler.tick(date.now());
+		const bool dark = !date.isDay();
+		lightSwitches += dark != lightsOn ? 1 : 0;
+		lightsOn = dark;
+	}
+	const uint32_t elapsedUs = micros() - started;
+
+	Serial.printf("Simulated up to  %s\n", date.nowLocalString().c_str());
+	Serial.printf("Waterings        %d (%d before sunrise)\n", waterings, darkWaterings);
+	Serial.printf("Light switches   %d\n", lightSwitches);
+	Serial.printf("A simulated year took %.1f ms of real time\n", elapsedUs / 1000.0);
+
+	// Back to the real clock.
+	date.setTimeSource(nullptr);
+	Serial.printf("Real time        %s\n", date.nowLocalString().c_str());
+}
+
+void loop() {
+}
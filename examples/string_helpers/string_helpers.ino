@@ -21,8 +21,8 @@ void setup() {
 		Serial.printf("DateTime::localString -> %s\n", buf);
 	}
 
-	std::string localStr = release.localString();
-	Serial.printf("DateTime local std::string -> %s\n", localStr.c_str());
+	DateTimeText localStr = release.localString(); // fixed inline buffer, no heap
+	Serial.printf("DateTime local DateTimeText -> %s\n", localStr.c_str());
 
 	// Convert to local components, then format directly from LocalDateTime.
 	LocalDateTime local = date.toLocal(release);
@@ -39,7 +39,7 @@ void setup() {
 		Serial.printf("ESPDate::nowLocalString -> %s\n", buf);
 	}
 
-	std::string nowUtc = date.nowUtcString(ESPDateFormat::Iso8601);
+	DateTimeText nowUtc = date.nowUtcString(ESPDateFormat::Iso8601);
 	Serial.printf("ESPDate::nowUtcString(ISO) -> %s\n", nowUtc.c_str());
 }
 
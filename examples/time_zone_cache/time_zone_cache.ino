@@ -0,0 +1,128 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+// A gateway rendering data for devices in many zones.
+static const char *const kZones[] = {
+    "UTC0",
+    "GMT0BST,M3.5.0/1,M10.5.0",
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "EET-2EEST,M3.5.0/3,M10.5.0/4",
+    "MSK-3",
+    "<+04>-4",
+    "IST-5:30",
+    "<+0545>-5:45",
+    "CST-8",
+    "JST-9",
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "NZST-12NZDT,M9.5.0,M4.1.0/3",
+    "<-03>3",
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+    "EST5EDT,M3.2.0,M11.1.0",
+    "CST6CDT,M3.2.0,M11.1.0",
+    "MST7",
+    "MST7MDT,M3.2.0,M11.1.0",
+    "PST8PDT,M3.2.0,M11.1.0",
+    "AKST9AKDT,M3.2.0,M11.1.0",
+    "HST10",
+    "NST3:30NDT,M3.2.0,M11.1.0",
+    "IST-2IDT,M3.4.4/26,M10.5.0",
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+    "WET0WEST,M3.5.0/1,M10.5.0",
+    "<+03>-3",
+    "WIB-7",
+    "PKT-5",
+    "SAST-2",
+};
+static constexpr size_t kZoneCount = sizeof(kZones) / sizeof(kZones[0]);
+static constexpr int kRounds = 100;
+
+static ESPDateTimeZone handles[kZoneCount];
+
+static void report(const char *name, uint32_t elapsedUs, int32_t checksum) {
+	Serial.printf(
+	    "%-22s %7.2f us/conversion (checksum %ld)\n",
+	    name,
+	    static_cast<double>(elapsedUs) / (kRounds * kZoneCount),
+	    static_cast<long>(checksum)
+	);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate time-zone cache example");
+
+	for (size_t z = 0; z < kZoneCount; ++z) {
+		handles[z] = ESPDateTimeZone::fromPosix(kZones[z]);
+	}
+	const DateTime start = date.fromUtc(2025, 3, 1, 0, 0, 0);
+
+	// What a per-call TZ string cost before: switch the process TZ, let libc convert, restore.
+	int32_t checksum = 0;
+	uint32_t started = micros();
+	for (int round = 0; round < kRounds; ++round) {
+		const time_t raw = static_cast<time_t>(date.addHours(start, round * 7).epochSeconds);
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			setenv("TZ", kZones[z], 1);
+			tzset();
+			tm local{};
+			localtime_r(&raw, &local);
+			checksum += local.tm_hour;
+		}
+	}
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	report("libc TZ switch", micros() - started, checksum);
+
+	// Parse the string on every call (cache disabled).
+	ESPDateTimeZoneCache &cache = ESPDateTimeZoneCache::shared();
+	cache.configure(0);
+	checksum = 0;
+	started = micros();
+	for (int round = 0; round < kRounds; ++round) {
+		const DateTime dt = date.addHours(start, round * 7);
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			checksum += date.toLocal(dt, kZones[z]).hour;
+		}
+	}
+	report("parse every call", micros() - started, checksum);
+
+	cache.configure(ESPDateTimeZoneCache::kDefaultCapacity);
+	cache.clear(); // count only the lookups below
+	checksum = 0;
+	started = micros();
+	for (int round = 0; round < kRounds; ++round) {
+		const DateTime dt = date.addHours(start, round * 7);
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			checksum += date.toLocal(dt, kZones[z]).hour;
+		}
+	}
+	report("cached TZ string", micros() - started, checksum);
+
+	checksum = 0;
+	started = micros();
+	for (int round = 0; round < kRounds; ++round) {
+		const DateTime dt = date.addHours(start, round * 7);
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			checksum += date.toLocal(dt, handles[z]).hour;
+		}
+	}
+	report("ESPDateTimeZone handle", micros() - started, checksum);
+
+	const ESPDateTimeZoneCacheStats stats = cache.stats();
+	Serial.printf(
+	    "cache: %lu hits, %lu misses, %lu evictions, %u/%u entries\n",
+	    static_cast<unsigned long>(stats.hits),
+	    static_cast<unsigned long>(stats.misses),
+	    static_cast<unsigned long>(stats.evictions),
+	    static_cast<unsigned>(stats.entries),
+	    static_cast<unsigned>(stats.capacity)
+	);
+}
+
+void loop() {
+	delay(1000);
+}
@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+ESPDate date;
+
+static constexpr size_t kStamps = 2000;
+
+static DateTime stamps[kStamps];
+static uint8_t buffer[kStamps * ESPDateDeltaEncoder::kMaxBytesPerStamp];
+
+static void report(const char *name, size_t bytes, uint32_t encodeUs, uint32_t decodeUs) {
+	Serial.printf(
+	    "%-14s %5.2f bytes/stamp, encode %7.0f stamps/ms, decode %7.0f stamps/ms\n",
+	    name,
+	    static_cast<double>(bytes) / kStamps,
+	    encodeUs > 0 ? kStamps * 1000.0 / encodeUs : 0.0,
+	    decodeUs > 0 ? kStamps * 1000.0 / decodeUs : 0.0
+	);
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.println("ESPDate timestamp codecs example");
+
+	// A sensor log every 15 s with a little scheduling jitter.
+	const int64_t start = date.fromUtc(2025, 5, 1, 0, 0, 0).epochSeconds;
+	for (size_t i = 0; i < kStamps; ++i) {
+		stamps[i] = DateTime{start + static_cast<int64_t>(i) * 15 + static_cast<int64_t>(i % 4)};
+	}
+	DateTime decoded{};
+	bool ok = true;
+
+	uint32_t started = micros();
+	ESPDateDeltaEncoder encoder(buffer, sizeof(buffer));
+	for (size_t i = 0; i < kStamps; ++i) {
+		encoder.append(stamps[i]);
+	}
+	uint32_t encodeUs = micros() - started;
+	started = micros();
+	ESPDateDeltaDecoder decoder(encoder.data(), encoder.size());
+	for (size_t i = 0; i < kStamps && decoder.next(decoded); ++i) {
+		ok = ok && decoded.epochSeconds == stamps[i].epochSeconds;
+	}
+	report("delta-of-delta", encoder.size(), encodeUs, micros() - started);
+
+	const ESPDateEpoch32Codec epoch32;
+	started = micros();
+	for (size_t i = 0; i < kStamps; ++i) {
+		epoch32.encode(stamps[i], buffer + i * ESPDateEpoch32Codec::kSize);
+	}
+	encodeUs = micros() - started;
+	started = micros();
+	for (size_t i = 0; i < kStamps; ++i) {
+		decoded = epoch32.decode(buffer + i * ESPDateEpoch32Codec::kSize);
+		ok = ok && decoded.epochSeconds == stamps[i].epochSeconds;
+	}
+	report("epoch32", kStamps * ESPDateEpoch32Codec::kSize, encodeUs, micros() - started);
+
+	started = micros();
+	for (size_t i = 0; i < kStamps; ++i) {
+		ESPDateCompact5Codec::encode(stamps[i], buffer + i * ESPDateCompact5Codec::kSize);
+	}
+	encodeUs = micros() - started;
+	started = micros();
+	for (size_t i = 0; i < kStamps; ++i) {
+		decoded = ESPDateCompact5Codec::decode(buffer + i * ESPDateCompact5Codec::kSize);
+		ok = ok && decoded.epochSeconds == stamps[i].epochSeconds;
+	}
+	report("compact5", kStamps * ESPDateCompact5Codec::kSize, encodeUs, micros() - started);
+
+	Serial.printf("raw DateTime   %5.2f bytes/stamp\n", static_cast<double>(sizeof(DateTime)));
+	Serial.printf("round trip     %s\n", ok ? "ok" : "MISMATCH");
+}
+
+void loop() {
+}
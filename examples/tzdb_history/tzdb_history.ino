@@ -0,0 +1,108 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+// Generated on the host with:
+//   scripts/generate_tzdb.py --output examples/tzdb_history/tzdb_zones America/New_York
+//       America/Sao_Paulo Europe/London Europe/Budapest Europe/Moscow Asia/Tokyo
+//       Australia/Sydney Pacific/Auckland
+#include "tzdb_zones.h"
+
+ESPDate date;
+
+struct ZonePair {
+	const char *name;  // IANA name, looked up in the generated table
+	const char *posix; // today's rule for the same zone
+};
+
+static const ZonePair kZones[] = {
+    {"America/New_York", "EST5EDT,M3.2.0,M11.1.0"},
+    {"America/Sao_Paulo", "<-03>3"},
+    {"Europe/London", "GMT0BST,M3.5.0/1,M10.5.0"},
+    {"Europe/Budapest", "CET-1CEST,M3.5.0,M10.5.0/3"},
+    {"Europe/Moscow", "MSK-3"},
+    {"Asia/Tokyo", "JST-9"},
+    {"Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+    {"Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3"},
+};
+static constexpr size_t kZoneCount = sizeof(kZones) / sizeof(kZones[0]);
+static constexpr int kRounds = 200;
+
+static ESPDateTimeZone tzdbZones[kZoneCount];
+static ESPDateTimeZone posixZones[kZoneCount];
+
+static void report(const char *name, uint32_t elapsedUs, int32_t checksum) {
+	Serial.printf(
+	    "%-26s %7.2f us/call (checksum %ld)\n",
+	    name,
+	    static_cast<double>(elapsedUs) / (kRounds * kZoneCount),
+	    static_cast<long>(checksum)
+	);
+}
+
+static int32_t convertAll(const ESPDateTimeZone *zones, const DateTime &start, int64_t step) {
+	int32_t checksum = 0;
+	for (int round = 0; round < kRounds; ++round) {
+		const DateTime dt = date.addSeconds(start, round * step);
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			checksum += date.toLocal(dt, zones[z]).hour;
+		}
+	}
+	return checksum;
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+	Serial.printf(
+	    "ESPDate tzdb example (tzdata %s, %u zones)\n",
+	    espDateTzdb.version,
+	    static_cast<unsigned>(espDateTzdb.zoneCount)
+	);
+
+	for (size_t z = 0; z < kZoneCount; ++z) {
+		tzdbZones[z] = ESPDateTimeZone::fromTzdb(espDateTzdb, kZones[z].name);
+		posixZones[z] = ESPDateTimeZone::fromPosix(kZones[z].posix);
+	}
+
+	// A log line from 2012: Moscow was on UTC+4 then, which today's "MSK-3" cannot know.
+	const DateTime logged = date.fromUtc(2012, 6, 1, 12, 0, 0);
+	char text[32];
+	date.toLocal(logged, tzdbZones[4]).localString(text, sizeof(text));
+	Serial.printf("2012-06-01 12:00 UTC in Moscow, tzdb:  %s\n", text);
+	date.toLocal(logged, posixZones[4]).localString(text, sizeof(text));
+	Serial.printf("2012-06-01 12:00 UTC in Moscow, POSIX: %s\n", text);
+
+	uint32_t started = micros();
+	size_t found = 0;
+	for (int round = 0; round < kRounds; ++round) {
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			found += ESPDateTzdbZone::find(espDateTzdb, kZones[z].name).isValid();
+		}
+	}
+	report("perfect-hash find()", micros() - started, static_cast<int32_t>(found));
+
+	// Recent instants resolve through the footer rule, older ones decode the transition table.
+	const DateTime recent = date.fromUtc(2025, 1, 1, 0, 0, 0);
+	const DateTime historic = date.fromUtc(1975, 1, 1, 0, 0, 0);
+	const int64_t step = 91 * 24 * 3600 + 7 * 3600; // kRounds steps span 1975..2025
+
+	started = micros();
+	int32_t checksum = convertAll(posixZones, recent, 7 * 3600);
+	report("POSIX handle", micros() - started, checksum);
+
+	started = micros();
+	checksum = convertAll(tzdbZones, recent, 7 * 3600);
+	report("tzdb handle, recent", micros() - started, checksum);
+
+	started = micros();
+	checksum = convertAll(tzdbZones, historic, step);
+	report("tzdb handle, 1975-2025", micros() - started, checksum);
+
+	started = micros();
+	checksum = convertAll(posixZones, historic, step);
+	report("POSIX handle, 1975-2025", micros() - started, checksum);
+}
+
+void loop() {
+	delay(1000);
+}
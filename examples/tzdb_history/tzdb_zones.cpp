@@ -0,0 +1,159 @@
+// Generated by scripts/generate_tzdb.py from tzdata 2025b; do not edit.
+// 8 zones, history since 1970.
+#include "tzdb_zones.h"
+
+namespace {
+const ESPDateTzdbZoneRecord kZones[] = {
+    {1, 17, 0, 0, 33, 0, 2, 60},         // Europe/Budapest
+    {44, 55, 100, 3, 0, 2, 1, 60},       // Asia/Tokyo
+    {61, 75, 100, 3, 50, 3, 3, 60},      // Europe/London
+    {100, 117, 251, 7, 74, 6, 2, 60},    // Australia/Sydney
+    {146, 160, 473, 12, 63, 8, 5, 60},   // Europe/Moscow
+    {166, 183, 664, 16, 67, 13, 2, 60},  // Pacific/Auckland
+    {211, 229, 866, 21, 68, 15, 2, 60},  // America/Sao_Paulo
+    {236, 253, 1071, 26, 75, 17, 2, 60}, // America/New_York
+};
+
+const uint16_t kBuckets[] = {
+    8, 2, 2,
+};
+
+const char kStrings[] =
+    "\0"
+    "Europe/Budapest\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Asia/Tokyo\0"
+    "JST-9\0"
+    "Europe/London\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "Australia/Sydney\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "Europe/Moscow\0"
+    "MSK-3\0"
+    "Pacific/Auckland\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "America/Sao_Paulo\0"
+    "<-03>3\0"
+    "America/New_York\0"
+    "EST5EDT,M3.2.0,M11.1.0";
+
+const int32_t kTypes[] = {
+    7200, 14401, 64800, 7200, 0, 7201, 72000, 79201,
+    21600, 28801, 21601, 14400, 28800, 86400, 93601, -21600,
+    -14399, -36000, -28799,
+};
+
+const uint8_t kTransitions[] = {
+    0x89, 0xe9, 0x92, 0x05, 0xc0, 0xe1, 0x1e, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f,
+    0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0xf1, 0x80, 0x20, 0xc0, 0x9c, 0x21, 0x81,
+    0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff,
+    0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f,
+    0xc0, 0x9c, 0x21, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81,
+    0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff,
+    0x1f, 0xc1, 0x9c, 0x21, 0xe9, 0x93, 0xb0, 0x01, 0x82, 0xf5, 0x24, 0x81, 0x88, 0x3b, 0x82, 0xf5,
+    0x24, 0x81, 0x88, 0x3b, 0x82, 0xf5, 0x24, 0x81, 0x88, 0x3b, 0x82, 0xf5, 0x24, 0x81, 0x88, 0x3b,
+    0xa2, 0xe1, 0x26, 0xe1, 0x9b, 0x39, 0xa2, 0xe1, 0x26, 0xe1, 0x9b, 0x39, 0xa2, 0xe1, 0x26, 0x81,
+    0x88, 0x3b, 0x82, 0xf5, 0x24, 0x81, 0x88, 0x3b, 0x82, 0xf5, 0x24, 0x81, 0x88, 0x3b, 0x8e, 0xcc,
+    0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37,
+    0xc2, 0xcd, 0x28, 0xe1, 0x9b, 0x39, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1,
+    0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd,
+    0x28, 0xe1, 0x9b, 0x39, 0xa2, 0xe1, 0x26, 0xe1, 0x9b, 0x39, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37,
+    0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1,
+    0xaf, 0x37, 0xc2, 0xcd, 0x28, 0xc1, 0xaf, 0x37, 0xe2, 0xb9, 0x2a, 0xc1, 0xae, 0x75, 0xc0, 0xf5,
+    0x14, 0xc1, 0x88, 0x2b, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29,
+    0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xb0, 0x17, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81,
+    0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93,
+    0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xa6, 0x1c, 0x81, 0xf5, 0x24,
+    0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81,
+    0xeb, 0x29, 0x80, 0xce, 0x18, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0x81, 0xb0, 0x27, 0xc0, 0xeb,
+    0x19, 0x81, 0xb0, 0x27, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29,
+    0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xb0, 0x17, 0x81,
+    0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x89,
+    0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24,
+    0x80, 0x89, 0x1b, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0x81, 0x89, 0x1b, 0x80, 0xf5, 0x24, 0xc1,
+    0x92, 0x26, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89,
+    0x1b, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24,
+    0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0xc0, 0xa6, 0x1c, 0xfd, 0x9b, 0x8d, 0x0e, 0xb4, 0xb3, 0x50,
+    0xed, 0xff, 0x4f, 0xb4, 0xb3, 0x50, 0xed, 0xff, 0x4f, 0xb4, 0xb3, 0x50, 0x8d, 0xb8, 0x50, 0x98,
+    0x82, 0x50, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd,
+    0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f,
+    0xc1, 0xfd, 0x4f, 0xa0, 0x87, 0x53, 0xc2, 0xfd, 0x4f, 0xef, 0xff, 0x4f, 0x80, 0x9c, 0x31, 0x95,
+    0xdf, 0x1e, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd,
+    0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xa1, 0x87, 0x53, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43,
+    0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae, 0x5f, 0xe1,
+    0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xc1, 0xd6, 0x43, 0xc0, 0xa4,
+    0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40,
+    0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xc1,
+    0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae,
+    0x5f, 0xe4, 0xcc, 0x40, 0xf4, 0x9c, 0xbf, 0x04, 0x91, 0xc4, 0xb6, 0x02, 0x80, 0xd8, 0x13, 0xc1,
+    0x88, 0x2b, 0xc0, 0xb0, 0x17, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93,
+    0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29,
+    0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xb0, 0x17, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81,
+    0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93,
+    0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xb0, 0x17, 0x81, 0xeb, 0x29,
+    0x80, 0x93, 0x16, 0xc1, 0x92, 0x26, 0xc0, 0xa6, 0x1c, 0xc1, 0xd7, 0x23, 0xc0, 0xa6, 0x1c, 0xc1,
+    0xd7, 0x23, 0xc0, 0xa6, 0x1c, 0xc1, 0xd7, 0x23, 0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4,
+    0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4, 0x1d, 0xc1, 0xd7, 0x23,
+    0xc0, 0xa6, 0x1c, 0xc1, 0xd7, 0x23, 0xc0, 0xa6, 0x1c, 0xc1, 0xd7, 0x23, 0x80, 0xc4, 0x1d, 0x81,
+    0xba, 0x22, 0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4, 0x1d, 0xc1, 0xd7, 0x23, 0xc0, 0xa6,
+    0x1c, 0xc1, 0xd7, 0x23, 0xc0, 0xa6, 0x1c, 0xc1, 0xd7, 0x23, 0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22,
+    0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4, 0x1d, 0x81, 0xba, 0x22, 0x80, 0xc4, 0x1d, 0x81,
+    0xba, 0x22, 0xe9, 0xde, 0xf8, 0x07, 0xc8, 0xaf, 0x17, 0xf9, 0xb0, 0x27, 0x88, 0xd7, 0x13, 0xb9,
+    0xbd, 0x2c, 0xc8, 0xb9, 0x12, 0xf9, 0xa6, 0x2c, 0xc8, 0xb9, 0x12, 0xb9, 0xc4, 0x2d, 0xc8, 0xf4,
+    0x14, 0xf9, 0xa6, 0x2c, 0xc8, 0xf4, 0x14, 0xb9, 0x89, 0x2b, 0x88, 0xd7, 0x13, 0xb9, 0xc4, 0x2d,
+    0x88, 0x9c, 0x11, 0xb9, 0xc4, 0x2d, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9,
+    0xeb, 0x29, 0xc8, 0xf4, 0x14, 0xf9, 0xeb, 0x29, 0xc8, 0xaf, 0x17, 0xf9, 0xe4, 0x28, 0x88, 0xd4,
+    0x19, 0xf9, 0xb0, 0x27, 0xc8, 0xaf, 0x17, 0xf9, 0xb0, 0x27, 0xc8, 0xea, 0x19, 0xf9, 0xb0, 0x27,
+    0xc8, 0xaf, 0x17, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xb9, 0xc4, 0x2d, 0xc8, 0xb9, 0x12, 0xb9,
+    0x89, 0x2b, 0xc8, 0xf4, 0x14, 0xb9, 0xf1, 0x2d, 0x88, 0xaa, 0x13, 0xf9, 0xeb, 0x29, 0x88, 0x92,
+    0x16, 0xb9, 0xc4, 0x2d, 0x88, 0xd7, 0x13, 0xb9, 0xce, 0x28, 0x88, 0x92, 0x16, 0xb9, 0x89, 0x2b,
+    0xc8, 0xf4, 0x14, 0xb9, 0x89, 0x2b, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9,
+    0xeb, 0x29, 0xc8, 0xaf, 0x17, 0xf9, 0xeb, 0x29, 0xc8, 0xf4, 0x14, 0xb9, 0x89, 0x2b, 0xc8, 0xf4,
+    0x14, 0xb9, 0x89, 0x2b, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29,
+    0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xb9, 0xc4, 0x2d, 0xc8, 0xb9, 0x12, 0x89,
+    0xa2, 0x14, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0xc8, 0x9b, 0x21, 0xf9, 0xff, 0x1f, 0x88, 0xfe,
+    0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xa7, 0x0c, 0x88, 0xd6, 0x33, 0xb9, 0xf6, 0x14,
+    0xc8, 0x87, 0x2b, 0xf9, 0xff, 0x1f, 0xc8, 0x9b, 0x21, 0xb9, 0xe2, 0x1e, 0xc8, 0x9b, 0x21, 0xf9,
+    0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe,
+    0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0xc8, 0x9b, 0x21, 0xb9, 0xe2, 0x1e,
+    0xc8, 0x9b, 0x21, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9,
+    0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4,
+    0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xa7, 0x1c,
+    0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4, 0x24, 0xf9,
+    0x89, 0x1b, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6,
+    0x23, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c,
+    0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9,
+    0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4,
+    0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xb1, 0x17,
+};
+
+const uint32_t kCheckpointTimes[] = {
+    323823600, 575427600, 828234000, 57722400, 309924000, 562122000,
+    814323600, 57686400, 309888000, 562089600, 814896000, 1067097600,
+    354920400, 606870000, 846370800, 1099177200, 152632800, 404834400,
+    655221600, 907423200, 1159624800, 499748400, 750826800, 1003028400,
+    1255834800, 1508036400, 9961200, 262767600, 514969200, 765356400,
+    1018162800,
+};
+
+const uint16_t kCheckpointOffsets[] = {
+    0, 49, 97, 0, 49, 97, 145, 0, 48, 96, 144, 192,
+    0, 49, 97, 145, 0, 49, 97, 145, 193, 0, 49, 97,
+    145, 193, 0, 48, 96, 144, 192,
+};
+
+} // namespace
+
+extern const ESPDateTzdbTable espDateTzdb = {
+    "2025b",
+    0LL,
+    8,
+    3,
+    kZones,
+    kBuckets,
+    kStrings,
+    kTypes,
+    kTransitions,
+    kCheckpointTimes,
+    kCheckpointOffsets,
+};
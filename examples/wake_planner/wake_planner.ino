@@ -0,0 +1,93 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <esp_sleep.h>
+
+ESPDate date;
+ESPDateWakePlanner planner(date);
+ESPDateRecurrence weeklyReport("0 9 * * MON");
+
+// Survive deep sleep; ESPDate itself starts over on every wake.
+RTC_DATA_ATTR int64_t lastWakeUs = 0;
+RTC_DATA_ATTR int64_t lastSyncUs = 0;
+
+static ESPDateWakePlanner::EntryId sampleId;
+static ESPDateWakePlanner::EntryId lightsOnId;
+static ESPDateWakePlanner::EntryId lightsOffId;
+static ESPDateWakePlanner::EntryId reportId;
+
+static bool isDue(uint32_t mask, ESPDateWakePlanner::EntryId id) {
+	return (mask & (1u << (id - 1))) != 0;
+}
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	ESPDateConfig config{};
+	config.latitude = 47.4979f;
+	config.longitude = 19.0402f;
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	config.ntpServer = "pool.ntp.org";
+	date.init(config); // bring WiFi up before this when a re-sync may be due
+
+	sampleId = planner.addPeriodic(2LL * 3600 * 1000000); // every two hours, on the hour
+	lightsOnId = planner.addSunset(-15 * 60);
+	lightsOffId = planner.addSunrise(15 * 60);
+	reportId = planner.addRecurrence(weeklyReport);
+	planner.setNtpResync(12LL * 3600 * 1000000);
+	if (lastSyncUs > 0) {
+		planner.setLastSync(lastSyncUs);
+	}
+	planner.setTolerance(10LL * 60 * 1000000); // anything may run up to 10 minutes late
+	planner.setMaxSleep(24LL * 3600 * 1000000);
+
+	const int64_t nowUs = date.nowUs().epochMicros;
+	const uint32_t due = lastWakeUs > 0 ? planner.dueMask(lastWakeUs, nowUs) : 0;
+	Serial.printf("Woke at %s\n", date.nowLocalString().c_str());
+	if (isDue(due, sampleId)) {
+		Serial.println("  take a sample");
+	}
+	if (isDue(due, lightsOnId)) {
+		Serial.println("  lights on");
+	}
+	if (isDue(due, lightsOffId)) {
+		Serial.println("  lights off");
+	}
+	if (isDue(due, reportId)) {
+		Serial.println("  send the weekly report");
+	}
+	if (lastWakeUs == 0 || isDue(due, ESPDateWakePlanner::kNtpResyncId)) {
+		Serial.println("  re-sync time over WiFi");
+		date.syncNTP();
+		for (int i = 0; i < 100 && !date.hasLastNtpSync(); ++i) {
+			delay(100);
+		}
+		if (date.hasLastNtpSync()) {
+			lastSyncUs = date.lastNtpSync().epochSeconds * 1000000LL;
+		} else {
+			// No network: try again in an hour rather than right away.
+			lastSyncUs = nowUs - 11LL * 3600 * 1000000;
+			planner.setLastSync(lastSyncUs);
+		}
+	}
+	lastWakeUs = nowUs;
+
+	const ESPDateWakePlan plan = planner.plan(); // the sync may have stepped the clock
+	if (!plan.ok) {
+		return;
+	}
+	char wakeText[32];
+	date.formatLocal(
+	    DateTime{plan.wakeEpochUs / 1000000},
+	    ESPDateFormat::DateTime,
+	    wakeText,
+	    sizeof(wakeText)
+	);
+	Serial.printf("Sleeping %.3f s, until %s\n", plan.sleepUs / 1e6, wakeText);
+	Serial.flush();
+	esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(plan.sleepUs));
+	esp_deep_sleep_start();
+}
+
+void loop() {
+}
@@ -0,0 +1,316 @@
+// Generated by scripts/generate_zone_grid.py from zone_outlines.geojson; do not edit.
+// 16 zones, depth 7, 741 nodes.
+#include "europe_zones.h"
+
+namespace {
+const uint16_t kNodes[] = {
+    0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c,
+    0x000d, 0x000e, 0xffff, 0xffff, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016,
+    0xffff, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+    0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0xffff, 0xffff,
+    0xffff, 0x0038, 0x0039, 0x003a, 0x003b, 0x800c, 0x800c, 0x800c, 0x003c, 0x003d, 0x003e, 0x003f,
+    0x0040, 0x800c, 0x0041, 0x0042, 0xffff, 0x0043, 0x0044, 0x0045, 0x0046, 0xffff, 0x0047, 0x0048,
+    0x0049, 0x004a, 0x004b, 0x004c, 0x800b, 0x004d, 0x004e, 0x004f, 0xffff, 0xffff, 0xffff, 0x0050,
+    0xffff, 0xffff, 0x0051, 0x0052, 0xffff, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0xffff, 0x0058,
+    0x0059, 0x800d, 0x005a, 0x800d, 0xffff, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061,
+    0x800d, 0x0062, 0x0063, 0x0064, 0x0065, 0xffff, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x8003, 0x006e, 0xffff, 0xffff, 0xffff, 0x006f, 0xffff, 0xffff, 0x0070, 0x0071,
+    0x0072, 0x0073, 0xffff, 0x0074, 0x0075, 0x8007, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b,
+    0xffff, 0xffff, 0x007c, 0x007d, 0x8007, 0x8007, 0x007e, 0x007f, 0x8007, 0x0080, 0x0081, 0x0082,
+    0xffff, 0xffff, 0x0083, 0x0084, 0xffff, 0x0085, 0x0086, 0x0087, 0xffff, 0x0088, 0xffff, 0x0089,
+    0x8008, 0x8008, 0x008a, 0x008b, 0xffff, 0xffff, 0x008c, 0x008d, 0x008e, 0x800c, 0x008f, 0x800c,
+    0x8008, 0x0090, 0x0091, 0x0092, 0x0093, 0x800c, 0x800c, 0x800c, 0x0094, 0x0095, 0xffff, 0x0096,
+    0x0097, 0x0098, 0x0099, 0xffff, 0xffff, 0x009a, 0xffff, 0xffff, 0x009b, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x009c, 0xffff, 0xffff, 0x009d, 0x009e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x009f,
+    0xffff, 0x00a0, 0xffff, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x800c, 0x800c, 0x800c,
+    0xffff, 0x00a7, 0xffff, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0xffff, 0x00ad, 0xffff, 0xffff,
+    0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x800c, 0x800c, 0x800c, 0x00b3, 0x00b4, 0xffff, 0xffff,
+    0x00b5, 0x00b6, 0xffff, 0xffff, 0x00b7, 0x8000, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x8009,
+    0x00bd, 0x800b, 0x00be, 0x800b, 0x8000, 0x00bf, 0x00c0, 0xffff, 0x00c1, 0x00c2, 0x800b, 0x00c3,
+    0xffff, 0xffff, 0x00c4, 0xffff, 0xffff, 0x8009, 0xffff, 0x8009, 0x00c5, 0x800b, 0x00c6, 0x800b,
+    0xffff, 0x00c7, 0xffff, 0x00c8, 0x00c9, 0x800b, 0x800b, 0x800b, 0x00ca, 0xffff, 0x00cb, 0xffff,
+    0x800b, 0x800b, 0x800b, 0x00cc, 0x800b, 0x00cd, 0x00ce, 0x00cf, 0xffff, 0xffff, 0xffff, 0x00d0,
+    0xffff, 0xffff, 0x00d1, 0x00d2, 0xffff, 0xffff, 0x00d3, 0xffff, 0xffff, 0x00d4, 0x00d5, 0x00d6,
+    0x00d7, 0x00d8, 0x00d9, 0x800e, 0x00da, 0x00db, 0x00dc, 0xffff, 0xffff, 0x00dd, 0xffff, 0xffff,
+    0x00de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00df, 0xffff, 0x00e0, 0xffff, 0x00e1,
+    0xffff, 0x00e2, 0x00e3, 0x800d, 0xffff, 0x00e4, 0xffff, 0x00e5, 0xffff, 0x00e6, 0x00e7, 0x8005,
+    0xffff, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x800d, 0x800d, 0x00ef, 0x00f0,
+    0x00f1, 0x00f2, 0x800a, 0x800a, 0x00f3, 0x00f4, 0x800a, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x800e,
+    0x800d, 0x00f9, 0x800d, 0x800d, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x800e, 0x0100,
+    0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x800f, 0x0107, 0x800d, 0x800d, 0x0108, 0x0109,
+    0x010a, 0x8003, 0x8003, 0x8003, 0xffff, 0x010b, 0xffff, 0xffff, 0x8003, 0x8003, 0x010c, 0x8003,
+    0x8003, 0x010d, 0x8003, 0x010e, 0x010f, 0x0110, 0xffff, 0xffff, 0x0111, 0xffff, 0x0112, 0xffff,
+    0x0113, 0x0114, 0x0115, 0x0116, 0xffff, 0xffff, 0xffff, 0x0117, 0x0118, 0x8007, 0x8007, 0x8007,
+    0x0119, 0x011a, 0x011b, 0x011c, 0x8002, 0x011d, 0x011e, 0x011f, 0xffff, 0x0120, 0xffff, 0xffff,
+    0xffff, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0xffff, 0xffff, 0x0126, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0127, 0xffff, 0xffff, 0xffff, 0x0128, 0xffff, 0x8007, 0x0129, 0x8007, 0x8007,
+    0x012a, 0x012b, 0x8007, 0x8007, 0x012c, 0x012d, 0x8007, 0x8007, 0x012e, 0x012f, 0x8007, 0x0130,
+    0x0131, 0x0132, 0xffff, 0xffff, 0x0133, 0x0134, 0xffff, 0xffff, 0x8007, 0x0135, 0x8007, 0x0136,
+    0xffff, 0x0137, 0xffff, 0x0138, 0x0139, 0xffff, 0x013a, 0x013b, 0x8004, 0x013c, 0x013d, 0x013e,
+    0x013f, 0xffff, 0x0140, 0x0141, 0xffff, 0xffff, 0xffff, 0x0142, 0xffff, 0xffff, 0x0143, 0x0144,
+    0xffff, 0x0145, 0x0146, 0x0147, 0xffff, 0x0148, 0xffff, 0x0149, 0xffff, 0x014a, 0xffff, 0xffff,
+    0x8008, 0x014b, 0xffff, 0xffff, 0x014c, 0x014d, 0xffff, 0xffff, 0x014e, 0x014f, 0x8008, 0x8008,
+    0x0150, 0x0151, 0x8008, 0x8008, 0x0152, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x0153, 0x800c,
+    0x8008, 0x8008, 0x8008, 0x0154, 0x8008, 0x8008, 0x0155, 0x0156, 0x0157, 0x800c, 0x800c, 0x800c,
+    0x8008, 0x0158, 0x0159, 0x015a, 0x015b, 0x8005, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160, 0x0161,
+    0xffff, 0x800a, 0x0162, 0x800a, 0x0163, 0x800a, 0x800a, 0x0164, 0x0165, 0xffff, 0xffff, 0xffff,
+    0x800a, 0x0166, 0x800a, 0x0167, 0xffff, 0x0168, 0xffff, 0xffff, 0x0169, 0xffff, 0xffff, 0xffff,
+    0x016a, 0x016b, 0xffff, 0x016c, 0x016d, 0x016e, 0x016f, 0xffff, 0x0170, 0xffff, 0xffff, 0xffff,
+    0x0171, 0x0172, 0x0173, 0x800c, 0xffff, 0xffff, 0xffff, 0x0174, 0x0175, 0x8006, 0x0176, 0x8006,
+    0xffff, 0xffff, 0x0177, 0xffff, 0x0178, 0x800c, 0x0179, 0x800c, 0x8006, 0x017a, 0x8006, 0x8006,
+    0x017b, 0x800c, 0x8006, 0x017c, 0x017d, 0x800c, 0x017e, 0x800c, 0x017f, 0x8006, 0xffff, 0x0180,
+    0xffff, 0xffff, 0xffff, 0x0181, 0x8006, 0x8006, 0x0182, 0x8006, 0x8006, 0x0183, 0x8006, 0x0184,
+    0x0185, 0x8006, 0x8006, 0x8006, 0x8006, 0x0186, 0x8006, 0x0187, 0xffff, 0x0188, 0x0189, 0x018a,
+    0x8006, 0x8006, 0x018b, 0x018c, 0x8006, 0x018d, 0x018e, 0x800c, 0xffff, 0x018f, 0xffff, 0xffff,
+    0x0190, 0x0191, 0xffff, 0xffff, 0x0192, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x0193,
+    0x800c, 0x0194, 0x0195, 0xffff, 0x0196, 0x0197, 0xffff, 0xffff, 0x0198, 0x800c, 0xffff, 0xffff,
+    0x0199, 0x8000, 0xffff, 0x019a, 0xffff, 0x019b, 0xffff, 0x019c, 0x8000, 0x019d, 0x019e, 0x019f,
+    0xffff, 0xffff, 0xffff, 0x01a0, 0xffff, 0xffff, 0x8009, 0x01a1, 0xffff, 0x01a2, 0xffff, 0x01a3,
+    0x01a4, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0x01a5, 0x800b, 0x01a6, 0xffff, 0x01a7, 0xffff,
+    0x01a8, 0xffff, 0xffff, 0xffff, 0x800b, 0x01a9, 0x800b, 0x800b, 0x01aa, 0xffff, 0x800b, 0xffff,
+    0x800b, 0x01ab, 0x800b, 0x800b, 0xffff, 0xffff, 0x01ac, 0xffff, 0x01ad, 0x800b, 0x800b, 0x800b,
+    0x01ae, 0x800b, 0x8009, 0x800b, 0x01af, 0x8009, 0x01b0, 0x01b1, 0x01b2, 0x800b, 0x01b3, 0x800b,
+    0x8009, 0x01b4, 0x01b5, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x01b6, 0x800b, 0x01b7,
+    0x800b, 0x800b, 0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x800b, 0x800b, 0x01bc, 0x01bd, 0x800d, 0x800d,
+    0x01be, 0x01bf, 0x800d, 0x800d, 0x01c0, 0xffff, 0x01c1, 0x01c2, 0x01c3, 0xffff, 0x800d, 0x01c4,
+    0xffff, 0xffff, 0x01c5, 0x01c6, 0xffff, 0xffff, 0x01c7, 0xffff, 0x01c8, 0x01c9, 0x01ca, 0x800e,
+    0xffff, 0x01cb, 0x01cc, 0x800e, 0x01cd, 0x800e, 0x800e, 0x800e, 0xffff, 0xffff, 0xffff, 0x01ce,
+    0xffff, 0x01cf, 0x01d0, 0x800e, 0xffff, 0x800e, 0x01d1, 0x800e, 0x800e, 0x800e, 0x800e, 0x01d2,
+    0x01d3, 0x01d4, 0xffff, 0xffff, 0x800e, 0xffff, 0x01d5, 0xffff, 0xffff, 0x01d6, 0xffff, 0xffff,
+    0x01d7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x01d8, 0x01d9, 0x800d, 0xffff, 0x800d,
+    0xffff, 0x800d, 0xffff, 0x800d, 0xffff, 0x800d, 0x01da, 0x800d, 0xffff, 0x01db, 0x800d, 0x800d,
+    0xffff, 0x01dc, 0xffff, 0xffff, 0xffff, 0xffff, 0x01dd, 0x01de, 0xffff, 0xffff, 0x01df, 0xffff,
+    0xffff, 0x8005, 0xffff, 0x01e0, 0xffff, 0x01e1, 0xffff, 0x01e2, 0x01e3, 0x01e4, 0x8005, 0x01e5,
+    0xffff, 0x01e6, 0xffff, 0x01e7, 0x01e8, 0x01e9, 0xffff, 0xffff, 0x01ea, 0x800d, 0x01eb, 0x800d,
+    0xffff, 0xffff, 0x01ec, 0xffff, 0xffff, 0x01ed, 0xffff, 0xffff, 0x01ee, 0x800d, 0xffff, 0xffff,
+    0x800d, 0x800d, 0x01ef, 0x800d, 0x800a, 0x800a, 0x01f0, 0x800a, 0x01f1, 0x01f2, 0x800a, 0x800a,
+    0x01f3, 0xffff, 0x800a, 0x800a, 0x01f4, 0x01f5, 0x01f6, 0xffff, 0x01f7, 0xffff, 0x01f8, 0xffff,
+    0x800d, 0x01f9, 0x01fa, 0x800e, 0xffff, 0xffff, 0x01fb, 0x800e, 0x800e, 0x800e, 0x01fc, 0x800e,
+    0x800d, 0x01fd, 0x800d, 0x01fe, 0xffff, 0x01ff, 0xffff, 0xffff, 0x0200, 0x800e, 0xffff, 0x0201,
+    0x0202, 0xffff, 0x800d, 0x0203, 0xffff, 0x0204, 0x8003, 0x8003, 0x0205, 0x800e, 0x800e, 0x800e,
+    0x800e, 0x0206, 0x800e, 0xffff, 0x0207, 0xffff, 0x800e, 0x0208, 0x800e, 0x800e, 0x0209, 0x020a,
+    0x800e, 0x800e, 0x800e, 0x020b, 0x800f, 0x800f, 0x8003, 0x8003, 0x800f, 0x800f, 0x8003, 0x020c,
+    0xffff, 0xffff, 0x800f, 0x800f, 0xffff, 0x020d, 0x020e, 0x020f, 0x800f, 0x0210, 0x800f, 0x800f,
+    0x800d, 0x800d, 0x800d, 0x0211, 0x0212, 0x0213, 0xffff, 0x0214, 0x800d, 0x0215, 0x800d, 0x0216,
+    0xffff, 0x0217, 0xffff, 0x0218, 0x0219, 0x8003, 0x021a, 0x8003, 0x8003, 0x8003, 0x8003, 0x021b,
+    0x8003, 0xffff, 0x021c, 0x021d, 0x021e, 0x800f, 0xffff, 0x021f, 0x800f, 0x0220, 0xffff, 0xffff,
+    0x8003, 0x0221, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff, 0x0222, 0xffff, 0x8002,
+    0x0223, 0xffff, 0x0224, 0xffff, 0x0225, 0x8002, 0x0226, 0x0227, 0x8002, 0x0228, 0x8002, 0x0229,
+    0xffff, 0x022a, 0xffff, 0x022b, 0x022c, 0x022d, 0x8007, 0x8007, 0xffff, 0xffff, 0x022e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x022f, 0x800e, 0x0230, 0x0231, 0xffff, 0xffff, 0x0232, 0xffff, 0xffff,
+    0x8002, 0xffff, 0x0233, 0xffff, 0x8002, 0x8002, 0x0234, 0x8002, 0x0235, 0xffff, 0x8002, 0x8002,
+    0x0236, 0x0237, 0xffff, 0xffff, 0xffff, 0x8007, 0x0238, 0x8007, 0xffff, 0xffff, 0x0239, 0x023a,
+    0x023b, 0x8007, 0x023c, 0x8007, 0x023d, 0x8002, 0xffff, 0xffff, 0x023e, 0x8007, 0xffff, 0x023f,
+    0x8007, 0x0240, 0x0241, 0xffff, 0xffff, 0xffff, 0x0242, 0x0243, 0xffff, 0xffff, 0xffff, 0x0244,
+    0x8007, 0x0245, 0x8007, 0x8007, 0x0246, 0x8007, 0x8007, 0x8007, 0x0247, 0x0248, 0x8007, 0x8007,
+    0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x0249,
+    0xffff, 0xffff, 0x024a, 0x024b, 0x8007, 0x024c, 0x8007, 0x8001, 0x024d, 0x024e, 0xffff, 0xffff,
+    0x8007, 0x8007, 0x024f, 0x0250, 0x8007, 0x0251, 0x0252, 0xffff, 0x0253, 0xffff, 0xffff, 0xffff,
+    0x8007, 0x0254, 0x8007, 0x0255, 0x8007, 0x0256, 0x0257, 0xffff, 0xffff, 0x0258, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x0259, 0x025a, 0x025b, 0x025c, 0xffff, 0xffff, 0xffff, 0x025d, 0x800c, 0x800c,
+    0x025e, 0x800c, 0x800c, 0x800c, 0x8004, 0x025f, 0x8004, 0x8004, 0x8004, 0x8004, 0xffff, 0xffff,
+    0x8004, 0x8004, 0x0260, 0x8004, 0x0261, 0xffff, 0x8004, 0x0262, 0x8004, 0x0263, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x0264, 0x0265, 0xffff, 0xffff, 0x0266, 0xffff, 0xffff, 0xffff, 0x8008, 0x0267,
+    0xffff, 0xffff, 0x0268, 0xffff, 0x0269, 0x026a, 0x026b, 0x8008, 0xffff, 0xffff, 0xffff, 0x026c,
+    0x026d, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x026e, 0x8008, 0xffff, 0x026f, 0xffff, 0x0270,
+    0xffff, 0x0271, 0xffff, 0x0272, 0x8008, 0x8008, 0x8008, 0x0273, 0x8008, 0x8008, 0x0274, 0x0275,
+    0x8008, 0x8008, 0x0276, 0x0277, 0xffff, 0xffff, 0x8008, 0x8008, 0x0278, 0x0279, 0x8008, 0x8008,
+    0x027a, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x027b, 0x027c, 0xffff, 0x027d, 0x027e, 0x800c,
+    0x027f, 0x800c, 0x8008, 0x8008, 0x8008, 0x8008, 0x0280, 0x0281, 0xffff, 0x0282, 0xffff, 0x0283,
+    0x8008, 0x0284, 0x800c, 0x800c, 0x8008, 0x0285, 0x0286, 0x800c, 0x800c, 0x800c, 0x0287, 0x800c,
+    0x8008, 0x0288, 0x800c, 0x800c, 0x0289, 0x800c, 0x800c, 0x800c, 0xffff, 0x028a, 0xffff, 0x028b,
+    0xffff, 0x028c, 0xffff, 0xffff, 0x028d, 0x028e, 0xffff, 0x028f, 0x8005, 0x8005, 0x8005, 0x0290,
+    0xffff, 0x0291, 0xffff, 0xffff, 0x800a, 0x800a, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x800a,
+    0xffff, 0x0297, 0xffff, 0x0298, 0x0299, 0x800a, 0xffff, 0x800a, 0x800a, 0x029a, 0x029b, 0xffff,
+    0x800a, 0x029c, 0x029d, 0xffff, 0x029e, 0xffff, 0x029f, 0xffff, 0x02a0, 0xffff, 0x02a1, 0xffff,
+    0x02a2, 0x800a, 0x02a3, 0x02a4, 0x800a, 0x02a5, 0x02a6, 0x02a7, 0x02a8, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0x02a9, 0x8003, 0x02aa, 0x8003, 0xffff, 0xffff, 0x8003, 0x8003, 0x8003, 0x02ab,
+    0x8003, 0x8003, 0x02ac, 0x02ad, 0x02ae, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0x02af, 0xffff,
+    0xffff, 0xffff, 0x02b0, 0x800c, 0x02b1, 0x02b2, 0x800c, 0x800c, 0x02b3, 0x800c, 0x02b4, 0x800c,
+    0xffff, 0xffff, 0x02b5, 0x02b6, 0xffff, 0x02b7, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006,
+    0xffff, 0xffff, 0x02b8, 0xffff, 0x02b9, 0x800c, 0x02ba, 0x800c, 0x02bb, 0x800c, 0x02bc, 0x800c,
+    0x8006, 0x02bd, 0x8006, 0x8006, 0x02be, 0x800c, 0x8006, 0x02bf, 0x02c0, 0x800c, 0x8006, 0x02c1,
+    0xffff, 0xffff, 0xffff, 0x02c2, 0x02c3, 0x800c, 0x02c4, 0x800c, 0xffff, 0x8006, 0xffff, 0x8006,
+    0x02c5, 0x8006, 0xffff, 0x02c6, 0xffff, 0xffff, 0xffff, 0x02c7, 0x8006, 0x8006, 0x02c8, 0x8006,
+    0x8006, 0x8006, 0x8006, 0x02c9, 0x02ca, 0x800c, 0x02cb, 0x800c, 0xffff, 0x8006, 0x02cc, 0x8006,
+    0x02cd, 0x800c, 0x8006, 0x800c, 0x02ce, 0x800c, 0x800c, 0x800c, 0xffff, 0x02cf, 0x02d0, 0x02d1,
+    0xffff, 0x02d2, 0x02d3, 0xffff, 0x8006, 0x8006, 0xffff, 0xffff, 0x8006, 0x8006, 0xffff, 0xffff,
+    0x8006, 0x8006, 0x02d4, 0x8006, 0x02d5, 0x800c, 0x02d6, 0x800c, 0x8006, 0x02d7, 0x8006, 0x02d8,
+    0xffff, 0x02d9, 0xffff, 0xffff, 0x02da, 0xffff, 0xffff, 0xffff, 0xffff, 0x02db, 0xffff, 0xffff,
+    0x02dc, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x02dd, 0x02de, 0x800c, 0x800c, 0x800c, 0x02df,
+    0x800c, 0x02e0, 0xffff, 0xffff, 0x800c, 0x800c, 0x02e1, 0xffff, 0x02e2, 0x02e3, 0xffff, 0xffff,
+    0x800c, 0x800c, 0xffff, 0x02e4, 0xffff, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0xffff, 0xffff, 0x800b, 0x8000, 0x8000, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0xffff, 0x800b, 0xffff, 0xffff, 0x8009, 0xffff, 0x8009,
+    0xffff, 0xffff, 0x8009, 0x8009, 0xffff, 0x8009, 0xffff, 0x8009, 0xffff, 0x8009, 0xffff, 0x8009,
+    0xffff, 0xffff, 0xffff, 0x800b, 0x800b, 0x800b, 0x8009, 0x800b, 0x8000, 0x8000, 0x8000, 0xffff,
+    0x8000, 0xffff, 0xffff, 0xffff, 0x8000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800b, 0x800b,
+    0xffff, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff,
+    0x8009, 0x800b, 0x8009, 0x800b, 0x8009, 0x800b, 0x8009, 0x800b, 0xffff, 0x8009, 0xffff, 0x8009,
+    0xffff, 0x8009, 0xffff, 0xffff, 0x8009, 0x8009, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b,
+    0x800b, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b, 0x8009, 0x800b, 0x8009, 0x800b, 0x800b, 0x800b,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0x800d,
+    0x800b, 0x800d, 0x800d, 0x800d, 0x800b, 0xffff, 0x800b, 0x800b, 0xffff, 0xffff, 0x800b, 0xffff,
+    0x800b, 0x800b, 0x800b, 0x800d, 0x800b, 0x800b, 0x800d, 0x800d, 0x800b, 0x800b, 0x800d, 0x800d,
+    0x800b, 0x800d, 0x800d, 0x800d, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0xffff, 0x800e, 0xffff, 0x800d, 0xffff, 0x800d, 0xffff, 0xffff, 0xffff, 0x800d, 0xffff,
+    0xffff, 0xffff, 0x800d, 0x800d, 0xffff, 0xffff, 0x800d, 0x800d, 0xffff, 0xffff, 0x800d, 0xffff,
+    0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e,
+    0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e, 0xffff,
+    0x800e, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0xffff,
+    0x800b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800d, 0xffff, 0x800d, 0xffff, 0x800d,
+    0xffff, 0x800d, 0x800d, 0x800d, 0xffff, 0xffff, 0x800d, 0x800d, 0x800d, 0x800d, 0xffff, 0xffff,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x8005, 0x8005,
+    0xffff, 0x8005, 0xffff, 0x8005, 0x800a, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a,
+    0x8005, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff,
+    0x800a, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x800d, 0x800d, 0xffff, 0xffff,
+    0x800d, 0x800d, 0xffff, 0xffff, 0x800d, 0x800d, 0xffff, 0x800d, 0xffff, 0x800d, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x800a, 0xffff, 0x800d, 0x800d, 0xffff, 0xffff, 0x800d, 0x800d, 0xffff, 0x800d,
+    0xffff, 0x800d, 0xffff, 0x800d, 0xffff, 0xffff, 0x800a, 0x800a, 0x800a, 0xffff, 0x800a, 0x800a,
+    0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0x800d, 0xffff, 0xffff,
+    0x800d, 0x800d, 0xffff, 0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff,
+    0x800a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0x800d, 0x800e, 0x800d, 0x800e,
+    0xffff, 0xffff, 0x800e, 0x800e, 0x800d, 0x800e, 0x800d, 0x800e, 0x800d, 0x800d, 0x800d, 0xffff,
+    0x800d, 0xffff, 0x800d, 0x800d, 0x800e, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0xffff, 0x800e, 0xffff, 0xffff, 0x800d, 0xffff, 0x800d, 0x800d, 0x800d, 0x8003, 0x800d, 0x8003,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800e, 0x800e, 0x800e, 0x800e, 0xffff, 0xffff, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0x800e, 0x800e, 0x800f, 0x800f,
+    0x800e, 0x800e, 0x800f, 0x800e, 0x800e, 0x800e, 0x800f, 0x800f, 0x8003, 0x800f, 0x8003, 0x800f,
+    0xffff, 0xffff, 0xffff, 0x8004, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0x8004, 0x8004, 0x8004,
+    0x800f, 0x8004, 0x800f, 0x8004, 0x800d, 0xffff, 0xffff, 0xffff, 0x800d, 0x800d, 0x800d, 0xffff,
+    0x800d, 0xffff, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x800d, 0x8003, 0x800d, 0x800d,
+    0x800d, 0x800d, 0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003, 0x8003, 0xffff,
+    0x8003, 0xffff, 0x8003, 0x8003, 0xffff, 0xffff, 0x8003, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff,
+    0xffff, 0x800f, 0xffff, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002,
+    0xffff, 0x8002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0x8002,
+    0xffff, 0x8002, 0x8002, 0x8002, 0x8002, 0xffff, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0x8007,
+    0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0x8007, 0x8007, 0x8007,
+    0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x8002, 0xffff, 0x8002, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0xffff, 0xffff, 0xffff, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0x8002, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0x8002, 0x8002,
+    0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0x8002, 0x8007,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8007, 0x8002, 0x8002, 0x8007, 0x8007, 0xffff, 0xffff,
+    0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8007,
+    0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007,
+    0xffff, 0x8007, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007,
+    0x8007, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8001,
+    0x8007, 0x8001, 0x8007, 0x8001, 0xffff, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0x8007,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0x8001, 0x8007, 0x8001,
+    0x8007, 0x8001, 0x8007, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800c, 0xffff, 0xffff, 0x800c, 0x800c,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800c,
+    0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0x8004, 0x8004, 0x8004, 0x8004, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004,
+    0x8004, 0xffff, 0x8004, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0xffff, 0x8008,
+    0x8008, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0x8008,
+    0xffff, 0x8008, 0x8008, 0x8008, 0xffff, 0x8008, 0xffff, 0x8008, 0x8008, 0x8008, 0xffff, 0x8008,
+    0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8008, 0xffff, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0x8008, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0xffff, 0xffff, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0xffff, 0x8008, 0x8008,
+    0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0x8008, 0x8008,
+    0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0x800c, 0x800c, 0x800c,
+    0x8008, 0x800c, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x800c, 0x8008, 0x800c, 0x800c, 0x800c,
+    0x8008, 0x8008, 0xffff, 0x8008, 0xffff, 0x800c, 0xffff, 0x800c, 0x8008, 0x8008, 0x8008, 0x800c,
+    0x8008, 0x8008, 0x800c, 0x800c, 0x8008, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x8008, 0x800c,
+    0x8008, 0x8008, 0x800c, 0x800c, 0x8008, 0x800c, 0x800c, 0x800c, 0xffff, 0x8005, 0xffff, 0x8005,
+    0xffff, 0x8005, 0x8005, 0x8005, 0xffff, 0x8005, 0xffff, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff,
+    0x8005, 0x800a, 0x8005, 0x800a, 0x8005, 0x8005, 0xffff, 0x8005, 0x8005, 0xffff, 0x800a, 0xffff,
+    0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a, 0x800a, 0xffff,
+    0xffff, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a, 0xffff, 0xffff,
+    0x800a, 0x800a, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff,
+    0x800a, 0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff,
+    0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0x800a, 0xffff,
+    0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0xffff, 0x8003, 0x8003, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff, 0x800c,
+    0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c,
+    0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0x8006, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006,
+    0xffff, 0xffff, 0x8006, 0x8006, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c,
+    0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0xffff, 0x8006, 0x8006,
+    0xffff, 0x800c, 0x8006, 0x800c, 0x800c, 0x800c, 0x8006, 0x8006, 0x8006, 0x800c, 0x8006, 0x8006,
+    0x800c, 0x800c, 0x8006, 0x800c, 0xffff, 0x800c, 0x800c, 0x800c, 0xffff, 0xffff, 0xffff, 0x800c,
+    0xffff, 0x800c, 0x800c, 0x800c, 0x8006, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff,
+    0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0x800c,
+    0x8006, 0x8006, 0x8006, 0x800c, 0x8006, 0x800c, 0x8006, 0x800c, 0xffff, 0x8006, 0x8006, 0x8006,
+    0x8006, 0x800c, 0x8006, 0x8006, 0x8006, 0x800c, 0x800c, 0x800c, 0xffff, 0x8006, 0xffff, 0x8006,
+    0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x800c, 0x8006, 0x800c,
+    0x8006, 0x800c, 0x800c, 0x800c, 0x8006, 0x800c, 0x8006, 0x800c, 0x8006, 0x800c, 0x8006, 0x800c,
+    0x8006, 0x8006, 0xffff, 0xffff, 0x8006, 0x8006, 0xffff, 0xffff, 0xffff, 0x800c, 0xffff, 0xffff,
+    0x800c, 0x800c, 0x8006, 0x800c, 0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff,
+    0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff,
+    0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff,
+};
+
+const uint32_t kZones[] = {
+    1, 19,    // Africa/Casablanca
+    27, 39,   // Asia/Tehran
+    52, 66,   // Europe/Athens
+    95, 109,  // Europe/Berlin
+    136, 109, // Europe/Budapest
+    152, 166, // Europe/Dublin
+    193, 66,  // Europe/Helsinki
+    209, 225, // Europe/Istanbul
+    233, 66,  // Europe/Kyiv
+    245, 259, // Europe/Lisbon
+    285, 299, // Europe/London
+    324, 109, // Europe/Madrid
+    338, 352, // Europe/Moscow
+    358, 109, // Europe/Paris
+    371, 109, // Europe/Rome
+    383, 109, // Europe/Vienna
+};
+
+const char kStrings[] =
+    "\0"
+    "Africa/Casablanca\0"
+    "<+01>-1\0"
+    "Asia/Tehran\0"
+    "<+0330>-3:30\0"
+    "Europe/Athens\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "Europe/Berlin\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Europe/Budapest\0"
+    "Europe/Dublin\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "Europe/Helsinki\0"
+    "Europe/Istanbul\0"
+    "<+03>-3\0"
+    "Europe/Kyiv\0"
+    "Europe/Lisbon\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "Europe/London\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "Europe/Madrid\0"
+    "Europe/Moscow\0"
+    "MSK-3\0"
+    "Europe/Paris\0"
+    "Europe/Rome\0"
+    "Europe/Vienna";
+
+} // namespace
+
+extern const ESPDateZoneGridTable espDateZoneGrid = {
+    34.0f,
+    -11.0f,
+    72.0f,
+    45.0f,
+    7,
+    0x0000,
+    16,
+    kNodes,
+    kZones,
+    kStrings,
+};
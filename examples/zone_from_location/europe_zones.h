@@ -0,0 +1,7 @@
+// Generated by scripts/generate_zone_grid.py from zone_outlines.geojson; do not edit.
+// 16 zones, depth 7, 741 nodes.
+#pragma once
+
+#include <ESPDate.h>
+
+extern const ESPDateZoneGridTable espDateZoneGrid;
@@ -0,0 +1,69 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+
+// Generated on the host with:
+//   scripts/generate_zone_grid.py --geojson scripts/zone_outlines.geojson
+//       --bbox 34,-11,72,45 --depth 7 --output examples/zone_from_location/europe_zones
+// The bundled outlines cover only a few zones; feed it timezone-boundary-builder polygons for
+// a table that covers every country.
+#include "europe_zones.h"
+
+ESPDate date;
+
+struct Place {
+	const char *label;
+	float latitude;
+	float longitude;
+};
+
+static const Place kPlaces[] = {
+    {"Budapest", 47.4979f, 19.0402f},
+    {"Lisbon", 38.7223f, -9.1393f},
+    {"Dublin", 53.3498f, -6.2603f},
+    {"Helsinki", 60.1699f, 24.9384f},
+    {"Moscow", 55.7558f, 37.6173f},
+    {"Bay of Biscay", 45.0f, -5.0f},
+    {"New York (outside)", 40.7128f, -74.0060f},
+};
+
+void setup() {
+	Serial.begin(115200);
+	delay(200);
+
+	const ESPDateZoneGrid grid(espDateZoneGrid);
+	for (const Place &place : kPlaces) {
+		const ESPDateZoneMatch match = grid.lookup(place.latitude, place.longitude);
+		Serial.printf(
+		    "%-20s %-18s %s\n",
+		    place.label,
+		    match.ok ? match.name : "-",
+		    match.ok ? match.posix : ""
+		);
+	}
+
+	// No timeZone: init() takes the rule at the configured location.
+	ESPDateConfig config{};
+	config.latitude = 47.4979f;
+	config.longitude = 19.0402f;
+	config.zoneGrid = &espDateZoneGrid;
+	date.init(config);
+	char text[32];
+	date.toLocal(date.fromUtc(2025, 7, 1, 10, 0, 0)).localString(text, sizeof(text));
+	Serial.printf("2025-07-01 10:00 UTC at the configured location: %s\n", text);
+
+	const uint32_t started = micros();
+	uint32_t found = 0;
+	for (int i = 0; i < 1000; ++i) {
+		found += grid.lookup(35.0f + (i % 37), -10.0f + (i % 55)).ok;
+	}
+	const uint32_t elapsedUs = micros() - started;
+	Serial.printf(
+	    "lookup: %.3f us/call (%lu hits)\n",
+	    elapsedUs / 1000.0,
+	    static_cast<unsigned long>(found)
+	);
+}
+
+void loop() {
+	delay(1000);
+}
@@ -0,0 +1,148 @@
+// Host benchmark for ESPDateLogRewriter. Generates a sorted UTC log of the requested size, then
+// rewrites it to local time in both stamp styles and, on a prefix, line by line through
+// parseIso8601UtcUs + localString for comparison. Run it through bench_log_rewriter.sh.
+#include <ESPDate.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr const char *kZone = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+constexpr size_t kBaselineLines = 1000000;
+
+double secondsSince(std::chrono::steady_clock::time_point started) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+}
+
+// One line every 250 ms starting 2025-03-29, so the log crosses the spring DST change.
+bool generate(const char *path, uint64_t bytes, uint64_t &lines) {
+	FILE *out = fopen(path, "wb");
+	if (!out) {
+		return false;
+	}
+	static const char *const kMessages[] = {
+	    "I sensor=outdoor temp=21.5 rh=40.2 pressure=1013.2",
+	    "W wifi rssi=-71 channel=6 retries=2",
+	    "I mqtt publish topic=site/boiler/state bytes=182",
+	    "E modbus timeout slave=3 register=40021",
+	};
+	const DateTime first{1743206400};
+	uint64_t written = 0;
+	lines = 0;
+	char line[160];
+	while (written < bytes) {
+		const DateTime second{first.epochSeconds + static_cast<int64_t>(lines / 4)};
+		const DateTimeText text = second.utcString(ESPDateFormat::DateTime);
+		const int length = snprintf(
+		    line,
+		    sizeof(line),
+		    "%s.%03u %s\n",
+		    text.c_str(),
+		    static_cast<unsigned>(lines % 4 * 250),
+		    kMessages[lines % 4]
+		);
+		if (fwrite(line, 1, static_cast<size_t>(length), out) != static_cast<size_t>(length)) {
+			fclose(out);
+			return false;
+		}
+		written += static_cast<uint64_t>(length);
+		++lines;
+	}
+	return fclose(out) == 0;
+}
+
+bool rewrite(const char *inPath, const char *outPath, ESPDateLogStampStyle style) {
+	ESPDateLogRewriterConfig config;
+	config.timeZone = kZone;
+	config.style = style;
+	ESPDateLogRewriter rewriter;
+	if (!rewriter.begin(config)) {
+		return false;
+	}
+	const auto started = std::chrono::steady_clock::now();
+	if (!rewriter.rewriteFile(inPath, outPath)) {
+		return false;
+	}
+	const double elapsed = secondsSince(started);
+	const ESPDateLogRewriteStats &stats = rewriter.stats();
+	printf(
+	    "%-9s %8.2f s %8.1f MB/s %7.1f M stamps/s\n",
+	    style == ESPDateLogStampStyle::Iso8601 ? "Iso8601" : "DateTime",
+	    elapsed,
+	    static_cast<double>(stats.bytesIn) / elapsed / 1e6,
+	    static_cast<double>(stats.stamps) / elapsed / 1e6
+	);
+	return true;
+}
+
+// What a log shipper typically does: parse each stamp, format it through libc.
+bool baseline(const char *inPath) {
+	FILE *in = fopen(inPath, "rb");
+	if (!in) {
+		return false;
+	}
+	ESPDate date;
+	date.init(ESPDateConfig{0.0f, 0.0f, kZone, nullptr});
+	char line[256];
+	char iso[40];
+	char local[48];
+	uint64_t bytes = 0;
+	size_t lines = 0;
+	const auto started = std::chrono::steady_clock::now();
+	while (lines < kBaselineLines && fgets(line, sizeof(line), in)) {
+		memcpy(iso, line, 23);
+		iso[10] = 'T';
+		iso[23] = 'Z';
+		iso[24] = '\0';
+		const ESPDate::ParseResultUs parsed = date.parseIso8601UtcUs(iso);
+		if (!parsed.ok ||
+		    !parsed.value.localString(local, sizeof(local), ESPDateFormat::Iso8601, 3)) {
+			fclose(in);
+			return false;
+		}
+		bytes += strlen(line);
+		++lines;
+	}
+	const double elapsed = secondsSince(started);
+	fclose(in);
+	printf(
+	    "%-9s %8.2f s %8.1f MB/s %7.1f M stamps/s (first %zu lines)\n",
+	    "libc",
+	    elapsed,
+	    static_cast<double>(bytes) / elapsed / 1e6,
+	    static_cast<double>(lines) / elapsed / 1e6,
+	    lines
+	);
+	return true;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+	if (argc != 4) {
+		fprintf(stderr, "usage: %s <gigabytes> <input.log> <output.log>\n", argv[0]);
+		return 2;
+	}
+	const uint64_t bytes = static_cast<uint64_t>(atof(argv[1]) * 1e9);
+	uint64_t lines = 0;
+	const auto started = std::chrono::steady_clock::now();
+	if (!generate(argv[2], bytes, lines)) {
+		fprintf(stderr, "could not write %s\n", argv[2]);
+		return 1;
+	}
+	printf(
+	    "generated %.2f GB, %llu lines in %.1f s\n",
+	    static_cast<double>(bytes) / 1e9,
+	    static_cast<unsigned long long>(lines),
+	    secondsSince(started)
+	);
+
+	// DateTime keeps every line's length, so it runs in place; Iso8601 adds "+hhmm".
+	if (!rewrite(argv[2], argv[3], ESPDateLogStampStyle::DateTime) ||
+	    !rewrite(argv[2], argv[3], ESPDateLogStampStyle::Iso8601) || !baseline(argv[2])) {
+		fprintf(stderr, "rewrite failed\n");
+		return 1;
+	}
+	return 0;
+}
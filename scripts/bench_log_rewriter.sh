@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+# Builds and runs the host log rewriter benchmark.
+# Usage: scripts/bench_log_rewriter.sh [gigabytes=2] [work-dir=$TMPDIR]
+
+set -euo pipefail
+
+_repo_root="$(git rev-parse --show-toplevel 2>/dev/null || pwd)"
+_gigabytes="${1:-2}"
+_work_dir="$(mktemp -d "${2:-${TMPDIR:-/tmp}}/esp-date-bench.XXXXXX")"
+trap 'rm -rf "${_work_dir}"' EXIT
+
+# The library only needs <Arduino.h> to exist on the host.
+mkdir -p "${_work_dir}/include"
+touch "${_work_dir}/include/Arduino.h"
+
+"${CXX:-c++}" -std=gnu++17 -O2 -fno-exceptions \
+    -I"${_work_dir}/include" -I"${_repo_root}/src" \
+    "${_repo_root}"/src/esp_date/*.cpp "${_repo_root}/scripts/bench_log_rewriter.cpp" \
+    -o "${_work_dir}/bench_log_rewriter" -lpthread
+
+"${_work_dir}/bench_log_rewriter" "${_gigabytes}" "${_work_dir}/in.log" "${_work_dir}/out.log"
@@ -0,0 +1,416 @@
+#!/usr/bin/env python3
+"""Compiles IANA zones from the host's TZif files into an ESPDateTzdbTable.
+
+The output is a header declaring the table and a source file holding it as const data, ready
+to drop into a sketch or component (see the ESPDateTzdbTable comment in src/esp_date/tzdb.h
+for the layout). A size report per zone is printed to stdout.
+
+    scripts/generate_tzdb.py --output src/tzdb_zones Europe/Budapest America/New_York
+    scripts/generate_tzdb.py --output src/tzdb_zones @zones.txt   # one zone per line
+    scripts/generate_tzdb.py --all --report-only                  # size of the full database
+"""
+
+import argparse
+import calendar
+import re
+import struct
+import sys
+import zoneinfo
+from pathlib import Path
+
+CHECKPOINT_INTERVAL = 16  # ESPDateTzdbTable::kCheckpointInterval
+RECORD_SIZE = 20  # sizeof(ESPDateTzdbZoneRecord)
+DEFAULT_ZONEINFO = Path("/usr/share/zoneinfo")
+
+
+def _hash(name, seed):
+    """FNV-1a plus the MurmurHash3 finalizer; must match hashName() in tzdb.cpp."""
+    value = 2166136261 ^ seed
+    for byte in name.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & 0xFFFFFFFF
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & 0xFFFFFFFF
+    value ^= value >> 16
+    return value
+
+
+def read_tzif(path):
+    """Returns (transition times, (utoff, isdst) per transition, type 0, footer)."""
+    data = path.read_bytes()
+    if data[:4] != b"TZif":
+        raise ValueError(f"{path} is not a TZif file")
+
+    def counts(offset):
+        # isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt
+        return struct.unpack(">6l", data[offset + 20 : offset + 44])
+
+    isut, isstd, leap, timecnt, typecnt, charcnt = counts(0)
+    offset = 44
+    time_size = 4
+    if data[4] != 0:
+        # Skip the 32-bit block; version 2+ repeats everything with 64-bit times.
+        offset += timecnt * 5 + typecnt * 6 + charcnt + leap * 8 + isstd + isut
+        isut, isstd, leap, timecnt, typecnt, charcnt = counts(offset)
+        offset += 44
+        time_size = 8
+
+    times = struct.unpack(f">{timecnt}{'q' if time_size == 8 else 'l'}",
+                          data[offset : offset + timecnt * time_size])
+    offset += timecnt * time_size
+    indices = data[offset : offset + timecnt]
+    offset += timecnt
+    types = []
+    for _ in range(typecnt):
+        utoff, isdst, _abbrind = struct.unpack(">lBB", data[offset : offset + 6])
+        types.append((utoff, bool(isdst)))
+        offset += 6
+    offset += charcnt + leap * (time_size + 4) + isstd + isut
+
+    footer = ""
+    if time_size == 8:
+        footer = data[offset:].strip(b"\n").decode()
+    return list(times), [types[i] for i in indices], types[0], footer
+
+
+class PosixRule:
+    """Just enough of a POSIX TZ evaluator to tell which transitions a footer reproduces."""
+
+    _NAME = r"(?:<[A-Za-z0-9+-]{3,}>|[A-Za-z]{3,})"
+    _TIME = r"[+-]?\d{1,3}(?::\d{1,2}){0,2}"
+    _DATE = rf"(?:J\d{{1,3}}|\d{{1,3}}|M\d{{1,2}}\.\d\.\d)(?:/{_TIME})?"
+    _PATTERN = re.compile(
+        rf"^{_NAME}({_TIME})(?:({_NAME})({_TIME})?(?:,({_DATE}),({_DATE}))?)?$"
+    )
+
+    def __init__(self, text):
+        match = self._PATTERN.match(text)
+        if not match:
+            raise ValueError(f"unsupported POSIX TZ footer '{text}'")
+        std, dst_name, dst, start, end = match.groups()
+        self.std = -self._seconds(std)
+        self.has_dst = dst_name is not None
+        self.dst = -self._seconds(dst) if dst else self.std + 3600
+        self.start = self._rule(start or "M3.2.0")
+        self.end = self._rule(end or "M11.1.0")
+
+    @staticmethod
+    def _seconds(text):
+        sign = -1 if text.startswith("-") else 1
+        parts = [int(part) for part in text.lstrip("+-").split(":")]
+        parts += [0] * (3 - len(parts))
+        return sign * (parts[0] * 3600 + parts[1] * 60 + parts[2])
+
+    def _rule(self, text):
+        date, _, time = text.partition("/")
+        return date, self._seconds(time) if time else 7200
+
+    @staticmethod
+    def _day(date, year):
+        """Days since 1970-01-01 of the rule date in `year`."""
+        jan1 = calendar.timegm((year, 1, 1, 0, 0, 0)) // 86400
+        if date.startswith("J"):
+            day = int(date[1:]) - 1
+            return jan1 + day + (1 if calendar.isleap(year) and day >= 59 else 0)
+        if not date.startswith("M"):
+            return jan1 + int(date)
+        month, week, weekday = (int(part) for part in date[1:].split("."))
+        first = calendar.timegm((year, month, 1, 0, 0, 0)) // 86400
+        day = first + (weekday - (first + 4) % 7) % 7 + (week - 1) * 7
+        while day - first >= calendar.monthrange(year, month)[1]:
+            day -= 7
+        return day
+
+    def _transitions(self, year):
+        start = self._day(self.start[0], year) * 86400 + self.start[1] - self.std
+        end = self._day(self.end[0], year) * 86400 + self.end[1] - self.dst
+        return start, end
+
+    def _events(self, utc):
+        year = 1970 + utc // 31556952  # may be a year off; the window below covers that
+        events = []
+        for candidate in range(year - 2, year + 3):
+            start, end = self._transitions(candidate)
+            events += [(start, True), (end, False)]
+        return sorted(events)
+
+    def state(self, utc):
+        if not self.has_dst:
+            return (self.std, False)
+        dst = False
+        for time, starts in self._events(utc):
+            if time > utc:
+                break
+            dst = starts
+        return (self.dst, True) if dst else (self.std, False)
+
+    def next_transition(self, utc):
+        if not self.has_dst:
+            return None
+        return next(time for time, _ in self._events(utc) if time > utc)
+
+
+class Zone:
+    def __init__(self, name, path, base):
+        times, states, initial, footer = read_tzif(path)
+        self.name = name
+        self.source_size = path.stat().st_size
+        self.dropped_old = 0
+        self.dropped_footer = 0
+
+        # Collapse the history to offset/DST changes from `base` on; abbreviation-only changes
+        # and anything older are not needed.
+        self.initial = initial
+        transitions = []
+        for time, state in zip(times, states):
+            if time < base:
+                self.initial = state
+                self.dropped_old += 1
+                continue
+            previous = transitions[-1][1] if transitions else self.initial
+            if state != previous:
+                transitions.append((time, state))
+
+        rule = None
+        if footer:
+            try:
+                rule = PosixRule(footer)
+            except ValueError as error:
+                print(f"[tzdb] {name}: {error}; keeping the transitions only", file=sys.stderr)
+                footer = ""
+        if rule:
+            # Walk back over the transitions the footer reproduces; the earliest of them stays
+            # as the hand-over point from the table to the rule.
+            keep = len(transitions)
+            while keep > 0 and self._reproduces(rule, transitions, keep - 1):
+                keep -= 1
+            if keep < len(transitions):
+                self.dropped_footer = len(transitions) - keep - 1
+                transitions = transitions[: keep + 1]
+            last = transitions[-1][1] if transitions else self.initial
+            probe = transitions[-1][0] if transitions else base
+            if rule.state(probe) != last:
+                print(f"[tzdb] {name}: footer '{footer}' disagrees with the last transition; "
+                      "dropping it", file=sys.stderr)
+                footer = ""
+        self.footer = footer
+        self.transitions = transitions
+
+        self.types = [self.initial]
+        for _, state in transitions:
+            if state not in self.types:
+                self.types.append(state)
+        self.unit = 60 if all((time - base) % 60 == 0 for time, _ in transitions) else 1
+
+        self.stream = bytearray()
+        self.checkpoints = []
+        previous = base
+        for index, (time, state) in enumerate(transitions):
+            if time - base >= 1 << 32:
+                raise ValueError(f"{name}: transition at {time} is too far after --since")
+            if index % CHECKPOINT_INTERVAL == 0:
+                self.checkpoints.append((time - base, len(self.stream)))
+            value = (time - previous) // self.unit * len(self.types) + self.types.index(state)
+            while True:
+                byte = value & 0x7F
+                value >>= 7
+                self.stream.append(byte | (0x80 if value else 0))
+                if not value:
+                    break
+            previous = time
+        if len(self.stream) > 0xFFFF:
+            raise ValueError(f"{name}: transition stream exceeds 64 KiB")
+
+    @staticmethod
+    def _reproduces(rule, transitions, index):
+        time, state = transitions[index]
+        previous = transitions[index - 1][1] if index else None
+        if rule.state(time) != state or (previous and rule.state(time - 1) != previous):
+            return False
+        # Regions sometimes sit out DST for a year or more; the rule would not.
+        if index + 1 < len(transitions):
+            return rule.next_transition(time) == transitions[index + 1][0]
+        return True
+
+    def size(self, strings_size):
+        return (RECORD_SIZE + len(self.stream) + 4 * len(self.types) + 6 * len(self.checkpoints)
+                + strings_size)
+
+
+def _perfect_hash(names):
+    """Hash-and-displace: one seed per bucket maps every name to its own slot."""
+    count = len(names)
+    bucket_count = max(1, (count + 2) // 3)
+    while True:
+        buckets = [[] for _ in range(bucket_count)]
+        for name in names:
+            buckets[_hash(name, 0) % bucket_count].append(name)
+        seeds = [0] * bucket_count
+        slots = [None] * count
+        for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+            members = buckets[bucket]
+            if not members:
+                continue
+            for seed in range(1, 0x10000):
+                positions = [_hash(name, seed) % count for name in members]
+                if len(set(positions)) == len(positions) and all(
+                    slots[position] is None for position in positions
+                ):
+                    break
+            else:
+                break
+            seeds[bucket] = seed
+            for name, position in zip(members, positions):
+                slots[position] = name
+        else:
+            return seeds, slots
+        bucket_count += 1
+
+
+def tzdata_version(zoneinfo_dir):
+    for candidate in ("tzdata.zi", "+VERSION"):
+        path = zoneinfo_dir / candidate
+        if path.exists():
+            match = re.search(r"(\d{4}[a-z])", path.read_text(errors="replace")[:200])
+            if match:
+                return match.group(1)
+    return "unknown"
+
+
+def _array(ctype, name, values, per_line, fmt=str):
+    values = list(values) or [0]  # C++ has no empty arrays
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[start : start + per_line]) + ",")
+    return f"const {ctype} {name}[] = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+def _write(output, table_name, zones, slots, seeds, base, since, version):
+    by_name = {zone.name: zone for zone in zones}
+    ordered = [by_name[name] for name in slots]
+
+    strings = {"": 0}
+    string_order = [""]
+
+    def intern(text):
+        if text not in strings:
+            strings[text] = sum(len(s) + 1 for s in string_order)
+            string_order.append(text)
+        return strings[text]
+
+    records = []
+    types = []
+    stream = bytearray()
+    checkpoint_times = []
+    checkpoint_offsets = []
+    for zone in ordered:
+        records.append(
+            (intern(zone.name), intern(zone.footer), len(stream), len(checkpoint_times),
+             len(zone.transitions), len(types), len(zone.types), zone.unit, zone.name)
+        )
+        types += [offset * 2 + int(dst) for offset, dst in zone.types]
+        stream += zone.stream
+        checkpoint_times += [time for time, _ in zone.checkpoints]
+        checkpoint_offsets += [position for _, position in zone.checkpoints]
+    if len(checkpoint_times) > 0xFFFF or len(types) > 0xFFFF:
+        raise ValueError("too many zones for 16-bit table indices; split the zone set")
+
+    header_path = output.with_suffix(".h")
+    source_path = output.with_suffix(".cpp")
+    banner = (f"// Generated by scripts/generate_tzdb.py from tzdata {version}; do not edit.\n"
+              f"// {len(zones)} zones, history since {since}.\n")
+    header_path.write_text(
+        f"{banner}#pragma once\n\n#include <ESPDate.h>\n\n"
+        f"extern const ESPDateTzdbTable {table_name};\n"
+    )
+
+    body = [f'{banner}#include "{header_path.name}"\n', "namespace {"]
+    body.append("const ESPDateTzdbZoneRecord kZones[] = {")
+    rows = ["{" + ", ".join(str(field) for field in record[:-1]) + "}," for record in records]
+    width = max(len(row) for row in rows)
+    for row, record in zip(rows, records):
+        body.append(f"    {row:<{width}} // {record[-1]}")
+    body.append("};\n")
+    body.append(_array("uint16_t", "kBuckets", seeds, 12))
+    body.append("const char kStrings[] =")
+    body += [f'    "{text}\\0"' for text in string_order[:-1]]
+    body.append(f'    "{string_order[-1]}";\n')
+    body.append(_array("int32_t", "kTypes", types, 8))
+    body.append(_array("uint8_t", "kTransitions", stream, 16, lambda v: f"0x{v:02x}"))
+    body.append(_array("uint32_t", "kCheckpointTimes", checkpoint_times, 6))
+    body.append(_array("uint16_t", "kCheckpointOffsets", checkpoint_offsets, 12))
+    body.append("} // namespace\n")
+    body.append(f"extern const ESPDateTzdbTable {table_name} = {{")
+    body.append(f'    "{version}",')
+    body.append(f"    {base}LL,")
+    body.append(f"    {len(zones)},")
+    body.append(f"    {len(seeds)},")
+    body.append("    kZones,\n    kBuckets,\n    kStrings,\n    kTypes,\n    kTransitions,")
+    body.append("    kCheckpointTimes,\n    kCheckpointOffsets,\n};")
+    source_path.write_text("\n".join(body) + "\n")
+    return header_path, source_path
+
+
+def _report(zones, seeds):
+    print(f"{'zone':<34} {'tzif':>6} {'kept':>5} {'old':>5} {'rule':>5} {'types':>5} {'bytes':>6}")
+    total = 0
+    source = 0
+    strings = set()
+    for zone in sorted(zones, key=lambda z: z.name):
+        # Footers are shared between zones; count each once, against its first user.
+        text = len(zone.name) + 1
+        if zone.footer and zone.footer not in strings:
+            strings.add(zone.footer)
+            text += len(zone.footer) + 1
+        size = zone.size(text)
+        total += size
+        source += zone.source_size
+        print(f"{zone.name:<34} {zone.source_size:>6} {len(zone.transitions):>5} "
+              f"{zone.dropped_old:>5} {zone.dropped_footer:>5} {len(zone.types):>5} {size:>6}")
+    total += 2 * len(seeds) + 1
+    print(f"{len(zones)} zones: {total} bytes of flash (TZif files: {source} bytes), "
+          f"{2 * len(seeds)} of them perfect-hash seeds")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compile IANA zones into an ESPDateTzdbTable.", fromfile_prefix_chars="@"
+    )
+    parser.add_argument("zones", nargs="*", help="IANA zone names, or @file with one per line")
+    parser.add_argument("--all", action="store_true", help="every zone the host knows")
+    parser.add_argument("--output", type=Path, help="output path without extension")
+    parser.add_argument("--name", default="espDateTzdb", help="C++ name of the table")
+    parser.add_argument("--since", type=int, default=1970, help="first year of history kept")
+    parser.add_argument("--zoneinfo", type=Path, default=DEFAULT_ZONEINFO)
+    parser.add_argument("--report-only", action="store_true", help="print sizes, write nothing")
+    args = parser.parse_args()
+
+    known = zoneinfo.available_timezones() - {"localtime", "posixrules", "Factory"}
+    names = sorted(set(args.zones) | (known if args.all else set()))
+    names = [name.strip() for name in names if name.strip() and not name.startswith("#")]
+    if not names:
+        parser.error("no zones given")
+    if not args.output and not args.report_only:
+        parser.error("--output is required unless --report-only is given")
+
+    base = calendar.timegm((args.since, 1, 1, 0, 0, 0))
+    zones = []
+    for name in names:
+        path = args.zoneinfo / name
+        if not path.is_file():
+            parser.error(f"unknown zone '{name}' (no {path})")
+        zones.append(Zone(name, path, base))
+
+    seeds, slots = _perfect_hash(names)
+    _report(zones, seeds)
+    if not args.report_only:
+        version = tzdata_version(args.zoneinfo)
+        for path in _write(
+            args.output, args.name, zones, slots, seeds, base, args.since, version
+        ):
+            print(f"wrote {path}")
+
+
+if __name__ == "__main__":
+    main()
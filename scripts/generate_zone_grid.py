@@ -0,0 +1,397 @@
+#!/usr/bin/env python3
+"""Builds an ESPDateZoneGridTable: a quadtree that maps latitude/longitude to an IANA zone.
+
+Two sources are supported, and one must be named:
+  --geojson  zone polygons, e.g. combined-with-oceans.json from timezone-boundary-builder
+             (https://github.com/evansiroky/timezone-boundary-builder/releases). Every cell of
+             the finest level takes the zone containing its centre. scripts/zone_outlines.geojson
+             holds simplified outlines of a few dozen zones for the tests and examples.
+  --points   a tzdata zone.tab / zone1970.tab (zone.tab of --zoneinfo when no path is given).
+             Each location takes the zone of the nearest listed city: a coarse fallback that
+             needs no download but can land in the neighbouring zone well inside a border.
+
+The tree is stored as 16-bit entries (see src/esp_date/zone_grid.h); uniform quadrants stop
+splitting early, so the size follows the length of the zone borders, not the area.
+
+    scripts/generate_zone_grid.py --geojson combined-with-oceans.json --depth 12 \\
+        --bbox 34,-11,72,45 --output src/zone_grid --check reference.csv
+    scripts/generate_zone_grid.py --points --output src/zone_grid
+"""
+
+import argparse
+import csv
+import json
+import math
+import sys
+from array import array
+from pathlib import Path
+
+from generate_tzdb import DEFAULT_ZONEINFO, read_tzif, tzdata_version
+
+LEAF = 0x8000
+NO_ZONE = 0x7FFF
+
+
+class Box:
+    def __init__(self, min_lat, min_lon, max_lat, max_lon):
+        self.min_lat, self.min_lon, self.max_lat, self.max_lon = min_lat, min_lon, max_lat, max_lon
+
+    def cell(self, depth, row, col):
+        """Bounds (min_lat, min_lon, max_lat, max_lon) of a cell at `depth`."""
+        size = 1 << depth
+        height = (self.max_lat - self.min_lat) / size
+        width = (self.max_lon - self.min_lon) / size
+        return (self.min_lat + row * height, self.min_lon + col * width,
+                self.min_lat + (row + 1) * height, self.min_lon + (col + 1) * width)
+
+
+def _parse_iso6709(text):
+    """+DDMM+DDDMM or +DDMMSS+DDDMMSS, as used by zone.tab."""
+    split = max(text.rfind("+"), text.rfind("-"))
+    values = []
+    for part in (text[:split], text[split:]):
+        sign = -1 if part[0] == "-" else 1
+        digits = part[1:]
+        degree_digits = len(digits) - (4 if len(digits) in (6, 7) else 2)
+        degrees = int(digits[:degree_digits])
+        minutes = int(digits[degree_digits : degree_digits + 2])
+        seconds = int(digits[degree_digits + 2 :] or 0)
+        values.append(sign * (degrees + minutes / 60 + seconds / 3600))
+    return values
+
+
+def _load_points(path):
+    points = []
+    for line in path.read_text().splitlines():
+        if not line or line.startswith("#"):
+            continue
+        fields = line.split("\t")
+        latitude, longitude = _parse_iso6709(fields[1])
+        points.append((fields[2], latitude, longitude))
+    return points
+
+
+def _load_polygons(path):
+    """{zone: [ring, ...]} with rings as [(lon, lat), ...]; holes are plain rings (even-odd)."""
+    data = json.loads(path.read_text())
+    zones = {}
+    for feature in data["features"]:
+        name = feature["properties"]["tzid"]
+        geometry = feature["geometry"]
+        polygons = geometry["coordinates"]
+        if geometry["type"] == "Polygon":
+            polygons = [polygons]
+        rings = zones.setdefault(name, [])
+        for polygon in polygons:
+            rings += [[(float(x), float(y)) for x, y, *_ in ring] for ring in polygon]
+    return zones
+
+
+class PointSource:
+    """Nearest listed city on the sphere. A cell is uniform once its nearest city beats every
+    other candidate by more than the cell's diameter, so only cells near borders split."""
+
+    def __init__(self, points, names):
+        self.points = [(names.index(name), self._vector(lat, lon)) for name, lat, lon in points]
+
+    @staticmethod
+    def _vector(lat, lon):
+        lat, lon = math.radians(lat), math.radians(lon)
+        return (math.cos(lat) * math.cos(lon), math.cos(lat) * math.sin(lon), math.sin(lat))
+
+    @staticmethod
+    def _angle(a, b):
+        dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+        return math.acos(max(-1.0, min(1.0, dot)))
+
+    def root(self):
+        return self.points
+
+    def classify(self, bounds, candidates):
+        """(uniform, zone, candidates for the children)."""
+        min_lat, min_lon, max_lat, max_lon = bounds
+        center = self._vector((min_lat + max_lat) / 2, (min_lon + max_lon) / 2)
+        corners = [self._vector(lat, lon) for lat in (min_lat, max_lat) for lon in (min_lon, max_lon)]
+        # Edges of a lat/lon box bulge towards the pole; the margin covers that.
+        radius = max(self._angle(center, corner) for corner in corners) * 1.05 + 1e-9
+        ranked = sorted((self._angle(center, vector), zone, vector) for zone, vector in candidates)
+        best = ranked[0][0]
+        kept = [(zone, vector) for distance, zone, vector in ranked if distance <= best + 2 * radius]
+        if all(zone == kept[0][0] for zone, _ in kept):
+            return True, kept[0][0], kept
+        return False, None, kept
+
+    def center(self, bounds, candidates):
+        min_lat, min_lon, max_lat, max_lon = bounds
+        center = self._vector((min_lat + max_lat) / 2, (min_lon + max_lon) / 2)
+        return min(candidates, key=lambda item: self._angle(center, item[1]))[0]
+
+    @staticmethod
+    def split(candidates):
+        return [candidates] * 4
+
+
+class RasterSource:
+    """Scanline fill of every zone's rings at the finest level (cell centres, even-odd rule)."""
+
+    def __init__(self, polygons, names, box, depth):
+        size = 1 << depth
+        self.size = size
+        self.depth = depth
+        height = (box.max_lat - box.min_lat) / size
+        width = (box.max_lon - box.min_lon) / size
+        self.rows = [array("H", [NO_ZONE]) * size for _ in range(size)]
+        for name, rings in polygons.items():
+            zone = names.index(name)
+            crossings = {}
+            for ring in rings:
+                for (x1, y1), (x2, y2) in zip(ring, ring[1:] + ring[:1]):
+                    if y1 == y2:
+                        continue
+                    low, high = (y1, y2) if y1 < y2 else (y2, y1)
+                    first = max(0, math.ceil((low - box.min_lat) / height - 0.5))
+                    last = min(size - 1, math.ceil((high - box.min_lat) / height - 0.5) - 1)
+                    slope = (x2 - x1) / (y2 - y1)
+                    for row in range(first, last + 1):
+                        y = box.min_lat + (row + 0.5) * height
+                        crossings.setdefault(row, []).append(x1 + (y - y1) * slope)
+            for row, xs in crossings.items():
+                xs.sort()
+                cells = self.rows[row]
+                for a, b in zip(xs[0::2], xs[1::2]):
+                    start = max(0, math.ceil((a - box.min_lon) / width - 0.5))
+                    stop = min(size, math.ceil((b - box.min_lon) / width - 0.5))
+                    if stop > start:
+                        cells[start:stop] = array("H", [zone]) * (stop - start)
+
+    def root(self):
+        return (0, 0, self.size)
+
+    def classify(self, _bounds, block):
+        row, col, span = block
+        value = self.rows[row][col]
+        template = array("H", [value]) * span
+        for cells in self.rows[row : row + span]:
+            if cells[col : col + span] != template:
+                return False, None, block
+        return True, (None if value == NO_ZONE else value), block
+
+    def center(self, _bounds, block):
+        row, col, _ = block
+        value = self.rows[row][col]
+        return None if value == NO_ZONE else value
+
+    def split(self, block):
+        row, col, span = block
+        half = span // 2
+        return [(row, col, half), (row, col + half, half),
+                (row + half, col, half), (row + half, col + half, half)]
+
+
+def _build(source, box, depth):
+    """Nested lists: a leaf is a zone index (None = no zone), a node is [SW, SE, NW, NE]."""
+
+    def node(level, row, col, state):
+        bounds = box.cell(level, row, col)
+        uniform, zone, state = source.classify(bounds, state)
+        if uniform:
+            return zone
+        if level == depth:
+            return source.center(bounds, state)
+        children = source.split(state)
+        quads = [(0, 0), (0, 1), (1, 0), (1, 1)]
+        result = [node(level + 1, row * 2 + dy, col * 2 + dx, child)
+                  for (dy, dx), child in zip(quads, children)]
+        if all(not isinstance(child, list) and child == result[0] for child in result):
+            return result[0]
+        return result
+
+    return node(0, 0, 0, source.root())
+
+
+def _flatten(tree):
+    """Breadth-first entries; the root entry is returned separately."""
+
+    def entry(item, index):
+        if isinstance(item, list):
+            return index
+        return LEAF | (NO_ZONE if item is None else item)
+
+    if not isinstance(tree, list):
+        return entry(tree, 0), []
+    nodes = []
+    queue = [tree]
+    head = 0
+    while head < len(queue):
+        for child in queue[head]:
+            if isinstance(child, list):
+                nodes.append(len(queue))
+                queue.append(child)
+            else:
+                nodes.append(entry(child, 0))
+        head += 1
+    if len(queue) >= LEAF:
+        raise ValueError(f"{len(queue)} nodes exceed the 16-bit index; lower --depth or --bbox")
+    return 0, nodes
+
+
+def _lookup(box, depth, root, nodes, lat, lon):
+    """Mirror of ESPDateZoneGrid::lookup, for --check."""
+    if not (box.min_lat <= lat <= box.max_lat and box.min_lon <= lon <= box.max_lon):
+        return None
+    size = 1 << depth
+    x = min(size - 1, int((lon - box.min_lon) / (box.max_lon - box.min_lon) * size))
+    y = min(size - 1, int((lat - box.min_lat) / (box.max_lat - box.min_lat) * size))
+    entry = root
+    level = depth - 1
+    while not entry & LEAF:
+        entry = nodes[entry * 4 + (((y >> level) & 1) << 1 | ((x >> level) & 1))]
+        level -= 1
+    zone = entry & ~LEAF
+    return None if zone == NO_ZONE else zone
+
+
+def _footer(zoneinfo_dir, name):
+    path = zoneinfo_dir / name
+    if not path.is_file():
+        print(f"[zone_grid] {name}: no TZif file; its POSIX rule is left empty", file=sys.stderr)
+        return ""
+    return read_tzif(path)[3]
+
+
+def _write(output, table_name, box, depth, root, nodes, names, footers, source_name):
+    strings = {"": 0}
+    order = [""]
+
+    def intern(text):
+        if text not in strings:
+            strings[text] = sum(len(s) + 1 for s in order)
+            order.append(text)
+        return strings[text]
+
+    zone_strings = []
+    for name, footer in zip(names, footers):
+        zone_strings += [intern(name), intern(footer)]
+
+    header_path = output.with_suffix(".h")
+    source_path = output.with_suffix(".cpp")
+    banner = (f"// Generated by scripts/generate_zone_grid.py from {source_name}; do not edit.\n"
+              f"// {len(names)} zones, depth {depth}, {len(nodes) // 4} nodes.\n")
+    header_path.write_text(
+        f"{banner}#pragma once\n\n#include <ESPDate.h>\n\n"
+        f"extern const ESPDateZoneGridTable {table_name};\n"
+    )
+    body = [f'{banner}#include "{header_path.name}"\n', "namespace {"]
+    body.append("const uint16_t kNodes[] = {")
+    values = nodes or [0]
+    for start in range(0, len(values), 12):
+        body.append("    " + ", ".join(f"0x{v:04x}" for v in values[start : start + 12]) + ",")
+    body.append("};\n")
+    body.append("const uint32_t kZones[] = {")
+    rows = [f"{zone_strings[2 * i]}, {zone_strings[2 * i + 1]}," for i in range(len(names))]
+    width = max(len(row) for row in rows)
+    body += [f"    {row:<{width}} // {name}" for row, name in zip(rows, names)]
+    body.append("};\n")
+    body.append("const char kStrings[] =")
+    body += [f'    "{text}\\0"' for text in order[:-1]]
+    body.append(f'    "{order[-1]}";\n')
+    body.append("} // namespace\n")
+    body.append(f"extern const ESPDateZoneGridTable {table_name} = {{")
+    body.append(f"    {box.min_lat!r}f,\n    {box.min_lon!r}f,\n    {box.max_lat!r}f,")
+    body.append(f"    {box.max_lon!r}f,\n    {depth},\n    0x{root:04x},\n    {len(names)},")
+    body.append("    kNodes,\n    kZones,\n    kStrings,\n};")
+    source_path.write_text("\n".join(body) + "\n")
+    return header_path, source_path
+
+
+def _check(path, box, depth, root, nodes, names, footers, zoneinfo_dir):
+    """Reference CSV rows: latitude,longitude,expected zone. Same rule counts as a match."""
+    exact = same_rule = total = 0
+    with path.open() as handle:
+        for row in csv.reader(line for line in handle if not line.startswith("#")):
+            if len(row) < 3:
+                continue
+            total += 1
+            latitude, longitude, expected = float(row[0]), float(row[1]), row[2].strip()
+            zone = _lookup(box, depth, root, nodes, latitude, longitude)
+            got = names[zone] if zone is not None else "-"
+            if got == expected:
+                exact += 1
+                continue
+            if zone is not None and footers[zone] == _footer(zoneinfo_dir, expected):
+                same_rule += 1
+                continue
+            print(f"  miss {latitude:9.4f} {longitude:9.4f} expected {expected}, got {got}")
+    print(f"reference: {total} points, {exact} exact, {same_rule} same rule, "
+          f"{total - exact - same_rule} wrong")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build an ESPDateZoneGridTable.")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--geojson", type=Path, help="zone polygons (tzid property)")
+    source.add_argument("--points", type=Path, nargs="?", const=True,
+                        help="zone.tab-style cities (default zone.tab in --zoneinfo)")
+    parser.add_argument("--depth", type=int, help="levels below the root (default 12, points 8)")
+    parser.add_argument("--bbox", default="-90,-180,90,180", help="minLat,minLon,maxLat,maxLon")
+    parser.add_argument("--output", type=Path, help="output path without extension")
+    parser.add_argument("--name", default="espDateZoneGrid", help="C++ name of the table")
+    parser.add_argument("--zoneinfo", type=Path, default=DEFAULT_ZONEINFO)
+    parser.add_argument("--check", type=Path, help="CSV of latitude,longitude,zone to verify")
+    args = parser.parse_args()
+
+    box = Box(*(float(value) for value in args.bbox.split(",")))
+    if args.geojson:
+        polygons = _load_polygons(args.geojson)
+        names = sorted(polygons)
+        depth = args.depth or 12
+        source = RasterSource(polygons, names, box, depth)
+        source_name = args.geojson.name
+    else:
+        if args.points is True:
+            args.points = args.zoneinfo / "zone.tab"
+        points = _load_points(args.points)
+        names = sorted({name for name, _, _ in points})
+        depth = args.depth or 8
+        source = PointSource(points, names)
+        source_name = f"{args.points.name} (tzdata {tzdata_version(args.zoneinfo)})"
+    if not 1 <= depth <= 15:
+        parser.error("--depth must be 1..15")
+    if len(names) >= NO_ZONE:
+        parser.error("too many zones")
+
+    tree = _build(source, box, depth)
+    # Drop zones the tree never reaches (outside --bbox) and renumber the rest.
+    used = sorted(_zones_in(tree))
+    remap = {old: new for new, old in enumerate(used)}
+    tree = _renumber(tree, remap)
+    names = [names[old] for old in used]
+    footers = [_footer(args.zoneinfo, name) for name in names]
+    root, nodes = _flatten(tree)
+
+    strings_size = sum(len(s) + 1 for s in set(names) | set(footers))
+    total = 2 * len(nodes) + 8 * len(names) + strings_size + 32
+    print(f"{source_name}: {len(names)} zones, depth {depth}, {len(nodes) // 4} nodes")
+    print(f"flash: {total} bytes ({2 * len(nodes)} tree, {8 * len(names) + strings_size} names)")
+    if args.check:
+        _check(args.check, box, depth, root, nodes, names, footers, args.zoneinfo)
+    if args.output:
+        for path in _write(args.output, args.name, box, depth, root, nodes, names, footers,
+                           source_name):
+            print(f"wrote {path}")
+
+
+def _zones_in(tree):
+    if isinstance(tree, list):
+        return set().union(*(_zones_in(child) for child in tree))
+    return set() if tree is None else {tree}
+
+
+def _renumber(tree, remap):
+    if isinstance(tree, list):
+        return [_renumber(child, remap) for child in tree]
+    return None if tree is None else remap[tree]
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#pragma once
+
+// ArduinoJson 7 converters for DateTime and LocalDateTime. ESPDate does not depend on
+// ArduinoJson; include this header where documents carry timestamps.
+//
+//   JsonDocument doc;
+//   doc["at"] = date.now();          // "2025-01-02T03:04:05Z"
+//   doc["local"] = date.nowLocal();  // "2025-01-02T04:04:05+0100"
+//   DateTime at = doc["at"].as<DateTime>();
+//
+// Text is written by ESPDateIso8601Codec into a stack buffer and copied once into the
+// document's string pool, so a field costs no std::string and no heap allocation of its own.
+
+#include "ESPDate.h"
+
+#include <ArduinoJson.h>
+#include <atomic>
+#include <stdint.h>
+
+enum class ESPDateJsonFormat : uint8_t {
+	Iso8601,      // DateTime as "...Z"; LocalDateTime keeps its wall time and "+hhmm" offset
+	EpochSeconds, // integer seconds since 1970-01-01T00:00:00Z (the UTC instant)
+	EpochMillis,  // integer milliseconds since the epoch
+};
+
+class ESPDateJson {
+  public:
+	// Process-wide, for every document serialized after the call. Epoch numbers are 64-bit,
+	// which ArduinoJson stores with ARDUINOJSON_USE_LONG_LONG (the default on ESP32).
+	static void setFormat(ESPDateJsonFormat format) {
+		format_.store(format, std::memory_order_relaxed);
+	}
+	static ESPDateJsonFormat format() {
+		return format_.load(std::memory_order_relaxed);
+	}
+
+	// Accepts ISO-8601 text (see ESPDateIso8601Codec::parse) and integers, read in
+	// milliseconds when `numbers` is EpochMillis and in seconds otherwise. A number carries no
+	// unit, so pass the format the document was written with; the converters (as<DateTime>(),
+	// is<DateTime>()) use the process-wide format() at read time instead.
+	static bool read(JsonVariantConst src, DateTime &out, ESPDateJsonFormat numbers) {
+		if (src.is<const char *>()) {
+			int offsetMinutes = 0;
+			return ESPDateIso8601Codec::parse(src.as<const char *>(), out, offsetMinutes);
+		}
+		if (!src.is<int64_t>()) {
+			return false;
+		}
+		const int64_t value = src.as<int64_t>();
+		out = DateTime{numbers == ESPDateJsonFormat::EpochMillis ? floorMillis(value) : value};
+		return true;
+	}
+	// Text keeps the wall time and offset it was written with; a number becomes UTC fields
+	// with offset 0.
+	static bool read(JsonVariantConst src, LocalDateTime &out, ESPDateJsonFormat numbers) {
+		if (src.is<const char *>()) {
+			return ESPDateIso8601Codec::parseLocal(src.as<const char *>(), out);
+		}
+		DateTime utc{};
+		if (!read(src, utc, numbers)) {
+			return false;
+		}
+		out = ESPDateIso8601Codec::atOffset(utc, 0);
+		return true;
+	}
+	static bool read(JsonVariantConst src, DateTime &out) {
+		return read(src, out, format());
+	}
+	static bool read(JsonVariantConst src, LocalDateTime &out) {
+		return read(src, out, format());
+	}
+
+	static bool write(const DateTime &src, JsonVariant dst) {
+		switch (format()) {
+		case ESPDateJsonFormat::EpochSeconds:
+			return dst.set(src.epochSeconds);
+		case ESPDateJsonFormat::EpochMillis:
+			return dst.set(src.epochSeconds * 1000);
+		case ESPDateJsonFormat::Iso8601:
+			break;
+		}
+		char text[ESPDateIso8601Codec::kUtcLength + 1];
+		// char*, not const char*: ArduinoJson copies it instead of keeping the pointer.
+		return ESPDateIso8601Codec::writeUtc(src, text, sizeof(text)) &&
+		       dst.set(static_cast<char *>(text));
+	}
+	static bool write(const LocalDateTime &src, JsonVariant dst) {
+		if (!src.ok) {
+			return false;
+		}
+		if (format() != ESPDateJsonFormat::Iso8601) {
+			return write(src.utc, dst);
+		}
+		char text[ESPDateIso8601Codec::kLocalLength + 1];
+		return ESPDateIso8601Codec::writeLocal(src, text, sizeof(text)) &&
+		       dst.set(static_cast<char *>(text));
+	}
+
+  private:
+	static int64_t floorMillis(int64_t millis) {
+		return millis >= 0 ? millis / 1000 : -((-millis + 999) / 1000);
+	}
+
+	static inline std::atomic<ESPDateJsonFormat> format_{ESPDateJsonFormat::Iso8601};
+};
+
+namespace ArduinoJson {
+template <> struct Converter<DateTime> {
+	static bool toJson(const DateTime &src, JsonVariant dst) {
+		return ESPDateJson::write(src, dst);
+	}
+	static DateTime fromJson(JsonVariantConst src) {
+		DateTime value{};
+		ESPDateJson::read(src, value);
+		return value;
+	}
+	static bool checkJson(JsonVariantConst src) {
+		DateTime value{};
+		return ESPDateJson::read(src, value);
+	}
+};
+
+template <> struct Converter<LocalDateTime> {
+	static bool toJson(const LocalDateTime &src, JsonVariant dst) {
+		return ESPDateJson::write(src, dst);
+	}
+	static LocalDateTime fromJson(JsonVariantConst src) {
+		LocalDateTime value{};
+		ESPDateJson::read(src, value);
+		return value;
+	}
+	static bool checkJson(JsonVariantConst src) {
+		LocalDateTime value{};
+		return ESPDateJson::read(src, value);
+	}
+};
+} // namespace ArduinoJson
@@ -0,0 +1,170 @@
+#include "civil_cache.h"
+#include "date.h"
+#include "utils.h"
+
+using Utils = ESPDateUtils;
+
+namespace {
+void writeFields(
+    DateFieldColumns &out,
+    size_t index,
+    int64_t localSeconds,
+    int32_t offsetSeconds,
+    ESPDateDayCache &cache
+) {
+	const int64_t days = Utils::floorDiv(localSeconds, Utils::kSecondsPerDay);
+	cache.load(days);
+	const int64_t secondOfDay = localSeconds - days * Utils::kSecondsPerDay;
+	if (out.year) {
+		out.year[index] = static_cast<int16_t>(cache.year);
+	}
+	if (out.month) {
+		out.month[index] = static_cast<uint8_t>(cache.month);
+	}
+	if (out.day) {
+		out.day[index] = static_cast<uint8_t>(cache.day);
+	}
+	if (out.hour) {
+		out.hour[index] = static_cast<uint8_t>(secondOfDay / Utils::kSecondsPerHour);
+	}
+	if (out.minute) {
+		out.minute[index] = static_cast<uint8_t>(
+		    secondOfDay % Utils::kSecondsPerHour / Utils::kSecondsPerMinute
+		);
+	}
+	if (out.second) {
+		out.second[index] = static_cast<uint8_t>(secondOfDay % Utils::kSecondsPerMinute);
+	}
+	if (out.weekday) {
+		out.weekday[index] = static_cast<uint8_t>(cache.weekday);
+	}
+	if (out.offsetMinutes) {
+		out.offsetMinutes[index] = static_cast<int16_t>(offsetSeconds / 60);
+	}
+}
+
+const char *batchTimeZone(const char *timeZone, const DateString &configured) {
+	if (timeZone && timeZone[0] != '\0') {
+		return timeZone;
+	}
+	return configured.empty() ? nullptr : configured.c_str();
+}
+
+// Chunks are independent (each starts its own offset span and day cache), so any split gives
+// the same output as one serial pass.
+constexpr size_t kMinBatchChunk = 256;
+
+void runBatch(ESPDateExecutor *executor, size_t count, const ESPDateExecutor::Job &job) {
+	if (executor) {
+		executor->parallelFor(count, kMinBatchChunk, job);
+	} else if (count > 0) {
+		job(0, count);
+	}
+}
+} // namespace
+
+size_t ESPDate::toLocalBatch(
+    const DateTime *in,
+    size_t count,
+    DateFieldColumns &out,
+    const char *timeZone,
+    ESPDateExecutor *executor
+) const {
+	if (!in) {
+		return 0;
+	}
+	const char *tz = batchTimeZone(timeZone, timeZone_);
+	ESPDatePosixTz zone;
+	if (Utils::posixTzFor(tz, zone)) {
+		runBatch(executor, count, [&](size_t begin, size_t end) {
+			ESPDateOffsetCursor offsets(zone);
+			ESPDateDayCache cache;
+			for (size_t i = begin; i < end; ++i) {
+				const int64_t utc = in[i].epochSeconds;
+				const int32_t offset = offsets.at(utc);
+				writeFields(out, i, utc + offset, offset, cache);
+			}
+		});
+		return count;
+	}
+
+	// Not a POSIX rule string: switch TZ once and let libc decompose each stamp. The TZ is
+	// process-wide, so this path always runs on the caller.
+	Utils::ScopedTz scoped(tz, usePSRAMBuffers_);
+	ESPDateDayCache cache;
+	for (size_t i = 0; i < count; ++i) {
+		tm local{};
+		if (!Utils::toLocalTm(in[i], local)) {
+			return i;
+		}
+		const int64_t localSeconds = Utils::timegm64(local);
+		writeFields(
+		    out,
+		    i,
+		    localSeconds,
+		    static_cast<int32_t>(localSeconds - in[i].epochSeconds),
+		    cache
+		);
+	}
+	return count;
+}
+
+size_t ESPDate::toCivilUtcBatch(
+    const DateTime *in, size_t count, DateFieldColumns &out, ESPDateExecutor *executor
+) const {
+	if (!in) {
+		return 0;
+	}
+	runBatch(executor, count, [&](size_t begin, size_t end) {
+		ESPDateDayCache cache;
+		for (size_t i = begin; i < end; ++i) {
+			writeFields(out, i, in[i].epochSeconds, 0, cache);
+		}
+	});
+	return count;
+}
+
+size_t ESPDate::startOfDayLocalBatch(
+    const DateTime *in,
+    size_t count,
+    DateTime *out,
+    const char *timeZone,
+    ESPDateExecutor *executor
+) const {
+	if (!in || !out) {
+		return 0;
+	}
+	const char *tz = batchTimeZone(timeZone, timeZone_);
+	ESPDatePosixTz zone;
+	if (Utils::posixTzFor(tz, zone)) {
+		// localToUtc only fails for invalid zones, which posixTzFor has ruled out.
+		runBatch(executor, count, [&](size_t begin, size_t end) {
+			ESPDateOffsetCursor offsets(zone);
+			bool haveDay = false;
+			int64_t lastDay = 0;
+			int64_t lastStart = 0;
+			for (size_t i = begin; i < end; ++i) {
+				const int64_t utc = in[i].epochSeconds;
+				const int64_t day = Utils::floorDiv(utc + offsets.at(utc), Utils::kSecondsPerDay);
+				if (!haveDay || day != lastDay) {
+					// Earliest: a day whose midnight was skipped starts when the clock jumps.
+					zone.localToUtc(
+					    day * Utils::kSecondsPerDay,
+					    ESPDateDstPolicy::Earliest,
+					    lastStart
+					);
+					lastDay = day;
+					haveDay = true;
+				}
+				out[i] = DateTime{lastStart};
+			}
+		});
+		return count;
+	}
+
+	Utils::ScopedTz scoped(tz, usePSRAMBuffers_);
+	for (size_t i = 0; i < count; ++i) {
+		out[i] = startOfDayLocal(in[i]);
+	}
+	return count;
+}
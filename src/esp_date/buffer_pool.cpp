@@ -0,0 +1,124 @@
+#include "buffer_pool.h"
+#include "date_allocator.h"
+
+namespace {
+ESPDateBufferPool sharedPool;
+} // namespace
+
+ESPDateBufferPool &ESPDateBufferPool::shared() {
+	return sharedPool;
+}
+
+bool ESPDateBufferPool::configure(size_t blockSize, size_t blockCount, bool usePSRAMBuffers) {
+	if (!release()) {
+		return false;
+	}
+	if (blockSize == 0 || blockCount == 0) {
+		return true; // pool stays disabled
+	}
+	if (blockCount > kMaxBlocks) {
+		blockCount = kMaxBlocks;
+	}
+	// Keep every block aligned like malloc would for the char/POD payloads it serves.
+	blockSize = (blockSize + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+
+	void *memory = date_allocator_detail::heapAllocate(blockSize * blockCount, usePSRAMBuffers);
+	if (!memory) {
+		return false;
+	}
+	for (size_t i = 0; i < kWords; ++i) {
+		used_[i].store(0, std::memory_order_relaxed);
+	}
+	inUse_.store(0, std::memory_order_relaxed);
+	highWater_.store(0, std::memory_order_relaxed);
+	failedAllocations_.store(0, std::memory_order_relaxed);
+	blockSize_ = blockSize;
+	blockCount_ = blockCount;
+	storage_ = static_cast<uint8_t *>(memory);
+	return true;
+}
+
+bool ESPDateBufferPool::release() {
+	if (!storage_) {
+		return true;
+	}
+	if (inUse_.load(std::memory_order_acquire) != 0) {
+		return false;
+	}
+	date_allocator_detail::heapDeallocate(storage_);
+	storage_ = nullptr;
+	blockSize_ = 0;
+	blockCount_ = 0;
+	return true;
+}
+
+void *ESPDateBufferPool::allocate(size_t bytes) {
+	if (!storage_) {
+		return nullptr;
+	}
+	if (bytes > blockSize_) {
+		failedAllocations_.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	const size_t words = (blockCount_ + kWordBits - 1) / kWordBits;
+	for (size_t w = 0; w < words; ++w) {
+		const size_t bitsInWord =
+		    (w + 1 == words && blockCount_ % kWordBits) ? blockCount_ % kWordBits : kWordBits;
+		const uint32_t validMask =
+		    bitsInWord == kWordBits ? 0xFFFFFFFFu : ((1u << bitsInWord) - 1u);
+		uint32_t current = used_[w].load(std::memory_order_relaxed);
+		while ((current & validMask) != validMask) {
+			const uint32_t freeBits = ~current & validMask;
+			const uint32_t bit = freeBits & (0u - freeBits); // lowest free block
+			if (used_[w].compare_exchange_weak(
+			        current,
+			        current | bit,
+			        std::memory_order_acquire,
+			        std::memory_order_relaxed
+			    )) {
+				size_t index = w * kWordBits;
+				for (uint32_t probe = bit; probe > 1u; probe >>= 1) {
+					++index;
+				}
+				noteInUse(inUse_.fetch_add(1, std::memory_order_relaxed) + 1);
+				return storage_ + index * blockSize_;
+			}
+		}
+	}
+	failedAllocations_.fetch_add(1, std::memory_order_relaxed);
+	return nullptr;
+}
+
+bool ESPDateBufferPool::deallocate(void *ptr) {
+	const uint8_t *bytes = static_cast<const uint8_t *>(ptr);
+	if (!storage_ || !bytes || bytes < storage_ || bytes >= storage_ + blockSize_ * blockCount_) {
+		return false;
+	}
+	const size_t index = static_cast<size_t>(bytes - storage_) / blockSize_;
+	used_[index / kWordBits].fetch_and(
+	    ~(1u << (index % kWordBits)),
+	    std::memory_order_release
+	);
+	inUse_.fetch_sub(1, std::memory_order_relaxed);
+	return true;
+}
+
+ESPDateBufferPoolStats ESPDateBufferPool::stats() const {
+	ESPDateBufferPoolStats out{};
+	out.enabled = storage_ != nullptr;
+	out.blockSize = blockSize_;
+	out.blockCount = blockCount_;
+	out.inUse = inUse_.load(std::memory_order_relaxed);
+	out.highWater = highWater_.load(std::memory_order_relaxed);
+	out.failedAllocations = failedAllocations_.load(std::memory_order_relaxed);
+	out.heapAllocations = heapAllocations_.load(std::memory_order_relaxed);
+	return out;
+}
+
+void ESPDateBufferPool::noteInUse(size_t inUse) {
+	size_t seen = highWater_.load(std::memory_order_relaxed);
+	while (inUse > seen &&
+	       !highWater_.compare_exchange_weak(seen, inUse, std::memory_order_relaxed)) {
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ESPDateBufferPoolStats {
+	bool enabled = false;
+	size_t blockSize = 0;
+	size_t blockCount = 0;
+	size_t inUse = 0;              // blocks currently handed out
+	size_t highWater = 0;          // most blocks ever in use at once
+	uint32_t failedAllocations = 0; // requests the pool could not serve (too large or exhausted)
+	uint32_t heapAllocations = 0;   // DateAllocator requests that reached the general heap
+};
+
+// Bounded fixed-block pool behind DateAllocator. Storage is reserved once by
+// configure() so steady-state DateString churn (TZ restore copies, config text)
+// stays off the general heap. Block claim/release is a lock-free bitmap CAS;
+// requests the pool cannot serve fall back to the heap and are counted.
+class ESPDateBufferPool {
+  public:
+	static constexpr size_t kMaxBlocks = 256;
+	static constexpr size_t kDefaultBlockSize = 64;
+
+	constexpr ESPDateBufferPool() = default;
+	ESPDateBufferPool(const ESPDateBufferPool &) = delete;
+	ESPDateBufferPool &operator=(const ESPDateBufferPool &) = delete;
+
+	// Process-wide pool used by every DateAllocator.
+	static ESPDateBufferPool &shared();
+
+	// Reserves blockCount blocks of blockSize bytes. Fails while blocks are still in use.
+	// Must not race with allocations; ESPDate calls it from init().
+	bool configure(size_t blockSize, size_t blockCount, bool usePSRAMBuffers = false);
+	// Returns the storage to the heap if no block is in use.
+	bool release();
+
+	// nullptr when disabled, when bytes exceed the block size, or when every block is taken.
+	void *allocate(size_t bytes);
+	// Returns false if ptr does not belong to the pool.
+	bool deallocate(void *ptr);
+	void noteHeapAllocation() {
+		heapAllocations_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	bool enabled() const {
+		return storage_ != nullptr;
+	}
+	ESPDateBufferPoolStats stats() const;
+
+  private:
+	static constexpr size_t kWordBits = 32;
+	static constexpr size_t kWords = kMaxBlocks / kWordBits;
+
+	void noteInUse(size_t inUse);
+
+	uint8_t *storage_ = nullptr;
+	size_t blockSize_ = 0;
+	size_t blockCount_ = 0;
+	std::atomic<uint32_t> used_[kWords]{};
+	std::atomic<size_t> inUse_{0};
+	std::atomic<size_t> highWater_{0};
+	std::atomic<uint32_t> failedAllocations_{0};
+	std::atomic<uint32_t> heapAllocations_{0};
+};
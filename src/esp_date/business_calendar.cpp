@@ -0,0 +1,369 @@
+#include "business_calendar.h"
+#include "date_allocator.h"
+#include "utils.h"
+
+namespace {
+using Utils = ESPDateUtils;
+
+constexpr uint8_t kFixed = 0;
+constexpr uint8_t kNthWeekday = 1;
+constexpr uint8_t kEaster = 2;
+constexpr uint32_t kBitsPerYear = ESPDateBusinessCalendar::kWordsPerYear * 64;
+
+int popcount(uint64_t word) {
+	return __builtin_popcountll(word);
+}
+
+// Position of the k-th (0-based) set bit; the word must have more than k set bits.
+uint32_t selectInWord(uint64_t word, uint32_t k) {
+	uint32_t base = 0;
+	for (;; base += 8) {
+		const uint32_t count = static_cast<uint32_t>(popcount((word >> base) & 0xff));
+		if (k < count) {
+			break;
+		}
+		k -= count;
+	}
+	uint64_t bits = word >> base;
+	for (; k > 0; --k) {
+		bits &= bits - 1;
+	}
+	return base + static_cast<uint32_t>(__builtin_ctzll(bits));
+}
+
+// Anonymous Gregorian computus (Meeus/Jones/Butcher).
+int64_t easterSunday(int year) {
+	const int a = year % 19;
+	const int b = year / 100;
+	const int c = year % 100;
+	const int h = (19 * a + b - b / 4 - (b - (b + 8) / 25 + 1) / 3 + 15) % 30;
+	const int l = (32 + 2 * (b % 4) + 2 * (c / 4) - h - c % 4) % 7;
+	const int m = (a + 11 * h + 22 * l) / 451;
+	const unsigned month = static_cast<unsigned>((h + l - 7 * m + 114) / 31);
+	const unsigned day = static_cast<unsigned>((h + l - 7 * m + 114) % 31 + 1);
+	return Utils::daysFromCivil(year, month, day);
+}
+} // namespace
+
+ESPDateBusinessCalendar::~ESPDateBusinessCalendar() {
+	end();
+}
+
+bool ESPDateBusinessCalendar::addRule(const Rule &rule) {
+	if (ruleCount_ >= kMaxRules) {
+		return false;
+	}
+	rules_[ruleCount_++] = rule;
+	return true;
+}
+
+bool ESPDateBusinessCalendar::addFixedHoliday(int month, int day, ESPDateHolidayShift shift) {
+	if (month < 1 || month > 12 || day < 1 || day > Utils::daysInMonth(2000, month)) {
+		return false;
+	}
+	Rule rule;
+	rule.kind = kFixed;
+	rule.month = static_cast<uint8_t>(month);
+	rule.day = static_cast<int8_t>(day);
+	rule.shift = shift;
+	return addRule(rule);
+}
+
+bool ESPDateBusinessCalendar::addNthWeekdayHoliday(int month, int weekday, int n) {
+	if (month < 1 || month > 12 || weekday < 0 || weekday > 6 || n == 0 || n < -1 || n > 5) {
+		return false;
+	}
+	Rule rule;
+	rule.kind = kNthWeekday;
+	rule.month = static_cast<uint8_t>(month);
+	rule.day = static_cast<int8_t>(weekday);
+	rule.nth = static_cast<int8_t>(n);
+	return addRule(rule);
+}
+
+bool ESPDateBusinessCalendar::addEasterHoliday(int offsetDays) {
+	if (offsetDays < -366 || offsetDays > 366) {
+		return false;
+	}
+	Rule rule;
+	rule.kind = kEaster;
+	rule.offset = static_cast<int16_t>(offsetDays);
+	return addRule(rule);
+}
+
+void ESPDateBusinessCalendar::clearRules() {
+	ruleCount_ = 0;
+}
+
+bool ESPDateBusinessCalendar::begin(int firstYear, int yearCount, bool usePSRAMBuffers) {
+	end();
+	if (yearCount < 1 || yearCount > kMaxYears || firstYear < 1 ||
+	    firstYear + yearCount - 1 > 9999) {
+		return false;
+	}
+	const size_t wordCount = static_cast<size_t>(yearCount) * kWordsPerYear;
+	void *wordMemory =
+	    date_allocator_detail::heapAllocate(sizeof(uint64_t) * wordCount, usePSRAMBuffers);
+	void *rankMemory =
+	    date_allocator_detail::heapAllocate(sizeof(uint32_t) * (wordCount + 1), usePSRAMBuffers);
+	if (!wordMemory || !rankMemory) {
+		date_allocator_detail::heapDeallocate(wordMemory);
+		date_allocator_detail::heapDeallocate(rankMemory);
+		return false;
+	}
+	words_ = static_cast<uint64_t *>(wordMemory);
+	ranks_ = static_cast<uint32_t *>(rankMemory);
+	wordCount_ = wordCount;
+	firstYear_ = firstYear;
+	yearCount_ = yearCount;
+	firstDay_ = Utils::daysFromCivil(firstYear, 1, 1);
+	endDay_ = Utils::daysFromCivil(firstYear + yearCount, 1, 1);
+
+	// Working weekdays first; bits past the end of a year stay clear.
+	for (int y = 0; y < yearCount; ++y) {
+		uint64_t *slot = words_ + static_cast<size_t>(y) * kWordsPerYear;
+		const int64_t start = Utils::daysFromCivil(firstYear + y, 1, 1);
+		const uint32_t length = static_cast<uint32_t>(
+		    Utils::daysFromCivil(firstYear + y + 1, 1, 1) - start
+		);
+		for (int w = 0; w < kWordsPerYear; ++w) {
+			slot[w] = 0;
+		}
+		for (uint32_t d = 0; d < length; ++d) {
+			if (!((weekend_ >> Utils::weekdayFromDays(start + d)) & 1)) {
+				slot[d / 64] |= uint64_t{1} << (d % 64);
+			}
+		}
+	}
+
+	// Holidays that stay put, then the movable fixed dates in the order they were added so a
+	// substitute day can see the holidays it must step over. The neighbouring years count too:
+	// 1 January on a Saturday is observed on 31 December.
+	for (int pass = 0; pass < 2; ++pass) {
+		for (size_t r = 0; r < ruleCount_; ++r) {
+			const Rule &rule = rules_[r];
+			const bool shifted = rule.kind == kFixed && rule.shift != ESPDateHolidayShift::None;
+			if (shifted != (pass == 1)) {
+				continue;
+			}
+			for (int year = firstYear - 1; year <= firstYear + yearCount; ++year) {
+				int64_t day = 0;
+				if (year >= 1 && year <= 9999 && ruleDay(rule, year, day)) {
+					observe(rule, day);
+				}
+			}
+		}
+	}
+	recount(0);
+	return true;
+}
+
+void ESPDateBusinessCalendar::end() {
+	date_allocator_detail::heapDeallocate(words_);
+	date_allocator_detail::heapDeallocate(ranks_);
+	words_ = nullptr;
+	ranks_ = nullptr;
+	wordCount_ = 0;
+	firstYear_ = 0;
+	yearCount_ = 0;
+	firstDay_ = 0;
+	endDay_ = 0;
+}
+
+bool ESPDateBusinessCalendar::ruleDay(const Rule &rule, int year, int64_t &day) const {
+	if (rule.kind == kEaster) {
+		day = easterSunday(year) + rule.offset;
+		return true;
+	}
+	const int length = Utils::daysInMonth(year, rule.month);
+	int dayOfMonth = rule.day;
+	if (rule.kind == kNthWeekday) {
+		if (rule.nth > 0) {
+			const int first = Utils::weekdayFromDays(Utils::daysFromCivil(year, rule.month, 1));
+			dayOfMonth = 1 + (rule.day - first + 7) % 7 + 7 * (rule.nth - 1);
+		} else {
+			const int last = Utils::weekdayFromDays(
+			    Utils::daysFromCivil(year, rule.month, static_cast<unsigned>(length))
+			);
+			dayOfMonth = length - (last - rule.day + 7) % 7;
+		}
+	}
+	if (dayOfMonth > length) {
+		return false; // 29 February outside leap years, a fifth weekday that does not exist
+	}
+	day = Utils::daysFromCivil(year, rule.month, static_cast<unsigned>(dayOfMonth));
+	return true;
+}
+
+void ESPDateBusinessCalendar::observe(const Rule &rule, int64_t day) {
+	// Outside the range only the weekend is known.
+	auto working = [this](int64_t d) {
+		uint32_t position = 0;
+		if (bitPosition(d, position)) {
+			return ((words_[position / 64] >> (position % 64)) & 1) != 0;
+		}
+		return !((weekend_ >> Utils::weekdayFromDays(d)) & 1);
+	};
+	if (rule.shift != ESPDateHolidayShift::None && !working(day)) {
+		const int64_t original = day;
+		for (int distance = 1; distance <= 7; ++distance) {
+			if (working(original + distance)) {
+				day = original + distance;
+				break;
+			}
+			if (rule.shift == ESPDateHolidayShift::NearestWeekday &&
+			    working(original - distance)) {
+				day = original - distance;
+				break;
+			}
+		}
+	}
+	setBit(day, false);
+}
+
+void ESPDateBusinessCalendar::setBit(int64_t day, bool value) {
+	uint32_t position = 0;
+	if (!bitPosition(day, position)) {
+		return;
+	}
+	const uint64_t mask = uint64_t{1} << (position % 64);
+	if (value) {
+		words_[position / 64] |= mask;
+	} else {
+		words_[position / 64] &= ~mask;
+	}
+}
+
+void ESPDateBusinessCalendar::recount(size_t fromWord) {
+	if (fromWord == 0) {
+		ranks_[0] = 0;
+	}
+	for (size_t w = fromWord; w < wordCount_; ++w) {
+		ranks_[w + 1] = ranks_[w] + static_cast<uint32_t>(popcount(words_[w]));
+	}
+}
+
+bool ESPDateBusinessCalendar::setBusinessDay(int year, int month, int day, bool isBusinessDay) {
+	if (month < 1 || month > 12 || day < 1 || day > Utils::daysInMonth(year, month)) {
+		return false;
+	}
+	const int64_t days =
+	    Utils::daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day));
+	uint32_t position = 0;
+	if (!bitPosition(days, position)) {
+		return false;
+	}
+	setBit(days, isBusinessDay);
+	recount(position / 64);
+	return true;
+}
+
+bool ESPDateBusinessCalendar::covers(int64_t day) const {
+	return words_ && day >= firstDay_ && day < endDay_;
+}
+
+bool ESPDateBusinessCalendar::bitPosition(int64_t day, uint32_t &position) const {
+	if (!covers(day)) {
+		return false;
+	}
+	int year = 0;
+	unsigned month = 0;
+	unsigned dayOfMonth = 0;
+	Utils::civilFromDays(day, year, month, dayOfMonth);
+	position = static_cast<uint32_t>(year - firstYear_) * kBitsPerYear +
+	           static_cast<uint32_t>(day - Utils::daysFromCivil(year, 1, 1));
+	return true;
+}
+
+int64_t ESPDateBusinessCalendar::dayAt(uint32_t position) const {
+	const int year = firstYear_ + static_cast<int>(position / kBitsPerYear);
+	return Utils::daysFromCivil(year, 1, 1) + position % kBitsPerYear;
+}
+
+uint32_t ESPDateBusinessCalendar::rank(uint32_t position) const {
+	const size_t word = position / 64;
+	const uint32_t bit = position % 64;
+	if (bit == 0) {
+		return ranks_[word];
+	}
+	const uint64_t below = words_[word] & ((uint64_t{1} << bit) - 1);
+	return ranks_[word] + static_cast<uint32_t>(popcount(below));
+}
+
+bool ESPDateBusinessCalendar::select(uint32_t target, uint32_t &position) const {
+	if (target >= ranks_[wordCount_]) {
+		return false;
+	}
+	// Last word whose running count is <= target; it holds the bit.
+	size_t low = 0;
+	size_t high = wordCount_;
+	while (high - low > 1) {
+		const size_t middle = low + (high - low) / 2;
+		if (ranks_[middle] <= target) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	position = static_cast<uint32_t>(low * 64) + selectInWord(words_[low], target - ranks_[low]);
+	return true;
+}
+
+bool ESPDateBusinessCalendar::isBusinessDay(int64_t day) const {
+	uint32_t position = 0;
+	return bitPosition(day, position) && ((words_[position / 64] >> (position % 64)) & 1) != 0;
+}
+
+bool ESPDateBusinessCalendar::isBusinessDay(int year, int month, int day) const {
+	if (month < 1 || month > 12 || day < 1 || day > Utils::daysInMonth(year, month)) {
+		return false;
+	}
+	return isBusinessDay(
+	    Utils::daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day))
+	);
+}
+
+bool ESPDateBusinessCalendar::businessDaysBetween(
+    int64_t fromDay, int64_t toDay, int32_t &count
+) const {
+	// The day after the range is a valid exclusive end.
+	auto rankOf = [this](int64_t day, uint32_t &out) {
+		uint32_t position = 0;
+		if (words_ && day == endDay_) {
+			out = ranks_[wordCount_];
+			return true;
+		}
+		if (!bitPosition(day, position)) {
+			return false;
+		}
+		out = rank(position);
+		return true;
+	};
+	uint32_t fromRank = 0;
+	uint32_t toRank = 0;
+	if (!rankOf(fromDay, fromRank) || !rankOf(toDay, toRank)) {
+		return false;
+	}
+	count = static_cast<int32_t>(toRank) - static_cast<int32_t>(fromRank);
+	return true;
+}
+
+bool ESPDateBusinessCalendar::addBusinessDays(int64_t day, int32_t days, int64_t &result) const {
+	uint32_t position = 0;
+	if (!bitPosition(day, position)) {
+		return false;
+	}
+	// rank(position) business days come before `day`.
+	int64_t target = rank(position);
+	if (days > 0) {
+		const bool open = ((words_[position / 64] >> (position % 64)) & 1) != 0;
+		target += (open ? 1 : 0) + days - 1;
+	} else {
+		target += days;
+	}
+	if (target < 0 || target > UINT32_MAX || !select(static_cast<uint32_t>(target), position)) {
+		return false;
+	}
+	result = dayAt(position);
+	return true;
+}
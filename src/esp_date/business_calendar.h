@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// How a fixed-date holiday that falls on a non-working day is observed.
+enum class ESPDateHolidayShift : uint8_t {
+	None,           // not moved; the day is lost
+	NearestWeekday, // closest working day, later one on a tie (US: Sat -> Fri, Sun -> Mon)
+	NextWorkingDay, // next day still working, after other holidays (UK substitute days)
+};
+
+// Working-day calendar: weekend days plus holiday rules, expanded by begin() into one bit per
+// day for a range of years. Each year takes a 384-bit slot (6 words, bit n = day n of the year)
+// and a running popcount per word, so membership, counting and offsetting are a couple of
+// popcounts whatever the span, instead of a day-by-day walk. About 72 bytes per year.
+//
+// Day numbers are days since 1970-01-01 (local calendar dates, no time zone involved); the
+// ESPDate overloads map DateTime values to them in the process TZ. Queries outside the built
+// range fail (return false) rather than guess.
+//
+//   ESPDateBusinessCalendar calendar;
+//   calendar.addFixedHoliday(1, 1, ESPDateHolidayShift::NearestWeekday);
+//   calendar.addNthWeekdayHoliday(11, 4, 4); // fourth Thursday of November
+//   calendar.addEasterHoliday(1);            // Easter Monday
+//   calendar.begin(2020, 20);
+class ESPDateBusinessCalendar {
+  public:
+	static constexpr size_t kMaxRules = 32;
+	static constexpr int kMaxYears = 400;
+	static constexpr int kWordsPerYear = 6; // 384 bits >= 366 days
+
+	ESPDateBusinessCalendar() = default;
+	~ESPDateBusinessCalendar();
+	ESPDateBusinessCalendar(const ESPDateBusinessCalendar &) = delete;
+	ESPDateBusinessCalendar &operator=(const ESPDateBusinessCalendar &) = delete;
+
+	// Rules take effect at the next begin(). Weekend bit w = weekday w (0 = Sunday) is off;
+	// the default is Saturday and Sunday.
+	void setWeekend(uint8_t weekdayMask) {
+		weekend_ = weekdayMask & 0x7f;
+	}
+	// All return false when the rule is out of range or kMaxRules are already set.
+	bool
+	addFixedHoliday(int month, int day, ESPDateHolidayShift shift = ESPDateHolidayShift::None);
+	// n = 1..5 counts from the start of the month (5 = fifth, skipped in months with four);
+	// n = -1 is the last such weekday.
+	bool addNthWeekdayHoliday(int month, int weekday, int n);
+	// Western (Gregorian) Easter Sunday plus offsetDays: -2 Good Friday, 1 Easter Monday,
+	// 39 Ascension, 50 Whit Monday.
+	bool addEasterHoliday(int offsetDays);
+	void clearRules();
+
+	// Expands the rules for [firstYear, firstYear + yearCount). Drops earlier exceptions.
+	// Returns false on a bad range (years 1..9999, at most kMaxYears) or allocation failure.
+	bool begin(int firstYear, int yearCount, bool usePSRAMBuffers = false);
+	void end();
+	bool isReady() const {
+		return words_ != nullptr;
+	}
+	int firstYear() const {
+		return firstYear_;
+	}
+	int yearCount() const {
+		return yearCount_;
+	}
+
+	// One-off exception on top of the rules (a bridge day off, a working Saturday). Costs
+	// O(years) to refresh the counts, so it belongs to setup. False outside the range.
+	bool setBusinessDay(int year, int month, int day, bool isBusinessDay);
+
+	bool covers(int64_t day) const;
+	bool isBusinessDay(int64_t day) const; // false outside the range as well
+	bool isBusinessDay(int year, int month, int day) const;
+	// Business days in [fromDay, toDay); negative when toDay < fromDay. toDay may be the day
+	// after the range.
+	bool businessDaysBetween(int64_t fromDay, int64_t toDay, int32_t &count) const;
+	// days > 0: the days-th business day after `day`; days < 0: before it; 0: `day` itself when
+	// it is a business day, else the next one. False when the answer leaves the range.
+	bool addBusinessDays(int64_t day, int32_t days, int64_t &result) const;
+
+  private:
+	struct Rule {
+		uint8_t kind = 0;
+		uint8_t month = 0;
+		int8_t day = 0; // day of month, or weekday
+		int8_t nth = 0;
+		int16_t offset = 0;
+		ESPDateHolidayShift shift = ESPDateHolidayShift::None;
+	};
+
+	bool addRule(const Rule &rule);
+	bool ruleDay(const Rule &rule, int year, int64_t &day) const;
+	void observe(const Rule &rule, int64_t day);
+	void setBit(int64_t day, bool value);
+	bool bitPosition(int64_t day, uint32_t &position) const;
+	int64_t dayAt(uint32_t position) const;
+	uint32_t rank(uint32_t position) const;
+	bool select(uint32_t rank, uint32_t &position) const;
+	void recount(size_t fromWord);
+
+	Rule rules_[kMaxRules];
+	size_t ruleCount_ = 0;
+	uint8_t weekend_ = 0x41; // Sunday, Saturday
+	uint64_t *words_ = nullptr;
+	uint32_t *ranks_ = nullptr; // ranks_[w] = set bits in words [0, w); wordCount_ + 1 entries
+	size_t wordCount_ = 0;
+	int firstYear_ = 0;
+	int yearCount_ = 0;
+	int64_t firstDay_ = 0;
+	int64_t endDay_ = 0; // first day after the range
+};
@@ -0,0 +1,330 @@
+#include "checkpoint.h"
+#include "date.h"
+#include "utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <sys/time.h>
+#endif
+
+#if ESPDATE_HAS_RTC_CHECKPOINT_STORE
+#include <esp_attr.h>
+#endif
+#if ESPDATE_HAS_NVS_CHECKPOINT_STORE
+#include <nvs.h>
+#endif
+#if ESPDATE_HAS_DEFERRED_CHECKPOINT
+#include <freertos/FreeRTOS.h>
+#include <freertos/timers.h>
+#endif
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr uint32_t kCheckpointMagic = 0x43544445; // "EDTC"
+constexpr uint8_t kCheckpointVersion = 1;
+// Error growth assumed while the device was down; covers the RC slow clock used in deep sleep.
+constexpr double kDowntimeUncertaintyPpm = 1000.0;
+// Error growth assumed after a restore, before NTP characterises the oscillator again.
+constexpr double kRestoredDriftUncertaintyPpm = 50.0;
+
+void putU32(uint8_t *out, uint32_t value) {
+	for (int i = 0; i < 4; ++i) {
+		out[i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+}
+
+void putI64(uint8_t *out, int64_t value) {
+	const uint64_t raw = static_cast<uint64_t>(value);
+	for (int i = 0; i < 8; ++i) {
+		out[i] = static_cast<uint8_t>(raw >> (8 * i));
+	}
+}
+
+uint32_t getU32(const uint8_t *in) {
+	uint32_t value = 0;
+	for (int i = 0; i < 4; ++i) {
+		value |= static_cast<uint32_t>(in[i]) << (8 * i);
+	}
+	return value;
+}
+
+int64_t getI64(const uint8_t *in) {
+	uint64_t raw = 0;
+	for (int i = 0; i < 8; ++i) {
+		raw |= static_cast<uint64_t>(in[i]) << (8 * i);
+	}
+	return static_cast<int64_t>(raw);
+}
+
+uint32_t crc32(const uint8_t *data, size_t size) {
+	uint32_t crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < size; ++i) {
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; ++bit) {
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+		}
+	}
+	return ~crc;
+}
+
+int64_t scalePpm(int64_t elapsedUs, double ppm) {
+	return static_cast<int64_t>(std::llround(static_cast<double>(elapsedUs) * ppm / 1000000.0));
+}
+
+#if ESPDATE_HAS_RTC_CHECKPOINT_STORE
+RTC_NOINIT_ATTR uint8_t rtcCheckpointBlob[ESPDateCheckpointStore::kBlobSize];
+#endif
+} // namespace
+
+// Layout: magic u32 | version u8 | reserved[3] | epochUs i64 | errorBoundUs i64 |
+// drift (parts per billion) i32 | crc32 u32, all little-endian.
+void ESPDateCheckpointStore::encode(
+    const ESPDateTimeCheckpoint &checkpoint, uint8_t (&out)[kBlobSize]
+) {
+	std::memset(out, 0, kBlobSize);
+	putU32(out, kCheckpointMagic);
+	out[4] = kCheckpointVersion;
+	putI64(out + 8, checkpoint.epochUs);
+	putI64(out + 16, checkpoint.errorBoundUs);
+	const int32_t driftPpb = static_cast<int32_t>(std::lround(checkpoint.driftPpm * 1000.0f));
+	putU32(out + 24, static_cast<uint32_t>(driftPpb));
+	putU32(out + 28, crc32(out, 28));
+}
+
+bool ESPDateCheckpointStore::decode(const uint8_t (&data)[kBlobSize], ESPDateTimeCheckpoint &out) {
+	if (getU32(data) != kCheckpointMagic || data[4] != kCheckpointVersion ||
+	    getU32(data + 28) != crc32(data, 28)) {
+		return false;
+	}
+	out.epochUs = getI64(data + 8);
+	out.errorBoundUs = getI64(data + 16);
+	out.driftPpm = static_cast<float>(static_cast<int32_t>(getU32(data + 24))) / 1000.0f;
+	return true;
+}
+
+bool ESPDateFileCheckpointStore::read(uint8_t *data, size_t size) {
+	if (!path_ || !data) {
+		return false;
+	}
+	FILE *file = std::fopen(path_, "rb");
+	if (!file) {
+		return false;
+	}
+	const size_t got = std::fread(data, 1, size, file);
+	std::fclose(file);
+	return got == size;
+}
+
+bool ESPDateFileCheckpointStore::write(const uint8_t *data, size_t size) {
+	if (!path_ || !data) {
+		return false;
+	}
+	FILE *file = std::fopen(path_, "wb");
+	if (!file) {
+		return false;
+	}
+	const size_t put = std::fwrite(data, 1, size, file);
+	const bool closed = std::fclose(file) == 0;
+	return put == size && closed;
+}
+
+#if ESPDATE_HAS_RTC_CHECKPOINT_STORE
+bool ESPDateRtcCheckpointStore::read(uint8_t *data, size_t size) {
+	if (!data || size > kBlobSize) {
+		return false;
+	}
+	std::memcpy(data, rtcCheckpointBlob, size);
+	return true;
+}
+
+bool ESPDateRtcCheckpointStore::write(const uint8_t *data, size_t size) {
+	if (!data || size > kBlobSize) {
+		return false;
+	}
+	std::memcpy(rtcCheckpointBlob, data, size);
+	return true;
+}
+#endif
+
+#if ESPDATE_HAS_NVS_CHECKPOINT_STORE
+bool ESPDateNvsCheckpointStore::read(uint8_t *data, size_t size) {
+	nvs_handle_t handle;
+	if (!data || nvs_open(namespace_, NVS_READONLY, &handle) != ESP_OK) {
+		return false;
+	}
+	size_t length = size;
+	const esp_err_t err = nvs_get_blob(handle, key_, data, &length);
+	nvs_close(handle);
+	return err == ESP_OK && length == size;
+}
+
+bool ESPDateNvsCheckpointStore::write(const uint8_t *data, size_t size) {
+	nvs_handle_t handle;
+	if (!data || nvs_open(namespace_, NVS_READWRITE, &handle) != ESP_OK) {
+		return false;
+	}
+	esp_err_t err = nvs_set_blob(handle, key_, data, size);
+	if (err == ESP_OK) {
+		err = nvs_commit(handle);
+	}
+	nvs_close(handle);
+	return err == ESP_OK;
+}
+#endif
+
+bool ESPDate::checkpointTime() {
+	if (!checkpointStore_) {
+		return false;
+	}
+	const ESPDateTimeEstimate estimate = timeEstimate();
+	if (estimate.quality == ESPDateTimeQuality::Unset) {
+		return false;
+	}
+	ESPDateTimeCheckpoint checkpoint;
+	checkpoint.epochUs = estimate.epochUs;
+	checkpoint.errorBoundUs = estimate.errorBoundUs;
+	checkpoint.driftPpm = static_cast<float>(clockDiscipline_.driftPpm());
+
+	uint8_t blob[ESPDateCheckpointStore::kBlobSize];
+	ESPDateCheckpointStore::encode(checkpoint, blob);
+	if (!checkpointStore_->write(blob, sizeof(blob))) {
+		return false;
+	}
+	hasCheckpoint_ = true;
+	checkpointMonotonicUs_ = monotonicMicros();
+	checkpointClockOffsetUs_ = wallClockOffsetUs();
+	syncClockOffsetUs_ = checkpointClockOffsetUs_; // the next sync step starts from here
+	hasSyncClockOffset_ = true;
+	return true;
+}
+
+std::atomic<ESPDate *> ESPDate::pendingCheckpointOwner_{nullptr};
+
+bool ESPDate::checkpointDue() const {
+	if (!hasCheckpoint_) {
+		return true;
+	}
+	const int64_t ageUs = monotonicMicros() - checkpointMonotonicUs_;
+	const int64_t stepUs = wallClockOffsetUs() - checkpointClockOffsetUs_;
+	return ageUs >= static_cast<int64_t>(checkpointIntervalMs_) * 1000 ||
+	       stepUs >= kCheckpointStepUs || stepUs <= -kCheckpointStepUs;
+}
+
+void ESPDate::requestCheckpoint() {
+#if ESPDATE_HAS_DEFERRED_CHECKPOINT
+	// Runs from the SNTP callback in the tcpip task: leave the flash write to the timer service
+	// task. One request is queued at a time; a failed queue leaves the next sync to retry.
+	ESPDate *expected = nullptr;
+	if (!pendingCheckpointOwner_.compare_exchange_strong(expected, this)) {
+		return;
+	}
+	if (xTimerPendFunctionCall(&ESPDate::runPendingCheckpoint, nullptr, 0, 0) != pdPASS) {
+		pendingCheckpointOwner_.store(nullptr);
+	}
+#else
+	checkpointTime();
+#endif
+}
+
+void ESPDate::runPendingCheckpoint(void *, uint32_t) {
+	ESPDate *owner = pendingCheckpointOwner_.exchange(nullptr);
+	if (owner) {
+		owner->checkpointTime();
+	}
+}
+
+bool ESPDate::restoreFromCheckpoint(int64_t elapsedHintUs) {
+	return restoreCheckpoint(now().epochSeconds * Utils::kMicrosPerSecond, elapsedHintUs);
+}
+
+bool ESPDate::restoreCheckpoint(int64_t systemNowUs, int64_t elapsedHintUs) {
+	if (!checkpointStore_) {
+		return false;
+	}
+	uint8_t blob[ESPDateCheckpointStore::kBlobSize];
+	ESPDateTimeCheckpoint checkpoint;
+	if (!checkpointStore_->read(blob, sizeof(blob)) ||
+	    !ESPDateCheckpointStore::decode(blob, checkpoint)) {
+		return false;
+	}
+
+	int64_t estimateUs = 0;
+	int64_t elapsedUs = 0;
+	bool bounded = checkpoint.errorBoundUs >= 0;
+	const bool clockSurvived = systemNowUs >= checkpoint.epochUs;
+	if (clockSurvived) {
+		// Deep sleep and software resets keep the RTC-backed system clock running.
+		estimateUs = systemNowUs;
+		elapsedUs = systemNowUs - checkpoint.epochUs;
+	} else {
+		// Cold boot: the downtime is only known if the caller tells us.
+		elapsedUs = elapsedHintUs > 0 ? elapsedHintUs : 0;
+		estimateUs = checkpoint.epochUs + elapsedUs;
+		bounded = bounded && elapsedHintUs > 0;
+	}
+
+	// The stored checkpoint is elapsedUs old; the next sync only rewrites it when it is due.
+	hasCheckpoint_ = true;
+	checkpointMonotonicUs_ = monotonicMicros() - elapsedUs;
+	hasRestoredTime_ = true;
+	restoredEpochUs_ = estimateUs;
+	restoredMonotonicUs_ = monotonicMicros();
+	restoredErrorBoundUs_ =
+	    bounded ? checkpoint.errorBoundUs + scalePpm(elapsedUs, kDowntimeUncertaintyPpm) : -1;
+	clockDiscipline_.seedDriftPpm(checkpoint.driftPpm);
+
+#if !defined(_WIN32)
+	if (restoreSystemClock_ && !clockSurvived) {
+		timeval tv{};
+		tv.tv_sec = static_cast<time_t>(Utils::floorDiv(estimateUs, Utils::kMicrosPerSecond));
+		tv.tv_usec = static_cast<suseconds_t>(estimateUs - tv.tv_sec * Utils::kMicrosPerSecond);
+		settimeofday(&tv, nullptr);
+		coarseClock_.invalidate();
+	}
+#endif
+	checkpointClockOffsetUs_ = wallClockOffsetUs();
+	return true;
+}
+
+ESPDateTimeQuality ESPDate::timeQuality() const {
+	if (hasLastNtpSync_) {
+		return ESPDateTimeQuality::Synced;
+	}
+	if (hasRestoredTime_) {
+		return ESPDateTimeQuality::Restored;
+	}
+	return ESPDateTimeQuality::Unset;
+}
+
+ESPDateTimeEstimate ESPDate::timeEstimate() const {
+	ESPDateTimeEstimate estimate;
+	estimate.quality = timeQuality();
+	switch (estimate.quality) {
+	case ESPDateTimeQuality::Synced:
+		estimate.epochUs = disciplinedNowUs();
+		estimate.errorBoundUs = timeSyncStats().errorBoundUs;
+		break;
+	case ESPDateTimeQuality::Restored: {
+		int64_t elapsedUs = monotonicMicros() - restoredMonotonicUs_;
+		if (elapsedUs < 0) {
+			elapsedUs = 0;
+		}
+		estimate.epochUs = restoredEpochUs_ + elapsedUs -
+		                   scalePpm(elapsedUs, clockDiscipline_.driftPpm());
+		estimate.errorBoundUs =
+		    restoredErrorBoundUs_ < 0
+		        ? -1
+		        : restoredErrorBoundUs_ + scalePpm(elapsedUs, kRestoredDriftUncertaintyPpm);
+		break;
+	}
+	case ESPDateTimeQuality::Unset:
+		estimate.epochUs = now().epochSeconds * Utils::kMicrosPerSecond;
+		break;
+	}
+	estimate.value = DateTime{Utils::floorDiv(estimate.epochUs, Utils::kMicrosPerSecond)};
+	return estimate;
+}
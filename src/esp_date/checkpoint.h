@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum class ESPDateTimeQuality {
+	Unset,    // nothing known; now() is whatever the system clock says
+	Restored, // estimated from a checkpoint, not confirmed by NTP yet
+	Synced    // confirmed by at least one NTP sync since init
+};
+
+struct ESPDateTimeCheckpoint {
+	int64_t epochUs = 0;      // last known good UTC, microseconds since epoch
+	int64_t errorBoundUs = 0; // uncertainty of epochUs when it was saved
+	float driftPpm = 0.0f;    // oscillator estimate carried over to the next boot
+};
+
+// Byte-oriented persistence backend for ESPDateTimeCheckpoint blobs.
+// ESPDate owns encoding and validation; a store only keeps the bytes.
+class ESPDateCheckpointStore {
+  public:
+	static constexpr size_t kBlobSize = 32;
+
+	virtual ~ESPDateCheckpointStore() = default;
+	virtual bool read(uint8_t *data, size_t size) = 0;
+	virtual bool write(const uint8_t *data, size_t size) = 0;
+
+	static void encode(const ESPDateTimeCheckpoint &checkpoint, uint8_t (&out)[kBlobSize]);
+	static bool decode(const uint8_t (&data)[kBlobSize], ESPDateTimeCheckpoint &out);
+};
+
+// Plain file (host builds, or a mounted SPIFFS/LittleFS path on device).
+class ESPDateFileCheckpointStore : public ESPDateCheckpointStore {
+  public:
+	explicit ESPDateFileCheckpointStore(const char *path) : path_(path) {
+	}
+	bool read(uint8_t *data, size_t size) override;
+	bool write(const uint8_t *data, size_t size) override;
+
+  private:
+	const char *path_;
+};
+
+#if defined(__has_include)
+#if __has_include(<esp_attr.h>)
+#define ESPDATE_HAS_RTC_CHECKPOINT_STORE 1
+#endif
+#if __has_include(<nvs.h>)
+#define ESPDATE_HAS_NVS_CHECKPOINT_STORE 1
+#endif
+#if __has_include(<freertos/timers.h>)
+#define ESPDATE_HAS_DEFERRED_CHECKPOINT 1
+#endif
+#endif
+#ifndef ESPDATE_HAS_RTC_CHECKPOINT_STORE
+#define ESPDATE_HAS_RTC_CHECKPOINT_STORE 0
+#endif
+#ifndef ESPDATE_HAS_NVS_CHECKPOINT_STORE
+#define ESPDATE_HAS_NVS_CHECKPOINT_STORE 0
+#endif
+// Device builds hand sync-triggered checkpoint writes to the FreeRTOS timer service task, so
+// the SNTP callback never waits on flash; host builds write inline.
+#ifndef ESPDATE_HAS_DEFERRED_CHECKPOINT
+#define ESPDATE_HAS_DEFERRED_CHECKPOINT 0
+#endif
+
+#if ESPDATE_HAS_RTC_CHECKPOINT_STORE
+// RTC slow memory: survives deep sleep and software resets, not power loss.
+class ESPDateRtcCheckpointStore : public ESPDateCheckpointStore {
+  public:
+	bool read(uint8_t *data, size_t size) override;
+	bool write(const uint8_t *data, size_t size) override;
+};
+#endif
+
+#if ESPDATE_HAS_NVS_CHECKPOINT_STORE
+// NVS blob: survives power loss. Keep checkpoints infrequent to spare flash.
+class ESPDateNvsCheckpointStore : public ESPDateCheckpointStore {
+  public:
+	explicit ESPDateNvsCheckpointStore(
+	    const char *nvsNamespace = "espdate", const char *key = "ckpt"
+	)
+	    : namespace_(nvsNamespace), key_(key) {
+	}
+	bool read(uint8_t *data, size_t size) override;
+	bool write(const uint8_t *data, size_t size) override;
+
+  private:
+	const char *namespace_;
+	const char *key_;
+};
+#endif
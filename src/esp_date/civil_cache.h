@@ -0,0 +1,50 @@
+#pragma once
+
+#include "posix_tz.h"
+#include "utils.h"
+
+#include <limits>
+
+// Internal helpers shared by the bulk paths (batch conversions, log rewriting) that convert
+// long runs of nearby instants.
+
+// Calendar fields of the last day seen; sorted input hits it for every stamp but the first
+// of each day.
+struct ESPDateDayCache {
+	bool valid = false;
+	int64_t days = 0;
+	int year = 0;
+	unsigned month = 0;
+	unsigned day = 0;
+	int weekday = 0;
+
+	void load(int64_t localDays) {
+		if (valid && localDays == days) {
+			return;
+		}
+		ESPDateUtils::civilFromDays(localDays, year, month, day);
+		weekday = ESPDateUtils::weekdayFromDays(localDays);
+		days = localDays;
+		valid = true;
+	}
+};
+
+// Walks a zone's offsets, re-evaluating the rules only when a stamp leaves the current span.
+class ESPDateOffsetCursor {
+  public:
+	explicit ESPDateOffsetCursor(const ESPDatePosixTz &zone) : zone_(zone) {
+	}
+
+	int32_t at(int64_t utcSeconds) {
+		if (utcSeconds < validFrom_ || utcSeconds >= validUntil_) {
+			offset_ = zone_.utcOffsetAt(utcSeconds, validFrom_, validUntil_);
+		}
+		return offset_;
+	}
+
+  private:
+	const ESPDatePosixTz &zone_;
+	int32_t offset_ = 0;
+	int64_t validFrom_ = std::numeric_limits<int64_t>::max(); // empty until the first lookup
+	int64_t validUntil_ = std::numeric_limits<int64_t>::min();
+};
@@ -0,0 +1,171 @@
+#include "clock_discipline.h"
+
+#include <cmath>
+
+namespace {
+constexpr double kMicrosPerSecond = 1000000.0;
+constexpr double kMaxDriftPpm = 1000.0;     // reject estimates beyond any sane crystal error
+constexpr int64_t kMinDriftSpanUs = 1000000; // need at least 1 s between samples to fit a slope
+
+int64_t scalePpm(int64_t elapsedUs, double ppm) {
+	return static_cast<int64_t>(std::llround(static_cast<double>(elapsedUs) * ppm / 1000000.0));
+}
+} // namespace
+
+void ESPDateClockDiscipline::configure(const ESPDateClockDisciplineConfig &config) {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	model_.config = config;
+	publish();
+}
+
+void ESPDateClockDiscipline::reset() {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	for (size_t i = 0; i < kMaxSamples; ++i) {
+		samples_[i] = Sample{};
+	}
+	nextSample_ = 0;
+	const ESPDateClockDisciplineConfig config = model_.config;
+	model_ = Model{};
+	model_.config = config;
+	publish();
+}
+
+int64_t ESPDateClockDiscipline::addSample(int64_t monotonicUs, int64_t referenceUs) {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	Model &model = model_;
+	int64_t error = 0;
+	if (model.sampleCount == 0) {
+		model.anchorUs = referenceUs;
+		model.pendingUs = 0;
+	} else {
+		const int64_t predicted = nowUs(model, monotonicUs);
+		error = referenceUs - predicted;
+		model.anchorUs = predicted;
+		model.pendingUs = error;
+		if (model.config.stepThresholdUs > 0 && error > model.config.stepThresholdUs) {
+			model.anchorUs = referenceUs;
+			model.pendingUs = 0;
+		}
+	}
+	model.anchorMonotonicUs = monotonicUs;
+	model.lastErrorUs = error;
+
+	samples_[nextSample_] = Sample{monotonicUs, referenceUs - monotonicUs};
+	nextSample_ = (nextSample_ + 1) % kMaxSamples;
+	if (model.sampleCount < kMaxSamples) {
+		++model.sampleCount;
+	}
+	estimateDrift();
+	publish();
+	return error;
+}
+
+void ESPDateClockDiscipline::seedDriftPpm(double driftPpm) {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	if (model_.sampleCount >= 2 || !std::isfinite(driftPpm) ||
+	    std::fabs(driftPpm) > kMaxDriftPpm) {
+		return;
+	}
+	model_.driftPpm = driftPpm;
+	publish();
+}
+
+bool ESPDateClockDiscipline::nowUs(int64_t monotonicUs, int64_t &utcUs) const {
+	const Model copy = model();
+	if (copy.sampleCount == 0) {
+		return false;
+	}
+	utcUs = nowUs(copy, monotonicUs);
+	return true;
+}
+
+int64_t ESPDateClockDiscipline::pendingCorrectionUs(int64_t monotonicUs) const {
+	const Model copy = model();
+	int64_t elapsed = monotonicUs - copy.anchorMonotonicUs;
+	if (elapsed < 0) {
+		elapsed = 0;
+	}
+	return copy.pendingUs - slewedUs(copy, elapsed);
+}
+
+ESPDateClockDiscipline::Model ESPDateClockDiscipline::model() const {
+	// An odd count means published_[0] is being written, an even one published_[1]; the other
+	// copy is stable, so a retry needs a writer to make progress, not to finish.
+	Model copy;
+	for (;;) {
+		const uint32_t before = sequence_.load(std::memory_order_acquire);
+		copy = published_[before & 1u];
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sequence_.load(std::memory_order_relaxed) == before) {
+			return copy;
+		}
+	}
+}
+
+void ESPDateClockDiscipline::publish() {
+	sequence_.fetch_add(1, std::memory_order_relaxed); // odd: readers use published_[1]
+	std::atomic_thread_fence(std::memory_order_release);
+	published_[0] = model_;
+	sequence_.fetch_add(1, std::memory_order_release); // even: readers use published_[0]
+	std::atomic_thread_fence(std::memory_order_release);
+	published_[1] = model_;
+}
+
+int64_t ESPDateClockDiscipline::nowUs(const Model &model, int64_t monotonicUs) {
+	if (model.sampleCount == 0) {
+		return 0;
+	}
+	int64_t elapsed = monotonicUs - model.anchorMonotonicUs;
+	if (elapsed < 0) {
+		elapsed = 0;
+	}
+	return model.anchorUs + elapsed + scalePpm(elapsed, -model.driftPpm) +
+	       slewedUs(model, elapsed);
+}
+
+int64_t ESPDateClockDiscipline::slewedUs(const Model &model, int64_t elapsedUs) {
+	const int64_t budget = scalePpm(elapsedUs, static_cast<double>(model.config.maxSlewPpm));
+	if (model.pendingUs > budget) {
+		return budget;
+	}
+	if (model.pendingUs < -budget) {
+		return -budget;
+	}
+	return model.pendingUs;
+}
+
+// Called with writeMutex_ held.
+void ESPDateClockDiscipline::estimateDrift() {
+	if (model_.sampleCount < 2) {
+		return;
+	}
+	// Oldest sample sits at nextSample_ once the ring is full, at 0 before that.
+	const size_t oldest = (model_.sampleCount == kMaxSamples) ? nextSample_ : 0;
+	const Sample &origin = samples_[oldest];
+	const size_t newest = (nextSample_ + kMaxSamples - 1) % kMaxSamples;
+	if (samples_[newest].monotonicUs - origin.monotonicUs < kMinDriftSpanUs) {
+		return;
+	}
+
+	// Least-squares slope of offset (us) over monotonic time (s) is directly in ppm.
+	double sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+	for (size_t i = 0; i < model_.sampleCount; ++i) {
+		const Sample &s = samples_[(oldest + i) % kMaxSamples];
+		const double x = static_cast<double>(s.monotonicUs - origin.monotonicUs) / kMicrosPerSecond;
+		const double y = static_cast<double>(s.offsetUs - origin.offsetUs);
+		sumX += x;
+		sumY += y;
+		sumXX += x * x;
+		sumXY += x * y;
+	}
+	const double n = static_cast<double>(model_.sampleCount);
+	const double denominator = n * sumXX - sumX * sumX;
+	if (denominator <= 0.0) {
+		return;
+	}
+	const double slope = (n * sumXY - sumX * sumY) / denominator;
+	if (!std::isfinite(slope) || std::fabs(slope) > kMaxDriftPpm) {
+		return;
+	}
+	model_.driftPpm = -slope;
+}
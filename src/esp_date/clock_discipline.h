@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ESPDateClockDisciplineConfig {
+	uint32_t maxSlewPpm = 500;   // max extra rate used to absorb a sync error (500 ppm = 0.5 ms/s)
+	int64_t stepThresholdUs = 0; // forward errors above this are stepped; 0 always slews
+};
+
+// Disciplines a monotonic clock against sparse reference samples (SNTP syncs).
+// Output never steps backwards: errors are slewed out at maxSlewPpm while the
+// estimated oscillator drift is applied as a rate correction between syncs.
+// All inputs are explicit so the model can be driven by simulated clocks.
+// Writers (addSample from the SNTP callback, configure, reset, seedDriftPpm) serialize on a
+// mutex and publish the model into two copies in turn, as ESPDateSyncHealth does; readers on
+// other tasks copy a stable one and never see the anchor of one sync with the slew of another.
+class ESPDateClockDiscipline {
+  public:
+	static constexpr size_t kMaxSamples = 8;
+
+	void configure(const ESPDateClockDisciplineConfig &config);
+	void reset();
+
+	// Records a reference sample: referenceUs is true UTC (microseconds since epoch)
+	// observed when the local monotonic clock read monotonicUs.
+	// Returns the prediction error (reference - disciplined time) at that instant.
+	int64_t addSample(int64_t monotonicUs, int64_t referenceUs);
+
+	bool hasSamples() const {
+		return model().sampleCount > 0;
+	}
+	size_t sampleCount() const {
+		return model().sampleCount;
+	}
+	// Seeds the extrapolation drift until two samples allow a fit (e.g. from a checkpoint).
+	void seedDriftPpm(double driftPpm);
+
+	// Disciplined UTC in microseconds for a monotonic reading. 0 before the first sample.
+	int64_t nowUs(int64_t monotonicUs) const {
+		return nowUs(model(), monotonicUs);
+	}
+	// Same, but false before the first sample, read from one snapshot of the model.
+	bool nowUs(int64_t monotonicUs, int64_t &utcUs) const;
+	// Estimated oscillator frequency error; positive means the local clock runs fast.
+	double driftPpm() const {
+		return model().driftPpm;
+	}
+	// Part of the last sync error that has not been slewed out yet.
+	int64_t pendingCorrectionUs(int64_t monotonicUs) const;
+	// Prediction error measured by the most recent addSample().
+	int64_t lastErrorUs() const {
+		return model().lastErrorUs;
+	}
+	int64_t lastSampleMonotonicUs() const {
+		return model().anchorMonotonicUs;
+	}
+	ESPDateClockDisciplineConfig config() const {
+		return model().config;
+	}
+
+  private:
+	struct Sample {
+		int64_t monotonicUs = 0;
+		int64_t offsetUs = 0; // reference - monotonic
+	};
+
+	// Everything readers need, published as one unit.
+	struct Model {
+		ESPDateClockDisciplineConfig config{};
+		size_t sampleCount = 0;
+		int64_t anchorMonotonicUs = 0;
+		int64_t anchorUs = 0;
+		int64_t pendingUs = 0;
+		int64_t lastErrorUs = 0;
+		double driftPpm = 0.0;
+	};
+
+	Model model() const;
+	void publish();
+	static int64_t nowUs(const Model &model, int64_t monotonicUs);
+	static int64_t slewedUs(const Model &model, int64_t elapsedUs);
+	void estimateDrift();
+
+	std::mutex writeMutex_;
+	// Writer-owned, under writeMutex_.
+	Model model_{};
+	Sample samples_[kMaxSamples]{};
+	size_t nextSample_ = 0;
+	std::atomic<uint32_t> sequence_{0};
+	Model published_[2]{};
+};
@@ -0,0 +1,60 @@
+#include "coarse_clock.h"
+
+// One attempt only: an odd count or a count that moved means a publish overlapped the copy,
+// and the caller is better off reading the clock than waiting for a writer that may have been
+// preempted by this very task.
+bool ESPDateCoarseClock::read(int64_t monotonicUs, ESPDateCoarseSample &out) const {
+	const uint32_t before = sequence_.load(std::memory_order_acquire);
+	if (before & 1u) {
+		return false;
+	}
+	const bool valid = valid_;
+	const uint32_t sampleGeneration = sampleGeneration_;
+	out = sample_;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return sequence_.load(std::memory_order_relaxed) == before && valid &&
+	       current(monotonicUs, out.expiresUs, sampleGeneration);
+}
+
+bool ESPDateCoarseClock::readSeconds(int64_t monotonicUs, int64_t &epochSeconds) const {
+	const uint32_t before = sequence_.load(std::memory_order_acquire);
+	if (before & 1u) {
+		return false;
+	}
+	const bool valid = valid_;
+	const uint32_t sampleGeneration = sampleGeneration_;
+	const int64_t expiresUs = sample_.expiresUs;
+	epochSeconds = sample_.epochSeconds;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return sequence_.load(std::memory_order_relaxed) == before && valid &&
+	       current(monotonicUs, expiresUs, sampleGeneration);
+}
+
+void ESPDateCoarseClock::publish(const ESPDateCoarseSample &sample, uint32_t generation) {
+	uint32_t before = sequence_.load(std::memory_order_relaxed);
+	const bool locked = (before & 1u) == 0 &&
+	                    sequence_.compare_exchange_strong(
+	                        before, before + 1, std::memory_order_acquire, std::memory_order_relaxed
+	                    );
+	if (!locked) {
+		return; // another refresh is storing the same second
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	if (generation_.load(std::memory_order_acquire) == generation) {
+		sample_ = sample;
+		sampleGeneration_ = generation;
+		valid_ = true;
+	}
+	sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void ESPDateCoarseClock::invalidate() {
+	generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+bool ESPDateCoarseClock::current(
+    int64_t monotonicUs, int64_t expiresUs, uint32_t sampleGeneration
+) const {
+	return sampleGeneration == generation_.load(std::memory_order_acquire) &&
+	       monotonicUs < expiresUs;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// One second of the system clock, with everything the "now" helpers derive from it.
+struct ESPDateCoarseSample {
+	static constexpr size_t kTextSize = 20; // "YYYY-MM-DD HH:MM:SS"
+
+	int64_t epochSeconds = 0;
+	int64_t expiresUs = 0; // monotonic time at which the next second starts
+	bool localOk = false;
+	int16_t offsetMinutes = 0;
+	int16_t year = 0;
+	uint8_t month = 0;
+	uint8_t day = 0;
+	uint8_t hour = 0;
+	uint8_t minute = 0;
+	uint8_t second = 0;
+	char utcText[kTextSize] = {};
+	char localText[kTextSize] = {};
+};
+
+// Shared store behind ESPDate::nowCoarse() and friends. Readers copy the sample through a
+// sequence counter, so any task may read without blocking; a sample counts as current until
+// the monotonic clock passes expiresUs. Nothing waits on a writer: a read that overlaps a
+// publish reports a miss (the caller reads the clock itself), and a publish that finds another
+// in progress is skipped. invalidate() (clock step, TZ change) bumps a generation, which
+// retires the stored sample and drops a refresh computed against the old clock or zone.
+class ESPDateCoarseClock {
+  public:
+	// False when there is no current sample at monotonicUs, or a publish is in progress.
+	bool read(int64_t monotonicUs, ESPDateCoarseSample &out) const;
+	bool readSeconds(int64_t monotonicUs, int64_t &epochSeconds) const;
+
+	uint32_t generation() const {
+		return generation_.load(std::memory_order_acquire);
+	}
+	// Stores the sample unless invalidate() ran since `generation` was read, or another
+	// publish holds the store.
+	void publish(const ESPDateCoarseSample &sample, uint32_t generation);
+	void invalidate();
+
+  private:
+	bool current(int64_t monotonicUs, int64_t expiresUs, uint32_t sampleGeneration) const;
+
+	std::atomic<uint32_t> sequence_{0};
+	std::atomic<uint32_t> generation_{0};
+	ESPDateCoarseSample sample_{};
+	uint32_t sampleGeneration_ = 0;
+	bool valid_ = false;
+};
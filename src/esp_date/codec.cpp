@@ -0,0 +1,152 @@
+#include "codec.h"
+#include "date.h"
+
+namespace {
+// Deltas are taken in uint64 so that any pair of int64 stamps wraps instead of overflowing;
+// the decoder wraps back the same way.
+uint64_t zigzag(uint64_t value) {
+	return (value << 1) ^ (0 - (value >> 63));
+}
+
+uint64_t unzigzag(uint64_t value) {
+	return (value >> 1) ^ (0 - (value & 1));
+}
+
+size_t varintLength(uint64_t value) {
+	size_t length = 1;
+	while (value >= 0x80) {
+		value >>= 7;
+		++length;
+	}
+	return length;
+}
+
+size_t writeVarint(uint64_t value, uint8_t *out) {
+	size_t length = 0;
+	while (value >= 0x80) {
+		out[length++] = static_cast<uint8_t>(value | 0x80);
+		value >>= 7;
+	}
+	out[length++] = static_cast<uint8_t>(value);
+	return length;
+}
+
+void writeLe(uint64_t value, uint8_t *out, size_t bytes) {
+	for (size_t i = 0; i < bytes; ++i) {
+		out[i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+}
+
+uint64_t readLe(const uint8_t *in, size_t bytes) {
+	uint64_t value = 0;
+	for (size_t i = 0; i < bytes; ++i) {
+		value |= static_cast<uint64_t>(in[i]) << (8 * i);
+	}
+	return value;
+}
+} // namespace
+
+bool ESPDateCompact5Codec::encode(const DateTime &dt, uint8_t *out) {
+	if (!out || dt.epochSeconds < kMinSeconds || dt.epochSeconds > kMaxSeconds) {
+		return false;
+	}
+	writeLe(static_cast<uint64_t>(dt.epochSeconds), out, kSize);
+	return true;
+}
+
+DateTime ESPDateCompact5Codec::decode(const uint8_t *in) {
+	const uint64_t raw = readLe(in, kSize);
+	// Sign-extend bit 39.
+	const uint64_t signBit = uint64_t{1} << 39;
+	return DateTime{static_cast<int64_t>((raw ^ signBit) - signBit)};
+}
+
+bool ESPDateEpoch32Codec::pack(const DateTime &dt, uint32_t &out) const {
+	if (dt.epochSeconds < epoch_ || dt.epochSeconds - epoch_ > int64_t{UINT32_MAX}) {
+		return false;
+	}
+	out = static_cast<uint32_t>(dt.epochSeconds - epoch_);
+	return true;
+}
+
+DateTime ESPDateEpoch32Codec::unpack(uint32_t packed) const {
+	return DateTime{epoch_ + packed};
+}
+
+bool ESPDateEpoch32Codec::encode(const DateTime &dt, uint8_t *out) const {
+	uint32_t packed = 0;
+	if (!out || !pack(dt, packed)) {
+		return false;
+	}
+	writeLe(packed, out, kSize);
+	return true;
+}
+
+DateTime ESPDateEpoch32Codec::decode(const uint8_t *in) const {
+	return unpack(static_cast<uint32_t>(readLe(in, kSize)));
+}
+
+ESPDateDeltaEncoder::ESPDateDeltaEncoder(uint8_t *buffer, size_t capacity)
+    : buffer_(buffer), capacity_(buffer ? capacity : 0) {
+}
+
+void ESPDateDeltaEncoder::reset(uint8_t *buffer, size_t capacity) {
+	*this = ESPDateDeltaEncoder(buffer, capacity);
+}
+
+bool ESPDateDeltaEncoder::append(const DateTime &dt) {
+	const uint64_t value = static_cast<uint64_t>(dt.epochSeconds);
+	const uint64_t delta = value - previous_;
+	uint64_t encoded = 0;
+	if (count_ == 0) {
+		encoded = zigzag(value);
+	} else if (count_ == 1) {
+		encoded = zigzag(delta);
+	} else {
+		encoded = zigzag(delta - previousDelta_);
+	}
+	if (varintLength(encoded) > remaining()) {
+		return false;
+	}
+	size_ += writeVarint(encoded, buffer_ + size_);
+	previousDelta_ = count_ == 0 ? 0 : delta;
+	previous_ = value;
+	++count_;
+	return true;
+}
+
+ESPDateDeltaDecoder::ESPDateDeltaDecoder(const uint8_t *data, size_t size)
+    : data_(data), size_(data ? size : 0) {
+}
+
+bool ESPDateDeltaDecoder::next(DateTime &out) {
+	if (error_ || offset_ >= size_) {
+		return false;
+	}
+	uint64_t encoded = 0;
+	for (unsigned shift = 0;; shift += 7) {
+		if (offset_ >= size_ || shift > 63) {
+			error_ = true;
+			return false;
+		}
+		const uint8_t byte = data_[offset_++];
+		encoded |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			break;
+		}
+	}
+
+	const uint64_t decoded = unzigzag(encoded);
+	uint64_t value = 0;
+	if (count_ == 0) {
+		value = decoded;
+	} else {
+		const uint64_t delta = count_ == 1 ? decoded : previousDelta_ + decoded;
+		value = previous_ + delta;
+		previousDelta_ = delta;
+	}
+	previous_ = value;
+	++count_;
+	out = DateTime{static_cast<int64_t>(value)};
+	return true;
+}
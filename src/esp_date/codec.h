@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct DateTime;
+
+// Compact DateTime encodings for flash logs and radio payloads. Every codec works on caller
+// buffers and never allocates. Multi-byte forms are little-endian.
+
+// Fixed 5 bytes: 40-bit two's complement seconds, about +-17,000 years around 1970.
+class ESPDateCompact5Codec {
+  public:
+	static constexpr size_t kSize = 5;
+	static constexpr int64_t kMinSeconds = -(int64_t{1} << 39);
+	static constexpr int64_t kMaxSeconds = (int64_t{1} << 39) - 1;
+
+	// False when dt is outside [kMinSeconds, kMaxSeconds].
+	static bool encode(const DateTime &dt, uint8_t *out);
+	static DateTime decode(const uint8_t *in);
+};
+
+// Fixed 4 bytes: unsigned seconds since a caller-chosen epoch, covering 136 years from it.
+class ESPDateEpoch32Codec {
+  public:
+	static constexpr size_t kSize = 4;
+	static constexpr int64_t kDefaultEpoch = 1577836800; // 2020-01-01T00:00:00Z
+
+	explicit constexpr ESPDateEpoch32Codec(int64_t epochSeconds = kDefaultEpoch)
+	    : epoch_(epochSeconds) {
+	}
+
+	// False when dt is before the epoch or more than UINT32_MAX seconds after it.
+	bool pack(const DateTime &dt, uint32_t &out) const;
+	DateTime unpack(uint32_t packed) const;
+	bool encode(const DateTime &dt, uint8_t *out) const;
+	DateTime decode(const uint8_t *in) const;
+	int64_t epochSeconds() const {
+		return epoch_;
+	}
+
+  private:
+	int64_t epoch_;
+};
+
+// Delta-of-delta stream for (mostly) regular series: the first stamp is stored whole, the
+// second as a delta and every later one as the change in delta, each zigzag-encoded as a
+// varint. A fixed-rate log costs one byte per stamp, as does any interval change within +-63 s.
+// Any int64 sequence round-trips, including out-of-order stamps. A stream can only be decoded
+// from its start, so begin a new encoder per flash page or radio packet.
+class ESPDateDeltaEncoder {
+  public:
+	static constexpr size_t kMaxBytesPerStamp = 10; // varint of a 64-bit value
+
+	ESPDateDeltaEncoder(uint8_t *buffer, size_t capacity);
+
+	// Appends one stamp; returns false (writing nothing) when it does not fit.
+	bool append(const DateTime &dt);
+	// Starts a new stream in the same or another buffer.
+	void reset(uint8_t *buffer, size_t capacity);
+
+	const uint8_t *data() const {
+		return buffer_;
+	}
+	size_t size() const {
+		return size_;
+	}
+	size_t count() const {
+		return count_;
+	}
+	size_t remaining() const {
+		return capacity_ - size_;
+	}
+
+  private:
+	uint8_t *buffer_;
+	size_t capacity_;
+	size_t size_ = 0;
+	size_t count_ = 0;
+	uint64_t previous_ = 0;
+	uint64_t previousDelta_ = 0;
+};
+
+class ESPDateDeltaDecoder {
+  public:
+	ESPDateDeltaDecoder(const uint8_t *data, size_t size);
+
+	// Returns false at the end of the stream or on a truncated/overlong varint (see error()).
+	bool next(DateTime &out);
+	bool error() const {
+		return error_;
+	}
+	size_t count() const {
+		return count_;
+	}
+
+  private:
+	const uint8_t *data_;
+	size_t size_;
+	size_t offset_ = 0;
+	size_t count_ = 0;
+	uint64_t previous_ = 0;
+	uint64_t previousDelta_ = 0;
+	bool error_ = false;
+};
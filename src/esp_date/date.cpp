@@ -6,6 +6,10 @@
 #include <cstring>
 #include <string>
 
+#if !defined(_WIN32)
+#include <sys/time.h>
+#endif
+
 #if defined(__has_include)
 #if __has_include(<esp_sntp.h>)
 #include <esp_sntp.h>
@@ -57,6 +61,12 @@ bool formatWithTm(const tm &value, const char *pattern, char *outBuffer, size_t
 	const size_t written = strftime(outBuffer, outSize, pattern, &copy);
 	return written > 0;
 }
+
+// Move-assigning an empty string would keep the old capacity; swapping hands the buffer
+// to the temporary so it is freed here (and its pool block, if any, returned).
+void resetText(DateString &text, bool usePSRAMBuffers) {
+	DateString(DateAllocator<char>(usePSRAMBuffers)).swap(text);
+}
 } // namespace
 
 ESPDate::NtpSyncCallback ESPDate::activeNtpSyncCallback_ = nullptr;
@@ -66,12 +76,14 @@ ESPDate *ESPDate::activeNtpSyncOwner_ = nullptr;
 #if ESPDATE_HAS_SNTP_NOTIFICATION_CB
 void ESPDate::handleSntpSync(struct timeval *tv) {
 	int64_t syncedEpoch = static_cast<int64_t>(time(nullptr));
+	int32_t syncedMicros = 0;
 	if (tv) {
 		syncedEpoch = static_cast<int64_t>(tv->tv_sec);
+		syncedMicros = static_cast<int32_t>(tv->tv_usec);
 	}
 	const DateTime syncedAtUtc{syncedEpoch};
 	if (activeNtpSyncOwner_) {
-		activeNtpSyncOwner_->dispatchNtpSync(syncedAtUtc);
+		activeNtpSyncOwner_->dispatchNtpSync(syncedAtUtc, syncedMicros);
 	}
 }
 #endif
@@ -125,6 +137,7 @@ int DateTime::secondUtc() const {
 }
 
 bool DateTime::utcString(char *outBuffer, size_t outSize, ESPDateFormat style) const {
+	ESPDATE_PROBE(Format);
 	tm t{};
 	if (!Utils::toUtcTm(*this, t)) {
 		return false;
@@ -133,6 +146,7 @@ bool DateTime::utcString(char *outBuffer, size_t outSize, ESPDateFormat style) c
 }
 
 bool DateTime::localString(char *outBuffer, size_t outSize, ESPDateFormat style) const {
+	ESPDATE_PROBE(Format);
 	tm t{};
 	if (!Utils::toLocalTm(*this, t)) {
 		return false;
@@ -140,23 +154,20 @@ bool DateTime::localString(char *outBuffer, size_t outSize, ESPDateFormat style)
 	return formatWithTm(t, patternForStyle(style, true), outBuffer, outSize);
 }
 
-std::string DateTime::utcString(ESPDateFormat style) const {
-	char buffer[40];
-	if (!utcString(buffer, sizeof(buffer), style)) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText DateTime::utcString(ESPDateFormat style) const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return utcString(buffer, size, style);
+	});
 }
 
-std::string DateTime::localString(ESPDateFormat style) const {
-	char buffer[48];
-	if (!localString(buffer, sizeof(buffer), style)) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText DateTime::localString(ESPDateFormat style) const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return localString(buffer, size, style);
+	});
 }
 
 bool LocalDateTime::localString(char *outBuffer, size_t outSize) const {
+	ESPDATE_PROBE(Format);
 	if (!ok || !outBuffer || outSize == 0) {
 		return false;
 	}
@@ -174,12 +185,10 @@ bool LocalDateTime::localString(char *outBuffer, size_t outSize) const {
 	return written > 0 && static_cast<size_t>(written) < outSize;
 }
 
-std::string LocalDateTime::localString() const {
-	char buffer[32];
-	if (!localString(buffer, sizeof(buffer))) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText LocalDateTime::localString() const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return localString(buffer, size);
+	});
 }
 
 ESPDate::ESPDate() = default;
@@ -193,6 +202,23 @@ void ESPDate::deinit() {
 	ntpSyncCallbackCallable_ = NtpSyncCallable{};
 	hasLastNtpSync_ = false;
 	lastNtpSync_ = DateTime{};
+	clockDiscipline_.reset();
+	clockDiscipline_.configure(ESPDateClockDisciplineConfig{});
+	syncIntervalController_.configure(ESPDateAdaptiveSyncConfig{});
+	adaptiveNtpSync_ = false;
+	syncHealth_.reset();
+	syncClockOffsetUs_ = 0;
+	hasSyncClockOffset_ = false;
+	ntpSyncTimeoutMs_ = kDefaultNtpSyncTimeoutMs;
+	checkpointStore_ = nullptr;
+	restoreSystemClock_ = true;
+	hasCheckpoint_ = false;
+	ESPDate *pendingOwner = this;
+	pendingCheckpointOwner_.compare_exchange_strong(pendingOwner, nullptr);
+	hasRestoredTime_ = false;
+	restoredErrorBoundUs_ = -1;
+	scheduler_ = nullptr;
+	schedulerClockOffsetUs_ = 0;
 	nextNtpSyncListenerId_ = 1;
 	for (size_t i = 0; i < kMaxNtpSyncListeners; ++i) {
 		ntpSyncListeners_[i].id = 0;
@@ -203,11 +229,15 @@ void ESPDate::deinit() {
 	longitude_ = 0.0f;
 	ntpSyncIntervalMs_ = 0;
 	const bool usePSRAM = usePSRAMBuffers_;
-	timeZone_ = DateString(DateAllocator<char>(usePSRAM));
+	resetText(timeZone_, usePSRAM);
 	for (size_t i = 0; i < kMaxNtpServers; ++i) {
-		ntpServers_[i] = DateString(DateAllocator<char>(usePSRAM));
+		resetText(ntpServers_[i], usePSRAM);
 	}
 	usePSRAMBuffers_ = false;
+	if (ownsBufferPool_) {
+		ESPDateBufferPool::shared().release();
+		ownsBufferPool_ = false;
+	}
 	initialized_ = false;
 
 	if (activeNtpSyncOwner_ == this) {
@@ -225,20 +255,48 @@ void ESPDate::init(const ESPDateConfig &config) {
 	longitude_ = config.longitude;
 	hasLocation_ = true;
 	usePSRAMBuffers_ = config.usePSRAMBuffers;
-	timeZone_ = DateString(DateAllocator<char>(usePSRAMBuffers_));
+	resetText(timeZone_, usePSRAMBuffers_);
 	for (size_t i = 0; i < kMaxNtpServers; ++i) {
-		ntpServers_[i] = DateString(DateAllocator<char>(usePSRAMBuffers_));
+		resetText(ntpServers_[i], usePSRAMBuffers_);
+	}
+	if (config.bufferPoolBlocks > 0) {
+		// Reserve the pool before the config strings below so they land in it as well.
+		ownsBufferPool_ = ESPDateBufferPool::shared().configure(
+		    config.bufferPoolBlockSize,
+		    config.bufferPoolBlocks,
+		    usePSRAMBuffers_
+		);
+	} else if (ownsBufferPool_) {
+		ESPDateBufferPool::shared().release();
+		ownsBufferPool_ = false;
 	}
 	ntpSyncIntervalMs_ = config.ntpSyncIntervalMs;
 	hasLastNtpSync_ = false;
 	lastNtpSync_ = DateTime{};
-
-	const bool hasTz = config.timeZone && config.timeZone[0] != '\0';
+	clockDiscipline_.reset();
+	syncIntervalController_.reset();
+	syncHealth_.reset();
+	syncClockOffsetUs_ = wallClockOffsetUs();
+	hasSyncClockOffset_ = true;
+	checkpointStore_ = config.checkpointStore;
+	restoreSystemClock_ = config.restoreSystemClock;
+	checkpointIntervalMs_ = config.checkpointIntervalMs;
+	hasCheckpoint_ = false;
+	hasRestoredTime_ = false;
+	restoredErrorBoundUs_ = -1;
+
+	bool hasTz = config.timeZone && config.timeZone[0] != '\0';
 	const char *configuredNtpServers[kMaxNtpServers] =
 	    {config.ntpServer, config.ntpServer2, config.ntpServer3};
 	size_t ntpServerCount = 0;
 	if (hasTz) {
 		timeZone_ = config.timeZone;
+	} else if (config.zoneGrid) {
+		const ESPDateZoneMatch match = zoneForLocation(*config.zoneGrid);
+		hasTz = match.ok && match.posix[0] != '\0';
+		if (hasTz) {
+			timeZone_ = match.posix;
+		}
 	}
 	for (size_t i = 0; i < kMaxNtpServers; ++i) {
 		const char *server = configuredNtpServers[i];
@@ -252,6 +310,10 @@ void ESPDate::init(const ESPDateConfig &config) {
 		setenv("TZ", timeZone_.c_str(), 1);
 		tzset();
 	}
+	if (checkpointStore_) {
+		restoreFromCheckpoint();
+	}
+	coarseClock_.invalidate(); // new TZ, and possibly a restored clock
 	initialized_ = true;
 }
 
@@ -285,6 +347,43 @@ void ESPDate::setNtpSyncCallbackCallable(const NtpSyncCallable &callback) {
 
 bool ESPDate::setNtpSyncIntervalMs(uint32_t intervalMs) {
 	ntpSyncIntervalMs_ = intervalMs;
+	adaptiveNtpSync_ = false;
+	return applyNtpSyncInterval(intervalMs);
+}
+
+bool ESPDate::enableAdaptiveNtpSync(const ESPDateAdaptiveSyncConfig &config) {
+#if ESPDATE_HAS_SNTP_SYNC_INTERVAL
+	syncIntervalController_.configure(config);
+	adaptiveNtpSync_ = true;
+	return applyNtpSyncInterval(syncIntervalController_.intervalMs());
+#else
+	(void)config;
+	return false;
+#endif
+}
+
+void ESPDate::disableAdaptiveNtpSync() {
+	if (!adaptiveNtpSync_) {
+		return;
+	}
+	adaptiveNtpSync_ = false;
+	applyNtpSyncInterval(ntpSyncIntervalMs_);
+}
+
+ESPDateSyncIntervalStats ESPDate::ntpSyncIntervalStats() const {
+	ESPDateSyncIntervalStats stats = syncIntervalController_.stats();
+	stats.adaptive = adaptiveNtpSync_;
+	if (!adaptiveNtpSync_) {
+		stats.intervalMs = ntpSyncIntervalMs_;
+		stats.syncsPerDay =
+		    ntpSyncIntervalMs_ > 0 ? 86400000.0f / static_cast<float>(ntpSyncIntervalMs_) : 0.0f;
+		stats.widenCount = 0;
+		stats.narrowCount = 0;
+	}
+	return stats;
+}
+
+bool ESPDate::applyNtpSyncInterval(uint32_t intervalMs) const {
 #if ESPDATE_HAS_SNTP_SYNC_INTERVAL
 	if (intervalMs > 0) {
 		sntp_set_sync_interval(intervalMs);
@@ -338,12 +437,91 @@ bool ESPDate::removeNtpSyncListener(NtpSyncListenerId id) {
 }
 
 bool ESPDate::syncNTP() {
-	return applyNtpConfig();
+	if (!applyNtpConfig()) {
+		return false;
+	}
+	syncHealth_.recordAttempt(monotonicMicros(), ntpSyncTimeoutMs_);
+	return true;
 }
 
-void ESPDate::dispatchNtpSync(const DateTime &syncedAtUtc) {
+void ESPDate::setNtpSyncTimeoutMs(uint32_t timeoutMs) {
+	ntpSyncTimeoutMs_ = timeoutMs;
+}
+
+ESPDateBufferPoolStats ESPDate::bufferPoolStats() const {
+	return ESPDateBufferPool::shared().stats();
+}
+
+bool ESPDate::syncFromReference(int64_t epochUs, int64_t monotonicUs, bool setSystemClock) {
+	const int64_t elapsedUs = monotonicMicros() - monotonicUs;
+	if (elapsedUs < 0) {
+		return false;
+	}
+	const int64_t nowUs = epochUs + elapsedUs;
+	const int64_t seconds = Utils::floorDiv(nowUs, Utils::kMicrosPerSecond);
+#if !defined(_WIN32)
+	if (setSystemClock) {
+		timeval tv{};
+		tv.tv_sec = static_cast<time_t>(seconds);
+		tv.tv_usec = static_cast<suseconds_t>(nowUs - seconds * Utils::kMicrosPerSecond);
+		settimeofday(&tv, nullptr);
+	}
+#endif
+	dispatchNtpSync(
+	    DateTime{seconds},
+	    static_cast<int32_t>(nowUs - seconds * Utils::kMicrosPerSecond)
+	);
+	return true;
+}
+
+TimeSyncStats ESPDate::timeSyncStats() const {
+	return syncHealth_.snapshot(monotonicMicros());
+}
+
+void ESPDate::dispatchNtpSync(const DateTime &syncedAtUtc, int32_t syncedAtMicros) {
+	ESPDATE_PROBE(NtpDispatch);
+	coarseClock_.invalidate(); // the sync may have stepped the clock
 	lastNtpSync_ = syncedAtUtc;
 	hasLastNtpSync_ = true;
+	const int64_t monotonicUs = monotonicMicros();
+	const bool hadSamples = clockDiscipline_.hasSamples();
+	const int64_t clockOffsetUs = wallClockOffsetUs();
+	const int64_t sinceLastSyncUs =
+	    hadSamples ? monotonicUs - clockDiscipline_.lastSampleMonotonicUs() : 0;
+	const int64_t offsetUs = clockDiscipline_.addSample(
+	    monotonicUs,
+	    syncedAtUtc.epochSeconds * Utils::kMicrosPerSecond + syncedAtMicros
+	);
+	ESPDateSyncHealth::SyncSample health;
+	health.monotonicUs = monotonicUs;
+	// The discipline residual includes pending slew and says nothing about how far the system
+	// clock moved; the step is the change in its offset from the monotonic timer.
+	health.stepUs = hasSyncClockOffset_ ? clockOffsetUs - syncClockOffsetUs_ : 0;
+	health.hasStep = hasSyncClockOffset_;
+	health.residualUs = offsetUs;
+	syncClockOffsetUs_ = clockOffsetUs;
+	hasSyncClockOffset_ = true;
+	health.pendingCorrectionUs = clockDiscipline_.pendingCorrectionUs(monotonicUs);
+	health.slewPpm = clockDiscipline_.config().maxSlewPpm;
+	health.driftPpm = static_cast<float>(clockDiscipline_.driftPpm());
+	health.driftModelled = clockDiscipline_.sampleCount() >= 2;
+	syncHealth_.recordSync(health);
+	if (scheduler_) {
+		// Relative deadlines follow the clock itself, like the step recorded above.
+		const int64_t stepUs = clockOffsetUs - schedulerClockOffsetUs_;
+		if (stepUs >= kMinSchedulerStepUs || stepUs <= -kMinSchedulerStepUs) {
+			scheduler_->onClockStep(stepUs);
+			schedulerClockOffsetUs_ = clockOffsetUs;
+		}
+	}
+	if (checkpointStore_ && checkpointDue()) {
+		requestCheckpoint();
+	}
+	const uint32_t previousIntervalMs = syncIntervalController_.intervalMs();
+	const uint32_t intervalMs = syncIntervalController_.onSync(offsetUs, sinceLastSyncUs);
+	if (adaptiveNtpSync_ && intervalMs != previousIntervalMs) {
+		applyNtpSyncInterval(intervalMs);
+	}
 
 	if (activeNtpSyncCallbackCallable_) {
 		activeNtpSyncCallbackCallable_(syncedAtUtc);
@@ -384,11 +562,9 @@ bool ESPDate::applyNtpConfig() const {
 	    (hasCallback || activeNtpSyncOwner_ != nullptr) ? &ESPDate::handleSntpSync : nullptr
 	);
 #endif
-#if ESPDATE_HAS_SNTP_SYNC_INTERVAL
-	if (ntpSyncIntervalMs_ > 0) {
-		sntp_set_sync_interval(ntpSyncIntervalMs_);
-	}
-#endif
+	applyNtpSyncInterval(
+	    adaptiveNtpSync_ ? syncIntervalController_.intervalMs() : ntpSyncIntervalMs_
+	);
 
 	const char *tz = timeZone_.empty() ? "UTC0" : timeZone_.c_str();
 	const char *ntpServer1 = ntpServers_[0].empty() ? nullptr : ntpServers_[0].c_str();
@@ -401,8 +577,32 @@ bool ESPDate::applyNtpConfig() const {
 #endif
 }
 
+DateTime ESPDate::disciplinedNow() const {
+	return DateTime{Utils::floorDiv(disciplinedNowUs(), Utils::kMicrosPerSecond)};
+}
+
+int64_t ESPDate::disciplinedNowUs() const {
+	int64_t utcUs = 0;
+	if (!clockDiscipline_.nowUs(monotonicMicros(), utcUs)) {
+		return now().epochSeconds * Utils::kMicrosPerSecond;
+	}
+	return utcUs;
+}
+
+void ESPDate::setClockDisciplineConfig(const ESPDateClockDisciplineConfig &config) {
+	clockDiscipline_.configure(config);
+}
+
+void ESPDate::setTimeSource(ESPDateTimeSource *source) {
+	timeSource_ = source;
+	coarseClock_.invalidate();
+	// A new source is not a step. Reading it here would also advance a simulated clock with
+	// auto-advance, so the first sync after a switch records no step instead.
+	hasSyncClockOffset_ = false;
+}
+
 DateTime ESPDate::now() const {
-	return DateTime{static_cast<int64_t>(time(nullptr))};
+	return DateTime{Utils::floorDiv(timeSource().epochMicros(), Utils::kMicrosPerSecond)};
 }
 
 DateTime ESPDate::nowUtc() const {
@@ -413,17 +613,121 @@ LocalDateTime ESPDate::nowLocal() const {
 	return toLocal(now(), nullptr);
 }
 
+namespace {
+bool copyCachedText(const char *text, char *outBuffer, size_t outSize) {
+	const size_t length = std::strlen(text);
+	if (!outBuffer || outSize <= length) {
+		return false;
+	}
+	std::memcpy(outBuffer, text, length + 1);
+	return true;
+}
+} // namespace
+
+// Current sample, rebuilt when the second has rolled over. Concurrent rebuilds are harmless:
+// each publishes the same second, and one computed before an invalidate() is dropped.
+void ESPDate::coarseSample(ESPDateCoarseSample &sample) const {
+	const int64_t monotonicUs = monotonicMicros();
+	if (coarseClock_.read(monotonicUs, sample)) {
+		return;
+	}
+	ESPDATE_COUNT(CoarseClockRefresh);
+	const uint32_t generation = coarseClock_.generation();
+	const int64_t epochUs = nowUs().epochMicros;
+	const DateTime utc{Utils::floorDiv(epochUs, Utils::kMicrosPerSecond)};
+	sample = ESPDateCoarseSample{};
+	sample.epochSeconds = utc.epochSeconds;
+	sample.expiresUs = monotonicUs + (utc.epochSeconds + 1) * Utils::kMicrosPerSecond - epochUs;
+	const LocalDateTime local = toLocal(utc);
+	sample.localOk = local.ok;
+	sample.offsetMinutes = static_cast<int16_t>(local.offsetMinutes);
+	sample.year = static_cast<int16_t>(local.year);
+	sample.month = static_cast<uint8_t>(local.month);
+	sample.day = static_cast<uint8_t>(local.day);
+	sample.hour = static_cast<uint8_t>(local.hour);
+	sample.minute = static_cast<uint8_t>(local.minute);
+	sample.second = static_cast<uint8_t>(local.second);
+	utc.utcString(sample.utcText, sizeof(sample.utcText));
+	local.localString(sample.localText, sizeof(sample.localText));
+	coarseClock_.publish(sample, generation);
+}
+
+DateTime ESPDate::nowCoarse() const {
+	int64_t epochSeconds = 0;
+	if (coarseClock_.readSeconds(monotonicMicros(), epochSeconds)) {
+		return DateTime{epochSeconds};
+	}
+	ESPDateCoarseSample sample;
+	coarseSample(sample);
+	return DateTime{sample.epochSeconds};
+}
+
+LocalDateTime ESPDate::nowLocalCached() const {
+	ESPDateCoarseSample sample;
+	coarseSample(sample);
+	LocalDateTime local{};
+	local.ok = sample.localOk;
+	local.year = sample.year;
+	local.month = sample.month;
+	local.day = sample.day;
+	local.hour = sample.hour;
+	local.minute = sample.minute;
+	local.second = sample.second;
+	local.offsetMinutes = sample.offsetMinutes;
+	local.utc = DateTime{sample.epochSeconds};
+	return local;
+}
+
+bool ESPDate::nowUtcStringCached(char *outBuffer, size_t outSize) const {
+	ESPDateCoarseSample sample;
+	coarseSample(sample);
+	return copyCachedText(sample.utcText, outBuffer, outSize);
+}
+
+bool ESPDate::nowLocalStringCached(char *outBuffer, size_t outSize) const {
+	ESPDateCoarseSample sample;
+	coarseSample(sample);
+	return sample.localOk && copyCachedText(sample.localText, outBuffer, outSize);
+}
+
+DateTimeText ESPDate::nowUtcStringCached() const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return nowUtcStringCached(buffer, size);
+	});
+}
+
+DateTimeText ESPDate::nowLocalStringCached() const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return nowLocalStringCached(buffer, size);
+	});
+}
+
+void ESPDate::refreshCoarseClock() const {
+	ESPDateCoarseSample sample;
+	coarseSample(sample);
+}
+
+void ESPDate::invalidateCoarseClock() const {
+	coarseClock_.invalidate();
+}
+
 LocalDateTime ESPDate::toLocal(const DateTime &dt) const {
 	return toLocal(dt, nullptr);
 }
 
 LocalDateTime ESPDate::toLocal(const DateTime &dt, const char *timeZone) const {
+	ESPDATE_PROBE(ToLocal);
 	LocalDateTime result{};
 	const char *tz = timeZone;
 	if (!tz || tz[0] == '\0') {
 		tz = timeZone_.empty() ? nullptr : timeZone_.c_str();
 	}
+	ESPDatePosixTz zone;
+	if (Utils::posixTzFor(tz, zone)) {
+		return Utils::localFromRules(dt, zone);
+	}
 
+	// Not a POSIX rule string (e.g. a zoneinfo name): only libc knows the zone.
 	Utils::ScopedTz scoped(tz, usePSRAMBuffers_);
 	time_t raw = static_cast<time_t>(dt.epochSeconds);
 	tm local{};
@@ -444,6 +748,11 @@ LocalDateTime ESPDate::toLocal(const DateTime &dt, const char *timeZone) const {
 	return result;
 }
 
+LocalDateTime ESPDate::toLocal(const DateTime &dt, const ESPDateTimeZone &zone) const {
+	ESPDATE_PROBE(ToLocal);
+	return Utils::localFromZone(dt, zone);
+}
+
 DateTime ESPDate::fromUnixSeconds(int64_t seconds) const {
 	return DateTime{seconds};
 }
@@ -466,20 +775,71 @@ DateTime ESPDate::fromUtc(int year, int month, int day, int hour, int minute, in
 }
 
 DateTime ESPDate::fromLocal(int year, int month, int day, int hour, int minute, int second) const {
+	return fromLocal(year, month, day, hour, minute, second, ESPDateDstPolicy::ShiftForward).value;
+}
+
+LocalTimeResult ESPDate::fromLocal(
+    int year, int month, int day, int hour, int minute, int second, ESPDateDstPolicy policy
+) const {
+	ESPDATE_PROBE(FromLocal);
 	if (!Utils::validHms(hour, minute, second) || month < 1 || month > 12 || year < 0 ||
 	    year > 9999) {
-		return DateTime{};
+		return LocalTimeResult{};
 	}
 	const int clampedDay = Utils::clampDay(year, month, day, *this);
+	const int64_t days = Utils::daysFromCivil(
+	    year,
+	    static_cast<unsigned>(month),
+	    static_cast<unsigned>(clampedDay)
+	);
+	return resolveLocalWall(
+	    days * Utils::kSecondsPerDay + hour * Utils::kSecondsPerHour +
+	        minute * Utils::kSecondsPerMinute + second,
+	    policy
+	);
+}
+
+// Local wall seconds (days since 1970-01-01 * 86400 + seconds of day) in the process TZ.
+int64_t ESPDate::localWallSeconds(const DateTime &dt) const {
+	ESPDatePosixTz zone;
+	if (Utils::processPosixTz(zone)) {
+		return dt.epochSeconds + zone.utcOffsetAt(dt.epochSeconds);
+	}
+	tm local{};
+	if (!Utils::toLocalTm(dt, local)) {
+		return dt.epochSeconds;
+	}
+	return Utils::timegm64(local);
+}
+
+LocalTimeResult ESPDate::resolveLocalWall(int64_t wallSeconds, ESPDateDstPolicy policy) const {
+	LocalTimeResult result{};
+	ESPDatePosixTz zone;
+	if (Utils::processPosixTz(zone)) {
+		int64_t utc = 0;
+		result.ok = zone.localToUtc(wallSeconds, policy, utc, &result.kind);
+		result.value = DateTime{result.ok ? utc : 0};
+		return result;
+	}
+
+	// Not a POSIX rule string (e.g. a zoneinfo name): only mktime knows the zone.
+	int year = 0;
+	unsigned month = 0;
+	unsigned day = 0;
+	const int64_t days = Utils::floorDiv(wallSeconds, Utils::kSecondsPerDay);
+	const int64_t secondOfDay = wallSeconds - days * Utils::kSecondsPerDay;
+	Utils::civilFromDays(days, year, month, day);
 	tm t{};
 	t.tm_year = year - 1900;
-	t.tm_mon = month - 1;
-	t.tm_mday = clampedDay;
-	t.tm_hour = hour;
-	t.tm_min = minute;
-	t.tm_sec = second;
+	t.tm_mon = static_cast<int>(month) - 1;
+	t.tm_mday = static_cast<int>(day);
+	t.tm_hour = static_cast<int>(secondOfDay / Utils::kSecondsPerHour);
+	t.tm_min = static_cast<int>(secondOfDay % Utils::kSecondsPerHour / Utils::kSecondsPerMinute);
+	t.tm_sec = static_cast<int>(secondOfDay % Utils::kSecondsPerMinute);
 	t.tm_isdst = -1; // let the runtime figure DST
-	return Utils::fromLocalTm(t);
+	result.ok = true;
+	result.value = Utils::fromLocalTm(t);
+	return result;
 }
 
 int64_t ESPDate::toUnixSeconds(const DateTime &dt) const {
@@ -507,9 +867,89 @@ bool ESPDate::isDstActive(const DateTime &dt, const char *timeZone) const {
 			tz = nullptr;
 		}
 	}
+	ESPDatePosixTz zone;
+	if (Utils::posixTzFor(tz, zone)) {
+		return zone.isDstAt(dt.epochSeconds);
+	}
 	return Utils::isDstActiveFor(dt, tz, usePSRAMBuffers_);
 }
 
+bool ESPDate::isDstActive(const DateTime &dt, const ESPDateTimeZone &zone) const {
+	return zone.isValid() && zone.isDstAt(dt.epochSeconds);
+}
+
+bool ESPDate::isBusinessDay(const DateTime &dt, const ESPDateBusinessCalendar &calendar) const {
+	return calendar.isBusinessDay(Utils::floorDiv(localWallSeconds(dt), Utils::kSecondsPerDay));
+}
+
+bool ESPDate::addBusinessDays(
+    const DateTime &dt, int32_t days, const ESPDateBusinessCalendar &calendar, DateTime &out
+) const {
+	const int64_t wall = localWallSeconds(dt);
+	const int64_t day = Utils::floorDiv(wall, Utils::kSecondsPerDay);
+	int64_t target = 0;
+	if (!calendar.addBusinessDays(day, days, target)) {
+		return false;
+	}
+	const LocalTimeResult resolved = resolveLocalWall(
+	    wall + (target - day) * Utils::kSecondsPerDay,
+	    ESPDateDstPolicy::ShiftForward
+	);
+	out = resolved.value;
+	return resolved.ok;
+}
+
+bool ESPDate::businessDaysBetween(
+    const DateTime &from,
+    const DateTime &to,
+    const ESPDateBusinessCalendar &calendar,
+    int32_t &count
+) const {
+	return calendar.businessDaysBetween(
+	    Utils::floorDiv(localWallSeconds(from), Utils::kSecondsPerDay),
+	    Utils::floorDiv(localWallSeconds(to), Utils::kSecondsPerDay),
+	    count
+	);
+}
+
+bool ESPDate::nextBusinessDayAt(
+    const DateTime &from,
+    int hour,
+    int minute,
+    const ESPDateBusinessCalendar &calendar,
+    DateTime &out
+) const {
+	if (!Utils::validHms(hour, minute, 0)) {
+		return false;
+	}
+	const int64_t secondOfDay = hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute;
+	const int64_t day = Utils::floorDiv(localWallSeconds(from), Utils::kSecondsPerDay);
+	// Today still counts when the time has not come yet; a skipped wall time (DST gap) resolves
+	// forward, which stays after `from` as well.
+	for (int32_t step = 0; step <= 1; ++step) {
+		int64_t target = 0;
+		if (!calendar.addBusinessDays(day, step, target)) {
+			return false;
+		}
+		const LocalTimeResult resolved = resolveLocalWall(
+		    target * Utils::kSecondsPerDay + secondOfDay,
+		    ESPDateDstPolicy::ShiftForward
+		);
+		if (resolved.ok && resolved.value.epochSeconds > from.epochSeconds) {
+			out = resolved.value;
+			return true;
+		}
+	}
+	return false;
+}
+
+ESPDateZoneMatch ESPDate::zoneForLocation(const ESPDateZoneGridTable &table) const {
+	if (!hasLocation_) {
+		return {false, "", ""};
+	}
+	return ESPDateZoneGrid(table).lookup(latitude_, longitude_);
+}
+
 DateTime ESPDate::addSeconds(const DateTime &dt, int64_t seconds) const {
 	return DateTime{dt.epochSeconds + seconds};
 }
@@ -788,17 +1228,23 @@ DateTime ESPDate::startOfYearLocal(const DateTime &dt) const {
 }
 
 DateTime ESPDate::setTimeOfDayLocal(const DateTime &dt, int hour, int minute, int second) const {
+	const LocalTimeResult result =
+	    setTimeOfDayLocal(dt, hour, minute, second, ESPDateDstPolicy::ShiftForward);
+	return result.ok ? result.value : dt;
+}
+
+LocalTimeResult ESPDate::setTimeOfDayLocal(
+    const DateTime &dt, int hour, int minute, int second, ESPDateDstPolicy policy
+) const {
 	if (!Utils::validHms(hour, minute, second)) {
-		return dt;
+		return LocalTimeResult{};
 	}
-	tm t{};
-	if (!Utils::toLocalTm(dt, t)) {
-		return dt;
-	}
-	t.tm_hour = hour;
-	t.tm_min = minute;
-	t.tm_sec = second;
-	return Utils::fromLocalTm(t);
+	const int64_t day = Utils::floorDiv(localWallSeconds(dt), Utils::kSecondsPerDay);
+	return resolveLocalWall(
+	    day * Utils::kSecondsPerDay + hour * Utils::kSecondsPerHour +
+	        minute * Utils::kSecondsPerMinute + second,
+	    policy
+	);
 }
 
 DateTime ESPDate::setTimeOfDayUtc(const DateTime &dt, int hour, int minute, int second) const {
@@ -815,32 +1261,44 @@ DateTime ESPDate::setTimeOfDayUtc(const DateTime &dt, int hour, int minute, int
 	return Utils::fromUtcTm(t);
 }
 
-DateTime ESPDate::nextDailyAtLocal(int hour, int minute, int second, const DateTime &from) const {
+DateTime ESPDate::nextDailyAtLocal(
+    int hour, int minute, int second, const DateTime &from, ESPDateDstPolicy policy
+) const {
 	if (!Utils::validHms(hour, minute, second)) {
 		return from;
 	}
-	DateTime candidate = setTimeOfDayLocal(from, hour, minute, second);
-	if (!isAfter(from, candidate)) {
-		return candidate;
+	const int64_t timeOfDay =
+	    hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second;
+	const int64_t today = Utils::floorDiv(localWallSeconds(from), Utils::kSecondsPerDay);
+	// Two extra days cover a time that is skipped today and a gap resolving before `from`.
+	for (int64_t day = today; day <= today + 2; ++day) {
+		const LocalTimeResult candidate =
+		    resolveLocalWall(day * Utils::kSecondsPerDay + timeOfDay, policy);
+		if (candidate.ok && !isAfter(from, candidate.value)) {
+			return candidate.value;
+		}
 	}
-	DateTime nextDay = addDays(from, 1);
-	return setTimeOfDayLocal(nextDay, hour, minute, second);
+	return from;
 }
 
 DateTime ESPDate::nextWeekdayAtLocal(
-    int weekday, int hour, int minute, int second, const DateTime &from
+    int weekday, int hour, int minute, int second, const DateTime &from, ESPDateDstPolicy policy
 ) const {
 	if (!Utils::validHms(hour, minute, second) || weekday < 0 || weekday > 6) {
 		return from;
 	}
-	const int current = getWeekdayLocal(from);
-	int daysAhead = (weekday - current + 7) % 7;
-	DateTime candidateDay = addDays(from, daysAhead);
-	DateTime candidate = setTimeOfDayLocal(candidateDay, hour, minute, second);
-	if (daysAhead == 0 && isAfter(from, candidate)) {
-		candidate = setTimeOfDayLocal(addDays(from, 7), hour, minute, second);
+	const int64_t timeOfDay =
+	    hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second;
+	const int64_t today = Utils::floorDiv(localWallSeconds(from), Utils::kSecondsPerDay);
+	const int64_t first = today + (weekday - Utils::weekdayFromDays(today) + 7) % 7;
+	for (int64_t day = first; day <= first + 14; day += 7) {
+		const LocalTimeResult candidate =
+		    resolveLocalWall(day * Utils::kSecondsPerDay + timeOfDay, policy);
+		if (candidate.ok && !isAfter(from, candidate.value)) {
+			return candidate.value;
+		}
 	}
-	return candidate;
+	return from;
 }
 
 int ESPDate::getYearLocal(const DateTime &dt) const {
@@ -911,6 +1369,7 @@ bool ESPDate::formatLocal(
 bool ESPDate::formatWithPatternUtc(
     const DateTime &dt, const char *pattern, char *outBuffer, size_t outSize
 ) const {
+	ESPDATE_PROBE(Format);
 	if (!pattern || !outBuffer || outSize == 0) {
 		return false;
 	}
@@ -925,6 +1384,7 @@ bool ESPDate::formatWithPatternUtc(
 bool ESPDate::formatWithPatternLocal(
     const DateTime &dt, const char *pattern, char *outBuffer, size_t outSize
 ) const {
+	ESPDATE_PROBE(Format);
 	if (!pattern || !outBuffer || outSize == 0) {
 		return false;
 	}
@@ -976,53 +1436,42 @@ bool ESPDate::lastNtpSyncStringLocal(char *outBuffer, size_t outSize, ESPDateFor
 	return dateTimeToStringLocal(lastNtpSync_, outBuffer, outSize, style);
 }
 
-std::string ESPDate::dateTimeToStringUtc(const DateTime &dt, ESPDateFormat style) const {
-	char buffer[40];
-	if (!dateTimeToStringUtc(dt, buffer, sizeof(buffer), style)) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText ESPDate::dateTimeToStringUtc(const DateTime &dt, ESPDateFormat style) const {
+	return dt.utcString(style);
 }
 
-std::string ESPDate::dateTimeToStringLocal(const DateTime &dt, ESPDateFormat style) const {
-	char buffer[48];
-	if (!dateTimeToStringLocal(dt, buffer, sizeof(buffer), style)) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText ESPDate::dateTimeToStringLocal(const DateTime &dt, ESPDateFormat style) const {
+	return dt.localString(style);
 }
 
-std::string ESPDate::localDateTimeToString(const LocalDateTime &dt) const {
-	char buffer[32];
-	if (!localDateTimeToString(dt, buffer, sizeof(buffer))) {
-		return std::string();
-	}
-	return std::string(buffer);
+DateTimeText ESPDate::localDateTimeToString(const LocalDateTime &dt) const {
+	return dt.localString();
 }
 
-std::string ESPDate::nowUtcString(ESPDateFormat style) const {
+DateTimeText ESPDate::nowUtcString(ESPDateFormat style) const {
 	return dateTimeToStringUtc(nowUtc(), style);
 }
 
-std::string ESPDate::nowLocalString(ESPDateFormat style) const {
+DateTimeText ESPDate::nowLocalString(ESPDateFormat style) const {
 	return dateTimeToStringLocal(now(), style);
 }
 
-std::string ESPDate::lastNtpSyncStringUtc(ESPDateFormat style) const {
+DateTimeText ESPDate::lastNtpSyncStringUtc(ESPDateFormat style) const {
 	if (!hasLastNtpSync_) {
-		return std::string();
+		return DateTimeText{};
 	}
 	return dateTimeToStringUtc(lastNtpSync_, style);
 }
 
-std::string ESPDate::lastNtpSyncStringLocal(ESPDateFormat style) const {
+DateTimeText ESPDate::lastNtpSyncStringLocal(ESPDateFormat style) const {
 	if (!hasLastNtpSync_) {
-		return std::string();
+		return DateTimeText{};
 	}
 	return dateTimeToStringLocal(lastNtpSync_, style);
 }
 
 ESPDate::ParseResult ESPDate::parseIso8601Utc(const char *str) const {
+	ESPDATE_PROBE(Parse);
 	ParseResult result{false, DateTime{}};
 	if (!str) {
 		return result;
@@ -1063,6 +1512,7 @@ ESPDate::ParseResult ESPDate::parseIso8601Utc(const char *str) const {
 }
 
 ESPDate::ParseResult ESPDate::parseDateTimeLocal(const char *str) const {
+	ESPDATE_PROBE(Parse);
 	ParseResult result{false, DateTime{}};
 	if (!str) {
 		return result;
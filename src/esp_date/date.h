@@ -1,7 +1,29 @@
 #pragma once
 
+#include "business_calendar.h"
+#include "checkpoint.h"
+#include "clock_discipline.h"
+#include "coarse_clock.h"
+#include "codec.h"
 #include "date_allocator.h"
+#include "date_text.h"
+#include "executor.h"
+#include "gnss.h"
+#include "instrumentation.h"
+#include "iso8601.h"
+#include "log_rewriter.h"
+#include "posix_tz.h"
+#include "recurrence.h"
+#include "scheduler.h"
+#include "sync_health.h"
+#include "sync_interval.h"
+#include "time_source.h"
+#include "time_zone.h"
+#include "tzdb.h"
+#include "wake_planner.h"
+#include "zone_grid.h"
 #include <Arduino.h>
+#include <atomic>
 #include <functional>
 #include <stdint.h>
 #include <string>
@@ -13,6 +35,17 @@ struct timeval;
 
 enum class ESPDateFormat { Iso8601, DateTime, Date, Time };
 
+// Longest text each ESPDateFormat can produce. %Y takes up to 11 chars because tm_year spans
+// the full int range; local ISO-8601 adds a "+hhmm" offset.
+constexpr size_t espDateFormatMaxLength(ESPDateFormat style) {
+	return style == ESPDateFormat::Iso8601    ? 11 + 15 + 5 // year, -MM-DDTHH:MM:SS, zone
+	       : style == ESPDateFormat::DateTime ? 11 + 15     // year, -MM-DD HH:MM:SS
+	       : style == ESPDateFormat::Date     ? 11 + 6      // year, -MM-DD
+	                                          : 8;          // HH:MM:SS
+}
+// Return type of the std::string-free convenience formatters; fits every ESPDateFormat.
+using DateTimeText = DateText<espDateFormatMaxLength(ESPDateFormat::Iso8601)>;
+
 struct DateTime {
 	int64_t epochSeconds = 0; // seconds since 1970-01-01T00:00:00Z
 
@@ -29,9 +62,91 @@ struct DateTime {
 	bool localString(
 	    char *outBuffer, size_t outSize, ESPDateFormat style = ESPDateFormat::DateTime
 	) const;
-	std::string utcString(ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string localString(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText utcString(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText localString(ESPDateFormat style = ESPDateFormat::DateTime) const;
+};
+
+// Widest DateTimeUs text: Iso8601 plus a ".ffffff" fraction.
+using DateTimeUsText = DateText<espDateFormatMaxLength(ESPDateFormat::Iso8601) + 7>;
+
+// Microsecond-precision instant. Still a single int64_t, so arrays of it keep DateTime's
+// 8-byte layout (range about +-292,000 years). Conversions to and from DateTime are explicit;
+// toDateTime() floors, so half a second before the epoch is still 1969-12-31T23:59:59.
+struct DateTimeUs {
+	static constexpr int64_t kMicrosPerMilli = 1000;
+	static constexpr int64_t kMicrosPerSecond = 1000000;
+
+	int64_t epochMicros = 0; // microseconds since 1970-01-01T00:00:00Z
+
+	static constexpr DateTimeUs fromDateTime(const DateTime &dt, int32_t micros = 0) {
+		return DateTimeUs{dt.epochSeconds * kMicrosPerSecond + micros};
+	}
+	static constexpr DateTimeUs fromEpochMillis(int64_t millis) {
+		return DateTimeUs{millis * kMicrosPerMilli};
+	}
+	DateTime toDateTime() const;
+	int64_t epochMillis() const;    // floored like toDateTime()
+	int32_t microsOfSecond() const; // 0..999999
+	int32_t millisOfSecond() const; // 0..999
+
+	constexpr DateTimeUs addMicros(int64_t micros) const {
+		return DateTimeUs{epochMicros + micros};
+	}
+	constexpr DateTimeUs addMillis(int64_t millis) const {
+		return DateTimeUs{epochMicros + millis * kMicrosPerMilli};
+	}
+	constexpr DateTimeUs addSeconds(int64_t seconds) const {
+		return DateTimeUs{epochMicros + seconds * kMicrosPerSecond};
+	}
+	// this - other; the coarser units truncate toward zero like ESPDate::differenceIn*.
+	constexpr int64_t differenceInMicros(const DateTimeUs &other) const {
+		return epochMicros - other.epochMicros;
+	}
+	constexpr int64_t differenceInMillis(const DateTimeUs &other) const {
+		return differenceInMicros(other) / kMicrosPerMilli;
+	}
+	constexpr int64_t differenceInSeconds(const DateTimeUs &other) const {
+		return differenceInMicros(other) / kMicrosPerSecond;
+	}
+
+	constexpr bool operator==(const DateTimeUs &other) const {
+		return epochMicros == other.epochMicros;
+	}
+	constexpr bool operator!=(const DateTimeUs &other) const {
+		return epochMicros != other.epochMicros;
+	}
+	constexpr bool operator<(const DateTimeUs &other) const {
+		return epochMicros < other.epochMicros;
+	}
+	constexpr bool operator<=(const DateTimeUs &other) const {
+		return epochMicros <= other.epochMicros;
+	}
+	constexpr bool operator>(const DateTimeUs &other) const {
+		return epochMicros > other.epochMicros;
+	}
+	constexpr bool operator>=(const DateTimeUs &other) const {
+		return epochMicros >= other.epochMicros;
+	}
+
+	// fractionDigits (0..6) are appended to the seconds as ".123"; Date ignores them.
+	bool utcString(
+	    char *outBuffer,
+	    size_t outSize,
+	    ESPDateFormat style = ESPDateFormat::DateTime,
+	    int fractionDigits = 3
+	) const;
+	bool localString(
+	    char *outBuffer,
+	    size_t outSize,
+	    ESPDateFormat style = ESPDateFormat::DateTime,
+	    int fractionDigits = 3
+	) const;
+	DateTimeUsText
+	utcString(ESPDateFormat style = ESPDateFormat::DateTime, int fractionDigits = 3) const;
+	DateTimeUsText
+	localString(ESPDateFormat style = ESPDateFormat::DateTime, int fractionDigits = 3) const;
 };
+static_assert(sizeof(DateTimeUs) == sizeof(int64_t), "DateTimeUs must stay one int64_t");
 
 struct LocalDateTime {
 	bool ok = false;
@@ -45,7 +160,28 @@ struct LocalDateTime {
 	DateTime utc{};
 
 	bool localString(char *outBuffer, size_t outSize) const;
-	std::string localString() const;
+	DateTimeText localString() const;
+};
+
+// Local wall time resolved to UTC under an ESPDateDstPolicy. ok is false for invalid input and
+// for a skipped time under ESPDateDstPolicy::Skip; kind reports what the wall time was.
+struct LocalTimeResult {
+	bool ok = false;
+	DateTime value{};
+	ESPDateLocalTimeKind kind = ESPDateLocalTimeKind::Unique;
+};
+
+// Structure-of-arrays output of the batch converters (toLocalBatch, toCivilUtcBatch). Every
+// column is optional: leave a pointer null to skip it. Non-null columns hold `count` entries.
+struct DateFieldColumns {
+	int16_t *year = nullptr;
+	uint8_t *month = nullptr;         // 1..12
+	uint8_t *day = nullptr;           // 1..31
+	uint8_t *hour = nullptr;          // 0..23
+	uint8_t *minute = nullptr;        // 0..59
+	uint8_t *second = nullptr;        // 0..59
+	uint8_t *weekday = nullptr;       // 0=Sunday..6=Saturday
+	int16_t *offsetMinutes = nullptr; // local - UTC; 0 for UTC batches
 };
 
 struct ESPDateConfig {
@@ -58,6 +194,22 @@ struct ESPDateConfig {
 	bool usePSRAMBuffers = false;   // prefer PSRAM for ESPDate-owned config/state text buffers
 	const char *ntpServer2 = nullptr; // optional secondary NTP server
 	const char *ntpServer3 = nullptr; // optional tertiary NTP server
+	ESPDateCheckpointStore *checkpointStore =
+	    nullptr; // optional: persist last known good time; init() restores from it
+	bool restoreSystemClock = true; // on restore, set the system clock when it lags the checkpoint
+	uint32_t checkpointIntervalMs =
+	    6UL * 60UL * 60UL * 1000UL; // syncs rewrite the checkpoint once this old or on a 1 s step
+	size_t bufferPoolBlocks = 0; // >0 serves DateAllocator from a fixed-block pool reserved here
+	size_t bufferPoolBlockSize = ESPDateBufferPool::kDefaultBlockSize; // bytes per pool block
+	const ESPDateZoneGridTable *zoneGrid =
+	    nullptr; // optional: without timeZone, init() takes the zone at latitude/longitude
+};
+
+struct ESPDateTimeEstimate {
+	ESPDateTimeQuality quality = ESPDateTimeQuality::Unset;
+	DateTime value{};
+	int64_t epochUs = 0;
+	int64_t errorBoundUs = -1; // -1 when the error is unknown or unbounded
 };
 
 struct SunCycleResult {
@@ -98,7 +250,30 @@ class ESPDate {
 	}
 	// Adjusts SNTP sync interval in milliseconds. Pass 0 to keep the runtime default.
 	// Returns false when the runtime does not expose interval control.
+	// A fixed interval also turns adaptive sync off.
 	bool setNtpSyncIntervalMs(uint32_t intervalMs);
+	// Lets ESPDate pick the SNTP interval from the residual error measured at each sync:
+	// it widens while the drift model holds the accuracy target and narrows when it does not.
+	// Returns false when the runtime does not expose interval control.
+	bool enableAdaptiveNtpSync(
+	    const ESPDateAdaptiveSyncConfig &config = ESPDateAdaptiveSyncConfig{}
+	);
+	void disableAdaptiveNtpSync();
+	bool isAdaptiveNtpSyncEnabled() const {
+		return adaptiveNtpSync_;
+	}
+	// Forwards every SNTP clock step to scheduler->onClockStep() so its relative deadlines keep
+	// their duration. The scheduler is ticked with now(); pass nullptr to detach. The step is how
+	// far the wall clock moved against the monotonic clock since the attach or the last step
+	// forwarded (so the first sync counts too); differences under kMinSchedulerStepUs are
+	// read-out jitter and carry over to the next sync.
+	static constexpr int64_t kMinSchedulerStepUs = 1000;
+	void attachScheduler(ESPDateScheduler *scheduler) {
+		scheduler_ = scheduler;
+		schedulerClockOffsetUs_ = scheduler ? wallClockOffsetUs() : 0;
+	}
+	// Sync count, residual offsets and the interval in use (energy vs accuracy tradeoff).
+	ESPDateSyncIntervalStats ntpSyncIntervalStats() const;
 	// True after at least one successful SNTP sync callback was received.
 	bool hasLastNtpSync() const;
 	// Returns the last SNTP sync timestamp (UTC epoch-backed DateTime).
@@ -109,17 +284,114 @@ class ESPDate {
 	// Triggers an immediate NTP sync with the configured server list.
 	// Returns false when no NTP server is configured or SNTP runtime support is unavailable.
 	bool syncNTP();
+	// Sync from a reference other than SNTP (GNSS, a radio clock, an RTC chip): `epochUs` was the
+	// UTC time at `monotonicUs` on the time source's monotonic clock. Sets the system clock
+	// unless setSystemClock is false, then runs the SNTP sync path: clock discipline, sync
+	// health, attached scheduler, checkpoint, sync callback and listeners. False when
+	// monotonicUs lies in the future.
+	bool syncFromReference(int64_t epochUs, int64_t monotonicUs, bool setSystemClock = true);
+	bool syncFromReference(const ESPDateGnssSample &sample, bool setSystemClock = true) {
+		return syncFromReference(sample.epochUs, sample.monotonicUs, setSystemClock);
+	}
+	// A syncNTP() attempt with no sync callback within this window counts as failed (default 30 s).
+	void setNtpSyncTimeoutMs(uint32_t timeoutMs);
+	// Lock-free time-quality snapshot (sync/failed counts, recent steps, drift, error bound).
+	// Safe to poll from another task.
+	TimeSyncStats timeSyncStats() const;
+
+	// Usage of the shared DateAllocator pool (ESPDateConfig::bufferPoolBlocks) plus the number
+	// of allocations that still reached the general heap.
+	ESPDateBufferPoolStats bufferPoolStats() const;
+
+	// Slewed clock discipline fed by SNTP syncs. Once synced, disciplinedNow() is derived from
+	// the monotonic timer plus the drift estimate and never steps backwards; before the first
+	// sync it falls back to now().
+	DateTime disciplinedNow() const;
+	int64_t disciplinedNowUs() const;
+	void setClockDisciplineConfig(const ESPDateClockDisciplineConfig &config);
+	const ESPDateClockDiscipline &clockDiscipline() const {
+		return clockDiscipline_;
+	}
+
+	// Checkpointing of the last known good time through ESPDateConfig::checkpointStore.
+	// Syncs checkpoint automatically, rate-limited by ESPDateConfig::checkpointIntervalMs and
+	// outside the SNTP callback; call checkpointTime() before deep sleep as well.
+	static constexpr int64_t kCheckpointStepUs = 1000000;
+	bool checkpointTime();
+	// Called by init(). elapsedHintUs is the known downtime (e.g. the planned sleep) and is
+	// only used when the system clock did not survive the reset.
+	bool restoreFromCheckpoint(int64_t elapsedHintUs = 0);
+	ESPDateTimeQuality timeQuality() const;
+	// Best current time with its quality flag and an estimated error bound.
+	ESPDateTimeEstimate timeEstimate() const;
+
+	// Reads the time through `source` instead of the system clock; nullptr restores the system
+	// clock. The source must outlive its use and survives deinit()/init(). Switch before other
+	// tasks read the time, and before the first sync: the clock discipline, sync health and
+	// checkpoint state keep monotonic readings from the source in use when they were taken.
+	void setTimeSource(ESPDateTimeSource *source);
+	ESPDateTimeSource &timeSource() const {
+		return timeSource_ ? *timeSource_ : ESPDateSystemTimeSource::instance();
+	}
 
 	DateTime now() const;
-	DateTime nowUtc() const; // alias of now(), returns the raw system clock (UTC)
+	DateTime nowUtc() const;  // alias of now(): UTC from the time source
+	DateTimeUs nowUs() const; // now() with its sub-second part
 	LocalDateTime nowLocal() const;
+	// Coarse clock for hot loops: the current second, its local breakdown and the DateTime-style
+	// strings are built once per second and shared, so further reads within that second cost a
+	// monotonic timer read and a copy. Safe from any task. SNTP syncs, init() and checkpoint
+	// restores invalidate it; call invalidateCoarseClock() after setting the clock or TZ yourself.
+	DateTime nowCoarse() const;
+	LocalDateTime nowLocalCached() const;
+	bool nowUtcStringCached(char *outBuffer, size_t outSize) const;
+	bool nowLocalStringCached(char *outBuffer, size_t outSize) const;
+	DateTimeText nowUtcStringCached() const;
+	DateTimeText nowLocalStringCached() const;
+	// Rebuilds the sample once the second has rolled over. Call it from a periodic timer and
+	// readers never pay for the rebuild themselves.
+	void refreshCoarseClock() const;
+	void invalidateCoarseClock() const;
 	LocalDateTime toLocal(const DateTime &dt) const;
 	LocalDateTime toLocal(const DateTime &dt, const char *timeZone) const;
+	// Same through a pre-resolved zone: no string lookup, no libc TZ switch.
+	LocalDateTime toLocal(const DateTime &dt, const ESPDateTimeZone &zone) const;
+	// Batch conversions: the TZ is resolved once per call (timeZone, else the configured TZ,
+	// else the process TZ) and consecutive stamps on the same day reuse its calendar fields,
+	// so sorted input is cheapest. Return how many entries were written. An executor splits
+	// the array across threads with identical output; zoneinfo names (non-POSIX TZ) always
+	// convert on the caller because they go through the process-wide TZ.
+	size_t toLocalBatch(
+	    const DateTime *in,
+	    size_t count,
+	    DateFieldColumns &out,
+	    const char *timeZone = nullptr,
+	    ESPDateExecutor *executor = nullptr
+	) const;
+	size_t toCivilUtcBatch(
+	    const DateTime *in,
+	    size_t count,
+	    DateFieldColumns &out,
+	    ESPDateExecutor *executor = nullptr
+	) const;
+	size_t startOfDayLocalBatch(
+	    const DateTime *in,
+	    size_t count,
+	    DateTime *out,
+	    const char *timeZone = nullptr,
+	    ESPDateExecutor *executor = nullptr
+	) const;
 	DateTime fromUnixSeconds(int64_t seconds) const;
 	DateTime
 	fromUtc(int year, int month, int day, int hour = 0, int minute = 0, int second = 0) const;
+	// Local wall time in the process TZ; repeated/skipped times resolve as ShiftForward.
 	DateTime
 	fromLocal(int year, int month, int day, int hour = 0, int minute = 0, int second = 0) const;
+	// Same with an explicit policy for DST overlaps and gaps. POSIX TZ strings are resolved from
+	// their transition rules; other TZ values fall back to mktime.
+	LocalTimeResult fromLocal(
+	    int year, int month, int day, int hour, int minute, int second, ESPDateDstPolicy policy
+	) const;
 	int64_t toUnixSeconds(const DateTime &dt) const;
 
 	// Arithmetic relative to a provided DateTime
@@ -190,10 +462,42 @@ class ESPDate {
 	DateTime startOfYearLocal(const DateTime &dt) const;
 
 	DateTime setTimeOfDayLocal(const DateTime &dt, int hour, int minute, int second) const;
+	LocalTimeResult setTimeOfDayLocal(
+	    const DateTime &dt, int hour, int minute, int second, ESPDateDstPolicy policy
+	) const;
 	DateTime setTimeOfDayUtc(const DateTime &dt, int hour, int minute, int second) const;
-	DateTime nextDailyAtLocal(int hour, int minute, int second, const DateTime &from) const;
-	DateTime
-	nextWeekdayAtLocal(int weekday, int hour, int minute, int second, const DateTime &from) const;
+	// Next local HH:MM:SS at or after `from`, walking calendar days (so DST nights are not off
+	// by an hour). Under Skip a day whose time falls into a gap is passed over.
+	DateTime nextDailyAtLocal(
+	    int hour,
+	    int minute,
+	    int second,
+	    const DateTime &from,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::ShiftForward
+	) const;
+	DateTime nextWeekdayAtLocal(
+	    int weekday,
+	    int hour,
+	    int minute,
+	    int second,
+	    const DateTime &from,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::ShiftForward
+	) const;
+	// Cron-style recurrences evaluated in the configured TZ (the process TZ when none is set);
+	// policy resolves wall times the zone skips or repeats, as in ESPDateRecurrence::next.
+	bool nextOccurrence(
+	    const ESPDateRecurrence &rule,
+	    const DateTime &from,
+	    DateTime &out,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::Earliest
+	) const;
+	size_t nextOccurrences(
+	    const ESPDateRecurrence &rule,
+	    const DateTime &from,
+	    size_t count,
+	    DateTime *out,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::Earliest
+	) const;
 
 	int getYearLocal(const DateTime &dt) const;
 	int getMonthLocal(const DateTime &dt) const;   // 1..12
@@ -213,8 +517,16 @@ class ESPDate {
 	bool formatWithPatternLocal(
 	    const DateTime &dt, const char *pattern, char *outBuffer, size_t outSize
 	) const;
+	// strftime patterns plus fractional seconds: %f (6 digits), %Nf (N = 1..6 digits) and
+	// %.f / %.Nf (the same with a leading '.'). Digits are truncated, never rounded up.
+	bool formatWithPatternUtc(
+	    const DateTimeUs &dt, const char *pattern, char *outBuffer, size_t outSize
+	) const;
+	bool formatWithPatternLocal(
+	    const DateTimeUs &dt, const char *pattern, char *outBuffer, size_t outSize
+	) const;
 
-	// String helpers (embedded-safe buffer first, then std::string convenience)
+	// String helpers: buffer-based first, then by-value DateTimeText (inline, no heap) convenience
 	bool dateTimeToStringUtc(
 	    const DateTime &dt,
 	    char *outBuffer,
@@ -241,24 +553,50 @@ class ESPDate {
 	    char *outBuffer, size_t outSize, ESPDateFormat style = ESPDateFormat::DateTime
 	) const;
 
-	std::string
+	DateTimeText
 	dateTimeToStringUtc(const DateTime &dt, ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string
+	DateTimeText
 	dateTimeToStringLocal(const DateTime &dt, ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string localDateTimeToString(const LocalDateTime &dt) const;
-	std::string nowUtcString(ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string nowLocalString(ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string lastNtpSyncStringUtc(ESPDateFormat style = ESPDateFormat::DateTime) const;
-	std::string lastNtpSyncStringLocal(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText localDateTimeToString(const LocalDateTime &dt) const;
+	DateTimeText nowUtcString(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText nowLocalString(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText lastNtpSyncStringUtc(ESPDateFormat style = ESPDateFormat::DateTime) const;
+	DateTimeText lastNtpSyncStringLocal(ESPDateFormat style = ESPDateFormat::DateTime) const;
 
 	struct ParseResult {
 		bool ok;
 		DateTime value;
 	};
+	struct ParseResultUs {
+		bool ok;
+		DateTimeUs value;
+	};
 
 	ParseResult parseIso8601Utc(const char *str) const;
+	// "YYYY-MM-DDTHH:MM:SS[.fraction]" then 'Z', "+hhmm" or "+hh:mm", as ESPDateIso8601Codec
+	// accepts it; offsets are normalized to UTC. The fraction takes 1..9 digits ('.' or ',')
+	// and is truncated to microseconds.
+	ParseResultUs parseIso8601UtcUs(const char *str) const;
 	ParseResult parseDateTimeLocal(const char *str) const;
 
+	// HTTP and mail dates, written from name tables without strftime or the locale. Buffers
+	// need one byte past the fixed length; years outside 0..9999 fail.
+	static constexpr size_t kHttpDateLength = 29; // "Sun, 06 Nov 1994 08:49:37 GMT"
+	static constexpr size_t kRfc2822Length = 31;  // "Sun, 06 Nov 1994 08:49:37 +0000"
+	bool formatHttpDate(const DateTime &dt, char *outBuffer, size_t outSize) const;
+	bool formatRfc2822Utc(const DateTime &dt, char *outBuffer, size_t outSize) const;
+	bool formatRfc2822Local(const DateTime &dt, char *outBuffer, size_t outSize) const;
+	DateTimeText formatHttpDate(const DateTime &dt) const;
+	DateTimeText formatRfc2822Utc(const DateTime &dt) const;
+	DateTimeText formatRfc2822Local(const DateTime &dt) const;
+	// IMF-fixdate plus the obsolete RFC 850 and asctime forms that RFC 7231 recipients must
+	// accept; names are case-sensitive and the weekday is not checked against the date. RFC 850
+	// two-digit years more than 50 years ahead of now() go back a century.
+	ParseResult parseHttpDate(const char *str) const;
+	// RFC 2822/5322 date-time: optional weekday, 1-2 digit day, optional seconds, and a numeric
+	// zone or one of UT, UTC, GMT, Z and the US zone names. Comments are not supported.
+	ParseResult parseRfc2822(const char *str) const;
+
 	// Sun cycle using stored configuration (lat/lon/timezone)
 	SunCycleResult sunrise() const;
 	SunCycleResult sunset() const;
@@ -282,6 +620,11 @@ class ESPDate {
 	sunrise(float latitude, float longitude, const char *timeZone, const DateTime &day) const;
 	SunCycleResult
 	sunset(float latitude, float longitude, const char *timeZone, const DateTime &day) const;
+	SunCycleResult sunrise(
+	    float latitude, float longitude, const ESPDateTimeZone &zone, const DateTime &day
+	) const;
+	SunCycleResult
+	sunset(float latitude, float longitude, const ESPDateTimeZone &zone, const DateTime &day) const;
 
 	// Daylight checks using stored configuration
 	bool isDay() const;
@@ -294,6 +637,32 @@ class ESPDate {
 	bool isDstActive(const DateTime &dt) const;
 	bool isDstActive(const char *timeZone) const;
 	bool isDstActive(const DateTime &dt, const char *timeZone) const;
+	bool isDstActive(const DateTime &dt, const ESPDateTimeZone &zone) const;
+
+	// Business days over local calendar dates in the process TZ. All return false when a date
+	// falls outside the calendar's built years. Results keep the local time of day.
+	bool isBusinessDay(const DateTime &dt, const ESPDateBusinessCalendar &calendar) const;
+	bool addBusinessDays(
+	    const DateTime &dt, int32_t days, const ESPDateBusinessCalendar &calendar, DateTime &out
+	) const;
+	// Business days in [local date of from, local date of to).
+	bool businessDaysBetween(
+	    const DateTime &from,
+	    const DateTime &to,
+	    const ESPDateBusinessCalendar &calendar,
+	    int32_t &count
+	) const;
+	// First hour:minute local on a business day strictly after `from` ("next working day 08:00").
+	bool nextBusinessDayAt(
+	    const DateTime &from,
+	    int hour,
+	    int minute,
+	    const ESPDateBusinessCalendar &calendar,
+	    DateTime &out
+	) const;
+
+	// Zone at the configured latitude/longitude, from a scripts/generate_zone_grid.py table
+	ESPDateZoneMatch zoneForLocation(const ESPDateZoneGridTable &table) const;
 
 	// Moon phase
 	MoonPhaseResult moonPhase() const;
@@ -310,10 +679,26 @@ class ESPDate {
 	static void handleSntpSync(struct timeval *tv);
 #endif
 #endif
-	void dispatchNtpSync(const DateTime &syncedAtUtc);
+	void dispatchNtpSync(const DateTime &syncedAtUtc, int32_t syncedAtMicros = 0);
 	void setNtpSyncCallbackCallable(const NtpSyncCallable &callback);
 	bool applyNtpConfig() const;
+	bool applyNtpSyncInterval(uint32_t intervalMs) const;
 	bool hasAnyNtpServerConfigured() const;
+	bool restoreCheckpoint(int64_t systemNowUs, int64_t elapsedHintUs);
+	bool checkpointDue() const;
+	void requestCheckpoint();
+	static void runPendingCheckpoint(void *, uint32_t);
+	int64_t localWallSeconds(const DateTime &dt) const;
+	LocalTimeResult resolveLocalWall(int64_t wallSeconds, ESPDateDstPolicy policy) const;
+	void coarseSample(ESPDateCoarseSample &sample) const;
+	int64_t monotonicMicros() const {
+		return timeSource().monotonicMicros();
+	}
+	// Wall clock minus monotonic clock; changes only when the wall clock is stepped or slewed.
+	int64_t wallClockOffsetUs() const {
+		const int64_t monotonicUs = monotonicMicros();
+		return timeSource().epochMicros() - monotonicUs;
+	}
 
 	SunCycleResult sunriseFromConfig(const DateTime &day) const;
 	SunCycleResult sunsetFromConfig(const DateTime &day) const;
@@ -326,8 +711,31 @@ class ESPDate {
 	DateString ntpServers_[kMaxNtpServers];
 	uint32_t ntpSyncIntervalMs_ = 0;
 	bool usePSRAMBuffers_ = false;
+	bool ownsBufferPool_ = false;
 	DateTime lastNtpSync_{};
 	bool hasLastNtpSync_ = false;
+	ESPDateClockDiscipline clockDiscipline_{};
+	ESPDateSyncIntervalController syncIntervalController_{};
+	bool adaptiveNtpSync_ = false;
+	ESPDateSyncHealth syncHealth_{};
+	mutable ESPDateCoarseClock coarseClock_{};
+	static constexpr uint32_t kDefaultNtpSyncTimeoutMs = 30000;
+	uint32_t ntpSyncTimeoutMs_ = kDefaultNtpSyncTimeoutMs;
+	ESPDateCheckpointStore *checkpointStore_ = nullptr;
+	bool restoreSystemClock_ = true;
+	uint32_t checkpointIntervalMs_ = 0;
+	bool hasCheckpoint_ = false;          // a checkpoint was written or restored this boot
+	int64_t checkpointMonotonicUs_ = 0;   // when it was taken, on the monotonic clock
+	int64_t checkpointClockOffsetUs_ = 0; // wallClockOffsetUs() at that point
+	int64_t syncClockOffsetUs_ = 0;       // wallClockOffsetUs() after the last sync or init()
+	bool hasSyncClockOffset_ = false;     // false after a source switch, until the next sync
+	bool hasRestoredTime_ = false;
+	int64_t restoredEpochUs_ = 0;
+	int64_t restoredMonotonicUs_ = 0;
+	int64_t restoredErrorBoundUs_ = -1;
+	ESPDateScheduler *scheduler_ = nullptr;
+	int64_t schedulerClockOffsetUs_ = 0; // wallClockOffsetUs() the scheduler is keyed to
+	ESPDateTimeSource *timeSource_ = nullptr;
 	NtpSyncCallback ntpSyncCallback_ = nullptr;
 	NtpSyncCallable ntpSyncCallbackCallable_;
 	struct NtpSyncListenerSlot {
@@ -340,6 +748,7 @@ class ESPDate {
 	static NtpSyncCallback activeNtpSyncCallback_;
 	static NtpSyncCallable activeNtpSyncCallbackCallable_;
 	static ESPDate *activeNtpSyncOwner_;
+	static std::atomic<ESPDate *> pendingCheckpointOwner_;
 	bool hasLocation_ = false;
 	bool initialized_ = false;
 
@@ -347,4 +756,7 @@ class ESPDate {
 	void _testDispatchNtpSync(const DateTime &syncedAtUtc) {
 		dispatchNtpSync(syncedAtUtc);
 	}
+	bool _testRestoreFromCheckpoint(int64_t systemNowUs, int64_t elapsedHintUs) {
+		return restoreCheckpoint(systemNowUs, elapsedHintUs);
+	}
 };
@@ -10,14 +10,19 @@
 #define ESP_DATE_HAS_BUFFER_MANAGER 0
 #endif
 
+#include "buffer_pool.h"
+#include "instrumentation.h"
+
 #include <cstddef>
 #include <cstdlib>
 #include <limits>
 #include <new>
 #include <string>
+#include <type_traits>
 
 namespace date_allocator_detail {
-inline void *allocate(std::size_t bytes, bool usePSRAMBuffers) noexcept {
+inline void *heapAllocate(std::size_t bytes, bool usePSRAMBuffers) noexcept {
+	ESPDATE_COUNT(HeapAllocation);
 #if ESP_DATE_HAS_BUFFER_MANAGER
 	return ESPBufferManager::allocate(bytes, usePSRAMBuffers);
 #else
@@ -26,18 +31,37 @@ inline void *allocate(std::size_t bytes, bool usePSRAMBuffers) noexcept {
 #endif
 }
 
-inline void deallocate(void *ptr) noexcept {
+inline void heapDeallocate(void *ptr) noexcept {
 #if ESP_DATE_HAS_BUFFER_MANAGER
 	ESPBufferManager::deallocate(ptr);
 #else
 	std::free(ptr);
 #endif
 }
+
+inline void *allocate(std::size_t bytes, bool usePSRAMBuffers) noexcept {
+	ESPDateBufferPool &pool = ESPDateBufferPool::shared();
+	if (void *block = pool.allocate(bytes)) {
+		return block;
+	}
+	pool.noteHeapAllocation();
+	return heapAllocate(bytes, usePSRAMBuffers);
+}
+
+inline void deallocate(void *ptr) noexcept {
+	if (ESPDateBufferPool::shared().deallocate(ptr)) {
+		return;
+	}
+	heapDeallocate(ptr);
+}
 } // namespace date_allocator_detail
 
 template <typename T> class DateAllocator {
   public:
 	using value_type = T;
+	// Let assignment/swap carry the PSRAM policy along with the buffer it allocated.
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
 
 	DateAllocator() noexcept = default;
 	explicit DateAllocator(bool usePSRAMBuffers) noexcept : usePSRAMBuffers_(usePSRAMBuffers) {
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include <string>
+
+// Fixed-capacity, NUL-terminated text returned by value from the convenience formatters.
+// Holds up to N characters inline, so formatting never touches the heap; the result is
+// empty when formatting failed. Converts implicitly to std::string where callers want one.
+template <size_t N> class DateText {
+  public:
+	static constexpr size_t kCapacity = N;
+
+	// Runs writer(buffer, bufferSize) and keeps the output only if the writer reports success.
+	template <typename Writer> static DateText write(Writer &&writer) {
+		DateText text;
+		if (writer(text.buffer_, sizeof(text.buffer_))) {
+			text.length_ = strlen(text.buffer_);
+		} else {
+			text.buffer_[0] = '\0';
+		}
+		return text;
+	}
+
+	const char *c_str() const {
+		return buffer_;
+	}
+	const char *data() const {
+		return buffer_;
+	}
+	size_t size() const {
+		return length_;
+	}
+	size_t length() const {
+		return length_;
+	}
+	bool empty() const {
+		return length_ == 0;
+	}
+	static constexpr size_t capacity() {
+		return N;
+	}
+
+	operator std::string() const {
+		return std::string(buffer_, length_);
+	}
+
+	bool operator==(const char *other) const {
+		return other && strcmp(buffer_, other) == 0;
+	}
+	bool operator!=(const char *other) const {
+		return !(*this == other);
+	}
+	template <size_t M> bool operator==(const DateText<M> &other) const {
+		return length_ == other.size() && memcmp(buffer_, other.c_str(), length_) == 0;
+	}
+	template <size_t M> bool operator!=(const DateText<M> &other) const {
+		return !(*this == other);
+	}
+
+  private:
+	char buffer_[N + 1] = {};
+	size_t length_ = 0;
+};
@@ -0,0 +1,225 @@
+#include "date.h"
+#include "utils.h"
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr int kMaxFractionDigits = 6;
+constexpr size_t kMaxPatternLength = 128;
+
+// ESPDateFormat patterns with the fraction (%.f) right after the seconds.
+const char *fractionalPatternForStyle(ESPDateFormat style, bool localIso8601) {
+	switch (style) {
+	case ESPDateFormat::Iso8601:
+		return localIso8601 ? "%Y-%m-%dT%H:%M:%S%.f%z" : "%Y-%m-%dT%H:%M:%S%.fZ";
+	case ESPDateFormat::DateTime:
+		return "%Y-%m-%d %H:%M:%S%.f";
+	case ESPDateFormat::Date:
+		return "%Y-%m-%d";
+	case ESPDateFormat::Time:
+		return "%H:%M:%S%.f";
+	}
+	return "%Y-%m-%d %H:%M:%S%.f";
+}
+
+// Replaces the fractional-second conversions with literal digits so strftime only sees the
+// standard ones. A bare %.f writes dotDigits digits (none when 0).
+bool expandFraction(
+    const char *pattern, int32_t micros, int dotDigits, char (&out)[kMaxPatternLength]
+) {
+	size_t length = 0;
+	auto put = [&](char c) {
+		if (length + 1 >= kMaxPatternLength) {
+			return false;
+		}
+		out[length++] = c;
+		return true;
+	};
+
+	for (const char *p = pattern; *p != '\0'; ++p) {
+		if (*p != '%') {
+			if (!put(*p)) {
+				return false;
+			}
+			continue;
+		}
+		const char *spec = p + 1;
+		const bool dot = *spec == '.';
+		if (dot) {
+			++spec;
+		}
+		int digits = dot ? dotDigits : kMaxFractionDigits;
+		if (*spec >= '1' && *spec <= '0' + kMaxFractionDigits) {
+			digits = *spec - '0';
+			++spec;
+		}
+		if (*spec != 'f') {
+			// Not ours: copy '%' and the next character (keeps "%%" intact).
+			if (!put('%') || (p[1] != '\0' && !put(*++p))) {
+				return false;
+			}
+			continue;
+		}
+		if (dot && digits > 0 && !put('.')) {
+			return false;
+		}
+		int32_t divisor = 100000;
+		for (int i = 0; i < digits; ++i) {
+			if (!put(static_cast<char>('0' + micros / divisor % 10))) {
+				return false;
+			}
+			divisor /= 10;
+		}
+		p = spec;
+	}
+	out[length] = '\0';
+	return true;
+}
+
+bool formatUs(
+    const tm &value,
+    int32_t micros,
+    const char *pattern,
+    int dotDigits,
+    char *outBuffer,
+    size_t outSize
+) {
+	if (!pattern || !outBuffer || outSize == 0) {
+		return false;
+	}
+	char expanded[kMaxPatternLength];
+	if (!expandFraction(pattern, micros, dotDigits, expanded)) {
+		return false;
+	}
+	tm copy = value;
+	return strftime(outBuffer, outSize, expanded, &copy) > 0;
+}
+
+int clampDigits(int fractionDigits) {
+	return fractionDigits < 0                    ? 0
+	       : fractionDigits > kMaxFractionDigits ? kMaxFractionDigits
+	                                             : fractionDigits;
+}
+} // namespace
+
+DateTime DateTimeUs::toDateTime() const {
+	return DateTime{Utils::floorDiv(epochMicros, kMicrosPerSecond)};
+}
+
+int64_t DateTimeUs::epochMillis() const {
+	return Utils::floorDiv(epochMicros, kMicrosPerMilli);
+}
+
+int32_t DateTimeUs::microsOfSecond() const {
+	return static_cast<int32_t>(epochMicros - toDateTime().epochSeconds * kMicrosPerSecond);
+}
+
+int32_t DateTimeUs::millisOfSecond() const {
+	return microsOfSecond() / static_cast<int32_t>(kMicrosPerMilli);
+}
+
+bool DateTimeUs::utcString(
+    char *outBuffer, size_t outSize, ESPDateFormat style, int fractionDigits
+) const {
+	tm t{};
+	if (!Utils::toUtcTm(toDateTime(), t)) {
+		return false;
+	}
+	return formatUs(
+	    t,
+	    microsOfSecond(),
+	    fractionalPatternForStyle(style, false),
+	    clampDigits(fractionDigits),
+	    outBuffer,
+	    outSize
+	);
+}
+
+bool DateTimeUs::localString(
+    char *outBuffer, size_t outSize, ESPDateFormat style, int fractionDigits
+) const {
+	tm t{};
+	if (!Utils::toLocalTm(toDateTime(), t)) {
+		return false;
+	}
+	return formatUs(
+	    t,
+	    microsOfSecond(),
+	    fractionalPatternForStyle(style, true),
+	    clampDigits(fractionDigits),
+	    outBuffer,
+	    outSize
+	);
+}
+
+DateTimeUsText DateTimeUs::utcString(ESPDateFormat style, int fractionDigits) const {
+	return DateTimeUsText::write([&](char *buffer, size_t size) {
+		return utcString(buffer, size, style, fractionDigits);
+	});
+}
+
+DateTimeUsText DateTimeUs::localString(ESPDateFormat style, int fractionDigits) const {
+	return DateTimeUsText::write([&](char *buffer, size_t size) {
+		return localString(buffer, size, style, fractionDigits);
+	});
+}
+
+DateTimeUs ESPDate::nowUs() const {
+	return DateTimeUs{timeSource().epochMicros()};
+}
+
+bool ESPDate::formatWithPatternUtc(
+    const DateTimeUs &dt, const char *pattern, char *outBuffer, size_t outSize
+) const {
+	ESPDATE_PROBE(Format);
+	tm t{};
+	if (!Utils::toUtcTm(dt.toDateTime(), t)) {
+		return false;
+	}
+	return formatUs(t, dt.microsOfSecond(), pattern, kMaxFractionDigits, outBuffer, outSize);
+}
+
+bool ESPDate::formatWithPatternLocal(
+    const DateTimeUs &dt, const char *pattern, char *outBuffer, size_t outSize
+) const {
+	ESPDATE_PROBE(Format);
+	tm t{};
+	if (!Utils::toLocalTm(dt.toDateTime(), t)) {
+		return false;
+	}
+	return formatUs(t, dt.microsOfSecond(), pattern, kMaxFractionDigits, outBuffer, outSize);
+}
+
+ESPDate::ParseResultUs ESPDate::parseIso8601UtcUs(const char *str) const {
+	ESPDATE_PROBE(Parse);
+	ParseResultUs result{false, DateTimeUs{}};
+	// The codec checks the fields and the offset, so both ISO parsers accept the same text; only
+	// the fraction, which the codec drops, is read here.
+	DateTime seconds{};
+	int offsetMinutes = 0;
+	if (!ESPDateIso8601Codec::parse(str, seconds, offsetMinutes)) {
+		return result;
+	}
+
+	const char *cursor = str + ESPDateIso8601Codec::kUtcLength - 1;
+	int32_t micros = 0;
+	if (*cursor == '.' || *cursor == ',') {
+		++cursor;
+		int digits = 0;
+		while (*cursor >= '0' && *cursor <= '9') {
+			if (++digits > 9) {
+				return result;
+			}
+			if (digits <= kMaxFractionDigits) {
+				micros = micros * 10 + (*cursor - '0');
+			}
+			++cursor;
+		}
+		for (; digits < kMaxFractionDigits; ++digits) {
+			micros *= 10;
+		}
+	}
+	result.ok = true;
+	result.value = DateTimeUs::fromDateTime(seconds, micros);
+	return result;
+}
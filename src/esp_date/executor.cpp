@@ -0,0 +1,193 @@
+#include "executor.h"
+
+void ESPDateExecutor::Work::drain() {
+	for (;;) {
+		const size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+		if (begin >= count) {
+			return;
+		}
+		const size_t end = count - begin > chunk ? begin + chunk : count;
+		(*job)(begin, end);
+	}
+}
+
+size_t ESPDateExecutor::chunkSize(size_t count, size_t minChunk, size_t threads) {
+	const size_t target = count / (threads * 4);
+	const size_t floor = minChunk > 0 ? minChunk : 1;
+	return target > floor ? target : floor;
+}
+
+void ESPDateSerialExecutor::parallelFor(size_t count, size_t, const Job &job) {
+	if (count > 0) {
+		job(0, count);
+	}
+}
+
+#if ESPDATE_HAS_THREAD_EXECUTOR
+ESPDateThreadExecutor::ESPDateThreadExecutor(size_t threads) {
+	if (threads == 0) {
+		threads = hardwareThreads();
+	}
+	if (threads > kMaxThreads) {
+		threads = kMaxThreads;
+	}
+	for (size_t i = 0; i + 1 < threads; ++i) {
+		workers_[i] = std::thread([this]() { workerLoop(); });
+		++workerCount_;
+	}
+}
+
+ESPDateThreadExecutor::~ESPDateThreadExecutor() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	wake_.notify_all();
+	for (size_t i = 0; i < workerCount_; ++i) {
+		workers_[i].join();
+	}
+}
+
+size_t ESPDateThreadExecutor::hardwareThreads() {
+	const unsigned threads = std::thread::hardware_concurrency();
+	return threads > 0 ? threads : 1;
+}
+
+void ESPDateThreadExecutor::parallelFor(size_t count, size_t minChunk, const Job &job) {
+	if (count == 0) {
+		return;
+	}
+	const size_t chunk = chunkSize(count, minChunk, concurrency());
+	if (workerCount_ == 0 || count <= chunk) {
+		job(0, count);
+		return;
+	}
+
+	std::lock_guard<std::mutex> call(callMutex_);
+	Work work;
+	work.job = &job;
+	work.count = count;
+	work.chunk = chunk;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		work_ = &work;
+		busy_ = workerCount_;
+		++generation_;
+	}
+	wake_.notify_all();
+	work.drain();
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	done_.wait(lock, [this]() { return busy_ == 0; });
+	work_ = nullptr;
+}
+
+void ESPDateThreadExecutor::workerLoop() {
+	uint32_t seen = 0;
+	for (;;) {
+		Work *work = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			wake_.wait(lock, [&]() { return stopping_ || generation_ != seen; });
+			if (stopping_) {
+				return;
+			}
+			seen = generation_;
+			work = work_;
+		}
+		work->drain();
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (--busy_ == 0) {
+			done_.notify_one();
+		}
+	}
+}
+#endif
+
+#if ESPDATE_HAS_FREERTOS_EXECUTOR
+ESPDateFreeRtosExecutor::ESPDateFreeRtosExecutor(
+    size_t threads, uint32_t stackBytes, UBaseType_t priority
+) {
+	if (threads == 0) {
+		threads = hardwareThreads();
+	}
+	if (threads > kMaxThreads) {
+		threads = kMaxThreads;
+	}
+	callMutex_ = xSemaphoreCreateMutex();
+	done_ = xSemaphoreCreateCounting(kMaxThreads, 0);
+	if (!callMutex_ || !done_) {
+		return;
+	}
+	const BaseType_t callerCore = xPortGetCoreID();
+	for (size_t i = 0; i + 1 < threads; ++i) {
+		const BaseType_t core =
+		    static_cast<BaseType_t>((callerCore + 1 + i) % portNUM_PROCESSORS);
+		TaskHandle_t handle = nullptr;
+		if (xTaskCreatePinnedToCore(
+		        workerEntry, "espdate_exec", stackBytes, this, priority, &handle, core
+		    ) != pdPASS) {
+			break;
+		}
+		workers_[workerCount_++] = handle;
+	}
+}
+
+ESPDateFreeRtosExecutor::~ESPDateFreeRtosExecutor() {
+	stopping_ = true;
+	for (size_t i = 0; i < workerCount_; ++i) {
+		xTaskNotifyGive(workers_[i]);
+	}
+	// Each worker gives done_ once more on its way out, before deleting itself.
+	for (size_t i = 0; i < workerCount_; ++i) {
+		xSemaphoreTake(done_, portMAX_DELAY);
+	}
+	if (done_) {
+		vSemaphoreDelete(done_);
+	}
+	if (callMutex_) {
+		vSemaphoreDelete(callMutex_);
+	}
+}
+
+void ESPDateFreeRtosExecutor::parallelFor(size_t count, size_t minChunk, const Job &job) {
+	if (count == 0) {
+		return;
+	}
+	const size_t chunk = chunkSize(count, minChunk, concurrency());
+	if (workerCount_ == 0 || count <= chunk) {
+		job(0, count);
+		return;
+	}
+
+	xSemaphoreTake(callMutex_, portMAX_DELAY);
+	Work work;
+	work.job = &job;
+	work.count = count;
+	work.chunk = chunk;
+	work_ = &work;
+	for (size_t i = 0; i < workerCount_; ++i) {
+		xTaskNotifyGive(workers_[i]);
+	}
+	work.drain();
+	for (size_t i = 0; i < workerCount_; ++i) {
+		xSemaphoreTake(done_, portMAX_DELAY);
+	}
+	work_ = nullptr;
+	xSemaphoreGive(callMutex_);
+}
+
+void ESPDateFreeRtosExecutor::workerEntry(void *self) {
+	ESPDateFreeRtosExecutor *executor = static_cast<ESPDateFreeRtosExecutor *>(self);
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if (executor->stopping_) {
+			break;
+		}
+		executor->work_->drain();
+		xSemaphoreGive(executor->done_);
+	}
+	xSemaphoreGive(executor->done_);
+	vTaskDelete(nullptr);
+}
+#endif
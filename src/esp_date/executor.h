@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__has_include)
+#if __has_include(<freertos/FreeRTOS.h>)
+#define ESPDATE_HAS_FREERTOS_EXECUTOR 1
+#endif
+#endif
+#ifndef ESPDATE_HAS_FREERTOS_EXECUTOR
+#define ESPDATE_HAS_FREERTOS_EXECUTOR 0
+#endif
+// Device builds split work with FreeRTOS tasks; std::thread is the host-side equivalent.
+#ifndef ESPDATE_HAS_THREAD_EXECUTOR
+#define ESPDATE_HAS_THREAD_EXECUTOR (!ESPDATE_HAS_FREERTOS_EXECUTOR)
+#endif
+
+#if ESPDATE_HAS_FREERTOS_EXECUTOR
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+#if ESPDATE_HAS_THREAD_EXECUTOR
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// Runs the index range of a bulk job (the *Batch conversions) on one or more threads. Ranges
+// are claimed dynamically in chunks, so a slow core simply ends up with fewer of them; the
+// job must only touch the indices it is given, which keeps the result identical to a serial run.
+class ESPDateExecutor {
+  public:
+	using Job = std::function<void(size_t begin, size_t end)>;
+
+	virtual ~ESPDateExecutor() = default;
+	// Threads that may run ranges at the same time, including the caller.
+	virtual size_t concurrency() const = 0;
+	// Calls job on disjoint [begin, end) ranges that together cover [0, count), each at least
+	// minChunk long except the last, and returns once all have finished. The caller takes part.
+	// Must not be called again from inside job.
+	virtual void parallelFor(size_t count, size_t minChunk, const Job &job) = 0;
+
+  protected:
+	// State of one parallelFor call shared by every participant.
+	struct Work {
+		const Job *job = nullptr;
+		size_t count = 0;
+		size_t chunk = 1;
+		std::atomic<size_t> next{0};
+
+		void drain();
+	};
+
+	// About four chunks per thread: enough to even out uneven cores, few enough to keep the
+	// per-chunk setup (TZ span, day cache) negligible.
+	static size_t chunkSize(size_t count, size_t minChunk, size_t threads);
+};
+
+// Runs everything on the caller; what the batch APIs use when no executor is given.
+class ESPDateSerialExecutor : public ESPDateExecutor {
+  public:
+	size_t concurrency() const override {
+		return 1;
+	}
+	void parallelFor(size_t count, size_t minChunk, const Job &job) override;
+};
+
+#if ESPDATE_HAS_THREAD_EXECUTOR
+// Fixed pool of std::thread workers that sleep between calls.
+class ESPDateThreadExecutor : public ESPDateExecutor {
+  public:
+	static constexpr size_t kMaxThreads = 32;
+
+	// threads includes the caller (1 = serial); 0 uses hardwareThreads(). Capped at kMaxThreads.
+	explicit ESPDateThreadExecutor(size_t threads = 0);
+	~ESPDateThreadExecutor() override;
+	ESPDateThreadExecutor(const ESPDateThreadExecutor &) = delete;
+	ESPDateThreadExecutor &operator=(const ESPDateThreadExecutor &) = delete;
+
+	static size_t hardwareThreads();
+	size_t concurrency() const override {
+		return workerCount_ + 1;
+	}
+	void parallelFor(size_t count, size_t minChunk, const Job &job) override;
+
+  private:
+	void workerLoop();
+
+	std::thread workers_[kMaxThreads - 1];
+	size_t workerCount_ = 0;
+	std::mutex callMutex_; // one parallelFor at a time
+	std::mutex mutex_;
+	std::condition_variable wake_;
+	std::condition_variable done_;
+	Work *work_ = nullptr;
+	uint32_t generation_ = 0;
+	size_t busy_ = 0;
+	bool stopping_ = false;
+};
+#endif
+
+#if ESPDATE_HAS_FREERTOS_EXECUTOR
+// Helper tasks pinned to the cores next to the one that constructs the executor, so on a
+// dual-core ESP32 the default instance puts one helper on the other core.
+class ESPDateFreeRtosExecutor : public ESPDateExecutor {
+  public:
+	static constexpr size_t kMaxThreads = 4;
+
+	// threads includes the caller; 0 uses hardwareThreads(). Tasks that cannot be created are
+	// left out, so concurrency() may come back lower than requested.
+	explicit ESPDateFreeRtosExecutor(
+	    size_t threads = 0, uint32_t stackBytes = 4096, UBaseType_t priority = 1
+	);
+	~ESPDateFreeRtosExecutor() override;
+	ESPDateFreeRtosExecutor(const ESPDateFreeRtosExecutor &) = delete;
+	ESPDateFreeRtosExecutor &operator=(const ESPDateFreeRtosExecutor &) = delete;
+
+	static size_t hardwareThreads() {
+		return portNUM_PROCESSORS;
+	}
+	size_t concurrency() const override {
+		return workerCount_ + 1;
+	}
+	void parallelFor(size_t count, size_t minChunk, const Job &job) override;
+
+  private:
+	static void workerEntry(void *self);
+
+	TaskHandle_t workers_[kMaxThreads - 1] = {};
+	size_t workerCount_ = 0;
+	SemaphoreHandle_t callMutex_ = nullptr;
+	SemaphoreHandle_t done_ = nullptr;
+	Work *volatile work_ = nullptr;
+	volatile bool stopping_ = false;
+};
+#endif
@@ -0,0 +1,316 @@
+#include "gnss.h"
+#include "utils.h"
+
+namespace {
+using Utils = ESPDateUtils;
+
+// hhmmss[.f...] to microseconds since midnight; fraction digits past the sixth are ignored.
+bool parseTimeOfDay(const char *text, size_t length, int64_t &out) {
+	int hour = 0;
+	int minute = 0;
+	int second = 0;
+	if (length < 6 || !Utils::parseIntSlice(text, 2, 0, 23, hour) ||
+	    !Utils::parseIntSlice(text + 2, 2, 0, 59, minute) ||
+	    !Utils::parseIntSlice(text + 4, 2, 0, 60, second)) {
+		return false;
+	}
+	int64_t micros = 0;
+	if (length > 6) {
+		if (text[6] != '.') {
+			return false;
+		}
+		int64_t scale = 100000;
+		for (size_t i = 7; i < length; ++i) {
+			const char c = text[i];
+			if (c < '0' || c > '9') {
+				return false;
+			}
+			micros += (c - '0') * scale;
+			scale /= 10;
+		}
+	}
+	out = (hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second) *
+	          Utils::kMicrosPerSecond +
+	      micros;
+	return true;
+}
+
+int hexValue(char c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+	if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+} // namespace
+
+bool ESPDateNmeaParser::feed(char c) {
+	++stats_.bytes;
+	if (c == '$') {
+		if (state_ == State::Fields || state_ == State::Checksum) {
+			if (sentence_ != ESPDateNmeaSentence::None) {
+				++stats_.malformed; // cut off by the next sentence
+			}
+		}
+		state_ = State::Fields;
+		sentence_ = ESPDateNmeaSentence::None;
+		checksum_ = 0;
+		field_ = 0;
+		fieldLength_ = 0;
+		length_ = 1;
+		statusValid_ = false;
+		fieldsOk_ = true;
+		secondOfDayUs_ = -1;
+		year_ = 0;
+		month_ = 0;
+		day_ = 0;
+		return false;
+	}
+
+	switch (state_) {
+	case State::Idle:
+	case State::Skip:
+		return false;
+
+	case State::Fields:
+		if (++length_ > kMaxSentenceLength) {
+			if (sentence_ != ESPDateNmeaSentence::None) {
+				++stats_.malformed;
+			}
+			state_ = State::Idle;
+			return false;
+		}
+		if (c == '*') {
+			if (!finishField()) {
+				state_ = State::Skip;
+				return false;
+			}
+			state_ = State::Checksum;
+			expected_ = 0;
+			checksumDigits_ = 0;
+			return false;
+		}
+		if (c == '\r' || c == '\n') {
+			if (sentence_ != ESPDateNmeaSentence::None) {
+				++stats_.checksumErrors;
+			}
+			state_ = State::Idle;
+			return false;
+		}
+		checksum_ ^= static_cast<uint8_t>(c);
+		if (c == ',') {
+			if (!finishField()) {
+				state_ = State::Skip;
+			}
+			return false;
+		}
+		if (fieldLength_ < kMaxFieldLength) {
+			fieldText_[fieldLength_++] = c;
+		} else {
+			fieldsOk_ = false;
+		}
+		return false;
+
+	case State::Checksum: {
+		const int digit = hexValue(c);
+		if (digit < 0) {
+			++stats_.checksumErrors;
+			state_ = State::Idle;
+			return false;
+		}
+		expected_ = static_cast<uint8_t>((expected_ << 4) | digit);
+		if (++checksumDigits_ < 2) {
+			return false;
+		}
+		state_ = State::Idle;
+		if (expected_ != checksum_) {
+			++stats_.checksumErrors;
+			return false;
+		}
+		return finishSentence();
+	}
+	}
+	return false;
+}
+
+size_t ESPDateNmeaParser::feed(const char *data, size_t length) {
+	size_t completed = 0;
+	for (size_t i = 0; i < length; ++i) {
+		completed += feed(data[i]) ? 1 : 0;
+	}
+	return completed;
+}
+
+void ESPDateNmeaParser::reset() {
+	*this = ESPDateNmeaParser{};
+}
+
+// Interprets the field that just ended. False stops decoding: the sentence is not one we read.
+bool ESPDateNmeaParser::finishField() {
+	const char *text = fieldText_;
+	const size_t length = fieldLength_;
+	const uint8_t field = field_++;
+	fieldLength_ = 0;
+	if (field == 0) {
+		// Address: two talker characters and the sentence type.
+		if (length == 5 && text[2] == 'R' && text[3] == 'M' && text[4] == 'C') {
+			sentence_ = ESPDateNmeaSentence::Rmc;
+		} else if (length == 5 && text[2] == 'Z' && text[3] == 'D' && text[4] == 'A') {
+			sentence_ = ESPDateNmeaSentence::Zda;
+		} else {
+			++stats_.ignored;
+			return false;
+		}
+		return true;
+	}
+	if (field == 1) {
+		fieldsOk_ = parseTimeOfDay(text, length, secondOfDayUs_) && fieldsOk_;
+		return true;
+	}
+	if (sentence_ == ESPDateNmeaSentence::Rmc) {
+		if (field == 2) {
+			statusValid_ = length == 1 && text[0] == 'A';
+		} else if (field == 9) {
+			int yy = 0;
+			fieldsOk_ = length == 6 && Utils::parseIntSlice(text, 2, 0, 99, day_) &&
+			            Utils::parseIntSlice(text + 2, 2, 0, 99, month_) &&
+			            Utils::parseIntSlice(text + 4, 2, 0, 99, yy) && fieldsOk_;
+			year_ = yy < 80 ? 2000 + yy : 1900 + yy;
+		}
+		return true;
+	}
+	if (field == 2) {
+		fieldsOk_ = length == 2 && Utils::parseIntSlice(text, 2, 0, 99, day_) && fieldsOk_;
+	} else if (field == 3) {
+		fieldsOk_ = length == 2 && Utils::parseIntSlice(text, 2, 0, 99, month_) && fieldsOk_;
+	} else if (field == 4) {
+		fieldsOk_ = length == 4 && Utils::parseIntSlice(text, 4, 0, 9999, year_) && fieldsOk_;
+	}
+	return true;
+}
+
+bool ESPDateNmeaParser::finishSentence() {
+	if (sentence_ == ESPDateNmeaSentence::Rmc && !statusValid_) {
+		++stats_.invalidFixes;
+		return false;
+	}
+	const uint8_t requiredFields = sentence_ == ESPDateNmeaSentence::Rmc ? 10 : 5;
+	if (!fieldsOk_ || field_ < requiredFields || secondOfDayUs_ < 0 || month_ < 1 ||
+	    month_ > 12 || day_ < 1 || day_ > Utils::daysInMonth(year_, month_)) {
+		++stats_.malformed;
+		return false;
+	}
+	const int64_t days =
+	    Utils::daysFromCivil(year_, static_cast<unsigned>(month_), static_cast<unsigned>(day_));
+	time_.epochUs = days * Utils::kSecondsPerDay * Utils::kMicrosPerSecond + secondOfDayUs_;
+	time_.sentence = sentence_;
+	++stats_.timeSentences;
+	return true;
+}
+
+void ESPDateGnssClock::onPps(int64_t monotonicUs) {
+	ppsUs_.store(monotonicUs, std::memory_order_release);
+	ppsEdges_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool ESPDateGnssClock::feed(const char *data, size_t length, int64_t monotonicUs) {
+	bool sampled = false;
+	for (size_t i = 0; i < length; ++i) {
+		if (parser_.feed(data[i])) {
+			sampled = accept(parser_.time(), monotonicUs) || sampled;
+		}
+	}
+	return sampled;
+}
+
+bool ESPDateGnssClock::feed(char c, int64_t monotonicUs) {
+	return parser_.feed(c) && accept(parser_.time(), monotonicUs);
+}
+
+// Receivers emit the sentences for second N shortly after the edge that starts N, so the
+// newest edge names the sentence's second when the sentence follows it closely. Edge spacing
+// is checked against the sentence times, which catches a missed edge or a late sentence.
+bool ESPDateGnssClock::accept(const ESPDateNmeaTime &time, int64_t monotonicUs) {
+	const int64_t secondUs =
+	    Utils::floorDiv(time.epochUs, Utils::kMicrosPerSecond) * Utils::kMicrosPerSecond;
+	const int64_t fractionUs = time.epochUs - secondUs;
+	if (secondUs == lastSecondUs_) {
+		return false; // RMC and ZDA for the same second, or a 5 Hz receiver's later fixes
+	}
+	const int64_t ppsUs = ppsUs_.load(std::memory_order_acquire);
+	bool aligned = fractionUs == 0 && ppsUs >= 0 && monotonicUs >= ppsUs &&
+	               monotonicUs - ppsUs <= config_.maxPpsToSentenceUs && ppsUs != lastAlignedPpsUs_;
+	if (aligned && lastAlignedPpsUs_ >= 0) {
+		const int64_t edgeSeconds = Utils::floorDiv(
+		    ppsUs - lastAlignedPpsUs_ + Utils::kMicrosPerSecond / 2,
+		    Utils::kMicrosPerSecond
+		);
+		if (edgeSeconds * Utils::kMicrosPerSecond != secondUs - lastAlignedEpochUs_) {
+			++stats_.ppsMismatches;
+			lastAlignedPpsUs_ = -1; // re-seed from the next edge
+			aligned = false;
+		}
+	}
+
+	ESPDateGnssSample sample;
+	if (aligned) {
+		sample.epochUs = secondUs;
+		sample.monotonicUs = ppsUs;
+		sample.errorBoundUs = config_.ppsUncertaintyUs;
+		sample.ppsAligned = true;
+		lastAlignedEpochUs_ = secondUs;
+		lastAlignedPpsUs_ = ppsUs;
+		++stats_.ppsAligned;
+	} else {
+		++stats_.unaligned;
+		if (config_.requirePps) {
+			lastSecondUs_ = secondUs;
+			return false;
+		}
+		sample.epochUs = time.epochUs;
+		sample.monotonicUs = monotonicUs;
+		sample.errorBoundUs = config_.sentenceUncertaintyUs;
+	}
+	lastSecondUs_ = secondUs;
+	sample_ = sample;
+	hasSample_ = true;
+	++stats_.samples;
+	offsetUs_.store(sample.epochUs - sample.monotonicUs, std::memory_order_relaxed);
+	offsetValid_.store(true, std::memory_order_release);
+	return true;
+}
+
+ESPDateGnssStats ESPDateGnssClock::stats() const {
+	ESPDateGnssStats stats = stats_;
+	stats.ppsEdges = ppsEdges_.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void ESPDateGnssClock::reset() {
+	parser_.reset();
+	ppsUs_.store(-1, std::memory_order_relaxed);
+	ppsEdges_.store(0, std::memory_order_relaxed);
+	offsetValid_.store(false, std::memory_order_relaxed);
+	sample_ = ESPDateGnssSample{};
+	hasSample_ = false;
+	lastSecondUs_ = -1;
+	lastAlignedEpochUs_ = 0;
+	lastAlignedPpsUs_ = -1;
+	stats_ = ESPDateGnssStats{};
+}
+
+int64_t ESPDateGnssClock::epochMicros() const {
+	if (!offsetValid_.load(std::memory_order_acquire)) {
+		return ESPDateSystemTimeSource::instance().epochMicros();
+	}
+	return Utils::monotonicMicros() + offsetUs_.load(std::memory_order_relaxed);
+}
+
+int64_t ESPDateGnssClock::monotonicMicros() const {
+	return Utils::monotonicMicros();
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "time_source.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+enum class ESPDateNmeaSentence : uint8_t {
+	None,
+	Rmc, // recommended minimum: time, status, date (two-digit year)
+	Zda, // time and date with a four-digit year
+};
+
+// UTC carried by one checksummed RMC (status A) or ZDA sentence.
+struct ESPDateNmeaTime {
+	int64_t epochUs = 0; // includes the sentence's fractional seconds
+	ESPDateNmeaSentence sentence = ESPDateNmeaSentence::None;
+};
+
+struct ESPDateNmeaStats {
+	uint64_t bytes = 0;
+	uint32_t timeSentences = 0;  // RMC/ZDA sentences that produced a time
+	uint32_t invalidFixes = 0;   // RMC with status V (receiver has no fix yet)
+	uint32_t checksumErrors = 0; // RMC/ZDA with a missing or wrong checksum
+	uint32_t malformed = 0;      // RMC/ZDA with unparseable fields, or overlong sentences
+	uint32_t ignored = 0;        // other sentence types; skipped without checksumming
+};
+
+// Incremental NMEA 0183 reader for the sentences that carry UTC. Feed bytes as they arrive
+// from the UART, in chunks of any size; a sentence is decoded field by field while it
+// streams in, so nothing is buffered beyond one field and nothing is allocated. Talker IDs
+// (GP, GN, GL, GA, BD...) are not checked. Two-digit RMC years map to 1980..2079.
+class ESPDateNmeaParser {
+  public:
+	static constexpr size_t kMaxSentenceLength = 82; // NMEA 0183 limit, '$' to '\n'
+
+	// True when `c` completes a time sentence; time() then holds it.
+	bool feed(char c);
+	// Returns how many time sentences `data` completed; time() holds the last one.
+	size_t feed(const char *data, size_t length);
+	const ESPDateNmeaTime &time() const {
+		return time_;
+	}
+	const ESPDateNmeaStats &stats() const {
+		return stats_;
+	}
+	void reset();
+
+  private:
+	enum class State : uint8_t { Idle, Fields, Skip, Checksum };
+	static constexpr size_t kMaxFieldLength = 15;
+
+	bool finishField();
+	bool finishSentence();
+
+	State state_ = State::Idle;
+	ESPDateNmeaSentence sentence_ = ESPDateNmeaSentence::None;
+	uint8_t checksum_ = 0;
+	uint8_t expected_ = 0;
+	uint8_t checksumDigits_ = 0;
+	uint8_t field_ = 0;
+	uint8_t fieldLength_ = 0;
+	uint8_t length_ = 0;
+	bool statusValid_ = false;
+	bool fieldsOk_ = true;
+	char fieldText_[kMaxFieldLength + 1] = {};
+	int64_t secondOfDayUs_ = -1;
+	int year_ = 0;
+	int month_ = 0;
+	int day_ = 0;
+	ESPDateNmeaTime time_{};
+	ESPDateNmeaStats stats_{};
+};
+
+struct ESPDateGnssConfig {
+	// A sentence that completes within this long after a PPS edge names the second that edge
+	// started. Receivers typically finish RMC/ZDA 50-500 ms after the edge.
+	int64_t maxPpsToSentenceUs = 900000;
+	// Error bound reported for PPS-aligned samples (edge capture latency and jitter).
+	int64_t ppsUncertaintyUs = 100;
+	// Without a usable edge the sentence time is taken as the time it was received, which is
+	// late by the receiver's output delay. Set requirePps to drop such samples instead.
+	int64_t sentenceUncertaintyUs = 1000000;
+	bool requirePps = false;
+};
+
+// One UTC reading: epochUs was the time at monotonicUs.
+struct ESPDateGnssSample {
+	int64_t epochUs = 0;
+	int64_t monotonicUs = 0;
+	int64_t errorBoundUs = -1;
+	bool ppsAligned = false;
+};
+
+struct ESPDateGnssStats {
+	uint32_t samples = 0;
+	uint32_t ppsAligned = 0;
+	uint32_t ppsEdges = 0;      // onPps() calls
+	uint32_t ppsMismatches = 0; // edge spacing disagreed with the sentence times; not aligned
+	uint32_t unaligned = 0;     // no edge in the window (dropped when requirePps)
+};
+
+// GNSS time for sites without network. Feeds NMEA through ESPDateNmeaParser and pins each
+// second to the PPS edge that started it, so samples carry the edge's microsecond timing
+// instead of the UART latency. Monotonic timestamps must come from the clock of the time
+// source ESPDate uses (esp_timer_get_time() with the default one); onPps() is a single store
+// and may run in the PPS interrupt.
+//
+// Each sample goes to ESPDate::syncFromReference(), which sets the system clock and runs the
+// SNTP sync path (discipline, health, scheduler, checkpoint, callback and listeners). The
+// object is also an ESPDateTimeSource that extrapolates from the last sample on the monotonic
+// timer, for setups that leave the system clock alone.
+class ESPDateGnssClock : public ESPDateTimeSource {
+  public:
+	explicit ESPDateGnssClock(const ESPDateGnssConfig &config = ESPDateGnssConfig{})
+	    : config_(config) {
+	}
+
+	void onPps(int64_t monotonicUs);
+	// monotonicUs is when the last byte of `data` arrived. Returns true when a new sample is
+	// ready in sample().
+	bool feed(const char *data, size_t length, int64_t monotonicUs);
+	bool feed(char c, int64_t monotonicUs);
+
+	bool hasSample() const {
+		return hasSample_;
+	}
+	const ESPDateGnssSample &sample() const {
+		return sample_;
+	}
+	ESPDateGnssStats stats() const;
+	const ESPDateNmeaParser &parser() const {
+		return parser_;
+	}
+	void reset();
+
+	// Falls back to the system clock until the first sample.
+	int64_t epochMicros() const override;
+	int64_t monotonicMicros() const override;
+
+  private:
+	bool accept(const ESPDateNmeaTime &time, int64_t monotonicUs);
+
+	ESPDateGnssConfig config_;
+	ESPDateNmeaParser parser_;
+	std::atomic<int64_t> ppsUs_{-1};
+	std::atomic<uint32_t> ppsEdges_{0};
+	std::atomic<int64_t> offsetUs_{0}; // epoch minus monotonic at the last sample
+	std::atomic<bool> offsetValid_{false};
+	ESPDateGnssSample sample_{};
+	bool hasSample_ = false;
+	int64_t lastSecondUs_ = -1; // epochUs of the last sample, whole seconds
+	int64_t lastAlignedEpochUs_ = 0;
+	int64_t lastAlignedPpsUs_ = -1;
+	ESPDateGnssStats stats_{};
+};
@@ -0,0 +1,399 @@
+#include "date.h"
+#include "utils.h"
+
+#include <cstring>
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr char kDayNames[] = "SunMonTueWedThuFriSat";
+constexpr char kMonthNames[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+// Rest of the RFC 850 weekday names, after the three-letter abbreviation.
+const char *const kDayNameTails[7] = {"day", "day", "sday", "nesday", "rsday", "day", "urday"};
+
+constexpr uint32_t packName(char a, char b, char c) {
+	return static_cast<uint32_t>(static_cast<uint8_t>(a)) << 16 |
+	       static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8 |
+	       static_cast<uint32_t>(static_cast<uint8_t>(c));
+}
+
+constexpr uint32_t kDayKeys[7] = {
+    packName('S', 'u', 'n'),
+    packName('M', 'o', 'n'),
+    packName('T', 'u', 'e'),
+    packName('W', 'e', 'd'),
+    packName('T', 'h', 'u'),
+    packName('F', 'r', 'i'),
+    packName('S', 'a', 't'),
+};
+constexpr uint32_t kMonthKeys[12] = {
+    packName('J', 'a', 'n'),
+    packName('F', 'e', 'b'),
+    packName('M', 'a', 'r'),
+    packName('A', 'p', 'r'),
+    packName('M', 'a', 'y'),
+    packName('J', 'u', 'n'),
+    packName('J', 'u', 'l'),
+    packName('A', 'u', 'g'),
+    packName('S', 'e', 'p'),
+    packName('O', 'c', 't'),
+    packName('N', 'o', 'v'),
+    packName('D', 'e', 'c'),
+};
+// OR-ing 0x20 lowercases the letters and maps no other byte onto a lowercase letter.
+constexpr uint32_t kFoldCase = 0x202020;
+
+// Index of the three-letter name at p in keys, or -1. HTTP names are case-sensitive, RFC 2822
+// names are not. Stops at a NUL without reading past it.
+int lookupName(const uint32_t *keys, int count, const char *p, bool ignoreCase) {
+	if (p[0] == '\0' || p[1] == '\0' || p[2] == '\0') {
+		return -1;
+	}
+	const uint32_t fold = ignoreCase ? kFoldCase : 0;
+	const uint32_t key = packName(p[0], p[1], p[2]) | fold;
+	for (int i = 0; i < count; ++i) {
+		if ((keys[i] | fold) == key) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+struct Civil {
+	int year = 0;
+	unsigned month = 0;
+	unsigned day = 0;
+	int weekday = 0;
+	int64_t secondOfDay = 0;
+};
+
+// False when the year does not fit the four digits every one of these formats uses.
+bool splitSeconds(int64_t seconds, Civil &out) {
+	const int64_t days = Utils::floorDiv(seconds, Utils::kSecondsPerDay);
+	Utils::civilFromDays(days, out.year, out.month, out.day);
+	out.weekday = Utils::weekdayFromDays(days);
+	out.secondOfDay = seconds - days * Utils::kSecondsPerDay;
+	return out.year >= 0 && out.year <= 9999;
+}
+
+// "Sun, 06 Nov 1994 08:49:37", the part IMF-fixdate and RFC 2822 share.
+constexpr size_t kDateTimeLength = 25;
+
+void writeDateTime(const Civil &civil, char *out) {
+	std::memcpy(out, kDayNames + 3 * civil.weekday, 3);
+	out[3] = ',';
+	out[4] = ' ';
+	Utils::putTwoDigits(out + 5, civil.day);
+	out[7] = ' ';
+	std::memcpy(out + 8, kMonthNames + 3 * (civil.month - 1), 3);
+	out[11] = ' ';
+	Utils::putTwoDigits(out + 12, static_cast<unsigned>(civil.year / 100));
+	Utils::putTwoDigits(out + 14, static_cast<unsigned>(civil.year % 100));
+	out[16] = ' ';
+	const unsigned secondOfDay = static_cast<unsigned>(civil.secondOfDay);
+	Utils::putTwoDigits(out + 17, secondOfDay / 3600);
+	out[19] = ':';
+	Utils::putTwoDigits(out + 20, secondOfDay / 60 % 60);
+	out[22] = ':';
+	Utils::putTwoDigits(out + 23, secondOfDay % 60);
+}
+
+bool writeRfc2822(const Civil &civil, int offsetMinutes, char *outBuffer, size_t outSize) {
+	const int magnitude = offsetMinutes < 0 ? -offsetMinutes : offsetMinutes;
+	if (!outBuffer || outSize <= ESPDate::kRfc2822Length || magnitude >= 100 * 60) {
+		return false;
+	}
+	writeDateTime(civil, outBuffer);
+	outBuffer[kDateTimeLength] = ' ';
+	outBuffer[kDateTimeLength + 1] = offsetMinutes < 0 ? '-' : '+';
+	Utils::putTwoDigits(outBuffer + kDateTimeLength + 2, static_cast<unsigned>(magnitude / 60));
+	Utils::putTwoDigits(outBuffer + kDateTimeLength + 4, static_cast<unsigned>(magnitude % 60));
+	outBuffer[ESPDate::kRfc2822Length] = '\0';
+	return true;
+}
+
+// "HH:MM:SS" (or "HH:MM" when seconds are optional); 60 seconds is a leap second.
+bool parseClock(const char *&p, bool secondsOptional, int &secondOfDay) {
+	int hour = 0, minute = 0, second = 0;
+	if (!Utils::parseIntSlice(p, 2, 0, 23, hour) || p[2] != ':' ||
+	    !Utils::parseIntSlice(p + 3, 2, 0, 59, minute)) {
+		return false;
+	}
+	p += 5;
+	if (*p == ':') {
+		if (!Utils::parseIntSlice(p + 1, 2, 0, 60, second)) {
+			return false;
+		}
+		p += 3;
+	} else if (!secondsOptional) {
+		return false;
+	}
+	secondOfDay = hour * 3600 + minute * 60 + second;
+	return true;
+}
+
+bool toSeconds(int year, int month, int day, int secondOfDay, int64_t &out) {
+	if (year < 0 || year > 9999 || day < 1 || day > Utils::daysInMonth(year, month)) {
+		return false;
+	}
+	out = Utils::daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) *
+	          Utils::kSecondsPerDay +
+	      secondOfDay;
+	return true;
+}
+
+bool isSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+const char *skipSpace(const char *p) {
+	while (isSpace(*p)) {
+		++p;
+	}
+	return p;
+}
+
+// Reads 1..maxDigits digits.
+bool parseNumber(const char *&p, int maxDigits, int &value, int &digits) {
+	value = 0;
+	digits = 0;
+	while (*p >= '0' && *p <= '9') {
+		if (++digits > maxDigits) {
+			return false;
+		}
+		value = value * 10 + (*p++ - '0');
+	}
+	return digits > 0;
+}
+
+// RFC 2822 zone: +hhmm / -hhmm, or one of the obsolete names. -0000 ("no zone information")
+// is read as UTC.
+bool parseZone(const char *&p, int &offsetMinutes) {
+	if (*p == '+' || *p == '-') {
+		int hours = 0, minutes = 0;
+		if (!Utils::parseIntSlice(p + 1, 2, 0, 99, hours) ||
+		    !Utils::parseIntSlice(p + 3, 2, 0, 59, minutes)) {
+			return false;
+		}
+		offsetMinutes = (*p == '-' ? -1 : 1) * (hours * 60 + minutes);
+		p += 5;
+		return true;
+	}
+	static const struct {
+		const char *name;
+		int8_t hours;
+	} kZones[] = {
+	    {"UT", 0},
+	    {"UTC", 0},
+	    {"GMT", 0},
+	    {"Z", 0},
+	    {"EST", -5},
+	    {"EDT", -4},
+	    {"CST", -6},
+	    {"CDT", -5},
+	    {"MST", -7},
+	    {"MDT", -6},
+	    {"PST", -8},
+	    {"PDT", -7},
+	};
+	size_t length = 0;
+	while ((p[length] >= 'A' && p[length] <= 'Z') || (p[length] >= 'a' && p[length] <= 'z')) {
+		++length;
+	}
+	for (const auto &zone : kZones) {
+		if (std::strlen(zone.name) != length) {
+			continue;
+		}
+		size_t i = 0;
+		while (i < length && (p[i] & ~0x20) == zone.name[i]) {
+			++i;
+		}
+		if (i == length) {
+			offsetMinutes = zone.hours * 60;
+			p += length;
+			return true;
+		}
+	}
+	return false;
+}
+} // namespace
+
+bool ESPDate::formatHttpDate(const DateTime &dt, char *outBuffer, size_t outSize) const {
+	ESPDATE_PROBE(Format);
+	Civil civil;
+	if (!outBuffer || outSize <= kHttpDateLength || !splitSeconds(dt.epochSeconds, civil)) {
+		return false;
+	}
+	writeDateTime(civil, outBuffer);
+	std::memcpy(outBuffer + kDateTimeLength, " GMT", 5);
+	return true;
+}
+
+DateTimeText ESPDate::formatHttpDate(const DateTime &dt) const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return formatHttpDate(dt, buffer, size);
+	});
+}
+
+bool ESPDate::formatRfc2822Utc(const DateTime &dt, char *outBuffer, size_t outSize) const {
+	ESPDATE_PROBE(Format);
+	Civil civil;
+	return splitSeconds(dt.epochSeconds, civil) && writeRfc2822(civil, 0, outBuffer, outSize);
+}
+
+bool ESPDate::formatRfc2822Local(const DateTime &dt, char *outBuffer, size_t outSize) const {
+	ESPDATE_PROBE(Format);
+	const LocalDateTime local = toLocal(dt);
+	Civil civil;
+	return local.ok &&
+	       splitSeconds(dt.epochSeconds + int64_t{local.offsetMinutes} * 60, civil) &&
+	       writeRfc2822(civil, local.offsetMinutes, outBuffer, outSize);
+}
+
+DateTimeText ESPDate::formatRfc2822Utc(const DateTime &dt) const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return formatRfc2822Utc(dt, buffer, size);
+	});
+}
+
+DateTimeText ESPDate::formatRfc2822Local(const DateTime &dt) const {
+	return DateTimeText::write([&](char *buffer, size_t size) {
+		return formatRfc2822Local(dt, buffer, size);
+	});
+}
+
+ESPDate::ParseResult ESPDate::parseHttpDate(const char *str) const {
+	ESPDATE_PROBE(Parse);
+	ParseResult result{false, DateTime{}};
+	const int weekday = str ? lookupName(kDayKeys, 7, str, false) : -1;
+	if (weekday < 0) {
+		return result;
+	}
+	int year = 0, month = 0, day = 0, secondOfDay = 0;
+	const char *p = str;
+
+	if (str[3] == ',') {
+		// IMF-fixdate: "Sun, 06 Nov 1994 08:49:37 GMT"
+		if (str[4] != ' ') {
+			return result;
+		}
+		p = str + 5;
+		if (!Utils::parseIntSlice(p, 2, 1, 31, day) || p[2] != ' ') {
+			return result;
+		}
+		month = lookupName(kMonthKeys, 12, p + 3, false) + 1;
+		if (month == 0 || p[6] != ' ' || !Utils::parseIntSlice(p + 7, 4, 0, 9999, year) ||
+		    p[11] != ' ') {
+			return result;
+		}
+		p += 12;
+		if (!parseClock(p, false, secondOfDay) || std::strcmp(p, " GMT") != 0) {
+			return result;
+		}
+	} else if (str[3] == ' ') {
+		// asctime: "Sun Nov  6 08:49:37 1994"
+		p = str + 4;
+		month = lookupName(kMonthKeys, 12, p, false) + 1;
+		if (month == 0 || p[3] != ' ' ||
+		    !Utils::parseIntSlice(p[4] == ' ' ? p + 5 : p + 4, p[4] == ' ' ? 1 : 2, 1, 31, day) ||
+		    p[6] != ' ') {
+			return result;
+		}
+		p += 7;
+		if (!parseClock(p, false, secondOfDay) || *p != ' ' ||
+		    !Utils::parseIntSlice(p + 1, 4, 0, 9999, year) || p[5] != '\0') {
+			return result;
+		}
+	} else {
+		// RFC 850: "Sunday, 06-Nov-94 08:49:37 GMT"
+		const size_t tailLength = std::strlen(kDayNameTails[weekday]);
+		if (std::strncmp(str + 3, kDayNameTails[weekday], tailLength) != 0) {
+			return result;
+		}
+		p = str + 3 + tailLength;
+		int twoDigitYear = 0;
+		if (p[0] != ',' || p[1] != ' ' || !Utils::parseIntSlice(p + 2, 2, 1, 31, day) ||
+		    p[4] != '-') {
+			return result;
+		}
+		month = lookupName(kMonthKeys, 12, p + 5, false) + 1;
+		if (month == 0 || p[8] != '-' || !Utils::parseIntSlice(p + 9, 2, 0, 99, twoDigitYear) ||
+		    p[11] != ' ') {
+			return result;
+		}
+		p += 12;
+		if (!parseClock(p, false, secondOfDay) || std::strcmp(p, " GMT") != 0) {
+			return result;
+		}
+		// RFC 7231 7.1.1.1: a year more than 50 years ahead is the latest matching past year.
+		Civil today;
+		splitSeconds(now().epochSeconds, today);
+		year = today.year - today.year % 100 + twoDigitYear;
+		if (year > today.year + 50) {
+			year -= 100;
+		} else if (year + 100 <= today.year + 50) {
+			year += 100;
+		}
+	}
+
+	int64_t seconds = 0;
+	if (!toSeconds(year, month, day, secondOfDay, seconds)) {
+		return result;
+	}
+	result.ok = true;
+	result.value = DateTime{seconds};
+	return result;
+}
+
+ESPDate::ParseResult ESPDate::parseRfc2822(const char *str) const {
+	ESPDATE_PROBE(Parse);
+	ParseResult result{false, DateTime{}};
+	if (!str) {
+		return result;
+	}
+	const char *p = skipSpace(str);
+	if (lookupName(kDayKeys, 7, p, true) >= 0) {
+		p = skipSpace(p + 3);
+		if (*p != ',') {
+			return result;
+		}
+		++p;
+	}
+
+	int day = 0, year = 0, digits = 0, secondOfDay = 0, offsetMinutes = 0;
+	p = skipSpace(p);
+	if (!parseNumber(p, 2, day, digits) || !isSpace(*p)) {
+		return result;
+	}
+	p = skipSpace(p);
+	const int month = lookupName(kMonthKeys, 12, p, true) + 1;
+	if (month == 0 || !isSpace(p[3])) {
+		return result;
+	}
+	p = skipSpace(p + 3);
+	if (!parseNumber(p, 4, year, digits) || digits < 2 || !isSpace(*p)) {
+		return result;
+	}
+	// Obsolete short years: 00-49 are 2000-2049, 50-99 and three digits count from 1900.
+	if (digits == 2) {
+		year += year < 50 ? 2000 : 1900;
+	} else if (digits == 3) {
+		year += 1900;
+	}
+	p = skipSpace(p);
+	if (!parseClock(p, true, secondOfDay) || !isSpace(*p)) {
+		return result;
+	}
+	p = skipSpace(p);
+	if (!parseZone(p, offsetMinutes) || *skipSpace(p) != '\0') {
+		return result;
+	}
+
+	int64_t seconds = 0;
+	if (!toSeconds(year, month, day, secondOfDay, seconds)) {
+		return result;
+	}
+	result.ok = true;
+	result.value = DateTime{seconds - int64_t{offsetMinutes} * 60};
+	return result;
+}
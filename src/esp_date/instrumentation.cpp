@@ -0,0 +1,204 @@
+#include "instrumentation.h"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+
+namespace {
+constexpr size_t kProbeCount = static_cast<size_t>(ESPDateProbe::Count);
+constexpr size_t kCounterCount = static_cast<size_t>(ESPDateCounter::Count);
+
+const char *const kProbeNames[kProbeCount] = {
+    "toLocal",
+    "fromLocal",
+    "format",
+    "parse",
+    "sun",
+    "moon",
+    "ntpDispatch",
+};
+
+const char *const kCounterNames[kCounterCount] = {
+    "scopedTzSwaps",
+    "heapAllocations",
+    "coarseClockRefreshes",
+};
+
+#if ESPDATE_INSTRUMENTATION
+struct ProbeCells {
+	std::atomic<uint32_t> calls{0};
+	std::atomic<uint64_t> totalTicks{0};
+	std::atomic<uint32_t> maxTicks{0};
+	std::atomic<uint32_t> histogram[ESPDateProbeStats::kBuckets];
+};
+
+ProbeCells probeCells[kProbeCount];
+std::atomic<uint32_t> counterCells[kCounterCount];
+
+size_t bucketFor(uint32_t ticks) {
+	size_t bucket = 0;
+	uint32_t limit = ESPDateProbeStats::kFirstBucketTicks;
+	while (bucket + 1 < ESPDateProbeStats::kBuckets && ticks >= limit) {
+		limit <<= 1;
+		++bucket;
+	}
+	return bucket;
+}
+
+const char *clockName() {
+#if ESPDATE_PROBE_CLOCK_CYCLES
+	return "cycles";
+#elif ESPDATE_PROBE_CLOCK_TSC
+	return "tsc";
+#else
+	return "ns";
+#endif
+}
+#endif
+
+// snprintf onto the tail of the buffer; false once the output no longer fits.
+bool append(char *out, size_t outSize, size_t &length, const char *format, ...) {
+	if (length >= outSize) {
+		return false;
+	}
+	va_list args;
+	va_start(args, format);
+	const int written = vsnprintf(out + length, outSize - length, format, args);
+	va_end(args);
+	if (written < 0 || static_cast<size_t>(written) >= outSize - length) {
+		length = outSize;
+		return false;
+	}
+	length += static_cast<size_t>(written);
+	return true;
+}
+} // namespace
+
+void ESPDateInstrumentation::record(ESPDateProbe probe, uint32_t ticks) {
+#if ESPDATE_INSTRUMENTATION
+	ProbeCells &cells = probeCells[static_cast<size_t>(probe)];
+	cells.calls.fetch_add(1, std::memory_order_relaxed);
+	cells.totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+	cells.histogram[bucketFor(ticks)].fetch_add(1, std::memory_order_relaxed);
+	uint32_t seen = cells.maxTicks.load(std::memory_order_relaxed);
+	while (ticks > seen &&
+	       !cells.maxTicks.compare_exchange_weak(seen, ticks, std::memory_order_relaxed)) {
+	}
+#else
+	(void)probe;
+	(void)ticks;
+#endif
+}
+
+void ESPDateInstrumentation::count(ESPDateCounter counter) {
+#if ESPDATE_INSTRUMENTATION
+	counterCells[static_cast<size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+#else
+	(void)counter;
+#endif
+}
+
+ESPDateInstrumentationSnapshot ESPDateInstrumentation::snapshot() {
+	ESPDateInstrumentationSnapshot result;
+#if ESPDATE_INSTRUMENTATION
+	result.enabled = true;
+	result.clock = clockName();
+	for (size_t i = 0; i < kProbeCount; ++i) {
+		const ProbeCells &cells = probeCells[i];
+		ESPDateProbeStats &stats = result.probes[i];
+		stats.calls = cells.calls.load(std::memory_order_relaxed);
+		stats.totalTicks = cells.totalTicks.load(std::memory_order_relaxed);
+		stats.maxTicks = cells.maxTicks.load(std::memory_order_relaxed);
+		for (size_t b = 0; b < ESPDateProbeStats::kBuckets; ++b) {
+			stats.histogram[b] = cells.histogram[b].load(std::memory_order_relaxed);
+		}
+	}
+	for (size_t i = 0; i < kCounterCount; ++i) {
+		result.counters[i] = counterCells[i].load(std::memory_order_relaxed);
+	}
+#endif
+	return result;
+}
+
+void ESPDateInstrumentation::reset() {
+#if ESPDATE_INSTRUMENTATION
+	for (ProbeCells &cells : probeCells) {
+		cells.calls.store(0, std::memory_order_relaxed);
+		cells.totalTicks.store(0, std::memory_order_relaxed);
+		cells.maxTicks.store(0, std::memory_order_relaxed);
+		for (std::atomic<uint32_t> &bucket : cells.histogram) {
+			bucket.store(0, std::memory_order_relaxed);
+		}
+	}
+	for (std::atomic<uint32_t> &counter : counterCells) {
+		counter.store(0, std::memory_order_relaxed);
+	}
+#endif
+}
+
+const char *ESPDateInstrumentation::probeName(ESPDateProbe probe) {
+	const size_t index = static_cast<size_t>(probe);
+	return index < kProbeCount ? kProbeNames[index] : "unknown";
+}
+
+const char *ESPDateInstrumentation::counterName(ESPDateCounter counter) {
+	const size_t index = static_cast<size_t>(counter);
+	return index < kCounterCount ? kCounterNames[index] : "unknown";
+}
+
+bool ESPDateInstrumentation::toJson(
+    const ESPDateInstrumentationSnapshot &snapshot, char *out, size_t outSize
+) {
+	if (!out || outSize == 0) {
+		return false;
+	}
+	out[0] = '\0';
+	size_t length = 0;
+	bool ok = append(
+	    out,
+	    outSize,
+	    length,
+	    "{\"enabled\":%s,\"clock\":\"%s\",\"firstBucketTicks\":%lu,\"probes\":{",
+	    snapshot.enabled ? "true" : "false",
+	    snapshot.clock,
+	    static_cast<unsigned long>(ESPDateProbeStats::kFirstBucketTicks)
+	);
+	for (size_t i = 0; ok && i < kProbeCount; ++i) {
+		const ESPDateProbeStats &stats = snapshot.probes[i];
+		ok = append(
+		    out,
+		    outSize,
+		    length,
+		    "%s\"%s\":{\"calls\":%lu,\"ticks\":%llu,\"maxTicks\":%lu,\"histogram\":[",
+		    i == 0 ? "" : ",",
+		    kProbeNames[i],
+		    static_cast<unsigned long>(stats.calls),
+		    static_cast<unsigned long long>(stats.totalTicks),
+		    static_cast<unsigned long>(stats.maxTicks)
+		);
+		for (size_t b = 0; ok && b < ESPDateProbeStats::kBuckets; ++b) {
+			ok = append(
+			    out,
+			    outSize,
+			    length,
+			    "%s%lu",
+			    b == 0 ? "" : ",",
+			    static_cast<unsigned long>(stats.histogram[b])
+			);
+		}
+		ok = ok && append(out, outSize, length, "]}");
+	}
+	ok = ok && append(out, outSize, length, "},\"counters\":{");
+	for (size_t i = 0; ok && i < kCounterCount; ++i) {
+		ok = append(
+		    out,
+		    outSize,
+		    length,
+		    "%s\"%s\":%lu",
+		    i == 0 ? "" : ",",
+		    kCounterNames[i],
+		    static_cast<unsigned long>(snapshot.counters[i])
+		);
+	}
+	return ok && append(out, outSize, length, "}}");
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Opt-in call counters and latency histograms for the hot entry points. Build with
+// -DESPDATE_INSTRUMENTATION=1 to record; otherwise every probe expands to nothing and the
+// snapshot API reports enabled == false.
+#ifndef ESPDATE_INSTRUMENTATION
+#define ESPDATE_INSTRUMENTATION 0
+#endif
+
+#if ESPDATE_INSTRUMENTATION
+#if defined(ESP_PLATFORM) && defined(__has_include)
+#if __has_include(<esp_cpu.h>) && __has_include(<esp_idf_version.h>)
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5 // esp_cpu_get_cycle_count() arrived with IDF 5
+#include <esp_cpu.h>
+#define ESPDATE_PROBE_CLOCK_CYCLES 1
+#endif
+#endif
+#endif
+#ifndef ESPDATE_PROBE_CLOCK_CYCLES
+#define ESPDATE_PROBE_CLOCK_CYCLES 0
+#endif
+#if !ESPDATE_PROBE_CLOCK_CYCLES && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define ESPDATE_PROBE_CLOCK_TSC 1
+#endif
+#ifndef ESPDATE_PROBE_CLOCK_TSC
+#define ESPDATE_PROBE_CLOCK_TSC 0
+#endif
+#if !ESPDATE_PROBE_CLOCK_CYCLES && !ESPDATE_PROBE_CLOCK_TSC
+#include <chrono>
+#endif
+#endif
+
+enum class ESPDateProbe : uint8_t {
+	ToLocal,
+	FromLocal,
+	Format, // formatWithPattern*, DateTime/LocalDateTime string methods
+	Parse,  // parseIso8601Utc, parseDateTimeLocal
+	Sun,    // sunrise/sunset
+	Moon,   // moonPhase
+	NtpDispatch,
+	Count,
+};
+
+enum class ESPDateCounter : uint8_t {
+	ScopedTzSwap,       // TZ environment swaps (setenv + tzset and the restore)
+	HeapAllocation,     // allocations that reached the heap / ESPBufferManager
+	CoarseClockRefresh, // nowCoarse() & co. rebuilding their per-second sample
+	Count,
+};
+
+struct ESPDateProbeStats {
+	// Bucket i counts calls below kFirstBucketTicks << i ticks; the last bucket is open-ended.
+	static constexpr size_t kBuckets = 16;
+	static constexpr uint32_t kFirstBucketTicks = 64;
+
+	uint32_t calls = 0;
+	uint64_t totalTicks = 0;
+	uint32_t maxTicks = 0;
+	uint32_t histogram[kBuckets]{};
+};
+
+struct ESPDateInstrumentationSnapshot {
+	bool enabled = false;
+	const char *clock = "none"; // "cycles" (CPU cycle counter), "tsc" or "ns"
+	ESPDateProbeStats probes[static_cast<size_t>(ESPDateProbe::Count)];
+	uint32_t counters[static_cast<size_t>(ESPDateCounter::Count)]{};
+};
+
+// Process-wide recorder. Updates are relaxed atomics, so probes may fire from any task; a
+// snapshot taken while calls are in flight can be off by those calls.
+class ESPDateInstrumentation {
+  public:
+	// Enough for toJson() with every field at its maximum.
+	static constexpr size_t kMaxJsonSize = 2304;
+
+	static ESPDateInstrumentationSnapshot snapshot();
+	static void reset();
+	// Writes the snapshot as one JSON object; false (with out truncated) when it does not fit.
+	static bool toJson(const ESPDateInstrumentationSnapshot &snapshot, char *out, size_t outSize);
+	static const char *probeName(ESPDateProbe probe);
+	static const char *counterName(ESPDateCounter counter);
+
+	static void record(ESPDateProbe probe, uint32_t ticks);
+	static void count(ESPDateCounter counter);
+
+	static uint32_t ticks() {
+#if !ESPDATE_INSTRUMENTATION
+		return 0;
+#elif ESPDATE_PROBE_CLOCK_CYCLES
+		return static_cast<uint32_t>(esp_cpu_get_cycle_count());
+#elif ESPDATE_PROBE_CLOCK_TSC
+		return static_cast<uint32_t>(__rdtsc());
+#else
+		return static_cast<uint32_t>(
+		    std::chrono::duration_cast<std::chrono::nanoseconds>(
+		        std::chrono::steady_clock::now().time_since_epoch()
+		    )
+		        .count()
+		);
+#endif
+	}
+};
+
+// Times the enclosing scope. Tick deltas are taken modulo 2^32, which covers any single call.
+class ESPDateProbeScope {
+  public:
+	explicit ESPDateProbeScope(ESPDateProbe probe)
+	    : probe_(probe), started_(ESPDateInstrumentation::ticks()) {
+	}
+	~ESPDateProbeScope() {
+		ESPDateInstrumentation::record(probe_, ESPDateInstrumentation::ticks() - started_);
+	}
+	ESPDateProbeScope(const ESPDateProbeScope &) = delete;
+	ESPDateProbeScope &operator=(const ESPDateProbeScope &) = delete;
+
+  private:
+	ESPDateProbe probe_;
+	uint32_t started_;
+};
+
+#if ESPDATE_INSTRUMENTATION
+#define ESPDATE_PROBE(probe) ESPDateProbeScope espDateProbeScope_(ESPDateProbe::probe)
+#define ESPDATE_COUNT(counter) ESPDateInstrumentation::count(ESPDateCounter::counter)
+#else
+#define ESPDATE_PROBE(probe) static_cast<void>(0)
+#define ESPDATE_COUNT(counter) static_cast<void>(0)
+#endif
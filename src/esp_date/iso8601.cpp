@@ -0,0 +1,128 @@
+#include "iso8601.h"
+#include "date.h"
+#include "utils.h"
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr size_t kFieldsLength = 19; // YYYY-MM-DDTHH:MM:SS
+
+bool validFields(int year, int month, int day, int hour, int minute, int second) {
+	return year >= 0 && year <= 9999 && month >= 1 && month <= 12 && day >= 1 &&
+	       day <= Utils::daysInMonth(year, month) && Utils::validHms(hour, minute, second);
+}
+
+void writeFields(int year, int month, int day, int hour, int minute, int second, char *out) {
+	Utils::putTwoDigits(out, static_cast<unsigned>(year / 100));
+	Utils::putTwoDigits(out + 2, static_cast<unsigned>(year % 100));
+	out[4] = '-';
+	Utils::putTwoDigits(out + 5, static_cast<unsigned>(month));
+	out[7] = '-';
+	Utils::putTwoDigits(out + 8, static_cast<unsigned>(day));
+	out[10] = 'T';
+	Utils::putTwoDigits(out + 11, static_cast<unsigned>(hour));
+	out[13] = ':';
+	Utils::putTwoDigits(out + 14, static_cast<unsigned>(minute));
+	out[16] = ':';
+	Utils::putTwoDigits(out + 17, static_cast<unsigned>(second));
+}
+} // namespace
+
+bool ESPDateIso8601Codec::writeUtc(const DateTime &dt, char *outBuffer, size_t outSize) {
+	if (!outBuffer || outSize <= kUtcLength) {
+		return false;
+	}
+	const LocalDateTime utc = Utils::localFromOffset(dt, 0);
+	if (utc.year < 0 || utc.year > 9999) {
+		return false;
+	}
+	writeFields(utc.year, utc.month, utc.day, utc.hour, utc.minute, utc.second, outBuffer);
+	outBuffer[kFieldsLength] = 'Z';
+	outBuffer[kUtcLength] = '\0';
+	return true;
+}
+
+bool ESPDateIso8601Codec::writeLocal(const LocalDateTime &local, char *outBuffer, size_t outSize) {
+	const int magnitude = local.offsetMinutes < 0 ? -local.offsetMinutes : local.offsetMinutes;
+	if (!outBuffer || outSize <= kLocalLength || !local.ok || magnitude >= 100 * 60 ||
+	    !validFields(local.year, local.month, local.day, local.hour, local.minute, local.second)) {
+		return false;
+	}
+	writeFields(
+	    local.year, local.month, local.day, local.hour, local.minute, local.second, outBuffer
+	);
+	outBuffer[kFieldsLength] = local.offsetMinutes < 0 ? '-' : '+';
+	Utils::putTwoDigits(outBuffer + kFieldsLength + 1, static_cast<unsigned>(magnitude / 60));
+	Utils::putTwoDigits(outBuffer + kFieldsLength + 3, static_cast<unsigned>(magnitude % 60));
+	outBuffer[kLocalLength] = '\0';
+	return true;
+}
+
+bool ESPDateIso8601Codec::parse(const char *str, DateTime &utc, int &offsetMinutes) {
+	if (!str) {
+		return false;
+	}
+	// Fields are checked in order, so no read goes past a terminator.
+	int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+	if (!Utils::parseIntSlice(str, 4, 0, 9999, year) || str[4] != '-' ||
+	    !Utils::parseIntSlice(str + 5, 2, 1, 12, month) || str[7] != '-' ||
+	    !Utils::parseIntSlice(str + 8, 2, 1, 31, day) ||
+	    (str[10] != 'T' && str[10] != 't' && str[10] != ' ') ||
+	    !Utils::parseIntSlice(str + 11, 2, 0, 23, hour) || str[13] != ':' ||
+	    !Utils::parseIntSlice(str + 14, 2, 0, 59, minute) || str[16] != ':' ||
+	    !Utils::parseIntSlice(str + 17, 2, 0, 60, second) ||
+	    day > Utils::daysInMonth(year, month)) {
+		return false;
+	}
+
+	const char *p = str + kFieldsLength;
+	if (*p == '.' || *p == ',') {
+		const char *digits = ++p;
+		while (*p >= '0' && *p <= '9') {
+			++p;
+		}
+		if (p == digits) {
+			return false;
+		}
+	}
+	int offset = 0;
+	if (*p == 'Z' || *p == 'z') {
+		++p;
+	} else if (*p == '+' || *p == '-') {
+		int hours = 0, minutes = 0;
+		const char *minuteText = p + 3 + (p[1] != '\0' && p[2] != '\0' && p[3] == ':' ? 1 : 0);
+		if (!Utils::parseIntSlice(p + 1, 2, 0, 99, hours) ||
+		    !Utils::parseIntSlice(minuteText, 2, 0, 59, minutes)) {
+			return false;
+		}
+		offset = (*p == '-' ? -1 : 1) * (hours * 60 + minutes);
+		p = minuteText + 2;
+	} else {
+		return false;
+	}
+	if (*p != '\0') {
+		return false;
+	}
+
+	const int64_t local =
+	    Utils::daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) *
+	        Utils::kSecondsPerDay +
+	    hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second;
+	utc = DateTime{local - offset * Utils::kSecondsPerMinute};
+	offsetMinutes = offset;
+	return true;
+}
+
+bool ESPDateIso8601Codec::parseLocal(const char *str, LocalDateTime &out) {
+	DateTime utc{};
+	int offsetMinutes = 0;
+	if (!parse(str, utc, offsetMinutes)) {
+		return false;
+	}
+	out = atOffset(utc, offsetMinutes);
+	return true;
+}
+
+LocalDateTime ESPDateIso8601Codec::atOffset(const DateTime &utc, int offsetMinutes) {
+	return Utils::localFromOffset(utc, offsetMinutes * static_cast<int32_t>(60));
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct DateTime;
+struct LocalDateTime;
+
+// Fixed-width ISO-8601 text for serializers that stamp many values (JSON payloads, CSV rows).
+// Digits come from a table instead of strftime, and nothing reads the process TZ: local text
+// uses the fields and offset a LocalDateTime already carries. Buffers need one byte past the
+// length for the terminator; years outside 0..9999 fail.
+class ESPDateIso8601Codec {
+  public:
+	static constexpr size_t kUtcLength = 20;   // "2025-01-02T03:04:05Z"
+	static constexpr size_t kLocalLength = 24; // "2025-01-02T04:04:05+0100"
+
+	static bool writeUtc(const DateTime &dt, char *outBuffer, size_t outSize);
+	static bool writeLocal(const LocalDateTime &local, char *outBuffer, size_t outSize);
+
+	// "YYYY-MM-DDTHH:MM:SS" ('T', 't' or ' '), an optional fraction that is dropped, then 'Z',
+	// "+hhmm" or "+hh:mm". Returns the instant and the offset as written.
+	static bool parse(const char *str, DateTime &utc, int &offsetMinutes);
+	// The same, keeping the wall time as written.
+	static bool parseLocal(const char *str, LocalDateTime &out);
+	// utc broken down at a fixed offset (minutes east of UTC), the way parseLocal fills it.
+	static LocalDateTime atOffset(const DateTime &utc, int offsetMinutes);
+};
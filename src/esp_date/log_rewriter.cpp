@@ -0,0 +1,427 @@
+#include "log_rewriter.h"
+#include "civil_cache.h"
+#include "date.h"
+#include "utils.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(__has_include) && !defined(ESP_PLATFORM)
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ESPDATE_HAS_MMAP 1
+#endif
+#endif
+#ifndef ESPDATE_HAS_MMAP
+#define ESPDATE_HAS_MMAP 0
+#endif
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr size_t kCoreLength = 19; // YYYY-MM-DD?HH:MM:SS
+constexpr size_t kMaxFractionDigits = 9;
+constexpr size_t kMaxStampText = kCoreLength + 1 + kMaxFractionDigits + 5;
+
+struct ParsedStamp {
+	int64_t utc = 0;
+	size_t length = 0;         // text consumed, including fraction and 'Z'
+	size_t fractionLength = 0; // including the separator
+};
+
+struct Edit {
+	size_t offset = 0;
+	size_t inLength = 0;
+	size_t outLength = 0;
+	char text[kMaxStampText];
+};
+
+bool isWordChar(char c) {
+	return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+	       c == '+' || c == '-';
+}
+
+bool parseStamp(const char *p, size_t available, ParsedStamp &out) {
+	if (available < kCoreLength || p[4] != '-' || p[7] != '-' || (p[10] != 'T' && p[10] != ' ') ||
+	    p[13] != ':' || p[16] != ':') {
+		return false;
+	}
+	int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+	if (!Utils::parseIntSlice(p, 4, 0, 9999, year) ||
+	    !Utils::parseIntSlice(p + 5, 2, 1, 12, month) ||
+	    !Utils::parseIntSlice(p + 8, 2, 1, 31, day) ||
+	    !Utils::parseIntSlice(p + 11, 2, 0, 23, hour) ||
+	    !Utils::parseIntSlice(p + 14, 2, 0, 59, minute) ||
+	    !Utils::parseIntSlice(p + 17, 2, 0, 60, second) || day > Utils::daysInMonth(year, month)) {
+		return false;
+	}
+
+	size_t length = kCoreLength;
+	if (length < available && (p[length] == '.' || p[length] == ',')) {
+		size_t digits = 0;
+		while (length + 1 + digits < available && p[length + 1 + digits] >= '0' &&
+		       p[length + 1 + digits] <= '9') {
+			++digits;
+		}
+		if (digits == 0 || digits > kMaxFractionDigits) {
+			return false;
+		}
+		length += 1 + digits;
+	}
+	out.fractionLength = length - kCoreLength;
+	if (length < available && p[length] == 'Z') {
+		++length;
+	} else if (length < available && isWordChar(p[length])) {
+		return false; // carries its own offset, or is not a stamp at all
+	}
+	out.length = length;
+	out.utc = Utils::daysFromCivil(year, month, day) * Utils::kSecondsPerDay +
+	          hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second;
+	return true;
+}
+
+// Formats local stamps, keeping the zone span and the date text of the current day.
+class StampWriter {
+  public:
+	StampWriter(const ESPDatePosixTz &zone, ESPDateLogStampStyle style)
+	    : offsets_(zone), style_(style) {
+	}
+
+	// Returns the text length, or 0 when the local year does not fit four digits.
+	size_t write(const char *source, const ParsedStamp &stamp, char *out) {
+		const int32_t offset = offsets_.at(stamp.utc);
+		const int64_t local = stamp.utc + offset;
+		const int64_t days = Utils::floorDiv(local, Utils::kSecondsPerDay);
+		if (!days_.valid || days != days_.days) {
+			days_.load(days);
+			if (days_.year < 0 || days_.year > 9999) {
+				days_.valid = false;
+				return 0;
+			}
+			Utils::putTwoDigits(dayText_, static_cast<unsigned>(days_.year / 100));
+			Utils::putTwoDigits(dayText_ + 2, static_cast<unsigned>(days_.year % 100));
+			dayText_[4] = '-';
+			Utils::putTwoDigits(dayText_ + 5, days_.month);
+			dayText_[7] = '-';
+			Utils::putTwoDigits(dayText_ + 8, days_.day);
+		}
+
+		const unsigned secondOfDay = static_cast<unsigned>(local - days * Utils::kSecondsPerDay);
+		memcpy(out, dayText_, sizeof(dayText_));
+		out[10] = style_ == ESPDateLogStampStyle::Iso8601 ? 'T' : ' ';
+		Utils::putTwoDigits(out + 11, secondOfDay / 3600);
+		out[13] = ':';
+		Utils::putTwoDigits(out + 14, secondOfDay / 60 % 60);
+		out[16] = ':';
+		Utils::putTwoDigits(out + 17, secondOfDay % 60);
+		size_t length = kCoreLength;
+		memcpy(out + length, source + kCoreLength, stamp.fractionLength);
+		length += stamp.fractionLength;
+		if (style_ == ESPDateLogStampStyle::Iso8601) {
+			const unsigned minutes = static_cast<unsigned>((offset < 0 ? -offset : offset) / 60);
+			out[length] = offset < 0 ? '-' : '+';
+			Utils::putTwoDigits(out + length + 1, minutes / 60);
+			Utils::putTwoDigits(out + length + 3, minutes % 60);
+			length += 5;
+		}
+		return length;
+	}
+
+  private:
+	ESPDateOffsetCursor offsets_;
+	ESPDateDayCache days_;
+	ESPDateLogStampStyle style_;
+	char dayText_[10] = {};
+};
+
+// Large enough for a whole window even if every line grows.
+size_t bufferCapacityFor(size_t chunkBytes, size_t columns) {
+	return chunkBytes + (chunkBytes / kCoreLength + 1) * columns *
+	                        ESPDateLogRewriter::kMaxGrowthPerStamp;
+}
+
+#if ESPDATE_HAS_MMAP
+// The mapping is read-only and every window goes through buffer: writing in place would
+// fault in a copy-on-write page for each 4 KiB, which costs more than the copy it saves.
+bool rewriteMapped(
+    ESPDateLogRewriter &rewriter,
+    const char *inPath,
+    FILE *output,
+    char *buffer,
+    size_t bufferCapacity,
+    size_t chunkBytes
+) {
+	const int fd = open(inPath, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat info {};
+	if (fstat(fd, &info) != 0) {
+		close(fd);
+		return false;
+	}
+	const size_t fileSize = static_cast<size_t>(info.st_size);
+	if (fileSize == 0) {
+		close(fd);
+		return true;
+	}
+	void *mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		return false;
+	}
+	madvise(mapped, fileSize, MADV_SEQUENTIAL);
+
+	const char *data = static_cast<const char *>(mapped);
+	size_t position = 0;
+	bool ok = true;
+	while (ok && position < fileSize) {
+		const size_t window = fileSize - position < chunkBytes ? fileSize - position : chunkBytes;
+		const bool last = position + window == fileSize;
+		const ESPDateLogRewriter::Result result =
+		    rewriter.rewrite(data + position, window, buffer, bufferCapacity, last);
+		size_t consumed = result.consumed;
+		ok = result.written == 0 || fwrite(buffer, 1, result.written, output) == result.written;
+		if (ok && consumed == 0) {
+			// A line longer than the window: pass it through untouched.
+			const void *newline = memchr(data + position, '\n', fileSize - position);
+			consumed = newline ? static_cast<const char *>(newline) - (data + position) + 1
+			                   : fileSize - position;
+			ok = fwrite(data + position, 1, consumed, output) == consumed;
+		}
+		position += consumed;
+	}
+	munmap(mapped, fileSize);
+	return ok;
+}
+#endif
+
+// Writes window[0, size) to output, rewriting in place where the line lengths allow and
+// through buffer otherwise. consumed stops short of a trailing partial line.
+bool pump(
+    ESPDateLogRewriter &rewriter,
+    char *window,
+    size_t size,
+    bool endOfInput,
+    char *buffer,
+    size_t bufferCapacity,
+    FILE *output,
+    size_t &consumed
+) {
+	consumed = 0;
+	while (consumed < size) {
+		char *rest = window + consumed;
+		ESPDateLogRewriter::Result result =
+		    rewriter.rewrite(rest, size - consumed, rest, size - consumed, endOfInput);
+		if (result.written > 0 && fwrite(rest, 1, result.written, output) != result.written) {
+			return false;
+		}
+		consumed += result.consumed;
+		if (!result.needsBuffer) {
+			return true;
+		}
+		rest = window + consumed;
+		result = rewriter.rewrite(rest, size - consumed, buffer, bufferCapacity, endOfInput);
+		if (result.written > 0 && fwrite(buffer, 1, result.written, output) != result.written) {
+			return false;
+		}
+		consumed += result.consumed;
+		if (result.consumed == 0) {
+			return true;
+		}
+	}
+	return true;
+}
+
+bool rewriteChunked(
+    ESPDateLogRewriter &rewriter,
+    const char *inPath,
+    FILE *output,
+    char *buffer,
+    size_t bufferCapacity,
+    size_t chunkBytes
+) {
+	FILE *input = fopen(inPath, "rb");
+	if (!input) {
+		return false;
+	}
+	char *window = static_cast<char *>(date_allocator_detail::heapAllocate(chunkBytes, false));
+	if (!window) {
+		fclose(input);
+		return false;
+	}
+
+	size_t filled = 0;
+	bool atEnd = false;
+	bool passThrough = false; // inside a line longer than the window
+	bool ok = true;
+	while (ok) {
+		if (!atEnd) {
+			const size_t wanted = chunkBytes - filled;
+			const size_t got = fread(window + filled, 1, wanted, input);
+			filled += got;
+			if (got < wanted) {
+				ok = !ferror(input);
+				atEnd = true;
+			}
+		}
+		if (!ok || filled == 0) {
+			break;
+		}
+
+		size_t consumed = 0;
+		if (passThrough) {
+			const void *newline = memchr(window, '\n', filled);
+			consumed = newline ? static_cast<const char *>(newline) - window + 1 : filled;
+			passThrough = newline == nullptr;
+			ok = fwrite(window, 1, consumed, output) == consumed;
+		} else {
+			ok = pump(rewriter, window, filled, atEnd, buffer, bufferCapacity, output, consumed);
+			if (ok && consumed == 0 && filled == chunkBytes) {
+				consumed = filled;
+				passThrough = true;
+				ok = fwrite(window, 1, consumed, output) == consumed;
+			}
+		}
+		if (consumed == 0 && atEnd) {
+			break;
+		}
+		memmove(window, window + consumed, filled - consumed);
+		filled -= consumed;
+	}
+
+	date_allocator_detail::heapDeallocate(window);
+	fclose(input);
+	return ok;
+}
+} // namespace
+
+bool ESPDateLogRewriter::begin(const ESPDateLogRewriterConfig &config) {
+	ready_ = false;
+	if (config.columnCount == 0 || config.columnCount > ESPDateLogRewriterConfig::kMaxColumns) {
+		return false;
+	}
+	const bool zoneOk =
+	    config.timeZone ? zone_.parse(config.timeZone) : Utils::processPosixTz(zone_);
+	if (!zoneOk) {
+		return false;
+	}
+	config_ = config;
+	// Columns are matched left to right so that edits can be applied in one pass.
+	for (size_t i = 1; i < config_.columnCount; ++i) {
+		for (size_t j = i; j > 0 && config_.columns[j] < config_.columns[j - 1]; --j) {
+			const size_t column = config_.columns[j];
+			config_.columns[j] = config_.columns[j - 1];
+			config_.columns[j - 1] = column;
+		}
+	}
+	ready_ = true;
+	return true;
+}
+
+ESPDateLogRewriter::Result ESPDateLogRewriter::rewrite(
+    const char *in, size_t inSize, char *out, size_t outCapacity, bool endOfInput
+) {
+	Result result;
+	if (!ready_ || !in || !out) {
+		return result;
+	}
+	const bool inPlace = out == in;
+	StampWriter writer(zone_, config_.style);
+	Edit edits[ESPDateLogRewriterConfig::kMaxColumns];
+	size_t position = 0;
+	while (position < inSize) {
+		const char *line = in + position;
+		const char *newline = static_cast<const char *>(memchr(line, '\n', inSize - position));
+		if (!newline && !endOfInput) {
+			break;
+		}
+		const size_t lineLength = newline ? static_cast<size_t>(newline - line) : inSize - position;
+		const size_t lineSpan = newline ? lineLength + 1 : lineLength;
+
+		size_t editCount = 0;
+		size_t outLength = lineSpan;
+		size_t editableFrom = 0;
+		for (size_t i = 0; i < config_.columnCount; ++i) {
+			const size_t column = config_.columns[i];
+			ParsedStamp stamp;
+			if (column < editableFrom || column >= lineLength ||
+			    !parseStamp(line + column, lineLength - column, stamp)) {
+				continue;
+			}
+			Edit &edit = edits[editCount];
+			edit.outLength = writer.write(line + column, stamp, edit.text);
+			if (edit.outLength == 0) {
+				continue;
+			}
+			edit.offset = column;
+			edit.inLength = stamp.length;
+			outLength = outLength - edit.inLength + edit.outLength;
+			editableFrom = column + stamp.length;
+			++editCount;
+		}
+
+		if (inPlace) {
+			if (outLength != lineSpan) {
+				result.needsBuffer = true;
+				break;
+			}
+			for (size_t i = 0; i < editCount; ++i) {
+				memcpy(out + position + edits[i].offset, edits[i].text, edits[i].outLength);
+			}
+		} else {
+			if (outLength > outCapacity - result.written) {
+				break;
+			}
+			char *target = out + result.written;
+			size_t copiedFrom = 0;
+			for (size_t i = 0; i < editCount; ++i) {
+				const size_t keep = edits[i].offset - copiedFrom;
+				memcpy(target, line + copiedFrom, keep);
+				memcpy(target + keep, edits[i].text, edits[i].outLength);
+				target += keep + edits[i].outLength;
+				copiedFrom = edits[i].offset + edits[i].inLength;
+			}
+			memcpy(target, line + copiedFrom, lineSpan - copiedFrom);
+		}
+		result.written += outLength;
+		position += lineSpan;
+		++stats_.lines;
+		stats_.stamps += editCount;
+	}
+	result.consumed = position;
+	stats_.bytesIn += result.consumed;
+	stats_.bytesOut += result.written;
+	return result;
+}
+
+bool ESPDateLogRewriter::rewriteFile(const char *inPath, const char *outPath, size_t chunkBytes) {
+	if (!ready_ || !inPath || !outPath || chunkBytes == 0) {
+		return false;
+	}
+	const size_t bufferCapacity = bufferCapacityFor(chunkBytes, config_.columnCount);
+	char *buffer =
+	    static_cast<char *>(date_allocator_detail::heapAllocate(bufferCapacity, false));
+	if (!buffer) {
+		return false;
+	}
+	FILE *output = fopen(outPath, "wb");
+	bool ok = output != nullptr;
+	if (ok) {
+#if ESPDATE_HAS_MMAP
+		if (!config_.forceChunked) {
+			ok = rewriteMapped(*this, inPath, output, buffer, bufferCapacity, chunkBytes);
+		} else {
+			ok = rewriteChunked(*this, inPath, output, buffer, bufferCapacity, chunkBytes);
+		}
+#else
+		ok = rewriteChunked(*this, inPath, output, buffer, bufferCapacity, chunkBytes);
+#endif
+		ok = fclose(output) == 0 && ok;
+	}
+	date_allocator_detail::heapDeallocate(buffer);
+	return ok;
+}
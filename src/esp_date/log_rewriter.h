@@ -0,0 +1,83 @@
+#pragma once
+
+#include "posix_tz.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Text written in place of each UTC stamp.
+enum class ESPDateLogStampStyle : uint8_t {
+	Iso8601,  // 2025-01-02T04:04:05+0100 (local time plus its offset)
+	DateTime, // 2025-01-02 04:04:05 (local time, no zone)
+};
+
+struct ESPDateLogRewriterConfig {
+	static constexpr size_t kMaxColumns = 4;
+
+	// Byte offsets within each line at which a UTC stamp may start. A column whose text is not
+	// a valid stamp is left untouched, so headers and continuation lines pass through.
+	size_t columns[kMaxColumns] = {0, 0, 0, 0};
+	size_t columnCount = 1;
+	const char *timeZone = nullptr; // POSIX TZ of the site; nullptr uses the process TZ
+	ESPDateLogStampStyle style = ESPDateLogStampStyle::Iso8601;
+	// rewriteFile reads through a heap window even where it could map the file, as on the
+	// device. Lets hosts run and test the windowed path.
+	bool forceChunked = false;
+};
+
+struct ESPDateLogRewriteStats {
+	uint64_t bytesIn = 0;
+	uint64_t bytesOut = 0;
+	uint64_t lines = 0;
+	uint64_t stamps = 0; // stamps actually rewritten
+};
+
+// Rewrites UTC stamps in line-oriented logs to site-local time without going through libc.
+// Recognised stamps are "YYYY-MM-DD(T| )HH:MM:SS[.fraction][Z]"; the fraction is copied as is.
+// The offset comes from the parsed POSIX rules with a cached validity span and the date text
+// is reused while lines stay on the same day, so sorted logs cost a digit parse and a digit
+// write per stamp.
+//
+// A stamp whose text keeps its length (a space-separated stamp without 'Z' in DateTime style)
+// is rewritten in place; anything else goes through a second buffer.
+class ESPDateLogRewriter {
+  public:
+	// Most a single stamp can grow by: a stamp without 'Z' gaining "+hhmm" in Iso8601 style.
+	static constexpr size_t kMaxGrowthPerStamp = 5;
+
+	struct Result {
+		size_t consumed = 0;      // input bytes fully processed (whole lines)
+		size_t written = 0;       // output bytes produced
+		bool needsBuffer = false; // in-place call stopped at a line whose length changes
+	};
+
+	// Parses the zone and sorts the columns. False for zoneinfo names (the rewriter needs POSIX
+	// rules), an empty column list or more than kMaxColumns columns.
+	bool begin(const ESPDateLogRewriterConfig &config);
+
+	// Rewrites the complete lines at the start of `in` into `out` and stops at a trailing partial
+	// line (pass it again with more data) unless endOfInput is set, or when `out` is full.
+	// Passing out == in rewrites in place; that call stops before the first line whose length
+	// would change and sets needsBuffer.
+	Result rewrite(
+	    const char *in, size_t inSize, char *out, size_t outCapacity, bool endOfInput = false
+	);
+
+	// Rewrites a whole file in chunkBytes windows: mapped read-only on hosts with mmap, read
+	// into a heap window (rewritten in place where possible) elsewhere or with forceChunked.
+	// Lines longer than the window are copied unchanged.
+	bool rewriteFile(const char *inPath, const char *outPath, size_t chunkBytes = 1 << 20);
+
+	const ESPDateLogRewriteStats &stats() const {
+		return stats_;
+	}
+	void resetStats() {
+		stats_ = ESPDateLogRewriteStats{};
+	}
+
+  private:
+	ESPDateLogRewriterConfig config_{};
+	ESPDatePosixTz zone_{};
+	ESPDateLogRewriteStats stats_{};
+	bool ready_ = false;
+};
@@ -112,5 +112,6 @@ MoonPhaseResult ESPDate::moonPhase() const {
 }
 
 MoonPhaseResult ESPDate::moonPhase(const DateTime &dt) const {
+	ESPDATE_PROBE(Moon);
 	return computeMoonPhase(dt);
 }
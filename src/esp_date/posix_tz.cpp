@@ -0,0 +1,300 @@
+#include "posix_tz.h"
+#include "utils.h"
+
+#include <cctype>
+#include <limits>
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr int32_t kMaxOffsetHours = 24;
+constexpr int32_t kMaxRuleTimeHours = 167; // RFC 8536 extension of POSIX 0..24
+
+bool parseNumber(const char *&cursor, int maxDigits, int32_t &value) {
+	if (!isdigit(static_cast<unsigned char>(*cursor))) {
+		return false;
+	}
+	value = 0;
+	for (int digits = 0; digits < maxDigits && isdigit(static_cast<unsigned char>(*cursor));
+	     ++digits) {
+		value = value * 10 + (*cursor++ - '0');
+	}
+	return !isdigit(static_cast<unsigned char>(*cursor));
+}
+
+int yearOf(int64_t seconds) {
+	int year = 0;
+	unsigned month = 0;
+	unsigned day = 0;
+	Utils::civilFromDays(Utils::floorDiv(seconds, Utils::kSecondsPerDay), year, month, day);
+	return year;
+}
+} // namespace
+
+bool ESPDatePosixTz::parse(const char *timeZone) {
+	*this = ESPDatePosixTz{};
+	if (!timeZone || *timeZone == ':') {
+		return false; // ":characters" is implementation-defined (usually a zoneinfo path)
+	}
+	const char *cursor = timeZone;
+	int32_t posixOffset = 0;
+	if (!parseName(cursor) || !parseOffset(cursor, posixOffset, kMaxOffsetHours)) {
+		return false;
+	}
+	// POSIX offsets count hours west of Greenwich; store local - UTC instead.
+	standardOffset_ = -posixOffset;
+	dstOffset_ = standardOffset_;
+	if (*cursor == '\0') {
+		valid_ = true;
+		return true;
+	}
+
+	if (!parseName(cursor)) {
+		return false;
+	}
+	dstOffset_ = standardOffset_ + 3600;
+	if (*cursor != ',' && *cursor != '\0') {
+		if (!parseOffset(cursor, posixOffset, kMaxOffsetHours)) {
+			return false;
+		}
+		dstOffset_ = -posixOffset;
+	}
+	if (*cursor == '\0') {
+		start_.month = 3;
+		start_.week = 2;
+		end_.month = 11;
+		end_.week = 1;
+	} else if (*cursor++ != ',' || !parseRule(cursor, start_) || *cursor++ != ',' ||
+	           !parseRule(cursor, end_) || *cursor != '\0') {
+		return false;
+	}
+	hasDst_ = true;
+	valid_ = true;
+	return true;
+}
+
+int32_t ESPDatePosixTz::utcOffsetAt(int64_t utcSeconds) const {
+	return isDstAt(utcSeconds) ? dstOffset_ : standardOffset_;
+}
+
+int32_t ESPDatePosixTz::utcOffsetAt(
+    int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil
+) const {
+	validFrom = std::numeric_limits<int64_t>::min();
+	validUntil = std::numeric_limits<int64_t>::max();
+	const int year = yearOf(utcSeconds);
+	for (int candidateYear = year - 1; candidateYear <= year + 1; ++candidateYear) {
+		int64_t candidates[2] = {};
+		if (!transitions(candidateYear, candidates[0], candidates[1])) {
+			return standardOffset_;
+		}
+		for (int64_t candidate : candidates) {
+			if (candidate <= utcSeconds && candidate > validFrom) {
+				validFrom = candidate;
+			} else if (candidate > utcSeconds && candidate < validUntil) {
+				validUntil = candidate;
+			}
+		}
+	}
+	return utcOffsetAt(utcSeconds);
+}
+
+bool ESPDatePosixTz::isDstAt(int64_t utcSeconds) const {
+	int64_t start = 0;
+	int64_t end = 0;
+	if (!transitions(yearOf(utcSeconds + standardOffset_), start, end)) {
+		return false;
+	}
+	if (start < end) {
+		return utcSeconds >= start && utcSeconds < end;
+	}
+	// Southern hemisphere: DST spans the turn of the year.
+	return utcSeconds < end || utcSeconds >= start;
+}
+
+bool ESPDatePosixTz::transitions(int year, int64_t &dstStartUtc, int64_t &dstEndUtc) const {
+	if (!valid_ || !hasDst_) {
+		return false;
+	}
+	// Rule times are wall-clock times in the offset in force just before each transition.
+	dstStartUtc = ruleDay(start_, year) * Utils::kSecondsPerDay + start_.timeSeconds -
+	              standardOffset_;
+	dstEndUtc = ruleDay(end_, year) * Utils::kSecondsPerDay + end_.timeSeconds - dstOffset_;
+	return true;
+}
+
+bool ESPDatePosixTz::nearestTransition(int64_t utcSeconds, int64_t &transitionUtc) const {
+	const int year = yearOf(utcSeconds);
+	bool found = false;
+	int64_t bestDistance = 0;
+	for (int candidateYear = year - 1; candidateYear <= year + 1; ++candidateYear) {
+		int64_t candidates[2] = {};
+		if (!transitions(candidateYear, candidates[0], candidates[1])) {
+			return false;
+		}
+		for (int64_t candidate : candidates) {
+			const int64_t distance =
+			    candidate > utcSeconds ? candidate - utcSeconds : utcSeconds - candidate;
+			if (!found || distance < bestDistance) {
+				found = true;
+				bestDistance = distance;
+				transitionUtc = candidate;
+			}
+		}
+	}
+	return found;
+}
+
+bool ESPDatePosixTz::localToUtc(
+    int64_t wallSeconds, ESPDateDstPolicy policy, int64_t &utcSeconds, ESPDateLocalTimeKind *kind
+) const {
+	if (!valid_) {
+		return false;
+	}
+	const int64_t asStandard = wallSeconds - standardOffset_;
+	const int64_t asDst = wallSeconds - dstOffset_;
+	const bool standardValid = !hasDst_ || !isDstAt(asStandard);
+	const bool dstValid = hasDst_ && isDstAt(asDst);
+
+	if (standardValid && dstValid && asStandard != asDst) {
+		if (kind) {
+			*kind = ESPDateLocalTimeKind::Repeated;
+		}
+		const int64_t first = asStandard < asDst ? asStandard : asDst;
+		const int64_t second = asStandard < asDst ? asDst : asStandard;
+		utcSeconds = policy == ESPDateDstPolicy::Latest ? second : first;
+		return true;
+	}
+	if (standardValid || dstValid) {
+		if (kind) {
+			*kind = ESPDateLocalTimeKind::Unique;
+		}
+		utcSeconds = standardValid ? asStandard : asDst;
+		return true;
+	}
+
+	if (kind) {
+		*kind = ESPDateLocalTimeKind::Skipped;
+	}
+	int64_t transition = 0;
+	if (policy == ESPDateDstPolicy::Skip || !nearestTransition(asStandard, transition)) {
+		return false;
+	}
+	if (policy == ESPDateDstPolicy::ShiftForward) {
+		// Read the wall time with the offset in force before the jump, e.g. 02:30 -> 03:30.
+		utcSeconds = wallSeconds - utcOffsetAt(transition - 1);
+	} else {
+		utcSeconds = transition;
+	}
+	return true;
+}
+
+bool ESPDatePosixTz::parseName(const char *&cursor) {
+	const char *begin = cursor;
+	if (*cursor == '<') {
+		++cursor;
+		begin = cursor;
+		while (isalnum(static_cast<unsigned char>(*cursor)) || *cursor == '+' || *cursor == '-') {
+			++cursor;
+		}
+		if (*cursor != '>' || cursor - begin < 3) {
+			return false;
+		}
+		++cursor;
+		return true;
+	}
+	while (isalpha(static_cast<unsigned char>(*cursor))) {
+		++cursor;
+	}
+	return cursor - begin >= 3;
+}
+
+bool ESPDatePosixTz::parseOffset(const char *&cursor, int32_t &seconds, int32_t maxHours) {
+	int32_t sign = 1;
+	if (*cursor == '+' || *cursor == '-') {
+		sign = *cursor == '-' ? -1 : 1;
+		++cursor;
+	}
+	int32_t hours = 0;
+	int32_t minutes = 0;
+	int32_t secs = 0;
+	if (!parseNumber(cursor, 3, hours) || hours > maxHours) {
+		return false;
+	}
+	if (*cursor == ':') {
+		++cursor;
+		if (!parseNumber(cursor, 2, minutes) || minutes > 59) {
+			return false;
+		}
+		if (*cursor == ':') {
+			++cursor;
+			if (!parseNumber(cursor, 2, secs) || secs > 59) {
+				return false;
+			}
+		}
+	}
+	seconds = sign * (hours * 3600 + minutes * 60 + secs);
+	return true;
+}
+
+bool ESPDatePosixTz::parseRule(const char *&cursor, Rule &rule) {
+	int32_t value = 0;
+	if (*cursor == 'J') {
+		++cursor;
+		if (!parseNumber(cursor, 3, value) || value < 1 || value > 365) {
+			return false;
+		}
+		rule.type = Rule::Type::JulianNoLeap;
+		rule.day = static_cast<uint16_t>(value);
+	} else if (*cursor == 'M') {
+		++cursor;
+		int32_t week = 0;
+		int32_t weekday = 0;
+		if (!parseNumber(cursor, 2, value) || value < 1 || value > 12 || *cursor++ != '.' ||
+		    !parseNumber(cursor, 1, week) || week < 1 || week > 5 || *cursor++ != '.' ||
+		    !parseNumber(cursor, 1, weekday) || weekday > 6) {
+			return false;
+		}
+		rule.type = Rule::Type::MonthWeekDay;
+		rule.month = static_cast<uint8_t>(value);
+		rule.week = static_cast<uint8_t>(week);
+		rule.weekday = static_cast<uint8_t>(weekday);
+	} else {
+		if (!parseNumber(cursor, 3, value) || value > 365) {
+			return false;
+		}
+		rule.type = Rule::Type::ZeroBasedDay;
+		rule.day = static_cast<uint16_t>(value);
+	}
+
+	rule.timeSeconds = 2 * 3600;
+	if (*cursor == '/') {
+		++cursor;
+		return parseOffset(cursor, rule.timeSeconds, kMaxRuleTimeHours);
+	}
+	return true;
+}
+
+int64_t ESPDatePosixTz::ruleDay(const Rule &rule, int year) {
+	const int64_t januaryFirst = Utils::daysFromCivil(year, 1, 1);
+	switch (rule.type) {
+	case Rule::Type::JulianNoLeap: {
+		// Jn never counts February 29, so J60 is always March 1.
+		const bool leap = Utils::daysInMonth(year, 2) == 29;
+		return januaryFirst + rule.day - 1 + ((leap && rule.day >= 60) ? 1 : 0);
+	}
+	case Rule::Type::ZeroBasedDay:
+		return januaryFirst + rule.day;
+	case Rule::Type::MonthWeekDay:
+	default: {
+		const int64_t monthFirst = Utils::daysFromCivil(year, rule.month, 1);
+		const int firstWeekday = Utils::weekdayFromDays(monthFirst);
+		int day = 1 + (rule.weekday - firstWeekday + 7) % 7 + (rule.week - 1) * 7;
+		const int monthDays = Utils::daysInMonth(year, rule.month);
+		while (day > monthDays) {
+			day -= 7; // week 5 means the last such weekday
+		}
+		return monthFirst + day - 1;
+	}
+	}
+}
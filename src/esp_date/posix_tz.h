@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// How a local wall time that the zone repeats (fall-back overlap) or skips (spring-forward
+// gap) maps to UTC:
+//   policy        repeated time           skipped time
+//   Earliest      first occurrence        instant the clock jumps (first valid time after)
+//   Latest        second occurrence       instant the clock jumps
+//   Skip          first occurrence        no result; next-occurrence helpers move on
+//   ShiftForward  first occurrence        moved forward by the gap (02:30 -> 03:30)
+enum class ESPDateDstPolicy : uint8_t { Earliest, Latest, Skip, ShiftForward };
+
+enum class ESPDateLocalTimeKind : uint8_t {
+	Unique,    // exactly one UTC instant shows this wall time
+	Repeated,  // fall-back overlap: two instants
+	Skipped,   // spring-forward gap: none
+};
+
+// Parsed POSIX TZ string ("std offset [dst [offset] [,start[/time],end[/time]]]") with the
+// transition rules evaluated arithmetically, so local <-> UTC mapping needs no libc TZ switch.
+// Supports <quoted> names, hh[:mm[:ss]] offsets, Jn / n / Mm.w.d dates and transition times
+// outside 0..24h (RFC 8536). A DST name without rules uses the US default M3.2.0,M11.1.0.
+class ESPDatePosixTz {
+  public:
+	ESPDatePosixTz() = default;
+	explicit ESPDatePosixTz(const char *timeZone) {
+		parse(timeZone);
+	}
+
+	// Returns false (and leaves the zone invalid) for syntax errors, Olson names or nullptr.
+	bool parse(const char *timeZone);
+	bool isValid() const {
+		return valid_;
+	}
+	bool hasDst() const {
+		return hasDst_;
+	}
+	// Offsets are local - UTC in seconds (CET = +3600), the opposite sign of the TZ string.
+	int32_t standardOffsetSeconds() const {
+		return standardOffset_;
+	}
+	int32_t dstOffsetSeconds() const {
+		return dstOffset_;
+	}
+
+	int32_t utcOffsetAt(int64_t utcSeconds) const;
+	// Same, plus the span [validFrom, validUntil) over which that offset holds, so callers that
+	// walk many instants only re-evaluate the rules when they leave it.
+	int32_t utcOffsetAt(int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil) const;
+	bool isDstAt(int64_t utcSeconds) const;
+	// UTC instants at which DST starts and ends in `year`. False for zones without DST.
+	bool transitions(int year, int64_t &dstStartUtc, int64_t &dstEndUtc) const;
+	// Transition closest to utcSeconds (searching the neighbouring years as well).
+	bool nearestTransition(int64_t utcSeconds, int64_t &transitionUtc) const;
+
+	// Classifies local wall seconds (days since 1970-01-01 * 86400 + seconds of day) and
+	// resolves them per policy. Returns false only for invalid zones and Skip in a gap.
+	bool localToUtc(
+	    int64_t wallSeconds,
+	    ESPDateDstPolicy policy,
+	    int64_t &utcSeconds,
+	    ESPDateLocalTimeKind *kind = nullptr
+	) const;
+
+  private:
+	struct Rule {
+		enum class Type : uint8_t { JulianNoLeap, ZeroBasedDay, MonthWeekDay };
+		Type type = Type::MonthWeekDay;
+		uint16_t day = 0; // Jn: 1..365, n: 0..365
+		uint8_t month = 0;
+		uint8_t week = 0;    // 1..5, 5 = last
+		uint8_t weekday = 0; // 0 = Sunday
+		int32_t timeSeconds = 2 * 3600;
+	};
+
+	static bool parseName(const char *&cursor);
+	static bool parseOffset(const char *&cursor, int32_t &seconds, int32_t maxHours);
+	static bool parseRule(const char *&cursor, Rule &rule);
+	static int64_t ruleDay(const Rule &rule, int year);
+
+	int32_t standardOffset_ = 0;
+	int32_t dstOffset_ = 0;
+	Rule start_{};
+	Rule end_{};
+	bool hasDst_ = false;
+	bool valid_ = false;
+};
@@ -0,0 +1,610 @@
+#include "recurrence.h"
+#include "date.h"
+#include "utils.h"
+
+#include <cctype>
+#include <cstring>
+#include <initializer_list>
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr int kSearchYears = 400; // a full Gregorian cycle: a satisfiable rule matches within it
+constexpr int64_t kBeforeWindow = 15 * Utils::kSecondsPerHour; // covers UTC offsets up to +14h
+constexpr int64_t kAfterWindow = 13 * Utils::kSecondsPerHour;  // covers UTC offsets down to -12h
+constexpr uint32_t kAllHours = (1u << 24) - 1u;
+constexpr size_t kMaxFields = 6;
+
+const char *const kMonthNames[] = {
+    "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"
+};
+const char *const kWeekdayNames[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+
+enum class Field { Second, Minute, Hour, DayOfMonth, Month, DayOfWeek };
+
+struct FieldSpec {
+	int min;
+	int max;
+	const char *const *names;
+	int nameCount;
+	int nameBase;
+};
+
+FieldSpec specFor(Field field) {
+	switch (field) {
+	case Field::Second:
+	case Field::Minute:
+		return FieldSpec{0, 59, nullptr, 0, 0};
+	case Field::Hour:
+		return FieldSpec{0, 23, nullptr, 0, 0};
+	case Field::DayOfMonth:
+		return FieldSpec{1, 31, nullptr, 0, 0};
+	case Field::Month:
+		return FieldSpec{1, 12, kMonthNames, 12, 1};
+	case Field::DayOfWeek:
+		return FieldSpec{0, 7, kWeekdayNames, 7, 0};
+	}
+	return FieldSpec{0, 0, nullptr, 0, 0};
+}
+
+struct ParsedField {
+	uint64_t bits = 0;
+	bool any = false; // "*" or "?" on its own
+	bool last = false;
+	uint8_t lastWeekdays = 0;
+	uint8_t nthWeekdays[7] = {};
+};
+
+// Parses a number or a three-letter name at [p, end); advances p past it.
+bool parseValue(const char *&p, const char *end, const FieldSpec &spec, int &out) {
+	if (p < end && std::isdigit(static_cast<unsigned char>(*p))) {
+		int value = 0;
+		while (p < end && std::isdigit(static_cast<unsigned char>(*p))) {
+			value = value * 10 + (*p - '0');
+			if (value > 1000) {
+				return false;
+			}
+			++p;
+		}
+		out = value;
+		return value >= spec.min && value <= spec.max;
+	}
+	if (!spec.names || end - p < 3) {
+		return false;
+	}
+	for (int i = 0; i < spec.nameCount; ++i) {
+		const char *name = spec.names[i];
+		if (std::toupper(static_cast<unsigned char>(p[0])) == name[0] &&
+		    std::toupper(static_cast<unsigned char>(p[1])) == name[1] &&
+		    std::toupper(static_cast<unsigned char>(p[2])) == name[2]) {
+			p += 3;
+			out = spec.nameBase + i;
+			return true;
+		}
+	}
+	return false;
+}
+
+int normalizeWeekday(int value) {
+	return value == 7 ? 0 : value;
+}
+
+bool parseItem(const char *p, const char *end, Field field, ParsedField &out) {
+	const FieldSpec spec = specFor(field);
+	const size_t length = static_cast<size_t>(end - p);
+
+	if (field == Field::DayOfMonth && length == 1 && (*p == 'L' || *p == 'l')) {
+		out.last = true;
+		return true;
+	}
+	if (field == Field::DayOfWeek && length >= 2 && (end[-1] == 'L' || end[-1] == 'l')) {
+		int weekday = 0;
+		const char *cursor = p;
+		if (!parseValue(cursor, end - 1, spec, weekday) || cursor != end - 1) {
+			return false;
+		}
+		out.lastWeekdays |= static_cast<uint8_t>(1u << normalizeWeekday(weekday));
+		return true;
+	}
+	if (field == Field::DayOfWeek) {
+		const char *hash = static_cast<const char *>(std::memchr(p, '#', length));
+		if (hash) {
+			int weekday = 0;
+			const char *cursor = p;
+			if (!parseValue(cursor, hash, spec, weekday) || cursor != hash || end - hash != 2 ||
+			    hash[1] < '1' || hash[1] > '5') {
+				return false;
+			}
+			const int nth = hash[1] - '0';
+			out.nthWeekdays[normalizeWeekday(weekday)] |= static_cast<uint8_t>(1u << nth);
+			return true;
+		}
+	}
+
+	int low = spec.min;
+	int high = spec.max;
+	const char *cursor = p;
+	bool hasRange = false;
+	if (cursor < end && (*cursor == '*' || *cursor == '?')) {
+		++cursor;
+		hasRange = true;
+	} else {
+		if (!parseValue(cursor, end, spec, low)) {
+			return false;
+		}
+		high = low;
+		if (cursor < end && *cursor == '-') {
+			++cursor;
+			if (!parseValue(cursor, end, spec, high) || high < low) {
+				return false;
+			}
+			hasRange = true;
+		}
+	}
+	int step = 1;
+	if (cursor < end && *cursor == '/') {
+		++cursor;
+		if (cursor == end) {
+			return false;
+		}
+		step = 0;
+		while (cursor < end && std::isdigit(static_cast<unsigned char>(*cursor))) {
+			step = step * 10 + (*cursor - '0');
+			if (step > spec.max + 1) {
+				return false;
+			}
+			++cursor;
+		}
+		if (step <= 0) {
+			return false;
+		}
+		if (!hasRange) {
+			high = spec.max; // "N/S" means N through the end of the field
+		}
+	}
+	if (cursor != end) {
+		return false;
+	}
+	for (int value = low; value <= high; value += step) {
+		const int bit = field == Field::DayOfWeek ? normalizeWeekday(value) : value;
+		out.bits |= uint64_t{1} << bit;
+	}
+	return true;
+}
+
+bool parseField(const char *p, const char *end, Field field, ParsedField &out) {
+	if (end - p == 1 && (*p == '*' || *p == '?')) {
+		out.any = true;
+	}
+	while (p < end) {
+		const char *comma = static_cast<const char *>(std::memchr(p, ',', end - p));
+		const char *itemEnd = comma ? comma : end;
+		if (itemEnd == p || !parseItem(p, itemEnd, field, out)) {
+			return false;
+		}
+		p = comma ? comma + 1 : end;
+		if (comma && p == end) {
+			return false; // trailing comma
+		}
+	}
+	return true;
+}
+
+const char *expandMacro(const char *expression) {
+	static const struct {
+		const char *name;
+		const char *expansion;
+	} kMacros[] = {
+	    {"@yearly", "0 0 1 1 *"},
+	    {"@annually", "0 0 1 1 *"},
+	    {"@monthly", "0 0 1 * *"},
+	    {"@weekly", "0 0 * * 0"},
+	    {"@daily", "0 0 * * *"},
+	    {"@midnight", "0 0 * * *"},
+	    {"@hourly", "0 * * * *"},
+	};
+	for (const auto &macro : kMacros) {
+		if (std::strcmp(expression, macro.name) == 0) {
+			return macro.expansion;
+		}
+	}
+	return nullptr;
+}
+
+int nextBit(uint64_t mask, int from) {
+	if (from >= 64) {
+		return -1;
+	}
+	const uint64_t remaining = mask >> from;
+	if (remaining == 0) {
+		return -1;
+	}
+	return from + __builtin_ctzll(remaining);
+}
+
+} // namespace
+
+// The zone a recurrence is evaluated in: parsed POSIX rules from the shared cache, or libc for
+// TZ values that are not rule strings (zoneinfo names), which needs the TZ applied by the caller.
+struct ESPDateRecurrence::Zone {
+	ESPDatePosixTz rules;
+	bool posix = false;
+
+	// UTC offset in seconds at a UTC instant.
+	int64_t offsetAt(int64_t utc) const {
+		if (posix) {
+			return rules.utcOffsetAt(utc);
+		}
+		tm local{};
+		if (!Utils::toLocalTm(DateTime{utc}, local)) {
+			return 0;
+		}
+		return Utils::timegm64(local) - utc;
+	}
+
+	// First instant in (low, high] whose offset differs from the one at low.
+	int64_t findTransition(int64_t low, int64_t high) const {
+		const int64_t offset = offsetAt(low);
+		while (high - low > 1) {
+			const int64_t mid = low + (high - low) / 2;
+			if (offsetAt(mid) == offset) {
+				low = mid;
+			} else {
+				high = mid;
+			}
+		}
+		return high;
+	}
+
+	// Same contract as ESPDatePosixTz::localToUtc. The libc path brackets the wall time with
+	// the offsets kBeforeWindow before and kAfterWindow after it.
+	bool localToUtc(
+	    int64_t wall, ESPDateDstPolicy policy, int64_t &utc, ESPDateLocalTimeKind &kind
+	) const {
+		if (posix) {
+			return rules.localToUtc(wall, policy, utc, &kind);
+		}
+		const int64_t before = offsetAt(wall - kBeforeWindow);
+		const int64_t after = offsetAt(wall + kAfterWindow);
+		const int64_t transition =
+		    before == after ? INT64_MAX : findTransition(wall - kBeforeWindow, wall + kAfterWindow);
+		const int64_t early = wall - before; // valid while still before the transition
+		const int64_t late = wall - after;   // valid once past it
+		const bool earlyValid = early < transition;
+		const bool lateValid = late >= transition;
+		if (earlyValid && lateValid && early != late) {
+			kind = ESPDateLocalTimeKind::Repeated;
+			const bool latest = policy == ESPDateDstPolicy::Latest;
+			utc = (early < late) == latest ? late : early;
+			return true;
+		}
+		if (earlyValid || lateValid) {
+			kind = ESPDateLocalTimeKind::Unique;
+			utc = earlyValid ? early : late;
+			return true;
+		}
+		kind = ESPDateLocalTimeKind::Skipped;
+		if (policy == ESPDateDstPolicy::Skip) {
+			return false;
+		}
+		utc = policy == ESPDateDstPolicy::ShiftForward ? early : transition;
+		return true;
+	}
+};
+
+bool ESPDateRecurrence::parse(const char *expression) {
+	*this = ESPDateRecurrence{};
+	if (!expression) {
+		return false;
+	}
+	while (std::isspace(static_cast<unsigned char>(*expression))) {
+		++expression;
+	}
+	if (const char *expansion = expandMacro(expression)) {
+		expression = expansion;
+	}
+
+	const char *begin[kMaxFields];
+	const char *end[kMaxFields];
+	size_t count = 0;
+	const char *p = expression;
+	while (*p) {
+		while (*p && std::isspace(static_cast<unsigned char>(*p))) {
+			++p;
+		}
+		if (!*p) {
+			break;
+		}
+		if (count == kMaxFields) {
+			return false;
+		}
+		begin[count] = p;
+		while (*p && !std::isspace(static_cast<unsigned char>(*p))) {
+			++p;
+		}
+		end[count++] = p;
+	}
+	if (count != 5 && count != 6) {
+		return false;
+	}
+
+	static const Field kFields[kMaxFields] = {
+	    Field::Second,
+	    Field::Minute,
+	    Field::Hour,
+	    Field::DayOfMonth,
+	    Field::Month,
+	    Field::DayOfWeek
+	};
+	ParsedField parsed[kMaxFields];
+	const size_t offset = kMaxFields - count;
+	if (offset == 1) {
+		parsed[0].bits = 1; // five-field form fires at second 0
+	}
+	for (size_t i = 0; i < count; ++i) {
+		if (!parseField(begin[i], end[i], kFields[offset + i], parsed[offset + i])) {
+			return false;
+		}
+	}
+
+	ESPDateRecurrence compiled;
+	compiled.seconds_ = parsed[0].bits;
+	compiled.minutes_ = parsed[1].bits;
+	compiled.hours_ = static_cast<uint32_t>(parsed[2].bits);
+	compiled.days_ = static_cast<uint32_t>(parsed[3].bits);
+	compiled.lastDay_ = parsed[3].last;
+	compiled.anyDay_ = parsed[3].any;
+	compiled.months_ = static_cast<uint16_t>(parsed[4].bits);
+	compiled.weekdays_ = static_cast<uint8_t>(parsed[5].bits);
+	compiled.lastWeekdays_ = parsed[5].lastWeekdays;
+	std::memcpy(compiled.nthWeekdays_, parsed[5].nthWeekdays, sizeof(compiled.nthWeekdays_));
+	compiled.anyWeekday_ = parsed[5].any;
+
+	// Reject day-of-month lists no selected month can hold (e.g. "0 0 30 2 *").
+	if (compiled.anyWeekday_ && !compiled.anyDay_ && !compiled.lastDay_) {
+		int longestMonth = 0;
+		for (int month = 1; month <= 12; ++month) {
+			if (compiled.months_ & (1u << month)) {
+				const int days = Utils::daysInMonth(2000, month); // leap year: February has 29
+				longestMonth = days > longestMonth ? days : longestMonth;
+			}
+		}
+		const int firstDay = nextBit(compiled.days_, 1);
+		if (firstDay < 0 || firstDay > longestMonth) {
+			return false;
+		}
+	}
+	compiled.valid_ = true;
+	*this = compiled;
+	return true;
+}
+
+bool ESPDateRecurrence::matchesDay(int year, int month, int day) const {
+	if (!valid_ || month < 1 || month > 12 || !(months_ & (1u << month))) {
+		return false;
+	}
+	const int daysInMonth = Utils::daysInMonth(year, month);
+	if (day < 1 || day > daysInMonth) {
+		return false;
+	}
+	if (anyDay_ && anyWeekday_) {
+		return true;
+	}
+	const bool dayOfMonth = (days_ & (1u << day)) || (lastDay_ && day == daysInMonth);
+	const int weekday = Utils::weekdayFromDays(
+	    Utils::daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day))
+	);
+	const bool dayOfWeek = (weekdays_ & (1u << weekday)) ||
+	                       ((lastWeekdays_ & (1u << weekday)) && day + 7 > daysInMonth) ||
+	                       (nthWeekdays_[weekday] & (1u << ((day - 1) / 7 + 1)));
+	if (anyDay_) {
+		return dayOfWeek;
+	}
+	if (anyWeekday_) {
+		return dayOfMonth;
+	}
+	return dayOfMonth || dayOfWeek;
+}
+
+// Smallest wall-clock time (local seconds since epoch, as if UTC) >= startWall that matches.
+bool ESPDateRecurrence::findWall(int64_t startWall, int64_t &wall) const {
+	const int64_t startDays = Utils::floorDiv(startWall, Utils::kSecondsPerDay);
+	const int64_t secondOfDay = startWall - startDays * Utils::kSecondsPerDay;
+	int year = 0;
+	unsigned month = 0;
+	unsigned day = 0;
+	Utils::civilFromDays(startDays, year, month, day);
+	int hour = static_cast<int>(secondOfDay / Utils::kSecondsPerHour);
+	int minute = static_cast<int>(secondOfDay / Utils::kSecondsPerMinute % 60);
+	int second = static_cast<int>(secondOfDay % 60);
+	const int lastYear = year + kSearchYears;
+
+	while (year <= lastYear) {
+		if (!(months_ & (1u << month))) {
+			int nextMonth = nextBit(months_, static_cast<int>(month) + 1);
+			if (nextMonth < 0 || nextMonth > 12) {
+				++year;
+				nextMonth = nextBit(months_, 1);
+			}
+			month = static_cast<unsigned>(nextMonth);
+			day = 1;
+			hour = minute = second = 0;
+			continue;
+		}
+		if (static_cast<int>(day) > Utils::daysInMonth(year, static_cast<int>(month))) {
+			if (++month > 12) {
+				month = 1;
+				++year;
+			}
+			day = 1;
+			hour = minute = second = 0;
+			continue;
+		}
+		if (hour > 23 || !matchesDay(year, static_cast<int>(month), static_cast<int>(day))) {
+			++day;
+			hour = minute = second = 0;
+			continue;
+		}
+
+		const int nextHour = nextBit(hours_, hour);
+		if (nextHour < 0) {
+			++day;
+			hour = minute = second = 0;
+			continue;
+		}
+		if (nextHour != hour) {
+			hour = nextHour;
+			minute = second = 0;
+		}
+		const int nextMinute = nextBit(minutes_, minute);
+		if (nextMinute < 0) {
+			++hour;
+			minute = second = 0;
+			continue;
+		}
+		if (nextMinute != minute) {
+			minute = nextMinute;
+			second = 0;
+		}
+		const int nextSecond = nextBit(seconds_, second);
+		if (nextSecond < 0) {
+			if (++minute > 59) {
+				minute = 0;
+				++hour;
+			}
+			second = 0;
+			continue;
+		}
+
+		wall = Utils::daysFromCivil(year, month, day) * Utils::kSecondsPerDay +
+		       hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + nextSecond;
+		return true;
+	}
+	return false;
+}
+
+// Smallest UTC instant >= after. Candidate wall times are mapped to UTC through the offsets on
+// either side of them; only around a transition can wall order and UTC order disagree, so the
+// walk continues past the first hit only there, resolving each wall time under `policy`.
+bool ESPDateRecurrence::nextInstant(
+    int64_t after, const Zone &zone, ESPDateDstPolicy policy, int64_t &instant
+) const {
+	const int64_t offsetNow = zone.offsetAt(after);
+	const int64_t offsetAhead = zone.offsetAt(after + kAfterWindow);
+	const int64_t maxOffset = offsetNow > offsetAhead ? offsetNow : offsetAhead;
+	int64_t start = after + (offsetNow < offsetAhead ? offsetNow : offsetAhead);
+	const bool repeatAmbiguous = hours_ == kAllHours;
+
+	// Nearest transition once one is seen: offsetBefore applies to instants < transition.
+	bool hasTransition = false;
+	int64_t transition = 0;
+	int64_t offsetBefore = 0;
+	int64_t offsetAfter = 0;
+
+	bool found = false;
+	int64_t best = 0;
+	auto consider = [&](int64_t candidate) {
+		if (candidate >= after && (!found || candidate < best)) {
+			best = candidate;
+			found = true;
+		}
+	};
+
+	int64_t wall = 0;
+	while (findWall(start, wall)) {
+		start = wall + 1;
+		if (found) {
+			int64_t earliest = wall - maxOffset;
+			if (hasTransition) {
+				const int64_t early = wall - offsetBefore;
+				earliest = early < transition ? early : wall - offsetAfter;
+			}
+			if (earliest > best) {
+				break;
+			}
+		}
+		if (!hasTransition) {
+			const int64_t before = zone.offsetAt(wall - kBeforeWindow);
+			const int64_t afterWindow = zone.offsetAt(wall + kAfterWindow);
+			if (before == afterWindow) {
+				consider(wall - before);
+				if (found) {
+					break; // no transition nearby: later walls map to later instants
+				}
+				continue;
+			}
+			hasTransition = true;
+			transition = zone.findTransition(wall - kBeforeWindow, wall + kAfterWindow);
+			offsetBefore = before;
+			offsetAfter = afterWindow;
+		}
+
+		int64_t resolved = 0;
+		ESPDateLocalTimeKind kind = ESPDateLocalTimeKind::Unique;
+		if (!zone.localToUtc(wall, policy, resolved, kind)) {
+			continue; // skipped under ESPDateDstPolicy::Skip
+		}
+		if (kind == ESPDateLocalTimeKind::Repeated && repeatAmbiguous) {
+			// "*" hours run the repeated hour twice, whatever the policy picks.
+			int64_t first = 0;
+			int64_t second = 0;
+			zone.localToUtc(wall, ESPDateDstPolicy::Earliest, first, kind);
+			zone.localToUtc(wall, ESPDateDstPolicy::Latest, second, kind);
+			consider(first >= after ? first : second);
+		} else {
+			consider(resolved);
+		}
+	}
+	instant = best;
+	return found;
+}
+
+bool ESPDateRecurrence::next(
+    const DateTime &from, DateTime &out, const char *timeZone, ESPDateDstPolicy policy
+) const {
+	return nextN(from, 1, &out, timeZone, policy) == 1;
+}
+
+size_t ESPDateRecurrence::nextN(
+    const DateTime &from,
+    size_t count,
+    DateTime *out,
+    const char *timeZone,
+    ESPDateDstPolicy policy
+) const {
+	if (!valid_ || !out || count == 0) {
+		return 0;
+	}
+	Zone zone;
+	zone.posix = Utils::posixTzFor(timeZone, zone.rules);
+	// Only zoneinfo names fall back to libc, which needs the TZ applied for the whole walk.
+	Utils::ScopedTz scoped(zone.posix ? nullptr : timeZone);
+	int64_t cursor = from.epochSeconds;
+	size_t written = 0;
+	while (written < count) {
+		int64_t instant = 0;
+		if (!nextInstant(cursor + 1, zone, policy, instant)) {
+			break;
+		}
+		out[written++] = DateTime{instant};
+		cursor = instant;
+	}
+	return written;
+}
+
+bool ESPDate::nextOccurrence(
+    const ESPDateRecurrence &rule, const DateTime &from, DateTime &out, ESPDateDstPolicy policy
+) const {
+	return nextOccurrences(rule, from, 1, &out, policy) == 1;
+}
+
+size_t ESPDate::nextOccurrences(
+    const ESPDateRecurrence &rule,
+    const DateTime &from,
+    size_t count,
+    DateTime *out,
+    ESPDateDstPolicy policy
+) const {
+	const char *tz = timeZone_.empty() ? nullptr : timeZone_.c_str();
+	return rule.nextN(from, count, out, tz, policy);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "posix_tz.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct DateTime;
+
+// Compiled cron-style recurrence, evaluated in local wall-clock time.
+//
+// Expression: [second] minute hour day-of-month month day-of-week
+//   - five fields (seconds default to 0) or six (seconds first)
+//   - items: *, ?, N, N-M, */S, N-M/S, N/S, comma-separated lists
+//   - months JAN..DEC and weekdays SUN..SAT (0 or 7 = Sunday) are accepted by name
+//   - day-of-month "L" is the last day of the month
+//   - day-of-week "5L" / "FRIL" is the last Friday, "1#2" / "MON#2" the second Monday
+//   - @yearly, @annually, @monthly, @weekly, @daily, @midnight, @hourly
+// As in Vixie cron, when both day fields are restricted a day matches if either does.
+//
+// Parsing happens once; next() walks the calendar fields (month, day, hour, minute, second)
+// directly and only consults the time zone to map each candidate wall time to UTC.
+// DST: wall times the zone skips or repeats resolve under an ESPDateDstPolicy, as in
+// ESPDate::fromLocal. The default, Earliest, fires a skipped time at the instant the clock
+// jumps past it and a repeated time once (first occurrence). With "*" in the hour field the
+// repeated hour runs twice under every policy.
+class ESPDateRecurrence {
+  public:
+	ESPDateRecurrence() = default;
+	explicit ESPDateRecurrence(const char *expression) {
+		parse(expression);
+	}
+
+	// Returns false (and leaves the recurrence invalid) on a syntax or range error.
+	bool parse(const char *expression);
+	bool isValid() const {
+		return valid_;
+	}
+
+	// First occurrence strictly after `from`. timeZone is a POSIX TZ string; nullptr uses the
+	// process TZ. Returns false when the rule is invalid or never matches within 400 years.
+	bool next(
+	    const DateTime &from,
+	    DateTime &out,
+	    const char *timeZone = nullptr,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::Earliest
+	) const;
+	// Fills up to `count` consecutive occurrences after `from`; returns how many were written.
+	size_t nextN(
+	    const DateTime &from,
+	    size_t count,
+	    DateTime *out,
+	    const char *timeZone = nullptr,
+	    ESPDateDstPolicy policy = ESPDateDstPolicy::Earliest
+	) const;
+
+	// True when the day fields (month, day-of-month, day-of-week) select this calendar date.
+	bool matchesDay(int year, int month, int day) const;
+
+  private:
+	struct Zone;
+
+	bool findWall(int64_t startWall, int64_t &wall) const;
+	bool nextInstant(
+	    int64_t after, const Zone &zone, ESPDateDstPolicy policy, int64_t &instant
+	) const;
+
+	uint64_t seconds_ = 0;
+	uint64_t minutes_ = 0;
+	uint32_t hours_ = 0;
+	uint32_t days_ = 0;      // bit d = day d (1..31)
+	uint16_t months_ = 0;    // bit m = month m (1..12)
+	uint8_t weekdays_ = 0;   // bit w = weekday w (0 = Sunday)
+	uint8_t lastWeekdays_ = 0;
+	uint8_t nthWeekdays_[7] = {}; // bit n = n-th occurrence (1..5) of weekday in the month
+	bool lastDay_ = false;
+	bool anyDay_ = true;
+	bool anyWeekday_ = true;
+	bool valid_ = false;
+};
@@ -0,0 +1,326 @@
+#include "scheduler.h"
+#include "date.h"
+#include "utils.h"
+
+#include <new>
+
+using Utils = ESPDateUtils;
+
+namespace {
+constexpr size_t kNoSlot = static_cast<size_t>(-1);
+constexpr uint32_t kSlotBits = 16;
+constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1u;
+} // namespace
+
+ESPDateScheduler::~ESPDateScheduler() {
+	end();
+}
+
+bool ESPDateScheduler::begin(size_t capacity, bool usePSRAMBuffers) {
+	if (running_) {
+		return false;
+	}
+	end();
+	if (capacity == 0) {
+		return true;
+	}
+	if (capacity > kMaxCapacity) {
+		capacity = kMaxCapacity;
+	}
+
+	void *taskMemory =
+	    date_allocator_detail::heapAllocate(sizeof(Task) * capacity, usePSRAMBuffers);
+	void *indexMemory =
+	    date_allocator_detail::heapAllocate(sizeof(size_t) * capacity * 2, usePSRAMBuffers);
+	if (!taskMemory || !indexMemory) {
+		date_allocator_detail::heapDeallocate(taskMemory);
+		date_allocator_detail::heapDeallocate(indexMemory);
+		return false;
+	}
+	tasks_ = static_cast<Task *>(taskMemory);
+	for (size_t i = 0; i < capacity; ++i) {
+		new (&tasks_[i]) Task();
+	}
+	heap_ = static_cast<size_t *>(indexMemory);
+	freeSlots_ = heap_ + capacity;
+	for (size_t i = 0; i < capacity; ++i) {
+		freeSlots_[i] = capacity - 1 - i; // lowest slot is handed out first
+	}
+	capacity_ = capacity;
+	freeCount_ = capacity;
+	size_ = 0;
+	return true;
+}
+
+void ESPDateScheduler::end() {
+	if (running_ || !tasks_) {
+		return;
+	}
+	for (size_t i = 0; i < capacity_; ++i) {
+		tasks_[i].~Task();
+	}
+	date_allocator_detail::heapDeallocate(tasks_);
+	date_allocator_detail::heapDeallocate(heap_);
+	tasks_ = nullptr;
+	heap_ = nullptr;
+	freeSlots_ = nullptr;
+	capacity_ = 0;
+	size_ = 0;
+	freeCount_ = 0;
+}
+
+ESPDateScheduler::TaskId ESPDateScheduler::scheduleAt(const DateTime &deadline, Callback callback) {
+	return scheduleAtUs(deadline.epochSeconds * Utils::kMicrosPerSecond, std::move(callback));
+}
+
+ESPDateScheduler::TaskId ESPDateScheduler::scheduleAtUs(int64_t deadlineUs, Callback callback) {
+	return add(deadlineUs, 0, nullptr, false, std::move(callback));
+}
+
+ESPDateScheduler::TaskId ESPDateScheduler::scheduleRecurring(
+    const ESPDateRecurrence &rule, const DateTime &from, Callback callback
+) {
+	DateTime first{};
+	if (!rule.next(from, first, timeZone_)) {
+		return kInvalidTaskId;
+	}
+	return add(first.epochSeconds * Utils::kMicrosPerSecond, 0, &rule, false, std::move(callback));
+}
+
+ESPDateScheduler::TaskId
+ESPDateScheduler::scheduleAfter(int64_t delayUs, int64_t nowUs, Callback callback) {
+	if (delayUs < 0) {
+		delayUs = 0;
+	}
+	return add(nowUs + delayUs, 0, nullptr, true, std::move(callback));
+}
+
+ESPDateScheduler::TaskId
+ESPDateScheduler::scheduleEvery(int64_t periodUs, int64_t nowUs, Callback callback) {
+	if (periodUs <= 0) {
+		return kInvalidTaskId;
+	}
+	return add(nowUs + periodUs, periodUs, nullptr, true, std::move(callback));
+}
+
+bool ESPDateScheduler::cancel(TaskId id) {
+	const size_t slot = id & kSlotMask;
+	if (id == kInvalidTaskId || slot >= capacity_ || tasks_[slot].id != id) {
+		return false;
+	}
+	if (slot == firingSlot_) {
+		// The callback is running; tickUs() releases the slot once it returns.
+		const bool wasPending = !firingCancelled_;
+		firingCancelled_ = true;
+		return wasPending;
+	}
+	removeAt(tasks_[slot].heapIndex);
+	releaseSlot(slot);
+	return true;
+}
+
+void ESPDateScheduler::clear() {
+	for (size_t slot = 0; slot < capacity_; ++slot) {
+		if (tasks_[slot].id == kInvalidTaskId) {
+			continue;
+		}
+		if (slot == firingSlot_) {
+			firingCancelled_ = true;
+		} else {
+			releaseSlot(slot);
+		}
+	}
+	size_ = 0;
+}
+
+size_t ESPDateScheduler::tick(const DateTime &now) {
+	return tickUs(now.epochSeconds * Utils::kMicrosPerSecond);
+}
+
+size_t ESPDateScheduler::tickUs(int64_t nowUs) {
+	if (running_) {
+		return 0;
+	}
+	running_ = true;
+	size_t fired = 0;
+	while (size_ > 0 && fired < capacity_) {
+		const size_t slot = heap_[0];
+		Task &task = tasks_[slot];
+		if (task.dueUs > nowUs) {
+			break;
+		}
+		removeAt(0);
+		firingSlot_ = slot;
+		firingCancelled_ = false;
+		const DateTime due{Utils::floorDiv(task.dueUs, Utils::kMicrosPerSecond)};
+		task.callback(task.id, due);
+		firingSlot_ = kNoSlot;
+		++fired;
+
+		if (firingCancelled_ || !reschedule(task, nowUs)) {
+			releaseSlot(slot);
+			continue;
+		}
+		task.sequence = nextSequence_++;
+		push(slot);
+	}
+	running_ = false;
+	return fired;
+}
+
+void ESPDateScheduler::onClockStep(int64_t stepUs) {
+	if (stepUs == 0) {
+		return;
+	}
+	// Absolute deadlines already sit at the right wall time. Relative ones were keyed by the
+	// old clock and keep their remaining duration by moving with it.
+	for (size_t slot = 0; slot < capacity_; ++slot) {
+		Task &task = tasks_[slot];
+		if (task.id != kInvalidTaskId && task.relative) {
+			task.dueUs += stepUs;
+		}
+	}
+	rebuildHeap();
+}
+
+bool ESPDateScheduler::nextDeadline(DateTime &out) const {
+	int64_t dueUs = 0;
+	if (!nextDeadlineUs(dueUs)) {
+		return false;
+	}
+	out = DateTime{Utils::floorDiv(dueUs, Utils::kMicrosPerSecond)};
+	return true;
+}
+
+bool ESPDateScheduler::nextDeadlineUs(int64_t &outUs) const {
+	if (size_ == 0) {
+		return false;
+	}
+	outUs = tasks_[heap_[0]].dueUs;
+	return true;
+}
+
+ESPDateScheduler::TaskId ESPDateScheduler::add(
+    int64_t dueUs,
+    int64_t periodUs,
+    const ESPDateRecurrence *rule,
+    bool relative,
+    Callback &&callback
+) {
+	if (!callback || freeCount_ == 0) {
+		return kInvalidTaskId;
+	}
+	const size_t slot = freeSlots_[--freeCount_];
+	Task &task = tasks_[slot];
+	task.generation = task.generation == 0xFFFF ? 1 : task.generation + 1;
+	task.id = (static_cast<TaskId>(task.generation) << kSlotBits) | static_cast<TaskId>(slot);
+	task.dueUs = dueUs;
+	task.periodUs = periodUs;
+	task.rule = rule;
+	task.relative = relative;
+	task.sequence = nextSequence_++;
+	task.callback = std::move(callback);
+	push(slot);
+	return task.id;
+}
+
+bool ESPDateScheduler::reschedule(Task &task, int64_t nowUs) const {
+	if (task.rule) {
+		// Continue from whichever is later so a late tick or a forward step fires once.
+		const int64_t fromUs = task.dueUs > nowUs ? task.dueUs : nowUs;
+		DateTime next{};
+		if (!task.rule->next(
+		        DateTime{Utils::floorDiv(fromUs, Utils::kMicrosPerSecond)},
+		        next,
+		        timeZone_
+		    )) {
+			return false;
+		}
+		task.dueUs = next.epochSeconds * Utils::kMicrosPerSecond;
+		return true;
+	}
+	if (task.periodUs > 0) {
+		task.dueUs += task.periodUs;
+		if (task.dueUs <= nowUs) {
+			task.dueUs += ((nowUs - task.dueUs) / task.periodUs + 1) * task.periodUs;
+		}
+		return true;
+	}
+	return false;
+}
+
+void ESPDateScheduler::releaseSlot(size_t slot) {
+	Task &task = tasks_[slot];
+	task.id = kInvalidTaskId;
+	task.rule = nullptr;
+	task.callback = Callback{};
+	freeSlots_[freeCount_++] = slot;
+}
+
+bool ESPDateScheduler::less(size_t a, size_t b) const {
+	const Task &left = tasks_[a];
+	const Task &right = tasks_[b];
+	if (left.dueUs != right.dueUs) {
+		return left.dueUs < right.dueUs;
+	}
+	return static_cast<int32_t>(left.sequence - right.sequence) < 0;
+}
+
+void ESPDateScheduler::place(size_t heapIndex, size_t slot) {
+	heap_[heapIndex] = slot;
+	tasks_[slot].heapIndex = heapIndex;
+}
+
+void ESPDateScheduler::siftUp(size_t heapIndex) {
+	const size_t slot = heap_[heapIndex];
+	while (heapIndex > 0) {
+		const size_t parent = (heapIndex - 1) / 2;
+		if (!less(slot, heap_[parent])) {
+			break;
+		}
+		place(heapIndex, heap_[parent]);
+		heapIndex = parent;
+	}
+	place(heapIndex, slot);
+}
+
+void ESPDateScheduler::siftDown(size_t heapIndex) {
+	const size_t slot = heap_[heapIndex];
+	for (;;) {
+		size_t child = heapIndex * 2 + 1;
+		if (child >= size_) {
+			break;
+		}
+		if (child + 1 < size_ && less(heap_[child + 1], heap_[child])) {
+			++child;
+		}
+		if (!less(heap_[child], slot)) {
+			break;
+		}
+		place(heapIndex, heap_[child]);
+		heapIndex = child;
+	}
+	place(heapIndex, slot);
+}
+
+void ESPDateScheduler::push(size_t slot) {
+	const size_t heapIndex = size_++;
+	place(heapIndex, slot);
+	siftUp(heapIndex);
+}
+
+void ESPDateScheduler::removeAt(size_t heapIndex) {
+	const size_t last = --size_;
+	if (heapIndex == last) {
+		return;
+	}
+	place(heapIndex, heap_[last]);
+	siftDown(heapIndex);
+	siftUp(heapIndex);
+}
+
+void ESPDateScheduler::rebuildHeap() {
+	for (size_t i = size_ / 2; i-- > 0;) {
+		siftDown(i);
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+struct DateTime;
+class ESPDateRecurrence;
+
+// Fixed-capacity min-heap of wall-clock deadlines. tick(now) runs every due callback in
+// deadline order (ties in scheduling order) and costs O(1) when nothing is due, so hundreds of
+// deadlines no longer need an isAfter() scan each loop. All time is passed in explicitly, which
+// lets host tests drive the scheduler from a simulated clock.
+//
+// Deadlines come in two flavours:
+//   - absolute (scheduleAt, scheduleRecurring): pinned to UTC wall time; a clock step moves
+//     "now" towards or away from them, and a recurrence that fell behind fires once, not once
+//     per missed occurrence;
+//   - relative (scheduleAfter, scheduleEvery): pinned to elapsed time; onClockStep() shifts them
+//     by the step so a "10 minutes from now" timer still fires 10 minutes later.
+// ESPDate::attachScheduler() forwards every SNTP clock step to onClockStep().
+class ESPDateScheduler {
+  public:
+	using TaskId = uint32_t;
+	using Callback = std::function<void(TaskId id, const DateTime &due)>;
+	static constexpr TaskId kInvalidTaskId = 0;
+	static constexpr size_t kMaxCapacity = 0xFFFF;
+
+	ESPDateScheduler() = default;
+	~ESPDateScheduler();
+	ESPDateScheduler(const ESPDateScheduler &) = delete;
+	ESPDateScheduler &operator=(const ESPDateScheduler &) = delete;
+
+	// Reserves room for `capacity` pending tasks (at most kMaxCapacity). Drops pending tasks;
+	// returns false when called from a callback or when the allocation fails.
+	bool begin(size_t capacity, bool usePSRAMBuffers = false);
+	void end();
+
+	// All schedule calls return kInvalidTaskId when the scheduler is full or the input is invalid.
+	TaskId scheduleAt(const DateTime &deadline, Callback callback);
+	TaskId scheduleAtUs(int64_t deadlineUs, Callback callback);
+	// Fires at every occurrence of `rule` after `from`. The rule is not copied and must outlive
+	// the task; it is evaluated in the scheduler's time zone.
+	TaskId
+	scheduleRecurring(const ESPDateRecurrence &rule, const DateTime &from, Callback callback);
+	TaskId scheduleAfter(int64_t delayUs, int64_t nowUs, Callback callback);
+	// First run at nowUs + periodUs; keeps its phase and skips periods missed by a late tick.
+	TaskId scheduleEvery(int64_t periodUs, int64_t nowUs, Callback callback);
+	// Safe from inside callbacks, including the task's own.
+	bool cancel(TaskId id);
+	void clear();
+
+	// Runs callbacks whose deadline is at or before now; returns how many ran.
+	// At most capacity() callbacks run per tick, so a callback that keeps scheduling overdue
+	// work cannot stall the loop.
+	size_t tick(const DateTime &now);
+	size_t tickUs(int64_t nowUs);
+	// The wall clock jumped by stepUs (positive = forward). Re-keys the pending deadlines.
+	void onClockStep(int64_t stepUs);
+
+	bool nextDeadline(DateTime &out) const;
+	bool nextDeadlineUs(int64_t &outUs) const;
+	size_t size() const {
+		return size_;
+	}
+	size_t capacity() const {
+		return capacity_;
+	}
+	// POSIX TZ used for recurrences; nullptr (default) uses the process TZ. Not copied.
+	void setTimeZone(const char *timeZone) {
+		timeZone_ = timeZone;
+	}
+
+  private:
+	struct Task {
+		TaskId id = kInvalidTaskId;
+		int64_t dueUs = 0;
+		int64_t periodUs = 0;
+		const ESPDateRecurrence *rule = nullptr;
+		uint32_t sequence = 0;
+		uint16_t generation = 0;
+		bool relative = false;
+		size_t heapIndex = 0;
+		Callback callback{};
+	};
+
+	TaskId add(
+	    int64_t dueUs,
+	    int64_t periodUs,
+	    const ESPDateRecurrence *rule,
+	    bool relative,
+	    Callback &&callback
+	);
+	bool reschedule(Task &task, int64_t nowUs) const;
+	void releaseSlot(size_t slot);
+	bool less(size_t a, size_t b) const;
+	void place(size_t heapIndex, size_t slot);
+	void siftUp(size_t heapIndex);
+	void siftDown(size_t heapIndex);
+	void push(size_t slot);
+	void removeAt(size_t heapIndex);
+	void rebuildHeap();
+
+	Task *tasks_ = nullptr;
+	size_t *heap_ = nullptr;      // slots ordered as a binary min-heap on (dueUs, sequence)
+	size_t *freeSlots_ = nullptr; // stack of unused slots
+	size_t capacity_ = 0;
+	size_t size_ = 0;
+	size_t freeCount_ = 0;
+	uint32_t nextSequence_ = 0;
+	const char *timeZone_ = nullptr;
+	bool running_ = false;
+	size_t firingSlot_ = static_cast<size_t>(-1); // slot whose callback is running
+	bool firingCancelled_ = false;
+};
@@ -35,9 +35,24 @@ LocalDateResult deriveLocalDateWithOffset(const DateTime &dt, int offsetSeconds)
 	return LocalDateResult{t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, true};
 }
 
-OffsetDateResult
-computeOffsetAndDate(const DateTime &dt, const char *timeZone, bool usePSRAMBuffers) {
-	Utils::ScopedTz scoped(timeZone, usePSRAMBuffers);
+// The zone a TZ-aware sun calculation runs in: a zone handle when the TZ has parsed rules (or
+// comes from a tzdb table), else the TZ string for libc under a ScopedTz (zoneinfo names).
+struct SunZone {
+	const ESPDateTimeZone *handle = nullptr;
+	const char *name = nullptr;
+	bool usePSRAMBuffers = false;
+};
+
+OffsetDateResult computeOffsetAndDate(const DateTime &dt, const SunZone &zone) {
+	if (zone.handle) {
+		const LocalDateTime local = Utils::localFromZone(dt, *zone.handle);
+		OffsetDateResult result;
+		result.offsetMinutes = static_cast<double>(zone.handle->utcOffsetAt(dt.epochSeconds)) /
+		                       Utils::kSecondsPerMinute;
+		result.date = LocalDateResult{local.year, local.month, local.day, local.ok};
+		return result;
+	}
+	Utils::ScopedTz scoped(zone.name, zone.usePSRAMBuffers);
 	time_t raw = static_cast<time_t>(dt.epochSeconds);
 	tm local{};
 	if (localtime_r(&raw, &local) == nullptr) {
@@ -51,33 +66,43 @@ computeOffsetAndDate(const DateTime &dt, const char *timeZone, bool usePSRAMBuff
 	return result;
 }
 
+// UTC instant of a local wall time on `date`, resolved like fromLocal (ShiftForward).
+DateTime localClockToUtc(
+    const LocalDateResult &date, int hour, int minute, const SunZone &zone, const ESPDate &helper
+) {
+	if (zone.handle) {
+		const int64_t wall = Utils::daysFromCivil(
+		                         date.year,
+		                         static_cast<unsigned>(date.month),
+		                         static_cast<unsigned>(date.day)
+		                     ) * Utils::kSecondsPerDay +
+		                     hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute;
+		int64_t utc = 0;
+		zone.handle->localToUtc(wall, ESPDateDstPolicy::ShiftForward, utc);
+		return DateTime{utc};
+	}
+	Utils::ScopedTz scoped(zone.name, zone.usePSRAMBuffers);
+	return helper.fromLocal(date.year, date.month, date.day, hour, minute, 0);
+}
+
+LocalDateTime resolveLocal(const DateTime &utc, const SunZone &zone, const ESPDate &helper) {
+	return zone.handle ? Utils::localFromZone(utc, *zone.handle) : helper.toLocal(utc, zone.name);
+}
+
 DateTime buildLocalEventUtc(
-    const LocalDateResult &date,
-    int minutes,
-    const char *timeZone,
-    bool usePSRAMBuffers,
-    const ESPDate &dateHelper
+    const LocalDateResult &date, int minutes, const SunZone &zone, const ESPDate &dateHelper
 ) {
 	if (!date.ok || minutes < 0 || minutes >= 1440) {
 		return DateTime{};
 	}
-	Utils::ScopedTz scoped(timeZone, usePSRAMBuffers);
-	const int hour = minutes / 60;
-	const int minute = minutes % 60;
-	return dateHelper.fromLocal(date.year, date.month, date.day, hour, minute, 0);
+	return localClockToUtc(date, minutes / 60, minutes % 60, zone, dateHelper);
 }
 
 double offsetMinutesForLocalClock(
-    const LocalDateResult &date,
-    int hour,
-    int minute,
-    const char *timeZone,
-    bool usePSRAMBuffers,
-    const ESPDate &dateHelper
+    const LocalDateResult &date, int hour, int minute, const SunZone &zone, const ESPDate &helper
 ) {
-	Utils::ScopedTz scoped(timeZone, usePSRAMBuffers);
-	DateTime local = dateHelper.fromLocal(date.year, date.month, date.day, hour, minute, 0);
-	LocalDateTime resolved = dateHelper.toLocal(local, timeZone);
+	const DateTime local = localClockToUtc(date, hour, minute, zone, helper);
+	LocalDateTime resolved = resolveLocal(local, zone, helper);
 	if (!resolved.ok) {
 		return std::numeric_limits<double>::quiet_NaN();
 	}
@@ -257,8 +282,7 @@ SunCycleResult buildTimeZoneAwareSunCycleResult(
     const LocalDateResult &date,
     double latitude,
     double longitude,
-    const char *timeZone,
-    bool usePSRAMBuffers,
+    const SunZone &zone,
     const ESPDate &dateHelper
 ) {
 	SunCycleResult result{false, DateTime{}};
@@ -266,8 +290,7 @@ SunCycleResult buildTimeZoneAwareSunCycleResult(
 		return result;
 	}
 
-	double offsetMinutes =
-	    offsetMinutesForLocalClock(date, 12, 0, timeZone, usePSRAMBuffers, dateHelper);
+	double offsetMinutes = offsetMinutesForLocalClock(date, 12, 0, zone, dateHelper);
 	if (!std::isfinite(offsetMinutes)) {
 		return result;
 	}
@@ -287,9 +310,8 @@ SunCycleResult buildTimeZoneAwareSunCycleResult(
 			return result;
 		}
 
-		DateTime eventUtc =
-		    buildLocalEventUtc(date, minutes, timeZone, usePSRAMBuffers, dateHelper);
-		LocalDateTime resolved = dateHelper.toLocal(eventUtc, timeZone);
+		DateTime eventUtc = buildLocalEventUtc(date, minutes, zone, dateHelper);
+		LocalDateTime resolved = resolveLocal(eventUtc, zone, dateHelper);
 		if (!resolved.ok) {
 			return result;
 		}
@@ -317,9 +339,54 @@ SunCycleResult buildTimeZoneAwareSunCycleResult(
 		return result;
 	}
 	result.ok = true;
-	result.value = buildLocalEventUtc(date, minutes, timeZone, usePSRAMBuffers, dateHelper);
+	result.value = buildLocalEventUtc(date, minutes, zone, dateHelper);
 	return result;
 }
+
+SunCycleResult timeZoneAwareSunEvent(
+    bool isRise,
+    float latitude,
+    float longitude,
+    const SunZone &zone,
+    const DateTime &day,
+    const ESPDate &dateHelper
+) {
+	if (!validCoordinates(latitude, longitude)) {
+		return SunCycleResult{false, DateTime{}};
+	}
+	OffsetDateResult data = computeOffsetAndDate(day, zone);
+	if (!data.date.ok) {
+		return SunCycleResult{false, DateTime{}};
+	}
+	return buildTimeZoneAwareSunCycleResult(
+	    isRise,
+	    data.date,
+	    latitude,
+	    longitude,
+	    zone,
+	    dateHelper
+	);
+}
+
+// Resolves a TZ string (nullptr = process TZ) through the shared zone cache.
+SunCycleResult timeZoneAwareSunEvent(
+    bool isRise,
+    float latitude,
+    float longitude,
+    const char *timeZone,
+    bool usePSRAMBuffers,
+    const DateTime &day,
+    const ESPDate &dateHelper
+) {
+	ESPDatePosixTz rules;
+	const bool parsed = Utils::posixTzFor(timeZone, rules);
+	const ESPDateTimeZone parsedZone(rules);
+	SunZone zone;
+	zone.handle = parsed ? &parsedZone : nullptr;
+	zone.name = timeZone;
+	zone.usePSRAMBuffers = usePSRAMBuffers;
+	return timeZoneAwareSunEvent(isRise, latitude, longitude, zone, day, dateHelper);
+}
 } // namespace
 
 SunCycleResult ESPDate::sunrise() const {
@@ -351,6 +418,7 @@ ESPDate::sunset(float latitude, float longitude, float timezoneHours, bool isDst
 SunCycleResult ESPDate::sunrise(
     float latitude, float longitude, float timezoneHours, bool isDst, const DateTime &day
 ) const {
+	ESPDATE_PROBE(Sun);
 	if (!validCoordinates(latitude, longitude)) {
 		return SunCycleResult{false, DateTime{}};
 	}
@@ -376,6 +444,7 @@ SunCycleResult ESPDate::sunrise(
 SunCycleResult ESPDate::sunset(
     float latitude, float longitude, float timezoneHours, bool isDst, const DateTime &day
 ) const {
+	ESPDATE_PROBE(Sun);
 	if (!validCoordinates(latitude, longitude)) {
 		return SunCycleResult{false, DateTime{}};
 	}
@@ -408,88 +477,64 @@ SunCycleResult ESPDate::sunset(float latitude, float longitude, const char *time
 
 SunCycleResult
 ESPDate::sunrise(float latitude, float longitude, const char *timeZone, const DateTime &day) const {
-	if (!validCoordinates(latitude, longitude)) {
-		return SunCycleResult{false, DateTime{}};
-	}
-	OffsetDateResult data = computeOffsetAndDate(day, timeZone, usePSRAMBuffers_);
-	if (!data.date.ok) {
-		return SunCycleResult{false, DateTime{}};
-	}
-	return buildTimeZoneAwareSunCycleResult(
-	    true,
-	    data.date,
-	    latitude,
-	    longitude,
-	    timeZone,
-	    usePSRAMBuffers_,
-	    *this
-	);
+	ESPDATE_PROBE(Sun);
+	return timeZoneAwareSunEvent(true, latitude, longitude, timeZone, usePSRAMBuffers_, day, *this);
 }
 
 SunCycleResult
 ESPDate::sunset(float latitude, float longitude, const char *timeZone, const DateTime &day) const {
-	if (!validCoordinates(latitude, longitude)) {
-		return SunCycleResult{false, DateTime{}};
-	}
-	OffsetDateResult data = computeOffsetAndDate(day, timeZone, usePSRAMBuffers_);
-	if (!data.date.ok) {
-		return SunCycleResult{false, DateTime{}};
-	}
-	return buildTimeZoneAwareSunCycleResult(
+	ESPDATE_PROBE(Sun);
+	return timeZoneAwareSunEvent(
 	    false,
-	    data.date,
 	    latitude,
 	    longitude,
 	    timeZone,
 	    usePSRAMBuffers_,
+	    day,
 	    *this
 	);
 }
 
-SunCycleResult ESPDate::sunriseFromConfig(const DateTime &day) const {
-	if (!hasLocation_) {
+SunCycleResult ESPDate::sunrise(
+    float latitude, float longitude, const ESPDateTimeZone &zone, const DateTime &day
+) const {
+	ESPDATE_PROBE(Sun);
+	if (!zone.isValid()) {
 		return SunCycleResult{false, DateTime{}};
 	}
-	if (!validCoordinates(latitude_, longitude_)) {
+	SunZone sunZone;
+	sunZone.handle = &zone;
+	return timeZoneAwareSunEvent(true, latitude, longitude, sunZone, day, *this);
+}
+
+SunCycleResult ESPDate::sunset(
+    float latitude, float longitude, const ESPDateTimeZone &zone, const DateTime &day
+) const {
+	ESPDATE_PROBE(Sun);
+	if (!zone.isValid()) {
 		return SunCycleResult{false, DateTime{}};
 	}
-	const char *tz = timeZone_.empty() ? nullptr : timeZone_.c_str();
-	OffsetDateResult data = computeOffsetAndDate(day, tz, usePSRAMBuffers_);
-	if (!data.date.ok) {
+	SunZone sunZone;
+	sunZone.handle = &zone;
+	return timeZoneAwareSunEvent(false, latitude, longitude, sunZone, day, *this);
+}
+
+SunCycleResult ESPDate::sunriseFromConfig(const DateTime &day) const {
+	ESPDATE_PROBE(Sun);
+	if (!hasLocation_) {
 		return SunCycleResult{false, DateTime{}};
 	}
-	return buildTimeZoneAwareSunCycleResult(
-	    true,
-	    data.date,
-	    latitude_,
-	    longitude_,
-	    tz,
-	    usePSRAMBuffers_,
-	    *this
-	);
+	const char *tz = timeZone_.empty() ? nullptr : timeZone_.c_str();
+	return timeZoneAwareSunEvent(true, latitude_, longitude_, tz, usePSRAMBuffers_, day, *this);
 }
 
 SunCycleResult ESPDate::sunsetFromConfig(const DateTime &day) const {
+	ESPDATE_PROBE(Sun);
 	if (!hasLocation_) {
 		return SunCycleResult{false, DateTime{}};
 	}
-	if (!validCoordinates(latitude_, longitude_)) {
-		return SunCycleResult{false, DateTime{}};
-	}
 	const char *tz = timeZone_.empty() ? nullptr : timeZone_.c_str();
-	OffsetDateResult data = computeOffsetAndDate(day, tz, usePSRAMBuffers_);
-	if (!data.date.ok) {
-		return SunCycleResult{false, DateTime{}};
-	}
-	return buildTimeZoneAwareSunCycleResult(
-	    false,
-	    data.date,
-	    latitude_,
-	    longitude_,
-	    tz,
-	    usePSRAMBuffers_,
-	    *this
-	);
+	return timeZoneAwareSunEvent(false, latitude_, longitude_, tz, usePSRAMBuffers_, day, *this);
 }
 
 bool ESPDate::isDay() const {
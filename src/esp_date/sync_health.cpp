@@ -0,0 +1,128 @@
+#include "sync_health.h"
+
+#include <cmath>
+
+namespace {
+int64_t absValue(int64_t value) {
+	return value < 0 ? -value : value;
+}
+
+int64_t scalePpm(int64_t elapsedUs, float ppm) {
+	return static_cast<int64_t>(std::llround(static_cast<double>(elapsedUs) * ppm / 1000000.0));
+}
+} // namespace
+
+void ESPDateSyncHealth::reset() {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	state_ = State{};
+	publish();
+}
+
+void ESPDateSyncHealth::recordAttempt(int64_t monotonicUs, uint32_t timeoutMs) {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	State &state = state_;
+	if (attemptExpired(state, monotonicUs)) {
+		++state.failedSyncCount;
+	}
+	state.attemptPending = true;
+	state.attemptMonotonicUs = monotonicUs;
+	state.attemptTimeoutUs = static_cast<int64_t>(timeoutMs) * 1000;
+	publish();
+}
+
+void ESPDateSyncHealth::recordSync(const SyncSample &sample) {
+	std::lock_guard<std::mutex> lock(writeMutex_);
+	State &state = state_;
+	if (attemptExpired(state, sample.monotonicUs)) {
+		++state.failedSyncCount; // the reply arrived, but too late to count for that attempt
+	}
+	state.attemptPending = false;
+
+	const int64_t sinceLastUs =
+	    state.syncCount > 0 ? sample.monotonicUs - state.lastSyncMonotonicUs : 0;
+	++state.syncCount;
+	if (sample.hasStep) {
+		state.steps[state.nextStep] = sample.stepUs;
+		state.nextStep = (state.nextStep + 1) % TimeSyncStats::kStepHistory;
+		if (state.stepCount < TimeSyncStats::kStepHistory) {
+			++state.stepCount;
+		}
+	}
+
+	// The residual over the last interval is the best estimate of how fast error grows now.
+	float growthPpm = kUnmodelledDriftPpm;
+	if (sample.driftModelled && sinceLastUs > 0) {
+		growthPpm = static_cast<float>(
+		    static_cast<double>(absValue(sample.residualUs)) /
+		    (static_cast<double>(sinceLastUs) / 1e6)
+		);
+		if (growthPpm < 1.0f) {
+			growthPpm = 1.0f;
+		}
+	}
+	state.driftPpm = sample.driftPpm;
+	state.errorGrowthPpm = growthPpm;
+	state.lastSyncMonotonicUs = sample.monotonicUs;
+	state.pendingCorrectionUs = sample.pendingCorrectionUs;
+	state.slewPpm = sample.slewPpm;
+	publish();
+}
+
+TimeSyncStats ESPDateSyncHealth::snapshot(int64_t monotonicUs) const {
+	// An odd count means published_[0] is being written, an even one published_[1]; the other
+	// copy is stable, so a retry needs a writer to make progress, not to finish.
+	State copy;
+	for (;;) {
+		const uint32_t before = sequence_.load(std::memory_order_acquire);
+		copy = published_[before & 1u];
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sequence_.load(std::memory_order_relaxed) == before) {
+			break;
+		}
+	}
+
+	TimeSyncStats out{};
+	out.synced = copy.syncCount > 0;
+	out.syncCount = copy.syncCount;
+	out.failedSyncCount = copy.failedSyncCount;
+	const bool expired = attemptExpired(copy, monotonicUs);
+	if (expired) {
+		++out.failedSyncCount;
+	}
+	out.syncPending = copy.attemptPending && !expired;
+	for (size_t i = 0; i < copy.stepCount; ++i) {
+		const size_t index =
+		    (copy.nextStep + TimeSyncStats::kStepHistory - 1 - i) % TimeSyncStats::kStepHistory;
+		out.recentStepsUs[i] = copy.steps[index];
+	}
+	out.recentStepCount = copy.stepCount;
+	out.driftPpm = copy.driftPpm;
+	if (!out.synced) {
+		return out;
+	}
+
+	int64_t elapsedUs = monotonicUs - copy.lastSyncMonotonicUs;
+	if (elapsedUs < 0) {
+		elapsedUs = 0;
+	}
+	out.sinceLastSyncMs = elapsedUs / 1000;
+	int64_t unslewedUs = absValue(copy.pendingCorrectionUs) - scalePpm(elapsedUs, copy.slewPpm);
+	if (unslewedUs < 0) {
+		unslewedUs = 0;
+	}
+	out.errorBoundUs = kSyncUncertaintyUs + unslewedUs + scalePpm(elapsedUs, copy.errorGrowthPpm);
+	return out;
+}
+
+void ESPDateSyncHealth::publish() {
+	sequence_.fetch_add(1, std::memory_order_relaxed); // odd: readers use published_[1]
+	std::atomic_thread_fence(std::memory_order_release);
+	published_[0] = state_;
+	sequence_.fetch_add(1, std::memory_order_release); // even: readers use published_[0]
+	std::atomic_thread_fence(std::memory_order_release);
+	published_[1] = state_;
+}
+
+bool ESPDateSyncHealth::attemptExpired(const State &state, int64_t monotonicUs) {
+	return state.attemptPending && monotonicUs - state.attemptMonotonicUs > state.attemptTimeoutUs;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+struct TimeSyncStats {
+	static constexpr size_t kStepHistory = 8;
+
+	bool synced = false;          // at least one sync since init
+	uint32_t syncCount = 0;       // successful sync callbacks
+	uint32_t failedSyncCount = 0; // syncNTP() attempts with no callback within the timeout
+	bool syncPending = false;     // a syncNTP() attempt is still inside its timeout window
+	int64_t recentStepsUs[kStepHistory]{}; // how far each sync moved the clock, newest first
+	size_t recentStepCount = 0;
+	float driftPpm = 0.0f;       // estimated oscillator error, positive = local clock fast
+	int64_t sinceLastSyncMs = -1; // -1 when never synced
+	int64_t errorBoundUs = -1;    // estimated current |error|; -1 when unknown (never synced)
+};
+
+// Writer side is fed from the SNTP callback and syncNTP(); readers take a snapshot
+// through a sequence counter, so polling never blocks or allocates. Writers serialize on a
+// mutex and publish into two copies in turn, so a reader always has one copy no writer is
+// touching and never waits on a writer that was preempted mid-update.
+class ESPDateSyncHealth {
+  public:
+	// Typical SNTP-over-WiFi accuracy assumed right after a sync.
+	static constexpr int64_t kSyncUncertaintyUs = 10000;
+	// Error growth assumed until at least two syncs characterise the oscillator.
+	static constexpr float kUnmodelledDriftPpm = 50.0f;
+
+	struct SyncSample {
+		int64_t monotonicUs = 0;
+		int64_t stepUs = 0;              // how far the sync moved the system clock
+		bool hasStep = false;            // false when the step could not be measured
+		int64_t residualUs = 0;          // disciplined-time prediction error at the sync
+		int64_t pendingCorrectionUs = 0; // part of the residual still to be slewed
+		uint32_t slewPpm = 0;
+		float driftPpm = 0.0f;
+		bool driftModelled = false; // drift fitted from at least two syncs
+	};
+
+	void reset();
+	void recordAttempt(int64_t monotonicUs, uint32_t timeoutMs);
+	void recordSync(const SyncSample &sample);
+	TimeSyncStats snapshot(int64_t monotonicUs) const;
+
+  private:
+	struct State {
+		uint32_t syncCount = 0;
+		uint32_t failedSyncCount = 0;
+		bool attemptPending = false;
+		int64_t attemptMonotonicUs = 0;
+		int64_t attemptTimeoutUs = 0;
+		int64_t steps[TimeSyncStats::kStepHistory]{};
+		size_t stepCount = 0;
+		size_t nextStep = 0;
+		float driftPpm = 0.0f;
+		float errorGrowthPpm = kUnmodelledDriftPpm;
+		int64_t lastSyncMonotonicUs = 0;
+		int64_t pendingCorrectionUs = 0;
+		uint32_t slewPpm = 0;
+	};
+
+	void publish();
+	static bool attemptExpired(const State &state, int64_t monotonicUs);
+
+	std::mutex writeMutex_;
+	State state_{}; // writer-owned, under writeMutex_
+	std::atomic<uint32_t> sequence_{0};
+	State published_[2]{};
+};
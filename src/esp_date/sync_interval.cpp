@@ -0,0 +1,101 @@
+#include "sync_interval.h"
+
+#include <cmath>
+
+namespace {
+constexpr double kMillisPerDay = 24.0 * 60.0 * 60.0 * 1000.0;
+
+int64_t absValue(int64_t value) {
+	return value < 0 ? -value : value;
+}
+} // namespace
+
+void ESPDateSyncIntervalController::configure(const ESPDateAdaptiveSyncConfig &config) {
+	config_ = config;
+	if (config_.minIntervalMs == 0) {
+		config_.minIntervalMs = 1;
+	}
+	if (config_.maxIntervalMs < config_.minIntervalMs) {
+		config_.maxIntervalMs = config_.minIntervalMs;
+	}
+	if (!(config_.safetyFactor > 0.0f) || config_.safetyFactor > 1.0f) {
+		config_.safetyFactor = 0.5f;
+	}
+	reset();
+}
+
+void ESPDateSyncIntervalController::reset() {
+	intervalMs_ = config_.minIntervalMs;
+	syncCount_ = 0;
+	lastOffsetUs_ = 0;
+	maxAbsOffsetUs_ = 0;
+	sumAbsOffsetUs_ = 0;
+	widenCount_ = 0;
+	narrowCount_ = 0;
+}
+
+uint32_t ESPDateSyncIntervalController::onSync(int64_t offsetUs, int64_t sinceLastSyncUs) {
+	const int64_t magnitude = absValue(offsetUs);
+	++syncCount_;
+	lastOffsetUs_ = offsetUs;
+	sumAbsOffsetUs_ += magnitude;
+	if (magnitude > maxAbsOffsetUs_) {
+		maxAbsOffsetUs_ = magnitude;
+	}
+
+	// The first sync only anchors the clock; there is no error rate to act on yet.
+	if (syncCount_ == 1 || sinceLastSyncUs <= 0) {
+		return intervalMs_;
+	}
+
+	const uint32_t previous = intervalMs_;
+	if (magnitude > static_cast<int64_t>(config_.targetAccuracyUs)) {
+		intervalMs_ = clampInterval(intervalMs_ / 2);
+	} else {
+		const uint64_t doubled = static_cast<uint64_t>(intervalMs_) * 2;
+		uint64_t planned = doubled;
+		if (magnitude > 0) {
+			// Error growth in us per second of elapsed time (numerically equal to ppm).
+			const double rate =
+			    static_cast<double>(magnitude) / (static_cast<double>(sinceLastSyncUs) / 1e6);
+			const double budgetUs =
+			    static_cast<double>(config_.targetAccuracyUs) * config_.safetyFactor;
+			const double idealMs = budgetUs / rate * 1000.0;
+			if (idealMs < static_cast<double>(doubled)) {
+				planned = static_cast<uint64_t>(idealMs);
+			}
+		}
+		intervalMs_ = clampInterval(planned);
+	}
+
+	if (intervalMs_ > previous) {
+		++widenCount_;
+	} else if (intervalMs_ < previous) {
+		++narrowCount_;
+	}
+	return intervalMs_;
+}
+
+ESPDateSyncIntervalStats ESPDateSyncIntervalController::stats() const {
+	ESPDateSyncIntervalStats out{};
+	out.syncCount = syncCount_;
+	out.intervalMs = intervalMs_;
+	out.lastOffsetUs = lastOffsetUs_;
+	out.maxAbsOffsetUs = maxAbsOffsetUs_;
+	out.meanAbsOffsetUs = syncCount_ > 0 ? sumAbsOffsetUs_ / syncCount_ : 0;
+	out.widenCount = widenCount_;
+	out.narrowCount = narrowCount_;
+	out.syncsPerDay =
+	    intervalMs_ > 0 ? static_cast<float>(kMillisPerDay / static_cast<double>(intervalMs_)) : 0;
+	return out;
+}
+
+uint32_t ESPDateSyncIntervalController::clampInterval(uint64_t intervalMs) const {
+	if (intervalMs < config_.minIntervalMs) {
+		return config_.minIntervalMs;
+	}
+	if (intervalMs > config_.maxIntervalMs) {
+		return config_.maxIntervalMs;
+	}
+	return static_cast<uint32_t>(intervalMs);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+struct ESPDateAdaptiveSyncConfig {
+	uint32_t minIntervalMs = 15UL * 60UL * 1000UL;       // never sync more often than this
+	uint32_t maxIntervalMs = 24UL * 60UL * 60UL * 1000UL; // never sync less often than this
+	uint32_t targetAccuracyUs = 50000; // keep the error accumulated between syncs below this
+	float safetyFactor = 0.5f;         // fraction of the target the controller plans for
+};
+
+struct ESPDateSyncIntervalStats {
+	bool adaptive = false;
+	uint32_t syncCount = 0;
+	uint32_t intervalMs = 0;      // interval currently handed to SNTP
+	int64_t lastOffsetUs = 0;     // residual error measured at the last sync
+	int64_t maxAbsOffsetUs = 0;   // worst residual since enable/reset
+	int64_t meanAbsOffsetUs = 0;  // running mean of |residual|
+	uint32_t widenCount = 0;      // interval increases
+	uint32_t narrowCount = 0;     // interval decreases
+	float syncsPerDay = 0.0f;     // radio wake-ups per day at the current interval
+};
+
+// Chooses the SNTP interval from the residual error measured at each sync.
+// The residual divided by the time since the previous sync gives the error
+// growth rate; the next interval is the time it takes that rate to consume
+// safetyFactor * targetAccuracyUs, limited to doubling per step and clamped
+// to [minIntervalMs, maxIntervalMs]. A residual above target halves it.
+class ESPDateSyncIntervalController {
+  public:
+	void configure(const ESPDateAdaptiveSyncConfig &config);
+	void reset();
+
+	// Returns the interval to use until the next sync.
+	uint32_t onSync(int64_t offsetUs, int64_t sinceLastSyncUs);
+
+	uint32_t intervalMs() const {
+		return intervalMs_;
+	}
+	const ESPDateAdaptiveSyncConfig &config() const {
+		return config_;
+	}
+	ESPDateSyncIntervalStats stats() const;
+
+  private:
+	uint32_t clampInterval(uint64_t intervalMs) const;
+
+	ESPDateAdaptiveSyncConfig config_{};
+	uint32_t intervalMs_ = 0;
+	uint32_t syncCount_ = 0;
+	int64_t lastOffsetUs_ = 0;
+	int64_t maxAbsOffsetUs_ = 0;
+	int64_t sumAbsOffsetUs_ = 0;
+	uint32_t widenCount_ = 0;
+	uint32_t narrowCount_ = 0;
+};
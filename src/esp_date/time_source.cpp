@@ -0,0 +1,90 @@
+#include "time_source.h"
+
+#include "utils.h"
+
+#include <chrono>
+
+using Utils = ESPDateUtils;
+
+ESPDateSystemTimeSource &ESPDateSystemTimeSource::instance() {
+	static ESPDateSystemTimeSource source;
+	return source;
+}
+
+int64_t ESPDateSystemTimeSource::epochMicros() const {
+	const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::microseconds>(sinceEpoch).count();
+}
+
+int64_t ESPDateSystemTimeSource::monotonicMicros() const {
+	return Utils::monotonicMicros();
+}
+
+ESPDateMonotonicTimeSource::ESPDateMonotonicTimeSource() {
+	anchorToSystemClock();
+}
+
+ESPDateMonotonicTimeSource::ESPDateMonotonicTimeSource(int64_t epochMicros) {
+	anchor(epochMicros);
+}
+
+void ESPDateMonotonicTimeSource::anchor(int64_t epochMicros) {
+	offsetUs_.store(epochMicros - Utils::monotonicMicros(), std::memory_order_relaxed);
+}
+
+void ESPDateMonotonicTimeSource::anchorToSystemClock() {
+	anchor(ESPDateSystemTimeSource::instance().epochMicros());
+}
+
+int64_t ESPDateMonotonicTimeSource::epochMicros() const {
+	return Utils::monotonicMicros() + offsetUs_.load(std::memory_order_relaxed);
+}
+
+int64_t ESPDateMonotonicTimeSource::monotonicMicros() const {
+	return Utils::monotonicMicros();
+}
+
+ESPDateSimulatedTimeSource::ESPDateSimulatedTimeSource(int64_t epochMicros) {
+	setEpochMicros(epochMicros);
+}
+
+void ESPDateSimulatedTimeSource::advanceMicros(int64_t micros) {
+	if (micros > 0) {
+		monotonicUs_.fetch_add(micros, std::memory_order_relaxed);
+	}
+}
+
+void ESPDateSimulatedTimeSource::advanceSeconds(int64_t seconds) {
+	advanceMicros(seconds * Utils::kMicrosPerSecond);
+}
+
+void ESPDateSimulatedTimeSource::advanceDays(int64_t days) {
+	advanceSeconds(days * Utils::kSecondsPerDay);
+}
+
+void ESPDateSimulatedTimeSource::setEpochMicros(int64_t epochMicros) {
+	offsetUs_.store(
+	    epochMicros - monotonicUs_.load(std::memory_order_relaxed),
+	    std::memory_order_relaxed
+	);
+}
+
+void ESPDateSimulatedTimeSource::setEpochSeconds(int64_t epochSeconds) {
+	setEpochMicros(epochSeconds * Utils::kMicrosPerSecond);
+}
+
+void ESPDateSimulatedTimeSource::setAutoAdvance(int64_t microsPerRead) {
+	autoAdvanceUs_.store(microsPerRead > 0 ? microsPerRead : 0, std::memory_order_relaxed);
+}
+
+int64_t ESPDateSimulatedTimeSource::epochMicros() const {
+	const int64_t step = autoAdvanceUs_.load(std::memory_order_relaxed);
+	const int64_t monotonicUs = step > 0
+	                                ? monotonicUs_.fetch_add(step, std::memory_order_relaxed) + step
+	                                : monotonicUs_.load(std::memory_order_relaxed);
+	return monotonicUs + offsetUs_.load(std::memory_order_relaxed);
+}
+
+int64_t ESPDateSimulatedTimeSource::monotonicMicros() const {
+	return monotonicUs_.load(std::memory_order_relaxed);
+}
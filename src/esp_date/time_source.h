@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+// Where ESPDate reads the time. now(), nowUs(), the coarse clock, the relative add*/sub* and
+// the sun/moon helpers without a date all read the wall clock through it. The clock
+// discipline, sync health and checkpoint code read its monotonic clock. Swap in another source
+// (ESPDate::setTimeSource) to run date logic against a clock you control. Implementations must
+// be safe to call from any task.
+class ESPDateTimeSource {
+  public:
+	virtual ~ESPDateTimeSource() = default;
+	// UTC wall clock, microseconds since 1970-01-01T00:00:00Z. May step.
+	virtual int64_t epochMicros() const = 0;
+	// Microseconds since an arbitrary origin. Never goes backwards.
+	virtual int64_t monotonicMicros() const = 0;
+};
+
+// The default: the system clock (set by SNTP and settimeofday) plus esp_timer on device or
+// steady_clock on host.
+class ESPDateSystemTimeSource : public ESPDateTimeSource {
+  public:
+	static ESPDateSystemTimeSource &instance();
+
+	int64_t epochMicros() const override;
+	int64_t monotonicMicros() const override;
+};
+
+// Wall clock extrapolated from the monotonic timer after an anchor. Later SNTP steps and
+// settimeofday() calls do not move it, so intervals measured with it stay exact; re-anchor()
+// to take a correction on purpose.
+class ESPDateMonotonicTimeSource : public ESPDateTimeSource {
+  public:
+	// Anchored to the system clock.
+	ESPDateMonotonicTimeSource();
+	explicit ESPDateMonotonicTimeSource(int64_t epochMicros);
+
+	// From now on epochMicros() continues from `epochMicros`.
+	void anchor(int64_t epochMicros);
+	void anchorToSystemClock();
+
+	int64_t epochMicros() const override;
+	int64_t monotonicMicros() const override;
+
+  private:
+	std::atomic<int64_t> offsetUs_{0}; // wall clock minus monotonic clock
+};
+
+// Virtual clock for host tests, soak runs and benchmarks. Time moves only when told to:
+//   advance*()        moves wall and monotonic time together, a year in one call;
+//   setEpochMicros()  steps the wall clock alone, like an SNTP correction;
+//   setAutoAdvance()  advances both by a fixed amount on every epochMicros() read, so code
+//                     that polls now() in a loop makes progress on its own.
+// A step does not reach ESPDate's coarse clock until its current second expires on the
+// monotonic clock; call ESPDate::invalidateCoarseClock() after setEpochMicros() if that matters.
+class ESPDateSimulatedTimeSource : public ESPDateTimeSource {
+  public:
+	explicit ESPDateSimulatedTimeSource(int64_t epochMicros = 0);
+
+	// Negative amounts are ignored; use setEpochMicros() to go back in wall time.
+	void advanceMicros(int64_t micros);
+	void advanceSeconds(int64_t seconds);
+	void advanceDays(int64_t days);
+	void setEpochMicros(int64_t epochMicros);
+	void setEpochSeconds(int64_t epochSeconds);
+	void setAutoAdvance(int64_t microsPerRead);
+
+	int64_t epochMicros() const override;
+	int64_t monotonicMicros() const override;
+
+  private:
+	mutable std::atomic<int64_t> monotonicUs_{0};
+	std::atomic<int64_t> offsetUs_{0};
+	std::atomic<int64_t> autoAdvanceUs_{0};
+};
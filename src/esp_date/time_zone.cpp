@@ -0,0 +1,137 @@
+#include "time_zone.h"
+#include "date_allocator.h"
+
+#include <cstring>
+#include <new>
+
+namespace {
+// FNV-1a; also yields the length so over-long names are caught in the same pass.
+uint32_t hashName(const char *name, size_t &length) {
+	uint32_t hash = 2166136261u;
+	length = 0;
+	for (const char *p = name; *p != '\0'; ++p, ++length) {
+		hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+	}
+	return hash;
+}
+} // namespace
+
+ESPDateTimeZone ESPDateTimeZone::fromPosix(const char *timeZone) {
+	ESPDateTimeZone zone;
+	ESPDateTimeZoneCache::shared().lookup(timeZone, zone.zone_.footer_);
+	return zone;
+}
+
+ESPDateTimeZoneCache::~ESPDateTimeZoneCache() {
+	configureLocked(0, false);
+}
+
+ESPDateTimeZoneCache &ESPDateTimeZoneCache::shared() {
+	static ESPDateTimeZoneCache cache;
+	return cache;
+}
+
+bool ESPDateTimeZoneCache::configure(size_t capacity, bool usePSRAMBuffers) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return configureLocked(capacity, usePSRAMBuffers);
+}
+
+bool ESPDateTimeZoneCache::configureLocked(size_t capacity, bool usePSRAMBuffers) {
+	if (entries_) {
+		for (size_t i = 0; i < capacity_; ++i) {
+			entries_[i].~Entry();
+		}
+		date_allocator_detail::heapDeallocate(entries_);
+	}
+	entries_ = nullptr;
+	capacity_ = 0;
+	useClock_ = 0;
+	configured_ = true;
+	if (capacity == 0) {
+		return true;
+	}
+	if (capacity > kMaxCapacity) {
+		return false;
+	}
+	void *storage = date_allocator_detail::heapAllocate(sizeof(Entry) * capacity, usePSRAMBuffers);
+	if (!storage) {
+		return false;
+	}
+	entries_ = static_cast<Entry *>(storage);
+	for (size_t i = 0; i < capacity; ++i) {
+		new (&entries_[i]) Entry();
+	}
+	capacity_ = capacity;
+	return true;
+}
+
+void ESPDateTimeZoneCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (size_t i = 0; i < capacity_; ++i) {
+		entries_[i] = Entry{};
+	}
+	useClock_ = 0;
+	stats_ = ESPDateTimeZoneCacheStats{};
+}
+
+bool ESPDateTimeZoneCache::lookup(const char *timeZone, ESPDatePosixTz &out) {
+	if (!timeZone) {
+		out = ESPDatePosixTz{};
+		return false;
+	}
+	size_t length = 0;
+	const uint32_t hash = hashName(timeZone, length);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (!configured_) {
+		configureLocked(kDefaultCapacity, false);
+	}
+	if (length > kMaxNameLength || capacity_ == 0) {
+		++stats_.uncached;
+		return out.parse(timeZone);
+	}
+
+	if (++useClock_ == 0) {
+		// Wrapped after 4 billion lookups: restart the ages rather than mis-order them.
+		for (size_t i = 0; i < capacity_; ++i) {
+			if (entries_[i].lastUse != 0) {
+				entries_[i].lastUse = 1;
+			}
+		}
+		useClock_ = 2;
+	}
+	Entry *victim = &entries_[0];
+	for (size_t i = 0; i < capacity_; ++i) {
+		Entry &entry = entries_[i];
+		if (entry.lastUse != 0 && entry.hash == hash && std::strcmp(entry.name, timeZone) == 0) {
+			entry.lastUse = useClock_;
+			++stats_.hits;
+			out = entry.rules;
+			return out.isValid();
+		}
+		if (entry.lastUse < victim->lastUse) {
+			victim = &entry;
+		}
+	}
+
+	++stats_.misses;
+	if (victim->lastUse != 0) {
+		++stats_.evictions;
+	}
+	out.parse(timeZone);
+	victim->hash = hash;
+	victim->lastUse = useClock_;
+	victim->rules = out;
+	std::memcpy(victim->name, timeZone, length + 1);
+	return out.isValid();
+}
+
+ESPDateTimeZoneCacheStats ESPDateTimeZoneCache::stats() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	ESPDateTimeZoneCacheStats result = stats_;
+	result.capacity = capacity_;
+	for (size_t i = 0; i < capacity_; ++i) {
+		result.entries += entries_[i].lastUse != 0;
+	}
+	return result;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "posix_tz.h"
+#include "tzdb.h"
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ESPDateTimeZoneCacheStats {
+	uint32_t hits = 0;
+	uint32_t misses = 0;    // lookups that had to parse the string
+	uint32_t evictions = 0; // least recently used entries dropped to make room
+	uint32_t uncached = 0;  // lookups parsed without caching (name too long, capacity 0)
+	size_t entries = 0;
+	size_t capacity = 0;
+};
+
+// Handle to a zone's rules: parsed POSIX TZ rules, or a zone of a generated tzdb table with
+// its full transition history. It holds the rules by value (a few dozen bytes), so it stays
+// valid after the cache evicts its string and can be copied freely between tasks. Keep one per
+// site and pass it to the ESPDateTimeZone overloads of toLocal/isDstActive/sunrise/sunset.
+class ESPDateTimeZone {
+  public:
+	ESPDateTimeZone() = default; // invalid; conversions through it report failure
+	explicit ESPDateTimeZone(const ESPDatePosixTz &rules) {
+		zone_.footer_ = rules;
+	}
+	explicit ESPDateTimeZone(const ESPDateTzdbZone &zone) : zone_(zone) {}
+
+	// Looks timeZone up in ESPDateTimeZoneCache::shared(), parsing it on a miss. Zoneinfo
+	// names (not POSIX rule strings) and nullptr give an invalid handle.
+	static ESPDateTimeZone fromPosix(const char *timeZone);
+	// IANA zone from a table emitted by scripts/generate_tzdb.py; invalid when it is missing.
+	static ESPDateTimeZone fromTzdb(const ESPDateTzdbTable &table, const char *name) {
+		return ESPDateTimeZone(ESPDateTzdbZone::find(table, name));
+	}
+
+	bool isValid() const {
+		return zone_.isValid();
+	}
+	// Current POSIX rules; for tzdb zones, the footer that applies after the last transition.
+	const ESPDatePosixTz &rules() const {
+		return zone_.footer();
+	}
+
+	int32_t utcOffsetAt(int64_t utcSeconds) const {
+		return zone_.utcOffsetAt(utcSeconds);
+	}
+	bool isDstAt(int64_t utcSeconds) const {
+		return zone_.isDstAt(utcSeconds);
+	}
+	bool localToUtc(
+	    int64_t wallSeconds,
+	    ESPDateDstPolicy policy,
+	    int64_t &utcSeconds,
+	    ESPDateLocalTimeKind *kind = nullptr
+	) const {
+		return zone_.localToUtc(wallSeconds, policy, utcSeconds, kind);
+	}
+
+  private:
+	ESPDateTzdbZone zone_{};
+};
+
+// Bounded LRU of parsed TZ strings, keyed by the string itself (interned as a copy, so callers
+// may pass temporaries). ESPDate resolves every per-call and configured TZ through the shared
+// instance, so repeated conversions in a zone skip both parsing and the libc TZ switch.
+// Strings that fail to parse are cached as well, so zoneinfo names fall back to libc without
+// being re-parsed each time. Lookups take a mutex and scan at most `capacity` entries.
+class ESPDateTimeZoneCache {
+  public:
+	static constexpr size_t kDefaultCapacity = 32;
+	static constexpr size_t kMaxCapacity = 256;
+	static constexpr size_t kMaxNameLength = 63; // longer strings are parsed on every lookup
+
+	ESPDateTimeZoneCache() = default;
+	~ESPDateTimeZoneCache();
+	ESPDateTimeZoneCache(const ESPDateTimeZoneCache &) = delete;
+	ESPDateTimeZoneCache &operator=(const ESPDateTimeZoneCache &) = delete;
+
+	// Process-wide cache used by ESPDate. Its storage (kDefaultCapacity entries) is allocated
+	// on the first lookup unless configure() ran before.
+	static ESPDateTimeZoneCache &shared();
+
+	// Drops every entry and resizes; capacity 0 turns caching off. False when the storage
+	// cannot be allocated (the cache is then disabled) or capacity exceeds kMaxCapacity.
+	bool configure(size_t capacity, bool usePSRAMBuffers = false);
+	// Drops every entry and zeroes the stats, keeping the capacity.
+	void clear();
+
+	// Parsed rules for timeZone; false for nullptr and strings that are not POSIX rules.
+	bool lookup(const char *timeZone, ESPDatePosixTz &out);
+	ESPDateTimeZoneCacheStats stats() const;
+
+  private:
+	struct Entry {
+		uint32_t hash = 0;
+		uint32_t lastUse = 0; // 0 = empty slot
+		ESPDatePosixTz rules{};
+		char name[kMaxNameLength + 1] = {};
+	};
+
+	bool configureLocked(size_t capacity, bool usePSRAMBuffers);
+
+	mutable std::mutex mutex_;
+	Entry *entries_ = nullptr;
+	size_t capacity_ = 0;
+	bool configured_ = false;
+	uint32_t useClock_ = 0;
+	ESPDateTimeZoneCacheStats stats_{};
+};
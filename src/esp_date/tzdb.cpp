@@ -0,0 +1,206 @@
+#include "tzdb.h"
+
+#include <cstring>
+#include <limits>
+
+namespace {
+constexpr int64_t kMinTime = std::numeric_limits<int64_t>::min();
+constexpr int64_t kMaxTime = std::numeric_limits<int64_t>::max();
+constexpr size_t kInterval = ESPDateTzdbTable::kCheckpointInterval;
+
+// FNV-1a finished with the MurmurHash3 mixer, so seeds that differ in a few bits still land
+// on unrelated slots. scripts/generate_tzdb.py computes the same function.
+uint32_t hashName(const char *name, uint32_t seed) {
+	uint32_t hash = 2166136261u ^ seed;
+	for (const char *p = name; *p != '\0'; ++p) {
+		hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+uint64_t readVarint(const uint8_t *&cursor) {
+	uint64_t value = 0;
+	for (int shift = 0;; shift += 7) {
+		const uint8_t byte = *cursor++;
+		value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0) {
+			return value;
+		}
+	}
+}
+} // namespace
+
+ESPDateTzdbZone ESPDateTzdbZone::find(const ESPDateTzdbTable &table, const char *name) {
+	ESPDateTzdbZone zone;
+	if (!name || table.zoneCount == 0 || table.bucketCount == 0) {
+		return zone;
+	}
+	const uint16_t seed = table.buckets[hashName(name, 0) % table.bucketCount];
+	const ESPDateTzdbZoneRecord &record = table.zones[hashName(name, seed) % table.zoneCount];
+	if (std::strcmp(table.strings + record.name, name) != 0) {
+		return zone;
+	}
+	zone.table_ = &table;
+	zone.record_ = &record;
+	const char *footer = table.strings + record.footer;
+	if (*footer != '\0') {
+		zone.footer_.parse(footer);
+	}
+	return zone;
+}
+
+const char *ESPDateTzdbZone::name() const {
+	return record_ ? table_->strings + record_->name : "";
+}
+
+int32_t ESPDateTzdbZone::utcOffsetAt(int64_t utcSeconds) const {
+	int64_t validFrom = 0;
+	int64_t validUntil = 0;
+	bool isDst = false;
+	return lookup(utcSeconds, validFrom, validUntil, isDst);
+}
+
+int32_t
+ESPDateTzdbZone::utcOffsetAt(int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil) const {
+	bool isDst = false;
+	return lookup(utcSeconds, validFrom, validUntil, isDst);
+}
+
+bool ESPDateTzdbZone::isDstAt(int64_t utcSeconds) const {
+	int64_t validFrom = 0;
+	int64_t validUntil = 0;
+	bool isDst = false;
+	lookup(utcSeconds, validFrom, validUntil, isDst);
+	return isDst;
+}
+
+int32_t ESPDateTzdbZone::lookup(
+    int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil, bool &isDst
+) const {
+	validFrom = kMinTime;
+	validUntil = kMaxTime;
+	isDst = false;
+	uint8_t type = 0;
+	bool pastLast = true;
+	if (record_) {
+		const ESPDateTzdbTable &table = *table_;
+		const ESPDateTzdbZoneRecord &zone = *record_;
+		const uint32_t *times = table.checkpointTimes + zone.checkpoints;
+		const size_t checkpoints = (zone.transitionCount + kInterval - 1) / kInterval;
+		// First checkpoint after utcSeconds; the one before it starts the linear decode.
+		size_t low = 0;
+		size_t high = checkpoints;
+		while (low < high) {
+			const size_t mid = low + (high - low) / 2;
+			if (table.base + static_cast<int64_t>(times[mid]) <= utcSeconds) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+		pastLast = zone.transitionCount == 0;
+		if (low == 0 && checkpoints > 0) {
+			validUntil = table.base + static_cast<int64_t>(times[0]);
+		} else if (low > 0) {
+			const size_t checkpoint = low - 1;
+			const uint8_t *cursor = table.transitions + zone.transitions +
+			                        table.checkpointOffsets[zone.checkpoints + checkpoint];
+			int64_t at = table.base + static_cast<int64_t>(times[checkpoint]);
+			type = static_cast<uint8_t>(readVarint(cursor) % zone.typeCount);
+			size_t index = checkpoint * kInterval;
+			while (++index < zone.transitionCount) {
+				const uint64_t value = readVarint(cursor);
+				const int64_t next =
+				    at + static_cast<int64_t>(value / zone.typeCount) * zone.unitSeconds;
+				if (next > utcSeconds) {
+					validUntil = next;
+					break;
+				}
+				at = next;
+				type = static_cast<uint8_t>(value % zone.typeCount);
+			}
+			validFrom = at;
+			pastLast = index >= zone.transitionCount;
+		}
+	}
+
+	if (pastLast && footer_.isValid()) {
+		int64_t from = 0;
+		const int32_t offset = footer_.utcOffsetAt(utcSeconds, from, validUntil);
+		validFrom = from > validFrom ? from : validFrom;
+		isDst = footer_.hasDst() && offset != footer_.standardOffsetSeconds();
+		return offset;
+	}
+	if (!record_) {
+		return 0;
+	}
+	const int32_t packed = table_->types[record_->types + type];
+	isDst = (packed & 1) != 0;
+	return (packed - (packed & 1)) / 2;
+}
+
+bool ESPDateTzdbZone::localToUtc(
+    int64_t wallSeconds, ESPDateDstPolicy policy, int64_t &utcSeconds, ESPDateLocalTimeKind *kind
+) const {
+	if (!record_) {
+		return footer_.localToUtc(wallSeconds, policy, utcSeconds, kind);
+	}
+	// Offsets never exceed a day, so the transitions that can make wallSeconds ambiguous are
+	// the ones bounding the span that contains it read as a UTC instant.
+	int64_t from = 0;
+	int64_t until = 0;
+	int32_t candidates[3] = {utcOffsetAt(wallSeconds, from, until), 0, 0};
+	size_t candidateCount = 1;
+	if (from != kMinTime) {
+		candidates[candidateCount++] = utcOffsetAt(from - 1);
+	}
+	if (until != kMaxTime) {
+		candidates[candidateCount++] = utcOffsetAt(until);
+	}
+	int64_t first = kMaxTime;
+	int64_t second = kMinTime;
+	for (size_t i = 0; i < candidateCount; ++i) {
+		const int64_t utc = wallSeconds - candidates[i];
+		if (utcOffsetAt(utc) != candidates[i]) {
+			continue;
+		}
+		first = utc < first ? utc : first;
+		second = utc > second ? utc : second;
+	}
+
+	if (first != kMaxTime) {
+		const bool repeated = first != second;
+		if (kind) {
+			*kind = repeated ? ESPDateLocalTimeKind::Repeated : ESPDateLocalTimeKind::Unique;
+		}
+		utcSeconds = repeated && policy == ESPDateDstPolicy::Latest ? second : first;
+		return true;
+	}
+
+	if (kind) {
+		*kind = ESPDateLocalTimeKind::Skipped;
+	}
+	if (policy == ESPDateDstPolicy::Skip) {
+		return false;
+	}
+	const int64_t bounds[2] = {from, until};
+	for (const int64_t transition : bounds) {
+		if (transition == kMinTime || transition == kMaxTime) {
+			continue;
+		}
+		const int32_t before = utcOffsetAt(transition - 1);
+		const int32_t after = utcOffsetAt(transition);
+		if (wallSeconds >= transition + before && wallSeconds < transition + after) {
+			// ShiftForward reads the wall time with the offset in force before the jump.
+			utcSeconds =
+			    policy == ESPDateDstPolicy::ShiftForward ? wallSeconds - before : transition;
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "posix_tz.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tables emitted by scripts/generate_tzdb.py from the host's TZif files. Everything is const
+// POD, so a generated table lives in flash/rodata and costs no RAM. Per zone:
+//   - types: distinct (UTC offset, DST flag) pairs, packed as offset * 2 + isDst;
+//   - transitions: LEB128 varints of delta * typeCount + type, where delta is the time since
+//     the previous transition (the first counts from `base`) in `unitSeconds`;
+//   - checkpoints: the absolute time and stream position of every kCheckpointInterval-th
+//     transition, which lookups binary search before decoding at most that many varints;
+//   - footer: the zone's POSIX rule, in force from the last transition on. The generator drops
+//     trailing transitions the footer reproduces, which is most of the size of a fat TZif file.
+struct ESPDateTzdbZoneRecord {
+	uint32_t name;        // offset of the zone name in strings
+	uint32_t footer;      // offset of the POSIX rule in strings ("" when there is none)
+	uint32_t transitions; // offset of the varint stream in transitions
+	uint16_t checkpoints; // first entry in checkpointTimes/checkpointOffsets
+	uint16_t transitionCount;
+	uint16_t types;      // first entry in types
+	uint8_t typeCount;   // type 0 is in force before the first transition
+	uint8_t unitSeconds; // 60 when every transition falls on a whole minute, else 1
+};
+
+struct ESPDateTzdbTable {
+	static constexpr uint16_t kCheckpointInterval = 16;
+
+	const char *version; // tzdata release the table was built from, e.g. "2025b"
+	int64_t base;        // UTC seconds the first delta and the checkpoint times count from
+	uint16_t zoneCount;
+	uint16_t bucketCount;
+	const ESPDateTzdbZoneRecord *zones; // in perfect-hash slot order
+	const uint16_t *buckets;            // hash seed per bucket
+	const char *strings;
+	const int32_t *types;
+	const uint8_t *transitions;
+	const uint32_t *checkpointTimes;   // seconds since base
+	const uint16_t *checkpointOffsets; // byte offset within the zone's stream
+};
+
+// One zone of a generated table, with its POSIX footer parsed once. A few dozen bytes; copy it
+// freely. Wrap it in ESPDateTimeZone::fromTzdb to use it with the ESPDate overloads.
+class ESPDateTzdbZone {
+  public:
+	ESPDateTzdbZone() = default; // invalid
+
+	// Perfect-hash lookup of an IANA name ("Europe/Budapest"); invalid when the table does not
+	// contain it. Hashes the name twice and compares it once, whatever the table size.
+	static ESPDateTzdbZone find(const ESPDateTzdbTable &table, const char *name);
+
+	bool isValid() const {
+		return record_ != nullptr || footer_.isValid();
+	}
+	const char *name() const; // "" when invalid or built from POSIX rules alone
+	size_t transitionCount() const {
+		return record_ ? record_->transitionCount : 0;
+	}
+	// Current rules, used for every instant after the last transition.
+	const ESPDatePosixTz &footer() const {
+		return footer_;
+	}
+
+	int32_t utcOffsetAt(int64_t utcSeconds) const;
+	// Same, plus the span [validFrom, validUntil) over which that offset holds.
+	int32_t utcOffsetAt(int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil) const;
+	bool isDstAt(int64_t utcSeconds) const;
+	// Same contract as ESPDatePosixTz::localToUtc, over the zone's whole history.
+	bool localToUtc(
+	    int64_t wallSeconds,
+	    ESPDateDstPolicy policy,
+	    int64_t &utcSeconds,
+	    ESPDateLocalTimeKind *kind = nullptr
+	) const;
+
+  private:
+	friend class ESPDateTimeZone;
+
+	int32_t lookup(int64_t utcSeconds, int64_t &validFrom, int64_t &validUntil, bool &isDst) const;
+
+	const ESPDateTzdbTable *table_ = nullptr;
+	const ESPDateTzdbZoneRecord *record_ = nullptr;
+	ESPDatePosixTz footer_{};
+};
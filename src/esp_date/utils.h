@@ -3,15 +3,49 @@
 #include "date.h"
 #include "date_allocator.h"
 
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <limits>
 
+#if defined(__has_include)
+#if __has_include(<esp_timer.h>)
+#include <esp_timer.h>
+#define ESPDATE_HAS_ESP_TIMER 1
+#else
+#define ESPDATE_HAS_ESP_TIMER 0
+#endif
+#else
+#define ESPDATE_HAS_ESP_TIMER 0
+#endif
+
 class ESPDateUtils {
   public:
 	static constexpr int64_t kSecondsPerMinute = 60;
 	static constexpr int64_t kSecondsPerHour = 60 * kSecondsPerMinute;
 	static constexpr int64_t kSecondsPerDay = 24 * kSecondsPerHour;
+	static constexpr int64_t kMicrosPerSecond = 1000000;
+
+	// Monotonic microseconds (esp_timer on device, steady_clock on host). Never steps with SNTP.
+	static int64_t monotonicMicros() {
+#if ESPDATE_HAS_ESP_TIMER
+		return static_cast<int64_t>(esp_timer_get_time());
+#else
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+		           std::chrono::steady_clock::now().time_since_epoch()
+		)
+		    .count();
+#endif
+	}
+
+	static int64_t floorDiv(int64_t value, int64_t divisor) {
+		int64_t quotient = value / divisor;
+		if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+			--quotient;
+		}
+		return quotient;
+	}
 
 	class ScopedTz {
 	  public:
@@ -22,6 +56,17 @@ class ESPDateUtils {
 			}
 
 			const char *current = std::getenv("TZ");
+			if (current && std::strcmp(current, tz) == 0) {
+				// Already active: skip the restore copy and the setenv/tzset round trip,
+				// both of which allocate in newlib.
+#if defined(_WIN32)
+				_tzset();
+#else
+				tzset();
+#endif
+				return;
+			}
+			ESPDATE_COUNT(ScopedTzSwap);
 			if (current) {
 				hadPrevious_ = true;
 				previous_ = current;
@@ -116,6 +161,53 @@ class ESPDateUtils {
 		return seconds;
 	}
 
+	// Transition rules of the process TZ. False when TZ is not a POSIX rule string (e.g. a
+	// zoneinfo name); callers then fall back to libc. An unset TZ is UTC.
+	static bool processPosixTz(ESPDatePosixTz &zone) {
+		const char *tz = getenv("TZ");
+		return ESPDateTimeZoneCache::shared().lookup(tz ? tz : "UTC0", zone);
+	}
+
+	// Rules of timeZone, or of the process TZ when it is nullptr, through the shared cache.
+	static bool posixTzFor(const char *timeZone, ESPDatePosixTz &zone) {
+		return timeZone ? ESPDateTimeZoneCache::shared().lookup(timeZone, zone)
+		                : processPosixTz(zone);
+	}
+
+	// Broken-down local time from parsed rules, matching what localtime_r gives for them.
+	static LocalDateTime localFromRules(const DateTime &dt, const ESPDatePosixTz &zone) {
+		if (!zone.isValid()) {
+			return LocalDateTime{};
+		}
+		return localFromOffset(dt, zone.utcOffsetAt(dt.epochSeconds));
+	}
+
+	static LocalDateTime localFromZone(const DateTime &dt, const ESPDateTimeZone &zone) {
+		if (!zone.isValid()) {
+			return LocalDateTime{};
+		}
+		return localFromOffset(dt, zone.utcOffsetAt(dt.epochSeconds));
+	}
+
+	static LocalDateTime localFromOffset(const DateTime &dt, int32_t offset) {
+		LocalDateTime result{};
+		const int64_t local = dt.epochSeconds + offset;
+		const int64_t days = floorDiv(local, kSecondsPerDay);
+		const int64_t secondOfDay = local - days * kSecondsPerDay;
+		unsigned month = 0;
+		unsigned day = 0;
+		civilFromDays(days, result.year, month, day);
+		result.ok = true;
+		result.month = static_cast<int>(month);
+		result.day = static_cast<int>(day);
+		result.hour = static_cast<int>(secondOfDay / kSecondsPerHour);
+		result.minute = static_cast<int>(secondOfDay % kSecondsPerHour / kSecondsPerMinute);
+		result.second = static_cast<int>(secondOfDay % kSecondsPerMinute);
+		result.offsetMinutes = offset / 60;
+		result.utc = dt;
+		return result;
+	}
+
 	static bool validHms(int hour, int minute, int second) {
 		return hour >= 0 && hour < 24 && minute >= 0 && minute < 60 && second >= 0 && second < 60;
 	}
@@ -165,7 +257,6 @@ class ESPDateUtils {
 		return true;
 	}
 
-  private:
 	static int64_t daysFromCivil(int year, unsigned month, unsigned day) {
 		year -= month <= 2;
 		const int era = (year >= 0 ? year : year - 399) / 400;
@@ -174,4 +265,48 @@ class ESPDateUtils {
 		const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
 		return era * 146097 + static_cast<int>(doe) - 719468;
 	}
+
+	// Inverse of daysFromCivil (days since 1970-01-01 to proleptic Gregorian Y/M/D).
+	static void civilFromDays(int64_t days, int &year, unsigned &month, unsigned &day) {
+		days += 719468;
+		const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+		const unsigned doe = static_cast<unsigned>(days - era * 146097);
+		const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+		const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+		const unsigned mp = (5 * doy + 2) / 153;
+		day = doy - (153 * mp + 2) / 5 + 1;
+		month = mp < 10 ? mp + 3 : mp - 9;
+		year = static_cast<int>(static_cast<int64_t>(yoe) + era * 400 + (month <= 2));
+	}
+
+	// Writes value (0..99) as two digits, from a table rather than a division per digit.
+	static void putTwoDigits(char *out, unsigned value) {
+		static constexpr char kPairs[] = "00010203040506070809"
+		                                 "10111213141516171819"
+		                                 "20212223242526272829"
+		                                 "30313233343536373839"
+		                                 "40414243444546474849"
+		                                 "50515253545556575859"
+		                                 "60616263646566676869"
+		                                 "70717273747576777879"
+		                                 "80818283848586878889"
+		                                 "90919293949596979899";
+		out[0] = kPairs[2 * value];
+		out[1] = kPairs[2 * value + 1];
+	}
+
+	// 0 = Sunday .. 6 = Saturday for days since 1970-01-01 (a Thursday).
+	static int weekdayFromDays(int64_t days) {
+		const int64_t weekday = (days + 4) % 7;
+		return static_cast<int>(weekday < 0 ? weekday + 7 : weekday);
+	}
+
+	static int daysInMonth(int year, int month) {
+		static const int kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+		if (month < 1 || month > 12) {
+			return 0;
+		}
+		const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+		return kDays[month - 1] + ((month == 2 && leap) ? 1 : 0);
+	}
 };
@@ -0,0 +1,259 @@
+#include "wake_planner.h"
+#include "date.h"
+#include "utils.h"
+
+namespace {
+using Utils = ESPDateUtils;
+
+int64_t secondsToMicros(int64_t seconds) {
+	return seconds * Utils::kMicrosPerSecond;
+}
+
+// The whole second containing fromUs: "strictly after it" is strictly after fromUs too.
+DateTime wholeSecond(int64_t fromUs) {
+	return DateTime{Utils::floorDiv(fromUs, Utils::kMicrosPerSecond)};
+}
+} // namespace
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::add(const Entry &entry) {
+	for (size_t i = 0; i < kMaxEntries; ++i) {
+		if (entries_[i].kind == Kind::None) {
+			entries_[i] = entry;
+			return static_cast<EntryId>(i + 1);
+		}
+	}
+	return kInvalidEntryId;
+}
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::addRecurrence(const ESPDateRecurrence &rule) {
+	if (!rule.isValid()) {
+		return kInvalidEntryId;
+	}
+	Entry entry;
+	entry.kind = Kind::Recurrence;
+	entry.rule = &rule;
+	return add(entry);
+}
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::addDailyLocal(int hour, int minute, int second) {
+	if (!Utils::validHms(hour, minute, second)) {
+		return kInvalidEntryId;
+	}
+	Entry entry;
+	entry.kind = Kind::DailyLocal;
+	entry.value = static_cast<int32_t>(
+	    hour * Utils::kSecondsPerHour + minute * Utils::kSecondsPerMinute + second
+	);
+	return add(entry);
+}
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::addSunrise(int32_t offsetSeconds) {
+	Entry entry;
+	entry.kind = Kind::Sunrise;
+	entry.value = offsetSeconds;
+	return add(entry);
+}
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::addSunset(int32_t offsetSeconds) {
+	Entry entry;
+	entry.kind = Kind::Sunset;
+	entry.value = offsetSeconds;
+	return add(entry);
+}
+
+ESPDateWakePlanner::EntryId
+ESPDateWakePlanner::addPeriodic(int64_t periodUs, int64_t phaseEpochUs) {
+	if (periodUs <= 0) {
+		return kInvalidEntryId;
+	}
+	Entry entry;
+	entry.kind = Kind::Periodic;
+	entry.periodUs = periodUs;
+	entry.epochUs = phaseEpochUs;
+	return add(entry);
+}
+
+ESPDateWakePlanner::EntryId ESPDateWakePlanner::addDeadline(int64_t epochUs) {
+	Entry entry;
+	entry.kind = Kind::Deadline;
+	entry.epochUs = epochUs;
+	return add(entry);
+}
+
+bool ESPDateWakePlanner::remove(EntryId id) {
+	if (id == kInvalidEntryId || id > kMaxEntries || entries_[id - 1].kind == Kind::None) {
+		return false;
+	}
+	entries_[id - 1] = Entry{};
+	return true;
+}
+
+void ESPDateWakePlanner::clear() {
+	for (Entry &entry : entries_) {
+		entry = Entry{};
+	}
+}
+
+size_t ESPDateWakePlanner::size() const {
+	size_t count = 0;
+	for (const Entry &entry : entries_) {
+		count += entry.kind != Kind::None ? 1 : 0;
+	}
+	return count;
+}
+
+bool ESPDateWakePlanner::nextDue(EntryId id, int64_t fromUs, int64_t &dueUs) const {
+	if (id == kNtpResyncId) {
+		if (!ntpDue(dueUs)) {
+			return false;
+		}
+		dueUs = dueUs > fromUs ? dueUs : fromUs + 1;
+		return true;
+	}
+	if (id == kInvalidEntryId || id > kMaxEntries) {
+		return false;
+	}
+	return entryNextDue(entries_[id - 1], fromUs, dueUs);
+}
+
+bool ESPDateWakePlanner::entryNextDue(const Entry &entry, int64_t fromUs, int64_t &dueUs) const {
+	switch (entry.kind) {
+	case Kind::None:
+		return false;
+	case Kind::Recurrence: {
+		// Both lookups are strictly after the whole second, hence after fromUs.
+		DateTime next{};
+		if (!date_.nextOccurrence(*entry.rule, wholeSecond(fromUs), next)) {
+			return false;
+		}
+		dueUs = secondsToMicros(next.epochSeconds);
+		return true;
+	}
+	case Kind::DailyLocal: {
+		// nextDailyAtLocal() may return `from` itself; start at the next whole second.
+		const DateTime from{wholeSecond(fromUs).epochSeconds + 1};
+		const int hour = static_cast<int>(entry.value / Utils::kSecondsPerHour);
+		const int minute =
+		    static_cast<int>(entry.value % Utils::kSecondsPerHour / Utils::kSecondsPerMinute);
+		const int second = static_cast<int>(entry.value % Utils::kSecondsPerMinute);
+		dueUs = secondsToMicros(date_.nextDailyAtLocal(hour, minute, second, from).epochSeconds);
+		return true;
+	}
+	case Kind::Sunrise:
+	case Kind::Sunset:
+		return sunNextDue(entry, fromUs, dueUs);
+	case Kind::Periodic: {
+		const int64_t steps = Utils::floorDiv(fromUs - entry.epochUs, entry.periodUs) + 1;
+		dueUs = entry.epochUs + steps * entry.periodUs;
+		return true;
+	}
+	case Kind::Deadline:
+		dueUs = entry.epochUs;
+		return entry.epochUs > fromUs;
+	}
+	return false;
+}
+
+// The sun helpers work per local day; the next event after fromUs is on fromUs's day or one
+// of the next two (polar nights and days can skip events entirely).
+bool ESPDateWakePlanner::sunNextDue(const Entry &entry, int64_t fromUs, int64_t &dueUs) const {
+	const int64_t fromSeconds = wholeSecond(fromUs).epochSeconds;
+	for (int day = -1; day <= 3; ++day) {
+		const DateTime when{fromSeconds + day * Utils::kSecondsPerDay};
+		const SunCycleResult event =
+		    entry.kind == Kind::Sunrise ? date_.sunrise(when) : date_.sunset(when);
+		if (!event.ok) {
+			continue;
+		}
+		const int64_t candidateUs = secondsToMicros(event.value.epochSeconds + entry.value);
+		if (candidateUs > fromUs) {
+			dueUs = candidateUs;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ESPDateWakePlanner::ntpDue(int64_t &dueUs) const {
+	if (maxSyncAgeUs_ <= 0) {
+		return false;
+	}
+	int64_t lastUs = lastSyncUs_;
+	if (date_.hasLastNtpSync()) {
+		const int64_t syncedUs = secondsToMicros(date_.lastNtpSync().epochSeconds);
+		lastUs = syncedUs > lastUs ? syncedUs : lastUs;
+	}
+	dueUs = lastUs == INT64_MIN ? INT64_MIN : lastUs + maxSyncAgeUs_;
+	return true;
+}
+
+ESPDateWakePlan ESPDateWakePlanner::plan() const {
+	return plan(date_.nowUs().epochMicros);
+}
+
+ESPDateWakePlan ESPDateWakePlanner::plan(int64_t nowUs) const {
+	int64_t dues[kMaxEntries + 1];
+	bool pending[kMaxEntries + 1] = {};
+	bool any = false;
+	int64_t earliestUs = INT64_MAX;
+	for (size_t i = 0; i <= kMaxEntries; ++i) {
+		const EntryId id = i < kMaxEntries ? static_cast<EntryId>(i + 1) : kNtpResyncId;
+		if (i == kMaxEntries) {
+			// An overdue re-sync is due now rather than strictly after it.
+			pending[i] = ntpDue(dues[i]);
+			dues[i] = pending[i] && dues[i] < nowUs ? nowUs : dues[i];
+		} else {
+			pending[i] = nextDue(id, nowUs, dues[i]);
+		}
+		if (pending[i]) {
+			any = true;
+			earliestUs = dues[i] < earliestUs ? dues[i] : earliestUs;
+		}
+	}
+
+	ESPDateWakePlan plan;
+	if (!any) {
+		if (maxSleepUs_ > 0) {
+			plan.ok = true;
+			plan.sleepUs = maxSleepUs_;
+			plan.wakeEpochUs = nowUs + maxSleepUs_;
+		}
+		return plan;
+	}
+	// Coalesce: wake at the last due time within the tolerance window after the earliest.
+	int64_t wakeUs = earliestUs;
+	for (size_t i = 0; i <= kMaxEntries; ++i) {
+		if (pending[i] && dues[i] <= earliestUs + toleranceUs_ && dues[i] > wakeUs) {
+			wakeUs = dues[i];
+		}
+	}
+	plan.ok = true;
+	if (maxSleepUs_ > 0 && wakeUs - nowUs > maxSleepUs_) {
+		plan.sleepUs = maxSleepUs_;
+		plan.wakeEpochUs = nowUs + maxSleepUs_;
+		return plan;
+	}
+	for (size_t i = 0; i <= kMaxEntries; ++i) {
+		if (pending[i] && dues[i] <= wakeUs) {
+			plan.dueMask |= 1u << i;
+		}
+	}
+	plan.sleepUs = wakeUs - nowUs;
+	plan.wakeEpochUs = wakeUs;
+	return plan;
+}
+
+uint32_t ESPDateWakePlanner::dueMask(int64_t sinceUs, int64_t nowUs) const {
+	uint32_t mask = 0;
+	for (size_t i = 0; i < kMaxEntries; ++i) {
+		int64_t dueUs = 0;
+		if (entryNextDue(entries_[i], sinceUs, dueUs) && dueUs <= nowUs) {
+			mask |= 1u << i;
+		}
+	}
+	int64_t syncDueUs = 0;
+	if (ntpDue(syncDueUs) && syncDueUs <= nowUs) {
+		mask |= 1u << kMaxEntries;
+	}
+	return mask;
+}
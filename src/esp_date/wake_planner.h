@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class ESPDate;
+class ESPDateRecurrence;
+
+// Outcome of ESPDateWakePlanner::plan(). sleepUs goes straight to the sleep timer
+// (esp_sleep_enable_timer_wakeup); keep wakeEpochUs (e.g. in RTC memory) and pass it to
+// dueMask() after waking.
+struct ESPDateWakePlan {
+	bool ok = false;         // false when nothing is pending and no maxSleepUs is set
+	int64_t sleepUs = 0;     // 0 when something is already due
+	int64_t wakeEpochUs = 0; // UTC of the planned wake
+	uint32_t dueMask = 0;    // bit (id - 1) per entry served by this wake; 0 for a capped sleep
+};
+
+// Works out how long a battery node may sleep. Entries are the things it wakes for: cron
+// rules, daily local times, sunrise/sunset with an offset, fixed periods, one-off deadlines
+// and an SNTP re-sync once the last sync gets too old. plan() returns the exact time to the
+// earliest of them; with a tolerance, entries due shortly after it are served by the same
+// wake, so nothing runs early and nothing runs more than `toleranceUs` late.
+//
+// Planning is stateless: after a wake, dueMask(previousWake, now) lists the entries that
+// came due in between, and plan(now) the next wake. Local times, the location and the time
+// zone come from the ESPDate instance, which must outlive the planner; so do the rules.
+//
+//   ESPDateWakePlanner planner(date);
+//   planner.addDailyLocal(3, 0);                   // nightly report
+//   planner.addSunset(-15 * 60);                   // lights on a quarter hour before sunset
+//   planner.addPeriodic(30 * 60 * 1000000LL);      // sample on the hour and half hour
+//   planner.setNtpResync(6 * 3600 * 1000000LL);
+//   planner.setTolerance(5 * 60 * 1000000LL);
+//   ESPDateWakePlan plan = planner.plan();
+class ESPDateWakePlanner {
+  public:
+	using EntryId = uint32_t;
+	static constexpr EntryId kInvalidEntryId = 0;
+	static constexpr size_t kMaxEntries = 16;
+	static constexpr EntryId kNtpResyncId = kMaxEntries + 1; // bit kMaxEntries in dueMask
+
+	explicit ESPDateWakePlanner(const ESPDate &date) : date_(date) {
+	}
+
+	// All return kInvalidEntryId when kMaxEntries are registered or the input is invalid.
+	EntryId addRecurrence(const ESPDateRecurrence &rule); // in the ESPDate's time zone
+	EntryId addDailyLocal(int hour, int minute, int second = 0);
+	EntryId addSunrise(int32_t offsetSeconds = 0);
+	EntryId addSunset(int32_t offsetSeconds = 0);
+	// Every periodUs, aligned so that phaseEpochUs is an occurrence (0 = the UTC epoch, so a
+	// 15-minute period lands on the quarter hours).
+	EntryId addPeriodic(int64_t periodUs, int64_t phaseEpochUs = 0);
+	EntryId addDeadline(int64_t epochUs);
+	bool remove(EntryId id);
+	void clear();
+	size_t size() const;
+
+	// Wake for an SNTP re-sync once the last sync is older than maxSyncAgeUs, or right away
+	// when there was none. 0 (default) turns it off.
+	void setNtpResync(int64_t maxSyncAgeUs) {
+		maxSyncAgeUs_ = maxSyncAgeUs > 0 ? maxSyncAgeUs : 0;
+	}
+	// A sync the ESPDate instance has not seen, e.g. one kept in RTC memory: lastNtpSync() does
+	// not survive deep sleep. The later of the two counts.
+	void setLastSync(int64_t epochUs) {
+		lastSyncUs_ = epochUs;
+	}
+	// How late an entry may run so that it shares a wake with an earlier one.
+	void setTolerance(int64_t toleranceUs) {
+		toleranceUs_ = toleranceUs > 0 ? toleranceUs : 0;
+	}
+	// Upper bound for sleepUs, so a node still checks in when nothing is scheduled. 0 = none.
+	void setMaxSleep(int64_t maxSleepUs) {
+		maxSleepUs_ = maxSleepUs > 0 ? maxSleepUs : 0;
+	}
+
+	ESPDateWakePlan plan() const;
+	ESPDateWakePlan plan(int64_t nowUs) const;
+	// Entries with an occurrence in (sinceUs, nowUs]; the NTP bit is set while a re-sync is due.
+	uint32_t dueMask(int64_t sinceUs, int64_t nowUs) const;
+	// First occurrence of the entry strictly after fromUs.
+	bool nextDue(EntryId id, int64_t fromUs, int64_t &dueUs) const;
+
+  private:
+	enum class Kind : uint8_t { None, Recurrence, DailyLocal, Sunrise, Sunset, Periodic, Deadline };
+	struct Entry {
+		Kind kind = Kind::None;
+		const ESPDateRecurrence *rule = nullptr;
+		int32_t value = 0; // seconds into the local day, or the sun event offset
+		int64_t periodUs = 0;
+		int64_t epochUs = 0; // phase or deadline
+	};
+
+	EntryId add(const Entry &entry);
+	bool entryNextDue(const Entry &entry, int64_t fromUs, int64_t &dueUs) const;
+	bool sunNextDue(const Entry &entry, int64_t fromUs, int64_t &dueUs) const;
+	bool ntpDue(int64_t &dueUs) const;
+
+	const ESPDate &date_;
+	Entry entries_[kMaxEntries]{};
+	int64_t maxSyncAgeUs_ = 0;
+	int64_t lastSyncUs_ = INT64_MIN;
+	int64_t toleranceUs_ = 0;
+	int64_t maxSleepUs_ = 0;
+};
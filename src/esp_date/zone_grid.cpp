@@ -0,0 +1,39 @@
+#include "zone_grid.h"
+
+#include <math.h>
+
+namespace {
+// Cell column/row of `value` at the finest level, or -1 outside [min, max].
+int32_t cellIndex(float value, float min, float max, uint8_t depth) {
+	if (!(value >= min && value <= max)) {
+		return -1; // also rejects NaN
+	}
+	const int32_t size = static_cast<int32_t>(1) << depth;
+	const int32_t index = static_cast<int32_t>(floorf((value - min) / (max - min) * size));
+	return index < size ? index : size - 1;
+}
+} // namespace
+
+ESPDateZoneMatch ESPDateZoneGrid::lookup(float latitude, float longitude) const {
+	const ESPDateZoneMatch none{false, "", ""};
+	const int32_t x = cellIndex(longitude, table_.minLongitude, table_.maxLongitude, table_.depth);
+	const int32_t y = cellIndex(latitude, table_.minLatitude, table_.maxLatitude, table_.depth);
+	if (x < 0 || y < 0) {
+		return none;
+	}
+
+	uint16_t entry = table_.root;
+	for (int level = table_.depth - 1; !(entry & ESPDateZoneGridTable::kLeaf); --level) {
+		if (level < 0) {
+			return none; // malformed table: deeper than it claims
+		}
+		const uint32_t quadrant = (((y >> level) & 1) << 1) | ((x >> level) & 1);
+		entry = table_.nodes[static_cast<uint32_t>(entry) * 4 + quadrant];
+	}
+	const uint16_t zone = entry & ~ESPDateZoneGridTable::kLeaf;
+	if (zone >= table_.zoneCount) {
+		return none; // kNoZone
+	}
+	const uint32_t *strings = table_.zones + zone * 2;
+	return {true, table_.strings + strings[0], table_.strings + strings[1]};
+}
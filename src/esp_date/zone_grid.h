@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tables emitted by scripts/generate_zone_grid.py: a quadtree over a latitude/longitude box,
+// stored as const 16-bit entries so it lives in flash/rodata. An entry with kLeaf set is a zone
+// index (kNoZone for open sea or areas the source left out); otherwise it is the index of an
+// internal node, whose four children sit at nodes[index * 4 + quadrant] with quadrant
+// (north << 1) | east, i.e. SW, SE, NW, NE. Uniform quadrants stop splitting early, so the size
+// follows the length of the zone borders rather than the area covered.
+struct ESPDateZoneGridTable {
+	static constexpr uint16_t kLeaf = 0x8000;
+	static constexpr uint16_t kNoZone = 0x7fff;
+
+	float minLatitude;
+	float minLongitude;
+	float maxLatitude;
+	float maxLongitude;
+	uint8_t depth;         // levels below the root; the finest cell is 1 / 2^depth of the box
+	uint16_t root;         // entry for the whole box
+	uint16_t zoneCount;
+	const uint16_t *nodes; // 4 entries per internal node
+	const uint32_t *zones; // per zone: offset of the IANA name, offset of the POSIX rule
+	const char *strings;
+};
+
+struct ESPDateZoneMatch {
+	bool ok;           // false outside the box or where the table has no zone
+	const char *name;  // IANA name, e.g. "Europe/Budapest"
+	const char *posix; // current POSIX rule, ready for ESPDateConfig::timeZone ("" if unknown)
+};
+
+// Location to time zone, without a network round trip. A lookup walks at most `depth` entries
+// and needs no RAM beyond the object itself.
+class ESPDateZoneGrid {
+  public:
+	explicit ESPDateZoneGrid(const ESPDateZoneGridTable &table) : table_(table) {
+	}
+
+	ESPDateZoneMatch lookup(float latitude, float longitude) const;
+
+  private:
+	const ESPDateZoneGridTable &table_;
+};
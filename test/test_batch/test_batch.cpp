@@ -0,0 +1,167 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+
+ESPDate date;
+
+static const char *kBudapestTz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+static constexpr size_t kCount = 600;
+
+struct Columns {
+	int16_t year[kCount];
+	uint8_t month[kCount];
+	uint8_t day[kCount];
+	uint8_t hour[kCount];
+	uint8_t minute[kCount];
+	uint8_t second[kCount];
+	uint8_t weekday[kCount];
+	int16_t offsetMinutes[kCount];
+
+	DateFieldColumns view() {
+		DateFieldColumns columns;
+		columns.year = year;
+		columns.month = month;
+		columns.day = day;
+		columns.hour = hour;
+		columns.minute = minute;
+		columns.second = second;
+		columns.weekday = weekday;
+		columns.offsetMinutes = offsetMinutes;
+		return columns;
+	}
+};
+
+static Columns columns;
+static DateTime stamps[kCount];
+
+static void fill_sorted(int64_t start, int64_t step) {
+	for (size_t i = 0; i < kCount; ++i) {
+		stamps[i] = DateTime{start + static_cast<int64_t>(i) * step};
+	}
+}
+
+static void assert_matches_scalar(const char *tz) {
+	for (size_t i = 0; i < kCount; ++i) {
+		const LocalDateTime local = date.toLocal(stamps[i], tz);
+		TEST_ASSERT_TRUE(local.ok);
+		TEST_ASSERT_EQUAL(local.year, columns.year[i]);
+		TEST_ASSERT_EQUAL(local.month, columns.month[i]);
+		TEST_ASSERT_EQUAL(local.day, columns.day[i]);
+		TEST_ASSERT_EQUAL(local.hour, columns.hour[i]);
+		TEST_ASSERT_EQUAL(local.minute, columns.minute[i]);
+		TEST_ASSERT_EQUAL(local.second, columns.second[i]);
+		TEST_ASSERT_EQUAL(local.offsetMinutes, columns.offsetMinutes[i]);
+		const DateTime civil = date.fromUtc(local.year, local.month, local.day);
+		TEST_ASSERT_EQUAL(date.getWeekdayUtc(civil), columns.weekday[i]);
+	}
+}
+
+static void test_local_batch_matches_scalar_across_dst() {
+	setenv("TZ", kBudapestTz, 1);
+	tzset();
+	DateFieldColumns view = columns.view();
+
+	// Every 7 minutes through the spring-forward night, then every 97 minutes through autumn.
+	fill_sorted(date.fromUtc(2025, 3, 29, 18, 0, 7).epochSeconds, 7 * 60);
+	TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, view));
+	assert_matches_scalar(nullptr);
+	fill_sorted(date.fromUtc(2025, 10, 1, 0, 0, 0).epochSeconds, 97 * 60);
+	TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, view));
+	assert_matches_scalar(nullptr);
+
+	// Unsorted input is still correct, just without the day reuse.
+	srand(11);
+	for (size_t i = 0; i < kCount; ++i) {
+		stamps[i] = DateTime{1700000000 + static_cast<int64_t>(rand() % 100000000)};
+	}
+	TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, view));
+	assert_matches_scalar(nullptr);
+
+	// An explicit zone overrides the process TZ.
+	const char *sydney = "AEST-10AEDT,M10.1.0,M4.1.0/3";
+	TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, view, sydney));
+	assert_matches_scalar(sydney);
+
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+
+static void test_utc_batch_and_optional_columns() {
+	fill_sorted(-86400LL * 3 - 1, 3600 * 5 + 17); // starts before 1970
+	DateFieldColumns view{};
+	view.day = columns.day;
+	view.hour = columns.hour;
+	columns.year[0] = -1;
+	TEST_ASSERT_EQUAL(kCount, date.toCivilUtcBatch(stamps, kCount, view));
+	TEST_ASSERT_EQUAL(-1, columns.year[0]); // skipped column untouched
+	for (size_t i = 0; i < kCount; ++i) {
+		TEST_ASSERT_EQUAL(stamps[i].dayUtc(), columns.day[i]);
+		TEST_ASSERT_EQUAL(stamps[i].hourUtc(), columns.hour[i]);
+	}
+
+	view = columns.view();
+	TEST_ASSERT_EQUAL(kCount, date.toCivilUtcBatch(stamps, kCount, view));
+	for (size_t i = 0; i < kCount; ++i) {
+		TEST_ASSERT_EQUAL(stamps[i].yearUtc(), columns.year[i]);
+		TEST_ASSERT_EQUAL(stamps[i].monthUtc(), columns.month[i]);
+		TEST_ASSERT_EQUAL(stamps[i].minuteUtc(), columns.minute[i]);
+		TEST_ASSERT_EQUAL(stamps[i].secondUtc(), columns.second[i]);
+		TEST_ASSERT_EQUAL(date.getWeekdayUtc(stamps[i]), columns.weekday[i]);
+		TEST_ASSERT_EQUAL(0, columns.offsetMinutes[i]);
+	}
+	TEST_ASSERT_EQUAL(0, date.toCivilUtcBatch(nullptr, kCount, view));
+}
+
+static void test_start_of_day_batch() {
+	DateTime starts[kCount];
+	fill_sorted(date.fromUtc(2025, 3, 20, 0, 0, 0).epochSeconds, 53 * 60);
+	TEST_ASSERT_EQUAL(kCount, date.startOfDayLocalBatch(stamps, kCount, starts, kBudapestTz));
+	for (size_t i = 0; i < kCount; ++i) {
+		const LocalDateTime local = date.toLocal(stamps[i], kBudapestTz);
+		setenv("TZ", kBudapestTz, 1);
+		tzset();
+		const LocalTimeResult midnight = date.fromLocal(
+		    local.year,
+		    local.month,
+		    local.day,
+		    0,
+		    0,
+		    0,
+		    ESPDateDstPolicy::Earliest
+		);
+		setenv("TZ", "UTC0", 1);
+		tzset();
+		TEST_ASSERT_TRUE(midnight.ok);
+		TEST_ASSERT_EQUAL_INT64(midnight.value.epochSeconds, starts[i].epochSeconds);
+	}
+
+	// Santiago skips local midnight on 2025-09-07: that day starts at 01:00 (04:00 UTC).
+	const DateTime morning = date.fromUtc(2025, 9, 7, 15, 0, 0);
+	DateTime start{};
+	TEST_ASSERT_EQUAL(
+	    1,
+	    date.startOfDayLocalBatch(&morning, 1, &start, "<-04>4<-03>,M9.1.6/24,M4.1.6/24")
+	);
+	TEST_ASSERT_EQUAL_INT64(date.fromUtc(2025, 9, 7, 4, 0, 0).epochSeconds, start.epochSeconds);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_local_batch_matches_scalar_across_dst);
+	RUN_TEST(test_utc_batch_and_optional_columns);
+	RUN_TEST(test_start_of_day_batch);
+	UNITY_END();
+}
+
+void loop() {
+}
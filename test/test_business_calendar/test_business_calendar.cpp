@@ -0,0 +1,199 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+ESPDate date;
+
+static int64_t dayOf(int year, int month, int day) {
+	return date.fromUtc(year, month, day).epochSeconds / 86400;
+}
+
+static void addUsFederalHolidays(ESPDateBusinessCalendar &calendar) {
+	calendar.addFixedHoliday(1, 1, ESPDateHolidayShift::NearestWeekday);
+	calendar.addNthWeekdayHoliday(1, 1, 3);  // Martin Luther King Jr. Day
+	calendar.addNthWeekdayHoliday(2, 1, 3);  // Washington's Birthday
+	calendar.addNthWeekdayHoliday(5, 1, -1); // Memorial Day
+	calendar.addFixedHoliday(6, 19, ESPDateHolidayShift::NearestWeekday);
+	calendar.addFixedHoliday(7, 4, ESPDateHolidayShift::NearestWeekday);
+	calendar.addNthWeekdayHoliday(9, 1, 1);  // Labor Day
+	calendar.addNthWeekdayHoliday(10, 1, 2); // Columbus Day
+	calendar.addFixedHoliday(11, 11, ESPDateHolidayShift::NearestWeekday);
+	calendar.addNthWeekdayHoliday(11, 4, 4); // Thanksgiving
+	calendar.addFixedHoliday(12, 25, ESPDateHolidayShift::NearestWeekday);
+}
+
+static void test_rules_expand_to_observed_days() {
+	ESPDateBusinessCalendar us;
+	addUsFederalHolidays(us);
+	TEST_ASSERT_TRUE(us.begin(2020, 10));
+	TEST_ASSERT_FALSE(us.isBusinessDay(2025, 5, 26));  // last Monday of May
+	TEST_ASSERT_FALSE(us.isBusinessDay(2025, 11, 27)); // fourth Thursday
+	TEST_ASSERT_TRUE(us.isBusinessDay(2025, 11, 28));
+	TEST_ASSERT_FALSE(us.isBusinessDay(2026, 7, 3));   // 4 July 2026 is a Saturday
+	TEST_ASSERT_FALSE(us.isBusinessDay(2021, 12, 31)); // 1 January 2022 is a Saturday
+	TEST_ASSERT_FALSE(us.isBusinessDay(2023, 1, 2));   // 1 January 2023 is a Sunday
+	TEST_ASSERT_TRUE(us.isBusinessDay(2025, 3, 3));
+	TEST_ASSERT_FALSE(us.isBusinessDay(2025, 3, 1)); // Saturday
+	TEST_ASSERT_FALSE(us.isBusinessDay(2025, 2, 30));
+
+	// UK substitute days step over each other: Christmas 2021 fell on a Saturday, Boxing Day
+	// on a Sunday, so the bank holidays were Monday 27 and Tuesday 28.
+	ESPDateBusinessCalendar uk;
+	uk.addFixedHoliday(12, 25, ESPDateHolidayShift::NextWorkingDay);
+	uk.addFixedHoliday(12, 26, ESPDateHolidayShift::NextWorkingDay);
+	uk.addEasterHoliday(-2);
+	uk.addEasterHoliday(1);
+	TEST_ASSERT_TRUE(uk.begin(2019, 20));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2021, 12, 27));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2021, 12, 28));
+	TEST_ASSERT_TRUE(uk.isBusinessDay(2021, 12, 29));
+	// Easter: 21 Apr 2019, 31 Mar 2024, 20 Apr 2025, 25 Apr 2038.
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2019, 4, 22));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2024, 3, 29));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2024, 4, 1));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2025, 4, 18));
+	TEST_ASSERT_FALSE(uk.isBusinessDay(2038, 4, 26));
+	TEST_ASSERT_TRUE(uk.isBusinessDay(2038, 4, 27));
+
+	// A Friday-Saturday weekend.
+	ESPDateBusinessCalendar gulf;
+	gulf.setWeekend((1 << 5) | (1 << 6));
+	TEST_ASSERT_TRUE(gulf.begin(2025, 1));
+	TEST_ASSERT_TRUE(gulf.isBusinessDay(2025, 3, 2)); // Sunday
+	TEST_ASSERT_FALSE(gulf.isBusinessDay(2025, 3, 7));
+
+	TEST_ASSERT_FALSE(uk.addNthWeekdayHoliday(13, 1, 1));
+	TEST_ASSERT_FALSE(uk.addNthWeekdayHoliday(1, 7, 1));
+	TEST_ASSERT_FALSE(uk.addNthWeekdayHoliday(1, 1, 0));
+	TEST_ASSERT_FALSE(uk.addFixedHoliday(2, 30));
+	TEST_ASSERT_FALSE(uk.begin(2000, 0));
+	TEST_ASSERT_FALSE(uk.isReady());
+}
+
+static void test_counts_and_offsets_match_a_day_by_day_walk() {
+	ESPDateBusinessCalendar calendar;
+	addUsFederalHolidays(calendar);
+	calendar.addEasterHoliday(-2);
+	TEST_ASSERT_TRUE(calendar.begin(2015, 25));
+	TEST_ASSERT_TRUE(calendar.setBusinessDay(2020, 3, 7, true));  // working Saturday
+	TEST_ASSERT_TRUE(calendar.setBusinessDay(2030, 8, 14, false)); // plant shutdown
+	TEST_ASSERT_FALSE(calendar.setBusinessDay(2040, 1, 2, false));
+
+	const int64_t first = dayOf(2015, 1, 1);
+	const int64_t end = dayOf(2040, 1, 1);
+	uint32_t seed = 12345;
+	auto next = [&seed](uint32_t bound) {
+		seed = seed * 1664525u + 1013904223u;
+		return (seed >> 8) % bound;
+	};
+	for (int i = 0; i < 300; ++i) {
+		const int64_t from = first + next(static_cast<uint32_t>(end - first));
+		const int64_t to = first + next(static_cast<uint32_t>(end - first + 1));
+		int32_t expected = 0;
+		for (int64_t d = from < to ? from : to; d < (from < to ? to : from); ++d) {
+			expected += calendar.isBusinessDay(d) ? 1 : 0;
+		}
+		if (to < from) {
+			expected = -expected;
+		}
+		int32_t count = 0;
+		TEST_ASSERT_TRUE(calendar.businessDaysBetween(from, to, count));
+		TEST_ASSERT_EQUAL_INT32(expected, count);
+
+		const int32_t offset = static_cast<int32_t>(next(1200)) - 600;
+		int64_t walked = from;
+		int32_t remaining = offset;
+		bool inRange = true;
+		if (offset == 0) {
+			while (inRange && !calendar.isBusinessDay(walked)) {
+				inRange = calendar.covers(++walked);
+			}
+		}
+		while (inRange && remaining != 0) {
+			walked += remaining > 0 ? 1 : -1;
+			inRange = calendar.covers(walked);
+			if (inRange && calendar.isBusinessDay(walked)) {
+				remaining += remaining > 0 ? -1 : 1;
+			}
+		}
+		int64_t result = 0;
+		TEST_ASSERT_EQUAL(inRange, calendar.addBusinessDays(from, offset, result));
+		if (inRange) {
+			TEST_ASSERT_EQUAL(walked, result);
+		}
+	}
+
+	int32_t count = 0;
+	TEST_ASSERT_TRUE(calendar.businessDaysBetween(first, end, count));
+	TEST_ASSERT_TRUE(count > 25 * 240 && count < 25 * 255);
+	TEST_ASSERT_FALSE(calendar.businessDaysBetween(first - 1, end, count));
+	TEST_ASSERT_FALSE(calendar.businessDaysBetween(first, end + 1, count));
+	TEST_ASSERT_FALSE(calendar.isBusinessDay(end));
+	int64_t result = 0;
+	TEST_ASSERT_FALSE(calendar.addBusinessDays(end - 1, 1, result)); // 2040 is not built
+}
+
+static void test_espdate_overloads_use_local_dates() {
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+	ESPDateBusinessCalendar calendar;
+	calendar.addFixedHoliday(1, 1);
+	calendar.addEasterHoliday(50); // Whit Monday: 9 June 2025
+	TEST_ASSERT_TRUE(calendar.begin(2025, 2));
+
+	// Friday 30 May 2025, 17:30 local; 23:30 UTC Friday is already Saturday in Budapest.
+	const DateTime friday = date.fromLocal(2025, 5, 30, 17, 30, 0);
+	TEST_ASSERT_TRUE(date.isBusinessDay(friday, calendar));
+	TEST_ASSERT_FALSE(date.isBusinessDay(date.fromUtc(2025, 5, 30, 23, 30, 0), calendar));
+
+	DateTime out{};
+	TEST_ASSERT_TRUE(date.addBusinessDays(friday, 1, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 6, 2, 17, 30, 0).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(date.addBusinessDays(friday, 6, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 6, 10, 17, 30, 0).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(date.addBusinessDays(friday, -5, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 5, 23, 17, 30, 0).epochSeconds, out.epochSeconds);
+
+	int32_t count = 0;
+	TEST_ASSERT_TRUE(
+	    date.businessDaysBetween(friday, date.fromLocal(2025, 6, 13, 9, 0, 0), calendar, count)
+	);
+	TEST_ASSERT_EQUAL_INT32(9, count);
+
+	// Next working day at 08:00: Friday evening -> Monday, Monday early -> same day.
+	TEST_ASSERT_TRUE(date.nextBusinessDayAt(friday, 8, 0, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 6, 2, 8, 0, 0).epochSeconds, out.epochSeconds);
+	const DateTime mondayEarly = date.fromLocal(2025, 6, 2, 7, 15, 0);
+	TEST_ASSERT_TRUE(date.nextBusinessDayAt(mondayEarly, 8, 0, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 6, 2, 8, 0, 0).epochSeconds, out.epochSeconds);
+	const DateTime beforeWhitMonday = date.fromLocal(2025, 6, 6, 9, 0, 0);
+	TEST_ASSERT_TRUE(date.nextBusinessDayAt(beforeWhitMonday, 8, 0, calendar, out));
+	TEST_ASSERT_EQUAL(date.fromLocal(2025, 6, 10, 8, 0, 0).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_FALSE(date.nextBusinessDayAt(friday, 24, 0, calendar, out));
+	// New Year's Eve 2026 after 08:00: 2027 is not built.
+	TEST_ASSERT_FALSE(
+	    date.nextBusinessDayAt(date.fromLocal(2026, 12, 31, 9, 0, 0), 8, 0, calendar, out)
+	);
+
+	ESPDateConfig reset{};
+	reset.timeZone = "UTC0";
+	date.init(reset);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_rules_expand_to_observed_days);
+	RUN_TEST(test_counts_and_offsets_match_a_day_by_day_walk);
+	RUN_TEST(test_espdate_overloads_use_local_dates);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,581 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__has_include)
+#if __has_include(<esp_sntp.h>)
+#define TEST_ESPDATE_HAS_SNTP_SYNC_INTERVAL 1
+#else
+#define TEST_ESPDATE_HAS_SNTP_SYNC_INTERVAL 0
+#endif
+#else
+#define TEST_ESPDATE_HAS_SNTP_SYNC_INTERVAL 0
+#endif
+
+// Simulated oscillator: local monotonic time runs driftPpm fast relative to true UTC.
+struct DriftingClock {
+	int64_t trueUs = 1767225600LL * 1000000LL; // 2026-01-01T00:00:00Z
+	int64_t monotonicUs = 5000000;             // boot offset
+	double driftPpm = 0.0;
+	double fraction = 0.0;
+
+	void advance(int64_t trueDeltaUs) {
+		trueUs += trueDeltaUs;
+		const double local = static_cast<double>(trueDeltaUs) * (1.0 + driftPpm / 1000000.0);
+		const int64_t whole = static_cast<int64_t>(local);
+		fraction += local - static_cast<double>(whole);
+		monotonicUs += whole;
+		if (fraction >= 1.0) {
+			monotonicUs += 1;
+			fraction -= 1.0;
+		}
+	}
+};
+
+// Scripted SNTP stand-in: answers with true time plus a per-reply error from the script.
+struct ScriptedSntpServer {
+	const int64_t *errorsUs = nullptr;
+	size_t count = 0;
+	size_t next = 0;
+
+	int64_t reply(const DriftingClock &clock) {
+		const int64_t error = (next < count) ? errorsUs[next] : 0;
+		++next;
+		return clock.trueUs + error;
+	}
+};
+
+static constexpr int64_t kSecondUs = 1000000;
+
+static void test_discipline_estimates_drift_from_sync_history() {
+	DriftingClock clock;
+	clock.driftPpm = 40.0;
+	ScriptedSntpServer server;
+	ESPDateClockDiscipline discipline;
+
+	for (int i = 0; i < 6; ++i) {
+		discipline.addSample(clock.monotonicUs, server.reply(clock));
+		clock.advance(600 * kSecondUs);
+	}
+
+	TEST_ASSERT_TRUE(discipline.hasSamples());
+	TEST_ASSERT_EQUAL(6U, discipline.sampleCount());
+	TEST_ASSERT_DOUBLE_WITHIN(0.5, 40.0, discipline.driftPpm());
+}
+
+static void test_discipline_extrapolates_between_syncs() {
+	DriftingClock clock;
+	clock.driftPpm = -25.0;
+	ScriptedSntpServer server;
+	ESPDateClockDiscipline discipline;
+
+	for (int i = 0; i < 4; ++i) {
+		discipline.addSample(clock.monotonicUs, server.reply(clock));
+		clock.advance(900 * kSecondUs);
+	}
+	clock.advance(2700 * kSecondUs); // one hour after the last sync
+
+	// Uncorrected, -25 ppm over one hour is 90 ms of error.
+	const int64_t error = discipline.nowUs(clock.monotonicUs) - clock.trueUs;
+	TEST_ASSERT_TRUE(llabs(error) < 5000);
+}
+
+static void test_discipline_slews_instead_of_stepping_backwards() {
+	DriftingClock clock;
+	const int64_t errors[] = {0, 0, -200000}; // third reply jumps 200 ms into the past
+	ScriptedSntpServer server{errors, 3, 0};
+	ESPDateClockDisciplineConfig config;
+	config.maxSlewPpm = 500;
+	ESPDateClockDiscipline discipline;
+	discipline.configure(config);
+
+	int64_t previous = 0;
+	for (int sync = 0; sync < 3; ++sync) {
+		const int64_t error = discipline.addSample(clock.monotonicUs, server.reply(clock));
+		if (sync == 2) {
+			TEST_ASSERT_INT64_WITHIN(10, -200000, error);
+		}
+		for (int second = 0; second < 600; ++second) {
+			const int64_t value = discipline.nowUs(clock.monotonicUs);
+			TEST_ASSERT_TRUE(value >= previous);
+			previous = value;
+			clock.advance(kSecondUs);
+		}
+	}
+
+	// 600 s at 500 ppm absorbs 300 ms, so the 200 ms correction has fully drained.
+	TEST_ASSERT_INT64_WITHIN(10, 0, discipline.pendingCorrectionUs(clock.monotonicUs));
+}
+
+static void test_discipline_slew_rate_is_bounded() {
+	ESPDateClockDiscipline discipline;
+	discipline.addSample(0, 1000 * kSecondUs);
+	discipline.addSample(10 * kSecondUs, 1010 * kSecondUs + 100000); // 100 ms ahead
+
+	// After 10 s at 500 ppm only 5 ms of the 100 ms error may be applied.
+	const int64_t later = 20 * kSecondUs;
+	TEST_ASSERT_INT64_WITHIN(2, 95000, discipline.pendingCorrectionUs(later));
+	TEST_ASSERT_INT64_WITHIN(2, 1020 * kSecondUs + 5000, discipline.nowUs(later));
+}
+
+static void test_discipline_steps_forward_above_threshold() {
+	ESPDateClockDisciplineConfig config;
+	config.stepThresholdUs = kSecondUs;
+	ESPDateClockDiscipline discipline;
+	discipline.configure(config);
+
+	discipline.addSample(0, 1000 * kSecondUs);
+	discipline.addSample(10 * kSecondUs, 1070 * kSecondUs); // 60 s ahead: stepped
+	TEST_ASSERT_EQUAL_INT64(1070 * kSecondUs, discipline.nowUs(10 * kSecondUs));
+	TEST_ASSERT_EQUAL_INT64(0, discipline.pendingCorrectionUs(10 * kSecondUs));
+}
+
+static void test_disciplined_now_tracks_dispatched_sync() {
+	ESPDate tracker;
+	tracker.init(ESPDateConfig{0.0f, 0.0f, "UTC0", nullptr});
+	TEST_ASSERT_FALSE(tracker.clockDiscipline().hasSamples());
+
+	DateTime synced = tracker.fromUtc(2026, 3, 1, 12, 0, 0);
+	tracker._testDispatchNtpSync(synced);
+
+	TEST_ASSERT_TRUE(tracker.clockDiscipline().hasSamples());
+	TEST_ASSERT_TRUE(llabs(tracker.differenceInSeconds(tracker.disciplinedNow(), synced)) <= 1);
+
+	tracker.deinit();
+	TEST_ASSERT_FALSE(tracker.clockDiscipline().hasSamples());
+}
+
+// Deterministic +/-2 ms reply jitter so the simulation is repeatable.
+static int64_t scripted_jitter_us(uint32_t &state) {
+	state = state * 1664525u + 1013904223u;
+	return static_cast<int64_t>(state >> 16) % 4001 - 2000;
+}
+
+struct AdaptiveSimulation {
+	DriftingClock clock;
+	ESPDateClockDiscipline discipline;
+	ESPDateSyncIntervalController controller;
+	uint32_t jitterState = 1;
+	int64_t worstErrorUs = 0;
+
+	uint32_t step() {
+		clock.advance(static_cast<int64_t>(controller.intervalMs()) * 1000);
+		const int64_t since = discipline.hasSamples()
+		                          ? clock.monotonicUs - discipline.lastSampleMonotonicUs()
+		                          : 0;
+		const int64_t reply = clock.trueUs + scripted_jitter_us(jitterState);
+		const int64_t error = discipline.addSample(clock.monotonicUs, reply);
+		if (discipline.sampleCount() > 2 && llabs(error) > worstErrorUs) {
+			worstErrorUs = llabs(error);
+		}
+		return controller.onSync(error, since);
+	}
+};
+
+static void test_adaptive_interval_widens_once_drift_is_characterised() {
+	AdaptiveSimulation sim;
+	sim.clock.driftPpm = 30.0;
+	ESPDateAdaptiveSyncConfig config;
+	config.targetAccuracyUs = 50000;
+	sim.controller.configure(config);
+	TEST_ASSERT_EQUAL_UINT32(config.minIntervalMs, sim.controller.intervalMs());
+
+	for (int i = 0; i < 30; ++i) {
+		sim.step();
+	}
+
+	const ESPDateSyncIntervalStats stats = sim.controller.stats();
+	TEST_ASSERT_EQUAL_UINT32(30U, stats.syncCount);
+	TEST_ASSERT_EQUAL_UINT32(config.maxIntervalMs, stats.intervalMs);
+	TEST_ASSERT_TRUE(stats.widenCount >= 5);
+	TEST_ASSERT_TRUE(stats.syncsPerDay < 1.5f);
+	TEST_ASSERT_TRUE(sim.worstErrorUs <= static_cast<int64_t>(config.targetAccuracyUs));
+}
+
+static void test_adaptive_interval_narrows_when_drift_changes() {
+	AdaptiveSimulation sim;
+	sim.clock.driftPpm = 30.0;
+	ESPDateAdaptiveSyncConfig config;
+	config.maxIntervalMs = 6UL * 60UL * 60UL * 1000UL;
+	sim.controller.configure(config);
+	for (int i = 0; i < 20; ++i) {
+		sim.step();
+	}
+	TEST_ASSERT_EQUAL_UINT32(config.maxIntervalMs, sim.controller.intervalMs());
+
+	sim.clock.driftPpm = 45.0; // oscillator warms up: 15 ppm over 6 h is ~324 ms
+	const uint32_t narrowed = sim.step();
+	TEST_ASSERT_TRUE(narrowed < config.maxIntervalMs);
+	TEST_ASSERT_EQUAL_UINT32(1U, sim.controller.stats().narrowCount);
+	TEST_ASSERT_TRUE(sim.controller.stats().maxAbsOffsetUs > 50000);
+}
+
+static void test_adaptive_sync_stats_through_espdate() {
+	ESPDate tracker;
+	tracker.init(ESPDateConfig{0.0f, 0.0f, "UTC0", nullptr, 30000});
+	TEST_ASSERT_EQUAL(
+	    static_cast<bool>(TEST_ESPDATE_HAS_SNTP_SYNC_INTERVAL),
+	    tracker.enableAdaptiveNtpSync()
+	);
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 0, 0));
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 0, 0));
+
+	ESPDateSyncIntervalStats stats = tracker.ntpSyncIntervalStats();
+	TEST_ASSERT_EQUAL_UINT32(2U, stats.syncCount);
+
+	tracker.setNtpSyncIntervalMs(30000);
+	stats = tracker.ntpSyncIntervalStats();
+	TEST_ASSERT_FALSE(stats.adaptive);
+	TEST_ASSERT_EQUAL_UINT32(30000U, stats.intervalMs);
+}
+
+static void test_sync_health_counts_timed_out_attempts() {
+	ESPDateSyncHealth health;
+	health.recordAttempt(0, 30000);
+
+	TimeSyncStats stats = health.snapshot(10 * kSecondUs);
+	TEST_ASSERT_TRUE(stats.syncPending);
+	TEST_ASSERT_EQUAL_UINT32(0U, stats.failedSyncCount);
+	TEST_ASSERT_FALSE(stats.synced);
+	TEST_ASSERT_EQUAL_INT64(-1, stats.sinceLastSyncMs);
+	TEST_ASSERT_EQUAL_INT64(-1, stats.errorBoundUs);
+
+	stats = health.snapshot(31 * kSecondUs);
+	TEST_ASSERT_FALSE(stats.syncPending);
+	TEST_ASSERT_EQUAL_UINT32(1U, stats.failedSyncCount);
+
+	health.recordAttempt(40 * kSecondUs, 30000);
+	ESPDateSyncHealth::SyncSample sample;
+	sample.monotonicUs = 41 * kSecondUs;
+	health.recordSync(sample);
+
+	stats = health.snapshot(51 * kSecondUs);
+	TEST_ASSERT_TRUE(stats.synced);
+	TEST_ASSERT_FALSE(stats.syncPending);
+	TEST_ASSERT_EQUAL_UINT32(1U, stats.syncCount);
+	TEST_ASSERT_EQUAL_UINT32(1U, stats.failedSyncCount);
+	TEST_ASSERT_EQUAL_INT64(10000, stats.sinceLastSyncMs);
+	// 10 ms sync uncertainty plus 50 ppm unmodelled drift over 10 s.
+	TEST_ASSERT_EQUAL_INT64(10500, stats.errorBoundUs);
+}
+
+static void test_sync_health_reports_recent_steps_and_bound() {
+	ESPDateSyncHealth health;
+	const int64_t steps[] = {0, 1200, -800, 400};
+	for (int i = 0; i < 4; ++i) {
+		ESPDateSyncHealth::SyncSample sample;
+		sample.monotonicUs = static_cast<int64_t>(i) * 100 * kSecondUs;
+		sample.stepUs = steps[i];
+		sample.hasStep = i > 0;
+		sample.residualUs = steps[i];
+		sample.pendingCorrectionUs = steps[i];
+		sample.slewPpm = 500;
+		sample.driftPpm = 12.5f;
+		sample.driftModelled = i > 0;
+		health.recordSync(sample);
+	}
+
+	const TimeSyncStats stats = health.snapshot(400 * kSecondUs);
+	TEST_ASSERT_EQUAL_UINT32(4U, stats.syncCount);
+	TEST_ASSERT_EQUAL(3U, stats.recentStepCount);
+	TEST_ASSERT_EQUAL_INT64(400, stats.recentStepsUs[0]);
+	TEST_ASSERT_EQUAL_INT64(-800, stats.recentStepsUs[1]);
+	TEST_ASSERT_EQUAL_INT64(1200, stats.recentStepsUs[2]);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 12.5f, stats.driftPpm);
+	// A 400 us residual over 100 s is 4 ppm of growth; it has long been slewed out.
+	TEST_ASSERT_EQUAL_INT64(10000 + 400, stats.errorBoundUs);
+}
+
+static void test_sync_health_snapshots_are_consistent_under_writes() {
+	ESPDateSyncHealth health;
+	const int kSyncs = 20000;
+	std::thread writer([&health, kSyncs]() {
+		for (int i = 0; i < kSyncs; ++i) {
+			ESPDateSyncHealth::SyncSample sample;
+			sample.monotonicUs = static_cast<int64_t>(i) * kSecondUs;
+			sample.stepUs = i;
+			sample.hasStep = true;
+			sample.driftPpm = static_cast<float>(i);
+			health.recordSync(sample);
+		}
+	});
+	// Every snapshot must come from a single sync: its newest step, drift and count agree.
+	uint32_t torn = 0;
+	uint32_t seen = 0;
+	while (seen < static_cast<uint32_t>(kSyncs)) {
+		const TimeSyncStats stats = health.snapshot(0);
+		seen = stats.syncCount;
+		if (seen > 0 && (stats.recentStepsUs[0] != static_cast<int64_t>(seen) - 1 ||
+		                 stats.driftPpm != static_cast<float>(seen - 1))) {
+			++torn;
+		}
+	}
+	writer.join();
+	TEST_ASSERT_EQUAL_UINT32(0U, torn);
+}
+
+static void test_discipline_snapshots_are_consistent_under_writes() {
+	ESPDateClockDiscipline discipline;
+	const int kSyncs = 5000;
+	const int64_t base = 1767225600LL * kSecondUs;
+	std::atomic<int64_t> monotonicUs{kSecondUs};
+	std::atomic<bool> done{false};
+	// Error-free samples a second apart: every consistent model predicts base + m for any m
+	// past its anchor, while an anchor torn from its monotonic reading is off by a second.
+	std::thread writer([&]() {
+		for (int i = 0; i < kSyncs; ++i) {
+			const int64_t at = monotonicUs.load() + kSecondUs;
+			discipline.addSample(at, base + at);
+			monotonicUs.store(at);
+			std::this_thread::yield(); // interleave with the reader on single-core hosts
+		}
+		done.store(true);
+	});
+	uint32_t checked = 0;
+	uint32_t torn = 0;
+	while (!done.load()) {
+		// Two seconds ahead clears the anchor of the newest model this read can see.
+		const int64_t before = monotonicUs.load();
+		int64_t utcUs = 0;
+		const bool ok = discipline.nowUs(before + 2 * kSecondUs, utcUs);
+		if (!ok || monotonicUs.load() != before) {
+			continue;
+		}
+		++checked;
+		if (utcUs != base + before + 2 * kSecondUs) {
+			++torn;
+		}
+	}
+	writer.join();
+	TEST_ASSERT_EQUAL_UINT32(0U, torn);
+	TEST_ASSERT_TRUE(checked > 0);
+	TEST_ASSERT_EQUAL(0.0, discipline.driftPpm());
+}
+
+static void test_time_sync_stats_through_espdate() {
+	ESPDateSimulatedTimeSource clock(0); // boot: the wall clock still reads 1970
+	ESPDate tracker;
+	tracker.setTimeSource(&clock);
+	tracker.init(ESPDateConfig{0.0f, 0.0f, "UTC0", nullptr});
+	TEST_ASSERT_FALSE(tracker.timeSyncStats().synced);
+
+	// Steps are how far each sync moved the clock, the first one included.
+	clock.advanceSeconds(5);
+	const int64_t syncedUs = tracker.fromUtc(2026, 3, 1, 12, 0, 0).epochSeconds * kSecondUs;
+	clock.setEpochMicros(syncedUs);
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 0, 0));
+	clock.advanceSeconds(60);
+	clock.setEpochMicros(clock.epochMicros() - 1500); // SNTP found the clock 1.5 ms fast
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 1, 0));
+	clock.advanceSeconds(60);
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 2, 0));
+
+	const TimeSyncStats stats = tracker.timeSyncStats();
+	TEST_ASSERT_TRUE(stats.synced);
+	TEST_ASSERT_EQUAL_UINT32(3U, stats.syncCount);
+	TEST_ASSERT_EQUAL(3U, stats.recentStepCount);
+	TEST_ASSERT_EQUAL_INT64(0, stats.recentStepsUs[0]);
+	TEST_ASSERT_EQUAL_INT64(-1500, stats.recentStepsUs[1]);
+	TEST_ASSERT_EQUAL_INT64(syncedUs - 5 * kSecondUs, stats.recentStepsUs[2]);
+	TEST_ASSERT_TRUE(stats.sinceLastSyncMs >= 0);
+	TEST_ASSERT_TRUE(stats.errorBoundUs >= ESPDateSyncHealth::kSyncUncertaintyUs);
+
+	// A new source is not a step, and switching does not read it.
+	ESPDateSimulatedTimeSource other(syncedUs + 180 * kSecondUs);
+	other.setAutoAdvance(1000);
+	tracker.setTimeSource(&other);
+	TEST_ASSERT_EQUAL_INT64(0, other.monotonicMicros());
+	tracker._testDispatchNtpSync(tracker.fromUtc(2026, 3, 1, 12, 3, 0));
+	TEST_ASSERT_EQUAL_UINT32(4U, tracker.timeSyncStats().syncCount);
+	TEST_ASSERT_EQUAL(3U, tracker.timeSyncStats().recentStepCount);
+	tracker.setTimeSource(nullptr);
+}
+
+// In-memory stand-in for RTC/NVS storage that outlives the simulated reboot.
+struct MemoryCheckpointStore : public ESPDateCheckpointStore {
+	uint8_t blob[kBlobSize]{};
+	bool hasData = false;
+	int writes = 0;
+
+	bool read(uint8_t *data, size_t size) override {
+		if (!hasData || size != kBlobSize) {
+			return false;
+		}
+		std::memcpy(data, blob, size);
+		return true;
+	}
+	bool write(const uint8_t *data, size_t size) override {
+		if (size != kBlobSize) {
+			return false;
+		}
+		std::memcpy(blob, data, size);
+		hasData = true;
+		++writes;
+		return true;
+	}
+	void put(const ESPDateTimeCheckpoint &checkpoint) {
+		encode(checkpoint, blob);
+		hasData = true;
+	}
+};
+
+static ESPDateConfig checkpoint_config(MemoryCheckpointStore &store) {
+	ESPDateConfig cfg{0.0f, 0.0f, "UTC0", nullptr};
+	cfg.checkpointStore = &store;
+	cfg.restoreSystemClock = false; // never touch the host clock from tests
+	return cfg;
+}
+
+static void test_checkpoint_blob_round_trip_and_corruption() {
+	ESPDateTimeCheckpoint in;
+	in.epochUs = 1767225600LL * kSecondUs + 123456;
+	in.errorBoundUs = 25000;
+	in.driftPpm = -17.25f;
+	uint8_t blob[ESPDateCheckpointStore::kBlobSize];
+	ESPDateCheckpointStore::encode(in, blob);
+
+	ESPDateTimeCheckpoint out;
+	TEST_ASSERT_TRUE(ESPDateCheckpointStore::decode(blob, out));
+	TEST_ASSERT_EQUAL_INT64(in.epochUs, out.epochUs);
+	TEST_ASSERT_EQUAL_INT64(in.errorBoundUs, out.errorBoundUs);
+	TEST_ASSERT_FLOAT_WITHIN(0.001f, in.driftPpm, out.driftPpm);
+
+	blob[10] ^= 0x01;
+	TEST_ASSERT_FALSE(ESPDateCheckpointStore::decode(blob, out));
+}
+
+static void test_restore_after_cold_boot_bounds_estimate_error() {
+	MemoryCheckpointStore store;
+	const int64_t savedUs = 1767225600LL * kSecondUs; // 2026-01-01T00:00:00Z
+	store.put(ESPDateTimeCheckpoint{savedUs, 10000, 20.0f});
+
+	ESPDate rebooted;
+	rebooted.init(checkpoint_config(store));
+	// Simulated reboot: system clock reset to 1970, device was down 1 h 3 s,
+	// the application only knows its planned one-hour sleep.
+	TEST_ASSERT_TRUE(rebooted._testRestoreFromCheckpoint(0, 3600 * kSecondUs));
+	const int64_t trueUs = savedUs + 3603 * kSecondUs;
+
+	const ESPDateTimeEstimate estimate = rebooted.timeEstimate();
+	TEST_ASSERT_TRUE(estimate.quality == ESPDateTimeQuality::Restored);
+	TEST_ASSERT_TRUE(rebooted.timeQuality() == ESPDateTimeQuality::Restored);
+	TEST_ASSERT_TRUE(estimate.errorBoundUs > 0);
+	TEST_ASSERT_TRUE(llabs(estimate.epochUs - trueUs) <= estimate.errorBoundUs);
+	TEST_ASSERT_TRUE(estimate.errorBoundUs < 5 * kSecondUs);
+	TEST_ASSERT_DOUBLE_WITHIN(0.01, 20.0, rebooted.clockDiscipline().driftPpm());
+}
+
+static void test_restore_keeps_surviving_system_clock() {
+	MemoryCheckpointStore store;
+	const int64_t savedUs = 1767225600LL * kSecondUs;
+	store.put(ESPDateTimeCheckpoint{savedUs, 10000, 0.0f});
+
+	ESPDate woke;
+	woke.init(checkpoint_config(store));
+	// Deep sleep: the RTC-backed clock kept running for 10 minutes.
+	TEST_ASSERT_TRUE(woke._testRestoreFromCheckpoint(savedUs + 600 * kSecondUs, 0));
+	const ESPDateTimeEstimate estimate = woke.timeEstimate();
+	TEST_ASSERT_INT64_WITHIN(kSecondUs, savedUs + 600 * kSecondUs, estimate.epochUs);
+	TEST_ASSERT_INT64_WITHIN(1000, 10000 + 600000, estimate.errorBoundUs);
+
+	// Cold boot without a downtime hint: the checkpoint is only a lower bound.
+	TEST_ASSERT_TRUE(woke._testRestoreFromCheckpoint(0, 0));
+	TEST_ASSERT_EQUAL_INT64(-1, woke.timeEstimate().errorBoundUs);
+}
+
+static void test_sync_confirms_restored_time_and_checkpoints() {
+	MemoryCheckpointStore store;
+	ESPDate tracker;
+	tracker.init(checkpoint_config(store));
+	TEST_ASSERT_TRUE(tracker.timeQuality() == ESPDateTimeQuality::Unset);
+	TEST_ASSERT_FALSE(tracker.checkpointTime());
+
+	DateTime synced = tracker.fromUtc(2026, 3, 1, 12, 0, 0);
+	tracker._testDispatchNtpSync(synced);
+	TEST_ASSERT_TRUE(tracker.timeQuality() == ESPDateTimeQuality::Synced);
+	TEST_ASSERT_EQUAL(1, store.writes);
+
+	ESPDateTimeCheckpoint saved;
+	TEST_ASSERT_TRUE(ESPDateCheckpointStore::decode(store.blob, saved));
+	TEST_ASSERT_INT64_WITHIN(kSecondUs, synced.epochSeconds * kSecondUs, saved.epochUs);
+	TEST_ASSERT_TRUE(saved.errorBoundUs >= ESPDateSyncHealth::kSyncUncertaintyUs);
+}
+
+static void test_sync_checkpoints_are_rate_limited() {
+	MemoryCheckpointStore store;
+	ESPDateSimulatedTimeSource clock(1772366400LL * kSecondUs); // 2026-03-01T12:00:00Z
+	ESPDateConfig cfg = checkpoint_config(store);
+	cfg.checkpointIntervalMs = 3600 * 1000;
+	ESPDate tracker;
+	tracker.setTimeSource(&clock);
+	tracker.init(cfg);
+	auto sync = [&](int64_t advanceSeconds) {
+		clock.advanceSeconds(advanceSeconds);
+		TEST_ASSERT_TRUE(
+		    tracker.syncFromReference(clock.epochMicros(), clock.monotonicMicros(), false)
+		);
+	};
+
+	sync(0);
+	TEST_ASSERT_EQUAL(1, store.writes); // nothing stored yet
+	sync(600);
+	TEST_ASSERT_EQUAL(1, store.writes); // fresh and the clock did not move
+	clock.setEpochMicros(clock.epochMicros() + 5 * kSecondUs);
+	sync(600);
+	TEST_ASSERT_EQUAL(2, store.writes); // the clock stepped
+	sync(1800);
+	TEST_ASSERT_EQUAL(2, store.writes);
+	sync(1860);
+	TEST_ASSERT_EQUAL(3, store.writes); // older than the interval
+
+	// After a wake the restored checkpoint counts as written: a sync 10 minutes later keeps it.
+	clock.advanceSeconds(600);
+	ESPDate woke;
+	woke.setTimeSource(&clock);
+	woke.init(cfg);
+	TEST_ASSERT_TRUE(woke.timeQuality() == ESPDateTimeQuality::Restored);
+	TEST_ASSERT_TRUE(woke.syncFromReference(clock.epochMicros(), clock.monotonicMicros(), false));
+	TEST_ASSERT_EQUAL(3, store.writes);
+	TEST_ASSERT_TRUE(woke.checkpointTime());
+	TEST_ASSERT_EQUAL(4, store.writes);
+	woke.setTimeSource(nullptr);
+	tracker.setTimeSource(nullptr);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_discipline_estimates_drift_from_sync_history);
+	RUN_TEST(test_discipline_extrapolates_between_syncs);
+	RUN_TEST(test_discipline_slews_instead_of_stepping_backwards);
+	RUN_TEST(test_discipline_slew_rate_is_bounded);
+	RUN_TEST(test_discipline_steps_forward_above_threshold);
+	RUN_TEST(test_disciplined_now_tracks_dispatched_sync);
+	RUN_TEST(test_adaptive_interval_widens_once_drift_is_characterised);
+	RUN_TEST(test_adaptive_interval_narrows_when_drift_changes);
+	RUN_TEST(test_adaptive_sync_stats_through_espdate);
+	RUN_TEST(test_sync_health_counts_timed_out_attempts);
+	RUN_TEST(test_sync_health_reports_recent_steps_and_bound);
+	RUN_TEST(test_sync_health_snapshots_are_consistent_under_writes);
+	RUN_TEST(test_discipline_snapshots_are_consistent_under_writes);
+	RUN_TEST(test_time_sync_stats_through_espdate);
+	RUN_TEST(test_checkpoint_blob_round_trip_and_corruption);
+	RUN_TEST(test_restore_after_cold_boot_bounds_estimate_error);
+	RUN_TEST(test_restore_keeps_surviving_system_clock);
+	RUN_TEST(test_sync_confirms_restored_time_and_checkpoints);
+	RUN_TEST(test_sync_checkpoints_are_rate_limited);
+	UNITY_END();
+}
+
+void loop() {
+}
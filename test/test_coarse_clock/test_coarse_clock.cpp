@@ -0,0 +1,161 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+ESPDate date;
+
+// Runs `check` until it completes within one second of the system clock, so a roll-over
+// between the cached and the direct read does not fail the comparison.
+template <typename Check> static void withinOneSecond(Check check) {
+	for (int attempt = 0; attempt < 5; ++attempt) {
+		const int64_t before = date.now().epochSeconds;
+		const bool ok = check();
+		if (date.now().epochSeconds == before) {
+			TEST_ASSERT_TRUE(ok);
+			return;
+		}
+	}
+	TEST_FAIL_MESSAGE("clock kept rolling over");
+}
+
+static void test_cached_reads_match_direct_reads() {
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+
+	withinOneSecond([] {
+		const DateTime coarse = date.nowCoarse();
+		const LocalDateTime cached = date.nowLocalCached();
+		const LocalDateTime direct = date.nowLocal();
+		char cachedText[32];
+		char directText[32];
+		return coarse.epochSeconds == date.now().epochSeconds && cached.ok &&
+		       cached.hour == direct.hour && cached.minute == direct.minute &&
+		       cached.second == direct.second && cached.offsetMinutes == direct.offsetMinutes &&
+		       cached.utc.epochSeconds == coarse.epochSeconds &&
+		       date.nowUtcStringCached(cachedText, sizeof(cachedText)) &&
+		       date.nowUtcString(directText, sizeof(directText)) &&
+		       strcmp(cachedText, directText) == 0 &&
+		       date.nowLocalStringCached(cachedText, sizeof(cachedText)) &&
+		       direct.localString(directText, sizeof(directText)) &&
+		       strcmp(cachedText, directText) == 0 &&
+		       date.nowLocalStringCached() == date.nowLocalCached().localString();
+	});
+
+	char tiny[8];
+	TEST_ASSERT_FALSE(date.nowUtcStringCached(tiny, sizeof(tiny)));
+	TEST_ASSERT_FALSE(date.nowLocalStringCached(nullptr, 32));
+	TEST_ASSERT_EQUAL(19, date.nowUtcStringCached().size());
+}
+
+static void test_init_switches_the_cached_zone() {
+	ESPDateConfig config{};
+	config.timeZone = "UTC0";
+	date.init(config);
+	withinOneSecond([] { return date.nowLocalCached().offsetMinutes == 0; });
+
+	// Same second, new zone: the cached fields must not survive init().
+	config.timeZone = "<+0545>-5:45";
+	date.init(config);
+	withinOneSecond([] {
+		const LocalDateTime local = date.nowLocalCached();
+		return local.offsetMinutes == 345 && local.hour == date.nowLocal().hour;
+	});
+
+	// Changing TZ behind ESPDate's back needs an explicit invalidation.
+	config.timeZone = "UTC0";
+	date.init(config);
+	date.refreshCoarseClock();
+	withinOneSecond([] {
+		date.invalidateCoarseClock();
+		return date.nowLocalCached().offsetMinutes == 0;
+	});
+}
+
+static void test_store_expiry_and_generations() {
+	ESPDateCoarseClock clock;
+	ESPDateCoarseSample sample;
+	int64_t seconds = 0;
+	TEST_ASSERT_FALSE(clock.read(0, sample));
+
+	sample.epochSeconds = 1000;
+	sample.expiresUs = 5000;
+	clock.publish(sample, clock.generation());
+	TEST_ASSERT_TRUE(clock.readSeconds(4999, seconds));
+	TEST_ASSERT_EQUAL(1000, seconds);
+	TEST_ASSERT_FALSE(clock.readSeconds(5000, seconds));
+
+	// A refresh computed before an invalidation is dropped.
+	const uint32_t generation = clock.generation();
+	clock.invalidate();
+	sample.epochSeconds = 2000;
+	sample.expiresUs = 9000;
+	clock.publish(sample, generation);
+	ESPDateCoarseSample read;
+	TEST_ASSERT_FALSE(clock.read(0, read));
+	clock.publish(sample, clock.generation());
+	TEST_ASSERT_TRUE(clock.read(0, read));
+	TEST_ASSERT_EQUAL(2000, read.epochSeconds);
+}
+
+static void test_readers_never_see_torn_samples() {
+	ESPDateCoarseClock clock;
+	std::atomic<bool> stop{false};
+	std::atomic<uint32_t> torn{0};
+	std::atomic<uint32_t> reads{0};
+	auto reader = [&] {
+		ESPDateCoarseSample sample;
+		char expected[ESPDateCoarseSample::kTextSize];
+		while (!stop.load()) {
+			if (!clock.read(0, sample)) {
+				continue;
+			}
+			const long long seconds = static_cast<long long>(sample.epochSeconds);
+			snprintf(expected, sizeof(expected), "%lld", seconds);
+			if (strcmp(expected, sample.utcText) != 0 || sample.year != seconds % 1000) {
+				torn.fetch_add(1);
+			}
+			reads.fetch_add(1);
+		}
+	};
+	std::thread first(reader);
+	std::thread second(reader);
+	ESPDateCoarseSample sample;
+	sample.expiresUs = INT64_MAX;
+	for (int64_t i = 0; i < 20000 || reads.load() < 1000; ++i) {
+		sample.epochSeconds = i;
+		sample.year = static_cast<int16_t>(i % 1000);
+		snprintf(sample.utcText, sizeof(sample.utcText), "%lld", static_cast<long long>(i));
+		clock.publish(sample, clock.generation());
+		if (i % 64 == 0) {
+			clock.invalidate();
+		}
+	}
+	stop.store(true);
+	first.join();
+	second.join();
+	TEST_ASSERT_EQUAL_UINT32(0, torn.load());
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_cached_reads_match_direct_reads);
+	RUN_TEST(test_init_switches_the_cached_zone);
+	RUN_TEST(test_store_expiry_and_generations);
+	RUN_TEST(test_readers_never_see_torn_samples);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,137 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+
+ESPDate date;
+
+static constexpr size_t kStamps = 1000;
+static DateTime series[kStamps];
+static uint8_t stream[kStamps * ESPDateDeltaEncoder::kMaxBytesPerStamp];
+
+static size_t encode_series(size_t count) {
+	ESPDateDeltaEncoder encoder(stream, sizeof(stream));
+	for (size_t i = 0; i < count; ++i) {
+		TEST_ASSERT_TRUE(encoder.append(series[i]));
+	}
+	TEST_ASSERT_EQUAL(count, encoder.count());
+	return encoder.size();
+}
+
+static void assert_decodes_series(size_t count, size_t bytes) {
+	ESPDateDeltaDecoder decoder(stream, bytes);
+	DateTime decoded{};
+	for (size_t i = 0; i < count; ++i) {
+		TEST_ASSERT_TRUE(decoder.next(decoded));
+		TEST_ASSERT_EQUAL_INT64(series[i].epochSeconds, decoded.epochSeconds);
+	}
+	TEST_ASSERT_FALSE(decoder.next(decoded));
+	TEST_ASSERT_FALSE(decoder.error());
+}
+
+static void test_delta_stream_regular_series_is_one_byte_per_stamp() {
+	const int64_t start = date.fromUtc(2025, 5, 1, 0, 0, 0).epochSeconds;
+	for (size_t i = 0; i < kStamps; ++i) {
+		// 10 s logging with up to 2 s of scheduling jitter.
+		series[i] = DateTime{start + static_cast<int64_t>(i) * 10 + static_cast<int64_t>(i % 3)};
+	}
+	const size_t bytes = encode_series(kStamps);
+	// 5 bytes for the absolute start, 1 for the first delta, then one byte each.
+	TEST_ASSERT_EQUAL(5 + 1 + (kStamps - 2), bytes);
+	assert_decodes_series(kStamps, bytes);
+}
+
+static void test_delta_stream_round_trips_arbitrary_values() {
+	srand(3);
+	for (size_t i = 0; i < kStamps; ++i) {
+		const int64_t high = static_cast<int64_t>(rand()) << 32;
+		series[i] = DateTime{(high ^ rand()) * (i % 2 ? -1 : 1)};
+	}
+	series[0] = DateTime{INT64_MIN};
+	series[1] = DateTime{INT64_MAX};
+	series[2] = DateTime{INT64_MIN};
+	const size_t bytes = encode_series(kStamps);
+	assert_decodes_series(kStamps, bytes);
+}
+
+static void test_delta_stream_bounds_and_errors() {
+	uint8_t small[6];
+	ESPDateDeltaEncoder encoder(small, sizeof(small));
+	TEST_ASSERT_TRUE(encoder.append(DateTime{1700000000})); // 5 bytes
+	TEST_ASSERT_TRUE(encoder.append(DateTime{1700000060})); // 1 byte (zigzag 120)
+	TEST_ASSERT_FALSE(encoder.append(DateTime{1700000120}));
+	TEST_ASSERT_EQUAL(2, encoder.count());
+	TEST_ASSERT_EQUAL(6, encoder.size());
+
+	// A varint cut off mid-way is reported, not silently decoded.
+	ESPDateDeltaDecoder truncated(small, 3);
+	DateTime out{};
+	TEST_ASSERT_FALSE(truncated.next(out));
+	TEST_ASSERT_TRUE(truncated.error());
+
+	const uint8_t overlong[11] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+	ESPDateDeltaDecoder tooLong(overlong, sizeof(overlong));
+	TEST_ASSERT_FALSE(tooLong.next(out));
+	TEST_ASSERT_TRUE(tooLong.error());
+
+	encoder.reset(nullptr, 100);
+	TEST_ASSERT_FALSE(encoder.append(DateTime{0}));
+}
+
+static void test_fixed_width_codecs() {
+	uint8_t bytes[ESPDateCompact5Codec::kSize];
+	const int64_t samples[] = {
+	    0,
+	    -1,
+	    1700000000,
+	    -2208988800, // 1900
+	    ESPDateCompact5Codec::kMinSeconds,
+	    ESPDateCompact5Codec::kMaxSeconds,
+	};
+	for (int64_t seconds : samples) {
+		TEST_ASSERT_TRUE(ESPDateCompact5Codec::encode(DateTime{seconds}, bytes));
+		TEST_ASSERT_EQUAL_INT64(seconds, ESPDateCompact5Codec::decode(bytes).epochSeconds);
+	}
+	TEST_ASSERT_FALSE(
+	    ESPDateCompact5Codec::encode(DateTime{ESPDateCompact5Codec::kMaxSeconds + 1}, bytes)
+	);
+
+	const ESPDateEpoch32Codec codec;
+	uint8_t packedBytes[ESPDateEpoch32Codec::kSize];
+	const DateTime stamp = date.fromUtc(2031, 7, 4, 12, 0, 0);
+	TEST_ASSERT_TRUE(codec.encode(stamp, packedBytes));
+	TEST_ASSERT_EQUAL_INT64(stamp.epochSeconds, codec.decode(packedBytes).epochSeconds);
+	uint32_t packed = 0;
+	TEST_ASSERT_TRUE(codec.pack(DateTime{ESPDateEpoch32Codec::kDefaultEpoch}, packed));
+	TEST_ASSERT_EQUAL(0, packed);
+	TEST_ASSERT_FALSE(codec.pack(DateTime{ESPDateEpoch32Codec::kDefaultEpoch - 1}, packed));
+	TEST_ASSERT_TRUE(codec.pack(date.fromUtc(2156, 1, 1, 0, 0, 0), packed));
+	TEST_ASSERT_FALSE(codec.pack(date.fromUtc(2157, 1, 1, 0, 0, 0), packed));
+
+	const ESPDateEpoch32Codec custom(date.fromUtc(2000, 1, 1).epochSeconds);
+	TEST_ASSERT_TRUE(custom.pack(date.fromUtc(2000, 1, 1, 0, 1, 0), packed));
+	TEST_ASSERT_EQUAL(60, packed);
+	TEST_ASSERT_EQUAL_INT64(
+	    date.fromUtc(2000, 1, 1, 0, 1, 0).epochSeconds,
+	    custom.unpack(packed).epochSeconds
+	);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_delta_stream_regular_series_is_one_byte_per_stamp);
+	RUN_TEST(test_delta_stream_round_trips_arbitrary_values);
+	RUN_TEST(test_delta_stream_bounds_and_errors);
+	RUN_TEST(test_fixed_width_codecs);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstring>
+
+ESPDate date;
+
+static void test_layout_and_explicit_conversions() {
+	TEST_ASSERT_EQUAL(8, sizeof(DateTimeUs));
+	const DateTime whole = date.fromUtc(2025, 6, 1, 12, 0, 5);
+	const DateTimeUs precise = DateTimeUs::fromDateTime(whole, 250000);
+	TEST_ASSERT_EQUAL_INT64(whole.epochSeconds, precise.toDateTime().epochSeconds);
+	TEST_ASSERT_EQUAL(250000, precise.microsOfSecond());
+	TEST_ASSERT_EQUAL(250, precise.millisOfSecond());
+	TEST_ASSERT_EQUAL_INT64(whole.epochSeconds * 1000 + 250, precise.epochMillis());
+	TEST_ASSERT_TRUE(DateTimeUs::fromEpochMillis(precise.epochMillis()) == precise);
+
+	// Before the epoch the second is floored and the fraction stays positive.
+	const DateTimeUs beforeEpoch{-1500000};
+	TEST_ASSERT_EQUAL_INT64(-2, beforeEpoch.toDateTime().epochSeconds);
+	TEST_ASSERT_EQUAL(500000, beforeEpoch.microsOfSecond());
+	TEST_ASSERT_EQUAL_INT64(-1500, beforeEpoch.epochMillis());
+}
+
+static void test_arithmetic_and_differences() {
+	const DateTimeUs event{1700000000123456LL};
+	const DateTimeUs later = event.addMillis(10).addMicros(7);
+	TEST_ASSERT_EQUAL_INT64(10007, later.differenceInMicros(event));
+	TEST_ASSERT_EQUAL_INT64(10, later.differenceInMillis(event));
+	TEST_ASSERT_EQUAL_INT64(-10, event.differenceInMillis(later));
+	TEST_ASSERT_EQUAL_INT64(0, later.differenceInSeconds(event));
+	TEST_ASSERT_EQUAL_INT64(90, event.addSeconds(90).differenceInSeconds(event));
+	TEST_ASSERT_TRUE(event < later);
+	TEST_ASSERT_TRUE(later > event);
+	TEST_ASSERT_TRUE(event <= event);
+	TEST_ASSERT_TRUE(event != later);
+	TEST_ASSERT_TRUE(later.addMicros(-10007) == event);
+}
+
+static void test_fractional_formatting() {
+	const DateTimeUs t = DateTimeUs::fromDateTime(date.fromUtc(2025, 1, 2, 3, 4, 5), 67899);
+	TEST_ASSERT_EQUAL_STRING("2025-01-02 03:04:05.067", t.utcString().c_str());
+	TEST_ASSERT_EQUAL_STRING(
+	    "2025-01-02T03:04:05.067899Z",
+	    t.utcString(ESPDateFormat::Iso8601, 6).c_str()
+	);
+	TEST_ASSERT_EQUAL_STRING("03:04:05", t.utcString(ESPDateFormat::Time, 0).c_str());
+	TEST_ASSERT_EQUAL_STRING("2025-01-02", t.utcString(ESPDateFormat::Date, 6).c_str());
+
+	char buf[64];
+	TEST_ASSERT_TRUE(date.formatWithPatternUtc(t, "%H:%M:%S.%f", buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("03:04:05.067899", buf);
+	TEST_ASSERT_TRUE(date.formatWithPatternUtc(t, "%S%.3f|%2f|%.f|%%f", buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("05.067|06|.067899|%f", buf);
+	TEST_ASSERT_FALSE(date.formatWithPatternUtc(t, "%f", buf, 4));
+
+	char longest[DateTimeUsText::kCapacity + 1];
+	const DateTimeUs farFuture{9999999999999999LL};
+	TEST_ASSERT_TRUE(farFuture.utcString(longest, sizeof(longest), ESPDateFormat::Iso8601, 6));
+
+	setenv("TZ", "CET-1CEST,M3.5.0/2,M10.5.0/3", 1);
+	tzset();
+	TEST_ASSERT_EQUAL_STRING(
+	    "2025-01-02T04:04:05.06+0100",
+	    t.localString(ESPDateFormat::Iso8601, 2).c_str()
+	);
+	TEST_ASSERT_TRUE(date.formatWithPatternLocal(t, "%H:%M:%S%.3f", buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("04:04:05.067", buf);
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+
+static void test_fractional_parsing() {
+	ESPDate::ParseResultUs parsed = date.parseIso8601UtcUs("2025-01-02T03:04:05.5Z");
+	TEST_ASSERT_TRUE(parsed.ok);
+	TEST_ASSERT_EQUAL_INT64(
+	    date.fromUtc(2025, 1, 2, 3, 4, 5).epochSeconds * 1000000 + 500000,
+	    parsed.value.epochMicros
+	);
+	parsed = date.parseIso8601UtcUs("2025-01-02T03:04:05,123456789Z");
+	TEST_ASSERT_TRUE(parsed.ok);
+	TEST_ASSERT_EQUAL(123456, parsed.value.microsOfSecond());
+	parsed = date.parseIso8601UtcUs("2025-01-02T03:04:05Z");
+	TEST_ASSERT_TRUE(parsed.ok);
+	TEST_ASSERT_EQUAL(0, parsed.value.microsOfSecond());
+
+	// Round trip through the formatter.
+	const DateTimeUs t{1733000000654321LL};
+	TEST_ASSERT_TRUE(
+	    date.parseIso8601UtcUs(t.utcString(ESPDateFormat::Iso8601, 6).c_str()).value == t
+	);
+
+	// Numeric offsets are normalized to UTC, as ESPDateIso8601Codec::parse does.
+	const DateTimeUs expected{date.fromUtc(2025, 1, 2, 3, 4, 5).epochSeconds * 1000000 + 250000};
+	parsed = date.parseIso8601UtcUs("2025-01-02T04:04:05.25+01:00");
+	TEST_ASSERT_TRUE(parsed.ok);
+	TEST_ASSERT_TRUE(parsed.value == expected);
+	parsed = date.parseIso8601UtcUs("2025-01-01T21:34:05,25-0530");
+	TEST_ASSERT_TRUE(parsed.ok);
+	TEST_ASSERT_TRUE(parsed.value == expected);
+	TEST_ASSERT_TRUE(date.parseIso8601UtcUs("2025-01-02T03:04:05-00:00").ok);
+
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02T03:04:05.Z").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02T03:04:05.25+01").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02T03:04:05+0160").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02T03:04:05.1234567890Z").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02T03:04:05.12").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-02-30T03:04:05.12Z").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs("2025-01-02").ok);
+	TEST_ASSERT_FALSE(date.parseIso8601UtcUs(nullptr).ok);
+}
+
+static void test_now_us_tracks_system_clock() {
+	const DateTime before = date.now();
+	const DateTimeUs current = date.nowUs();
+	const DateTime after = date.now();
+	TEST_ASSERT_TRUE(current.toDateTime().epochSeconds >= before.epochSeconds);
+	TEST_ASSERT_TRUE(current.toDateTime().epochSeconds <= after.epochSeconds);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_layout_and_explicit_conversions);
+	RUN_TEST(test_arithmetic_and_differences);
+	RUN_TEST(test_fractional_formatting);
+	RUN_TEST(test_fractional_parsing);
+	RUN_TEST(test_now_us_tracks_system_clock);
+	UNITY_END();
+}
+
+void loop() {
+}
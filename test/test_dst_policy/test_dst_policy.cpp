@@ -0,0 +1,353 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+
+ESPDate date;
+
+static const char *kBudapestTz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+static const char *kNewYorkTz = "EST5EDT,M3.2.0,M11.1.0";
+static const char *kSydneyTz = "AEST-10AEDT,M10.1.0,M4.1.0/3";
+static const char *kLordHoweTz = "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0";
+static const char *kSantiagoTz = "<-04>4<-03>,M9.1.6/24,M4.1.6/24";
+static const char *kNuukTz = "<-02>2<-01>,M3.5.0/-1,M10.5.0/0";
+
+static void useProcessTz(const char *tz) {
+	setenv("TZ", tz, 1);
+	tzset();
+}
+
+static int64_t utc(int year, int month, int day, int hour, int minute, int second = 0) {
+	return date.fromUtc(year, month, day, hour, minute, second).epochSeconds;
+}
+
+static int64_t wall(int year, int month, int day, int hour, int minute) {
+	return utc(year, month, day, hour, minute); // wall clock encoded like a UTC timestamp
+}
+
+static void assert_resolves(
+    const ESPDatePosixTz &zone,
+    int64_t wallSeconds,
+    ESPDateDstPolicy policy,
+    ESPDateLocalTimeKind expectedKind,
+    int64_t expectedUtc
+) {
+	int64_t out = 0;
+	ESPDateLocalTimeKind kind = ESPDateLocalTimeKind::Unique;
+	TEST_ASSERT_TRUE(zone.localToUtc(wallSeconds, policy, out, &kind));
+	TEST_ASSERT_EQUAL(static_cast<int>(expectedKind), static_cast<int>(kind));
+	TEST_ASSERT_EQUAL_INT64(expectedUtc, out);
+}
+
+static void test_parser_accepts_posix_forms_and_rejects_others() {
+	const char *valid[] = {
+	    "UTC0",
+	    "IST-5:30",
+	    "<+0545>-5:45",
+	    kBudapestTz,
+	    kNewYorkTz,
+	    "EST5EDT",
+	    kSydneyTz,
+	    kLordHoweTz,
+	    kSantiagoTz,
+	    kNuukTz,
+	    "EST5EDT4,J60/2:30:15,299/-3",
+	};
+	for (const char *tz : valid) {
+		ESPDatePosixTz zone;
+		TEST_ASSERT_TRUE_MESSAGE(zone.parse(tz), tz);
+	}
+	const char *invalid[] = {
+	    "",
+	    "Europe/Budapest",
+	    ":Europe/Budapest",
+	    "CET",
+	    "CE-1",
+	    "<+1>-1",
+	    "CET-1CEST,M3.5.0",
+	    "CET-1CEST,M13.5.0,M10.5.0",
+	    "CET-1CEST,M3.6.0,M10.5.0",
+	    "CET-1CEST,M3.5.7,M10.5.0",
+	    "CET-1CEST,J0,J365",
+	    "CET-1CEST,M3.5.0/200,M10.5.0",
+	    "CET-1CEST,M3.5.0,M10.5.0x",
+	};
+	for (const char *tz : invalid) {
+		ESPDatePosixTz zone;
+		TEST_ASSERT_FALSE_MESSAGE(zone.parse(tz), tz);
+	}
+	ESPDatePosixTz none(nullptr);
+	TEST_ASSERT_FALSE(none.isValid());
+
+	ESPDatePosixTz kathmandu("<+0545>-5:45");
+	TEST_ASSERT_FALSE(kathmandu.hasDst());
+	TEST_ASSERT_EQUAL(5 * 3600 + 45 * 60, kathmandu.utcOffsetAt(utc(2025, 6, 1, 0, 0)));
+}
+
+static void test_transition_dates_follow_the_rules() {
+	int64_t start = 0;
+	int64_t end = 0;
+	// Times outside 0..24h: Nuuk switches at the same UTC instants as the EU.
+	ESPDatePosixTz nuuk(kNuukTz);
+	TEST_ASSERT_TRUE(nuuk.transitions(2025, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 30, 1, 0), start);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 1, 0), end);
+
+	// Santiago: Saturday 24:00 is Sunday 00:00.
+	ESPDatePosixTz santiago(kSantiagoTz);
+	TEST_ASSERT_TRUE(santiago.transitions(2025, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 9, 7, 4, 0), start);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 4, 6, 3, 0), end);
+
+	// Jn skips February 29; n counts it.
+	ESPDatePosixTz julian("EST5EDT,J60,J300");
+	TEST_ASSERT_TRUE(julian.transitions(2024, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2024, 3, 1, 7, 0), start);
+	ESPDatePosixTz zeroBased("EST5EDT,59,299");
+	TEST_ASSERT_TRUE(zeroBased.transitions(2024, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2024, 2, 29, 7, 0), start);
+	TEST_ASSERT_TRUE(zeroBased.transitions(2025, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 1, 7, 0), start);
+
+	// A DST name without rules gets the US defaults.
+	ESPDatePosixTz implicitRules("EST5EDT");
+	TEST_ASSERT_TRUE(implicitRules.transitions(2025, start, end));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 9, 7, 0), start);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 11, 2, 6, 0), end);
+}
+
+static void test_offsets_match_libc_across_zones() {
+	const char *zones[] = {kBudapestTz, kNewYorkTz, kSydneyTz, kLordHoweTz, "IST-5:30"};
+	for (const char *tz : zones) {
+		ESPDatePosixTz zone(tz);
+		TEST_ASSERT_TRUE_MESSAGE(zone.isValid(), tz);
+		const int64_t from = utc(2024, 1, 1, 0, 0);
+		const int64_t to = utc(2026, 1, 1, 0, 0);
+		for (int64_t t = from; t < to; t += 3600) {
+			const LocalDateTime local = date.toLocal(DateTime{t}, tz);
+			TEST_ASSERT_TRUE(local.ok);
+			TEST_ASSERT_EQUAL_INT64_MESSAGE(local.offsetMinutes * 60, zone.utcOffsetAt(t), tz);
+		}
+		for (int year = 2024; year <= 2025; ++year) {
+			int64_t transitions[2] = {};
+			const bool hasTransitions = zone.transitions(year, transitions[0], transitions[1]);
+			TEST_ASSERT_TRUE(zone.hasDst() == hasTransitions);
+			if (!zone.hasDst()) {
+				continue;
+			}
+			for (int64_t transition : transitions) {
+				for (int64_t t = transition - 120; t <= transition + 120; t += 30) {
+					const LocalDateTime local = date.toLocal(DateTime{t}, tz);
+					TEST_ASSERT_EQUAL_INT64_MESSAGE(
+					    local.offsetMinutes * 60,
+					    zone.utcOffsetAt(t),
+					    tz
+					);
+				}
+			}
+		}
+	}
+}
+
+static void test_policies_for_gaps_and_overlaps() {
+	using Kind = ESPDateLocalTimeKind;
+	using Policy = ESPDateDstPolicy;
+
+	// Budapest: 02:00 -> 03:00 on 2025-03-30, 03:00 -> 02:00 on 2025-10-26 (both 01:00 UTC).
+	ESPDatePosixTz budapest(kBudapestTz);
+	const int64_t gap = wall(2025, 3, 30, 2, 30);
+	assert_resolves(budapest, gap, Policy::Earliest, Kind::Skipped, utc(2025, 3, 30, 1, 0));
+	assert_resolves(budapest, gap, Policy::Latest, Kind::Skipped, utc(2025, 3, 30, 1, 0));
+	assert_resolves(budapest, gap, Policy::ShiftForward, Kind::Skipped, utc(2025, 3, 30, 1, 30));
+	int64_t out = 0;
+	ESPDateLocalTimeKind kind = Kind::Unique;
+	TEST_ASSERT_FALSE(budapest.localToUtc(gap, Policy::Skip, out, &kind));
+	TEST_ASSERT_EQUAL(static_cast<int>(Kind::Skipped), static_cast<int>(kind));
+
+	const int64_t overlap = wall(2025, 10, 26, 2, 30);
+	assert_resolves(budapest, overlap, Policy::Earliest, Kind::Repeated, utc(2025, 10, 26, 0, 30));
+	assert_resolves(budapest, overlap, Policy::Latest, Kind::Repeated, utc(2025, 10, 26, 1, 30));
+	assert_resolves(budapest, overlap, Policy::Skip, Kind::Repeated, utc(2025, 10, 26, 0, 30));
+	assert_resolves(
+	    budapest,
+	    overlap,
+	    Policy::ShiftForward,
+	    Kind::Repeated,
+	    utc(2025, 10, 26, 0, 30)
+	);
+	assert_resolves(
+	    budapest,
+	    wall(2025, 10, 26, 3, 0),
+	    Policy::Latest,
+	    Kind::Unique,
+	    utc(2025, 10, 26, 2, 0)
+	);
+
+	// New York: gap 02:00-03:00 on 2025-03-09, overlap 01:00-02:00 on 2025-11-02.
+	ESPDatePosixTz newYork(kNewYorkTz);
+	assert_resolves(
+	    newYork,
+	    wall(2025, 3, 9, 2, 30),
+	    Policy::ShiftForward,
+	    Kind::Skipped,
+	    utc(2025, 3, 9, 7, 30)
+	);
+	assert_resolves(
+	    newYork,
+	    wall(2025, 11, 2, 1, 30),
+	    Policy::Latest,
+	    Kind::Repeated,
+	    utc(2025, 11, 2, 6, 30)
+	);
+
+	// Sydney (southern hemisphere): gap on 2025-10-05, overlap on 2025-04-06.
+	ESPDatePosixTz sydney(kSydneyTz);
+	assert_resolves(
+	    sydney,
+	    wall(2025, 10, 5, 2, 30),
+	    Policy::Earliest,
+	    Kind::Skipped,
+	    utc(2025, 10, 4, 16, 0)
+	);
+	assert_resolves(
+	    sydney,
+	    wall(2025, 4, 6, 2, 30),
+	    Policy::Earliest,
+	    Kind::Repeated,
+	    utc(2025, 4, 5, 15, 30)
+	);
+	assert_resolves(
+	    sydney,
+	    wall(2025, 4, 6, 2, 30),
+	    Policy::Latest,
+	    Kind::Repeated,
+	    utc(2025, 4, 5, 16, 30)
+	);
+
+	// Lord Howe shifts by 30 minutes.
+	ESPDatePosixTz lordHowe(kLordHoweTz);
+	assert_resolves(
+	    lordHowe,
+	    wall(2025, 10, 5, 2, 15),
+	    Policy::ShiftForward,
+	    Kind::Skipped,
+	    utc(2025, 10, 4, 15, 45)
+	);
+	assert_resolves(
+	    lordHowe,
+	    wall(2025, 4, 6, 1, 45),
+	    Policy::Latest,
+	    Kind::Repeated,
+	    utc(2025, 4, 5, 15, 15)
+	);
+
+	// Santiago falls back at midnight: Saturday 23:30 happens twice.
+	ESPDatePosixTz santiago(kSantiagoTz);
+	assert_resolves(
+	    santiago,
+	    wall(2025, 4, 5, 23, 30),
+	    Policy::Earliest,
+	    Kind::Repeated,
+	    utc(2025, 4, 6, 2, 30)
+	);
+	assert_resolves(
+	    santiago,
+	    wall(2025, 9, 7, 0, 30),
+	    Policy::ShiftForward,
+	    Kind::Skipped,
+	    utc(2025, 9, 7, 4, 30)
+	);
+}
+
+static void test_esp_date_local_helpers_apply_policy() {
+	useProcessTz(kBudapestTz);
+
+	LocalTimeResult skipped = date.fromLocal(2025, 3, 30, 2, 30, 0, ESPDateDstPolicy::Skip);
+	TEST_ASSERT_FALSE(skipped.ok);
+	TEST_ASSERT_EQUAL(
+	    static_cast<int>(ESPDateLocalTimeKind::Skipped),
+	    static_cast<int>(skipped.kind)
+	);
+	TEST_ASSERT_EQUAL_INT64(
+	    utc(2025, 3, 30, 1, 30),
+	    date.fromLocal(2025, 3, 30, 2, 30, 0).epochSeconds
+	);
+
+	const DateTime fallBackMorning = DateTime{utc(2025, 10, 26, 8, 0)};
+	LocalTimeResult late =
+	    date.setTimeOfDayLocal(fallBackMorning, 2, 30, 0, ESPDateDstPolicy::Latest);
+	TEST_ASSERT_TRUE(late.ok);
+	TEST_ASSERT_EQUAL(
+	    static_cast<int>(ESPDateLocalTimeKind::Repeated),
+	    static_cast<int>(late.kind)
+	);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 1, 30), late.value.epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(
+	    utc(2025, 10, 26, 0, 30),
+	    date.setTimeOfDayLocal(fallBackMorning, 2, 30, 0).epochSeconds
+	);
+
+	useProcessTz("UTC0");
+}
+
+static void test_next_daily_runs_once_per_day_across_dst() {
+	useProcessTz(kBudapestTz);
+
+	// 07:15 local every day across both transitions: one run per calendar day, always 07:15.
+	DateTime cursor = DateTime{utc(2025, 3, 27, 0, 0)};
+	for (int i = 0; i < 8; ++i) {
+		const DateTime run = date.nextDailyAtLocal(7, 15, 0, cursor);
+		const LocalDateTime local = date.toLocal(run);
+		TEST_ASSERT_EQUAL(7, local.hour);
+		TEST_ASSERT_EQUAL(15, local.minute);
+		TEST_ASSERT_EQUAL((26 + i) % 31 + 1, local.day);
+		cursor = date.addSeconds(run, 1);
+	}
+
+	// 02:30 does not exist on 2025-03-30: Skip moves on, ShiftForward runs at 03:30.
+	const DateTime saturdayNoon = DateTime{utc(2025, 3, 29, 11, 0)};
+	TEST_ASSERT_EQUAL_INT64(
+	    utc(2025, 3, 31, 0, 30),
+	    date.nextDailyAtLocal(2, 30, 0, saturdayNoon, ESPDateDstPolicy::Skip).epochSeconds
+	);
+	TEST_ASSERT_EQUAL_INT64(
+	    utc(2025, 3, 30, 1, 30),
+	    date.nextDailyAtLocal(2, 30, 0, saturdayNoon).epochSeconds
+	);
+
+	// 02:30 happens twice on 2025-10-26: the default runs once, at the first one.
+	DateTime first = date.nextDailyAtLocal(2, 30, 0, DateTime{utc(2025, 10, 25, 12, 0)});
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 0, 30), first.epochSeconds);
+	DateTime second = date.nextDailyAtLocal(2, 30, 0, date.addSeconds(first, 1));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 27, 1, 30), second.epochSeconds);
+
+	// Sunday 02:30 weekly, with the gap Sunday skipped.
+	TEST_ASSERT_EQUAL_INT64(
+	    utc(2025, 4, 6, 0, 30),
+	    date.nextWeekdayAtLocal(0, 2, 30, 0, saturdayNoon, ESPDateDstPolicy::Skip).epochSeconds
+	);
+
+	useProcessTz("UTC0");
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	useProcessTz("UTC0");
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_parser_accepts_posix_forms_and_rejects_others);
+	RUN_TEST(test_transition_dates_follow_the_rules);
+	RUN_TEST(test_offsets_match_libc_across_zones);
+	RUN_TEST(test_policies_for_gaps_and_overlaps);
+	RUN_TEST(test_esp_date_local_helpers_apply_policy);
+	RUN_TEST(test_next_daily_runs_once_per_day_across_dst);
+	UNITY_END();
+}
+
+void loop() {
+}
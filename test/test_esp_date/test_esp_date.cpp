@@ -18,6 +18,19 @@
 #endif
 
 ESPDate date;
+
+// Counts global operator new calls so tests can assert heap-free code paths.
+static size_t gOperatorNewCalls = 0;
+void *operator new(size_t size) {
+	++gOperatorNewCalls;
+	return std::malloc(size ? size : 1);
+}
+void operator delete(void *ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void *ptr, size_t) noexcept {
+	std::free(ptr);
+}
 static const float kBudapestLat = 47.4979f;
 static const float kBudapestLon = 19.0402f;
 static const char *kBudapestTz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
@@ -518,6 +531,46 @@ static void test_string_helpers_for_datetime_and_local_datetime() {
 	TEST_ASSERT_TRUE(lastYear.localString(lastYearLocalBuf, sizeof(lastYearLocalBuf)));
 }
 
+static void test_text_helpers_do_not_allocate() {
+	ESPDate synced;
+	synced.init(ESPDateConfig{0.0f, 0.0f, "UTC0", nullptr});
+	DateTime dt = synced.fromUtc(2025, 1, 2, 3, 4, 5);
+	synced._testDispatchNtpSync(dt);
+	LocalDateTime local = synced.toLocal(dt);
+	TEST_ASSERT_TRUE(local.ok);
+
+	const size_t before = gOperatorNewCalls;
+	const DateTimeText texts[] = {
+	    dt.utcString(),
+	    dt.localString(ESPDateFormat::Iso8601),
+	    local.localString(),
+	    synced.dateTimeToStringUtc(dt, ESPDateFormat::Iso8601),
+	    synced.dateTimeToStringLocal(dt, ESPDateFormat::Date),
+	    synced.localDateTimeToString(local),
+	    synced.nowUtcString(ESPDateFormat::Time),
+	    synced.nowLocalString(),
+	    synced.lastNtpSyncStringUtc(),
+	    synced.lastNtpSyncStringLocal(ESPDateFormat::Iso8601),
+	};
+	TEST_ASSERT_EQUAL(before, gOperatorNewCalls);
+
+	for (const DateTimeText &text : texts) {
+		TEST_ASSERT_FALSE(text.empty());
+	}
+	TEST_ASSERT_TRUE(texts[0] == "2025-01-02 03:04:05");
+	TEST_ASSERT_EQUAL_STRING("2025-01-02T03:04:05Z", texts[3].c_str());
+	TEST_ASSERT_EQUAL_STRING("2025-01-02", texts[4].c_str());
+	TEST_ASSERT_EQUAL_STRING("2025-01-02 03:04:05", texts[5].c_str());
+	TEST_ASSERT_EQUAL_STRING("2025-01-02 03:04:05", texts[8].c_str());
+
+	// Six-digit years still fit the inline capacity.
+	DateTime farFuture{3000000000000LL};
+	TEST_ASSERT_FALSE(farFuture.utcString(ESPDateFormat::Iso8601).empty());
+
+	ESPDate neverSynced;
+	TEST_ASSERT_TRUE(neverSynced.lastNtpSyncStringUtc().empty());
+}
+
 static void test_psram_buffer_policy_toggle_is_safe() {
 	ESPDate psramDate;
 	ESPDateConfig cfg{};
@@ -531,6 +584,65 @@ static void test_psram_buffer_policy_toggle_is_safe() {
 	TEST_ASSERT_EQUAL_STRING("2025-01-02 03:04:05", buf);
 }
 
+static void test_buffer_pool_keeps_local_conversions_off_heap() {
+	ESPDate pooled;
+	ESPDateConfig cfg{};
+	cfg.timeZone = kBudapestTz;
+	cfg.bufferPoolBlocks = 4;
+	pooled.init(cfg);
+
+	ESPDateBufferPoolStats stats = pooled.bufferPoolStats();
+	TEST_ASSERT_TRUE(stats.enabled);
+	TEST_ASSERT_EQUAL(1, stats.inUse); // the stored TZ string
+
+	const char *newYorkTz = "EST5EDT,M3.2.0,M11.1.0";
+	DateTime start = pooled.fromUtc(2025, 3, 1, 12, 0, 0);
+	TEST_ASSERT_TRUE(pooled.toLocal(start, newYorkTz).ok); // warm-up
+	const uint32_t heapAfterWarmUp = pooled.bufferPoolStats().heapAllocations;
+
+	for (int i = 0; i < 200; ++i) {
+		DateTime dt = pooled.addHours(start, i * 12);
+		TEST_ASSERT_TRUE(pooled.toLocal(dt, newYorkTz).ok);
+		TEST_ASSERT_TRUE(pooled.toLocal(dt).ok);
+		pooled.isDstActive(dt, kBudapestTz);
+	}
+
+	stats = pooled.bufferPoolStats();
+	TEST_ASSERT_EQUAL_UINT32(heapAfterWarmUp, stats.heapAllocations);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.failedAllocations);
+	TEST_ASSERT_EQUAL(1, stats.inUse);
+	// POSIX zones resolve through the parsed-rule cache, so no TZ restore copy is ever taken.
+	TEST_ASSERT_EQUAL(1, stats.highWater);
+
+	pooled.deinit();
+	TEST_ASSERT_FALSE(pooled.bufferPoolStats().enabled);
+	setenv("TZ", "UTC", 1);
+	tzset();
+}
+
+static void test_buffer_pool_falls_back_to_heap_when_exhausted() {
+	ESPDateBufferPool &pool = ESPDateBufferPool::shared();
+	TEST_ASSERT_TRUE(pool.configure(32, 2));
+
+	const char *text = "a string long enough to skip SSO";
+	{
+		DateString first(text, 24, DateAllocator<char>());
+		DateString second(text, 24, DateAllocator<char>());
+		const uint32_t heapBefore = pool.stats().heapAllocations;
+		DateString third(text, 24, DateAllocator<char>());
+		DateString tooLarge(64, 'x', DateAllocator<char>());
+
+		ESPDateBufferPoolStats stats = pool.stats();
+		TEST_ASSERT_EQUAL(2, stats.inUse);
+		TEST_ASSERT_EQUAL_UINT32(2, stats.failedAllocations);
+		TEST_ASSERT_EQUAL_UINT32(heapBefore + 2, stats.heapAllocations);
+		TEST_ASSERT_EQUAL_STRING(third.c_str(), first.c_str());
+		TEST_ASSERT_FALSE(pool.release()); // blocks still handed out
+	}
+	TEST_ASSERT_EQUAL(0, pool.stats().inUse);
+	TEST_ASSERT_TRUE(pool.release());
+}
+
 void setUp() {
 }
 void tearDown() {
@@ -568,7 +680,10 @@ void setup() {
 	RUN_TEST(test_ntp_sync_interval_setter_accepts_default);
 	RUN_TEST(test_last_ntp_sync_defaults_to_empty);
 	RUN_TEST(test_string_helpers_for_datetime_and_local_datetime);
+	RUN_TEST(test_text_helpers_do_not_allocate);
 	RUN_TEST(test_psram_buffer_policy_toggle_is_safe);
+	RUN_TEST(test_buffer_pool_keeps_local_conversions_off_heap);
+	RUN_TEST(test_buffer_pool_falls_back_to_heap_when_exhausted);
 	UNITY_END();
 }
 
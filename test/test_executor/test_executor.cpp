@@ -0,0 +1,132 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+ESPDate date;
+
+#if ESPDATE_HAS_THREAD_EXECUTOR
+using PoolExecutor = ESPDateThreadExecutor;
+static constexpr size_t kMaxTestThreads = 6;
+#else
+using PoolExecutor = ESPDateFreeRtosExecutor;
+static constexpr size_t kMaxTestThreads = PoolExecutor::kMaxThreads;
+#endif
+
+static constexpr size_t kCount = 2000;
+
+static DateTime stamps[kCount];
+static DateTime starts[kCount];
+static DateTime expectedStarts[kCount];
+static int16_t years[2][kCount];
+static uint8_t hours[2][kCount];
+static uint8_t weekdays[2][kCount];
+static int16_t offsets[2][kCount];
+
+static DateFieldColumns columns_for(size_t set) {
+	DateFieldColumns columns{};
+	columns.year = years[set];
+	columns.hour = hours[set];
+	columns.weekday = weekdays[set];
+	columns.offsetMinutes = offsets[set];
+	return columns;
+}
+
+static void assert_same_columns() {
+	TEST_ASSERT_EQUAL(0, memcmp(years[0], years[1], sizeof(years[0])));
+	TEST_ASSERT_EQUAL(0, memcmp(hours[0], hours[1], sizeof(hours[0])));
+	TEST_ASSERT_EQUAL(0, memcmp(weekdays[0], weekdays[1], sizeof(weekdays[0])));
+	TEST_ASSERT_EQUAL(0, memcmp(offsets[0], offsets[1], sizeof(offsets[0])));
+}
+
+static void test_parallel_for_covers_every_index_once() {
+	static std::atomic<uint8_t> hits[kCount];
+	const size_t counts[] = {0, 1, 7, 255, 256, 1000, kCount};
+	for (size_t threads = 1; threads <= kMaxTestThreads; ++threads) {
+		PoolExecutor executor(threads);
+		TEST_ASSERT_EQUAL(threads, executor.concurrency());
+		for (size_t count : counts) {
+			for (size_t i = 0; i < kCount; ++i) {
+				hits[i].store(0);
+			}
+			std::atomic<size_t> shortChunks{0};
+			executor.parallelFor(count, 64, [&](size_t begin, size_t end) {
+				if (end - begin < 64 && end != count) {
+					shortChunks.fetch_add(1);
+				}
+				for (size_t i = begin; i < end; ++i) {
+					hits[i].fetch_add(1);
+				}
+			});
+			TEST_ASSERT_EQUAL(0, shortChunks.load());
+			for (size_t i = 0; i < kCount; ++i) {
+				TEST_ASSERT_EQUAL(i < count ? 1 : 0, hits[i].load());
+			}
+		}
+	}
+
+	ESPDateSerialExecutor serial;
+	size_t calls = 0;
+	serial.parallelFor(kCount, 1, [&](size_t begin, size_t end) {
+		TEST_ASSERT_EQUAL(0, begin);
+		TEST_ASSERT_EQUAL(kCount, end);
+		++calls;
+	});
+	TEST_ASSERT_EQUAL(1, calls);
+}
+
+static void test_parallel_batches_match_serial() {
+	const char *tz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+	srand(5);
+	for (size_t i = 0; i < kCount; ++i) {
+		// Half sorted (sensor log), half scattered over decades, including pre-1970.
+		const int64_t scattered = static_cast<int64_t>(rand() % 2000000000) - 300000000;
+		stamps[i] = DateTime{i < kCount / 2 ? 1740000000 + static_cast<int64_t>(i) * 900
+		                                    : scattered};
+	}
+
+	DateFieldColumns serialColumns = columns_for(0);
+	TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, serialColumns, tz));
+	TEST_ASSERT_EQUAL(kCount, date.startOfDayLocalBatch(stamps, kCount, expectedStarts, tz));
+
+	for (size_t threads = 1; threads <= kMaxTestThreads; ++threads) {
+		PoolExecutor executor(threads);
+		DateFieldColumns parallel = columns_for(1);
+		memset(years[1], 0, sizeof(years[1]));
+		TEST_ASSERT_EQUAL(kCount, date.toLocalBatch(stamps, kCount, parallel, tz, &executor));
+		assert_same_columns();
+
+		TEST_ASSERT_EQUAL(
+		    kCount,
+		    date.startOfDayLocalBatch(stamps, kCount, starts, tz, &executor)
+		);
+		TEST_ASSERT_EQUAL(0, memcmp(starts, expectedStarts, sizeof(starts)));
+	}
+
+	PoolExecutor executor(4);
+	TEST_ASSERT_EQUAL(kCount, date.toCivilUtcBatch(stamps, kCount, serialColumns));
+	DateFieldColumns parallel = columns_for(1);
+	TEST_ASSERT_EQUAL(kCount, date.toCivilUtcBatch(stamps, kCount, parallel, &executor));
+	assert_same_columns();
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_parallel_for_covers_every_index_once);
+	RUN_TEST(test_parallel_batches_match_serial);
+	UNITY_END();
+}
+
+void loop() {
+}
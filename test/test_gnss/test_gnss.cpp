@@ -0,0 +1,242 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstring>
+
+ESPDate date;
+
+static constexpr int64_t kMicros = 1000000;
+static constexpr int64_t kNoonUs = 1743336000LL * kMicros; // 2025-03-30T12:00:00Z
+
+// u-blox M8 output captured at 1 Hz: a cold start without a fix, then one burst per second.
+static const char *const kColdStart = "$GNRMC,,V,,,,,,,,,,N*4D\r\n"
+                                      "$GNGGA,,,,,,0,00,99.99,,,,,,*56\r\n"
+                                      "$GNRMC,235959.00,V,,,,,,,310325,,,N*64\r\n";
+static const char *const kBursts[] = {
+    "$GNRMC,120000.00,A,4729.73521,N,01902.41310,E,0.012,,300325,,,A*6E\r\n"
+    "$GNVTG,,T,,M,0.012,N,0.022,K,A*3E\r\n"
+    "$GNGGA,120000.00,4729.73521,N,01902.41310,E,1,12,0.79,112.4,M,40.5,M,,*4C\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.37,0.79,1.12*11\r\n"
+    "$GPGSV,3,1,11,05,27,073,38,13,33,126,41,15,65,101,44,18,21,318,35*77\r\n"
+    "$GNGLL,4729.73521,N,01902.41310,E,120000.00,A,A*73\r\n"
+    "$GNZDA,120000.00,30,03,2025,00,00*7E\r\n",
+    "$GNRMC,120001.00,A,4729.73521,N,01902.41310,E,0.012,,300325,,,A*6F\r\n"
+    "$GNVTG,,T,,M,0.012,N,0.022,K,A*3E\r\n"
+    "$GNGGA,120001.00,4729.73521,N,01902.41310,E,1,12,0.79,112.4,M,40.5,M,,*4D\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.37,0.79,1.12*11\r\n"
+    "$GPGSV,3,1,11,05,27,073,38,13,33,126,41,15,65,101,44,18,21,318,35*77\r\n"
+    "$GNGLL,4729.73521,N,01902.41310,E,120001.00,A,A*72\r\n"
+    "$GNZDA,120001.00,30,03,2025,00,00*7F\r\n",
+    "$GNRMC,120002.00,A,4729.73521,N,01902.41310,E,0.012,,300325,,,A*6C\r\n"
+    "$GNVTG,,T,,M,0.012,N,0.022,K,A*3E\r\n"
+    "$GNGGA,120002.00,4729.73521,N,01902.41310,E,1,12,0.79,112.4,M,40.5,M,,*4E\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.37,0.79,1.12*11\r\n"
+    "$GPGSV,3,1,11,05,27,073,38,13,33,126,41,15,65,101,44,18,21,318,35*77\r\n"
+    "$GNGLL,4729.73521,N,01902.41310,E,120002.00,A,A*71\r\n"
+    "$GNZDA,120002.00,30,03,2025,00,00*7C\r\n",
+    "$GNRMC,120003.00,A,4729.73521,N,01902.41310,E,0.012,,300325,,,A*6D\r\n"
+    "$GNVTG,,T,,M,0.012,N,0.022,K,A*3E\r\n"
+    "$GNGGA,120003.00,4729.73521,N,01902.41310,E,1,12,0.79,112.4,M,40.5,M,,*4F\r\n"
+    "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.37,0.79,1.12*11\r\n"
+    "$GPGSV,3,1,11,05,27,073,38,13,33,126,41,15,65,101,44,18,21,318,35*77\r\n"
+    "$GNGLL,4729.73521,N,01902.41310,E,120003.00,A,A*70\r\n"
+    "$GNZDA,120003.00,30,03,2025,00,00*7D\r\n",
+};
+static constexpr int kBurstCount = sizeof(kBursts) / sizeof(kBursts[0]);
+
+static void test_parser_reads_rmc_and_zda() {
+	ESPDateNmeaParser bytewise;
+	ESPDateNmeaParser chunked;
+	int64_t seen[2 * kBurstCount] = {};
+	int count = 0;
+	for (const char *c = kColdStart; *c; ++c) {
+		TEST_ASSERT_FALSE(bytewise.feed(*c));
+	}
+	TEST_ASSERT_EQUAL(0, chunked.feed(kColdStart, strlen(kColdStart)));
+	for (const char *burst : kBursts) {
+		for (const char *c = burst; *c; ++c) {
+			if (bytewise.feed(*c)) {
+				seen[count++] = bytewise.time().epochUs;
+			}
+		}
+		TEST_ASSERT_EQUAL(2, chunked.feed(burst, strlen(burst)));
+		TEST_ASSERT_TRUE(chunked.time().sentence == ESPDateNmeaSentence::Zda);
+		TEST_ASSERT_EQUAL(bytewise.time().epochUs, chunked.time().epochUs);
+	}
+	TEST_ASSERT_EQUAL(2 * kBurstCount, count);
+	for (int i = 0; i < count; ++i) {
+		TEST_ASSERT_EQUAL(kNoonUs + i / 2 * kMicros, seen[i]);
+	}
+
+	const ESPDateNmeaStats &stats = bytewise.stats();
+	TEST_ASSERT_EQUAL(2 * kBurstCount, stats.timeSentences);
+	TEST_ASSERT_EQUAL(2, stats.invalidFixes);
+	TEST_ASSERT_EQUAL(1 + 5 * kBurstCount, stats.ignored);
+	TEST_ASSERT_EQUAL(0, stats.checksumErrors);
+	TEST_ASSERT_EQUAL(0, stats.malformed);
+
+	// Fractional seconds, the two-digit year window and a leap second.
+	ESPDateNmeaParser parser;
+	const char *const fraction = "$GPRMC,000000.50,A,,,,,,,010199,,,A*60\r\n";
+	TEST_ASSERT_EQUAL(1, parser.feed(fraction, strlen(fraction)));
+	TEST_ASSERT_EQUAL(915148800LL * kMicros + 500000, parser.time().epochUs);
+	const char *const leap = "$GPZDA,235960.00,31,12,2016,00,00*69\r\n";
+	TEST_ASSERT_EQUAL(1, parser.feed(leap, strlen(leap)));
+	TEST_ASSERT_EQUAL(1483228800LL * kMicros, parser.time().epochUs);
+}
+
+static void test_parser_rejects_damaged_sentences() {
+	ESPDateNmeaParser parser;
+	const char *const badChecksum = "$GNZDA,120000.00,30,03,2025,00,00*7F\r\n";
+	const char *const noChecksum = "$GNZDA,120000.00,30,03,2025,00,00\r\n";
+	const char *const badDate = "$GPRMC,120000.00,A,,,,,,,300225,,,A*60\r\n"; // 30 Feb
+	const char *const cutOff = "$GNZDA,120000.00,30,0$GNZDA,120001.00,30,03,2025,00,00*7F\r\n";
+	const char *const lowercase = "$GNZDA,120003.00,30,03,2025,00,00*7d\r\n";
+	char overlong[128];
+	strcpy(overlong, "$GNZDA,120000.00,30,03,2025,00,00");
+	while (strlen(overlong) < 100) {
+		strcat(overlong, ",0");
+	}
+	strcat(overlong, "*00\r\n");
+
+	TEST_ASSERT_EQUAL(0, parser.feed(badChecksum, strlen(badChecksum)));
+	TEST_ASSERT_EQUAL(0, parser.feed(noChecksum, strlen(noChecksum)));
+	TEST_ASSERT_EQUAL(0, parser.feed(badDate, strlen(badDate)));
+	TEST_ASSERT_EQUAL(0, parser.feed(overlong, strlen(overlong)));
+	TEST_ASSERT_EQUAL(2, parser.stats().checksumErrors);
+	TEST_ASSERT_EQUAL(2, parser.stats().malformed);
+
+	TEST_ASSERT_EQUAL(1, parser.feed(cutOff, strlen(cutOff)));
+	TEST_ASSERT_EQUAL(kNoonUs + kMicros, parser.time().epochUs);
+	TEST_ASSERT_EQUAL(3, parser.stats().malformed);
+	TEST_ASSERT_EQUAL(1, parser.feed(lowercase, strlen(lowercase)));
+	TEST_ASSERT_EQUAL(kNoonUs + 3 * kMicros, parser.time().epochUs);
+
+	parser.reset();
+	TEST_ASSERT_EQUAL(0, parser.stats().bytes);
+}
+
+// Replays the bursts against synthetic PPS edges: edge k at base + k s (with jitter), the
+// burst completing 120..380 ms later.
+static void test_pps_alignment_replay() {
+	const int64_t base = 50 * kMicros;
+	const int64_t jitterUs[] = {3, -2, 5, 0};
+	const int64_t delayUs[] = {120000, 380000, 250000, 200000};
+
+	ESPDateGnssClock gnss;
+	gnss.feed(kColdStart, strlen(kColdStart), base - 500000);
+	TEST_ASSERT_FALSE(gnss.hasSample());
+	for (int k = 0; k < kBurstCount; ++k) {
+		const int64_t edgeUs = base + k * kMicros + jitterUs[k];
+		gnss.onPps(edgeUs);
+		TEST_ASSERT_TRUE(gnss.feed(kBursts[k], strlen(kBursts[k]), edgeUs + delayUs[k]));
+		const ESPDateGnssSample &sample = gnss.sample();
+		TEST_ASSERT_TRUE(sample.ppsAligned);
+		TEST_ASSERT_EQUAL(kNoonUs + k * kMicros, sample.epochUs);
+		TEST_ASSERT_EQUAL(edgeUs, sample.monotonicUs);
+		TEST_ASSERT_EQUAL(100, sample.errorBoundUs);
+	}
+	ESPDateGnssStats stats = gnss.stats();
+	TEST_ASSERT_EQUAL(kBurstCount, stats.samples);
+	TEST_ASSERT_EQUAL(kBurstCount, stats.ppsAligned);
+	TEST_ASSERT_EQUAL(kBurstCount, stats.ppsEdges);
+
+	// A missed edge: the burst still gives a sample, stamped at reception and not aligned.
+	gnss.reset();
+	gnss.onPps(base);
+	gnss.feed(kBursts[0], strlen(kBursts[0]), base + 200000);
+	TEST_ASSERT_TRUE(gnss.feed(kBursts[1], strlen(kBursts[1]), base + kMicros + 200000));
+	TEST_ASSERT_FALSE(gnss.sample().ppsAligned);
+	TEST_ASSERT_EQUAL(base + kMicros + 200000, gnss.sample().monotonicUs);
+	TEST_ASSERT_EQUAL(1000000, gnss.sample().errorBoundUs);
+
+	// A burst delayed past the next edge would pin second 2 to edge 3; the spacing check
+	// catches it.
+	gnss.onPps(base + 3 * kMicros);
+	TEST_ASSERT_TRUE(gnss.feed(kBursts[2], strlen(kBursts[2]), base + 3 * kMicros + 10000));
+	TEST_ASSERT_FALSE(gnss.sample().ppsAligned);
+	TEST_ASSERT_EQUAL(1, gnss.stats().ppsMismatches);
+	TEST_ASSERT_TRUE(gnss.feed(kBursts[3], strlen(kBursts[3]), base + 3 * kMicros + 300000));
+	TEST_ASSERT_TRUE(gnss.sample().ppsAligned);
+	TEST_ASSERT_EQUAL(base + 3 * kMicros, gnss.sample().monotonicUs);
+
+	// requirePps drops what cannot be aligned.
+	ESPDateGnssConfig strict;
+	strict.requirePps = true;
+	ESPDateGnssClock strictClock(strict);
+	TEST_ASSERT_FALSE(strictClock.feed(kBursts[0], strlen(kBursts[0]), base));
+	TEST_ASSERT_FALSE(strictClock.hasSample());
+	TEST_ASSERT_EQUAL(1, strictClock.stats().unaligned);
+}
+
+static void test_samples_feed_the_sync_path() {
+	ESPDateSimulatedTimeSource clock(0);
+	clock.advanceSeconds(100);
+	date.setTimeSource(&clock);
+
+	DateTime heard{};
+	int calls = 0;
+	date.addNtpSyncListener([&](const DateTime &syncedAt) {
+		heard = syncedAt;
+		++calls;
+	});
+
+	ESPDateGnssClock gnss;
+	const int64_t edgeUs = clock.monotonicMicros();
+	gnss.onPps(edgeUs);
+	clock.advanceMicros(250000);
+	TEST_ASSERT_TRUE(gnss.feed(kBursts[0], strlen(kBursts[0]), clock.monotonicMicros()));
+	clock.advanceMicros(1500000); // the application gets to it 1.5 s later
+	TEST_ASSERT_TRUE(date.syncFromReference(gnss.sample(), false));
+
+	TEST_ASSERT_EQUAL(1, calls);
+	TEST_ASSERT_EQUAL(kNoonUs / kMicros + 1, heard.epochSeconds);
+	TEST_ASSERT_TRUE(date.hasLastNtpSync());
+	TEST_ASSERT_EQUAL(1, date.timeSyncStats().syncCount);
+	TEST_ASSERT_EQUAL(kNoonUs + 1750000, date.disciplinedNowUs());
+
+	TEST_ASSERT_FALSE(date.syncFromReference(kNoonUs, clock.monotonicMicros() + 1, false));
+	TEST_ASSERT_EQUAL(1, calls);
+	date.setTimeSource(nullptr);
+}
+
+static void test_gnss_clock_as_time_source() {
+	ESPDateGnssClock gnss;
+	const ESPDateSystemTimeSource &system = ESPDateSystemTimeSource::instance();
+	TEST_ASSERT_TRUE(gnss.epochMicros() - system.epochMicros() < kMicros);
+
+	const int64_t edgeUs = system.monotonicMicros();
+	gnss.onPps(edgeUs);
+	gnss.feed(kBursts[0], strlen(kBursts[0]), edgeUs);
+	date.setTimeSource(&gnss);
+	const int64_t sinceEdgeUs = date.nowUs().epochMicros - kNoonUs;
+	TEST_ASSERT_TRUE(sinceEdgeUs >= 0 && sinceEdgeUs < kMicros);
+	TEST_ASSERT_EQUAL(kNoonUs / kMicros, date.now().epochSeconds);
+	date.setTimeSource(nullptr);
+}
+
+void setUp() {
+	ESPDateConfig config{};
+	config.timeZone = "UTC0";
+	date.init(config);
+}
+
+void tearDown() {
+	date.setTimeSource(nullptr);
+	date.deinit();
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_parser_reads_rmc_and_zda);
+	RUN_TEST(test_parser_rejects_damaged_sentences);
+	RUN_TEST(test_pps_alignment_replay);
+	RUN_TEST(test_samples_feed_the_sync_path);
+	RUN_TEST(test_gnss_clock_as_time_source);
+	UNITY_END();
+}
+
+void loop() {
+}
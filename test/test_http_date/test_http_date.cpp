@@ -0,0 +1,224 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstring>
+
+ESPDate date;
+
+static const int64_t kRfcExample = 784111777; // Sun, 06 Nov 1994 08:49:37 GMT
+
+static void test_http_date_matches_strftime() {
+	char fast[ESPDate::kHttpDateLength + 1];
+	char slow[64];
+	TEST_ASSERT_TRUE(date.formatHttpDate(DateTime{kRfcExample}, fast, sizeof(fast)));
+	TEST_ASSERT_EQUAL_STRING("Sun, 06 Nov 1994 08:49:37 GMT", fast);
+	TEST_ASSERT_EQUAL_STRING(
+	    "Sun, 06 Nov 1994 08:49:37 GMT", date.formatHttpDate(DateTime{kRfcExample}).c_str()
+	);
+
+	// Every weekday, month and leap day from 1900 to 2200, at varying times of day.
+	const int64_t from = date.fromUtc(1900, 1, 1, 0, 0, 0).epochSeconds;
+	const int64_t to = date.fromUtc(2200, 1, 1, 0, 0, 0).epochSeconds;
+	for (int64_t seconds = from; seconds < to; seconds += 86400 * 3 + 3607) {
+		const DateTime dt{seconds};
+		TEST_ASSERT_TRUE(date.formatHttpDate(dt, fast, sizeof(fast)));
+		TEST_ASSERT_TRUE(
+		    date.formatWithPatternUtc(dt, "%a, %d %b %Y %H:%M:%S GMT", slow, sizeof(slow))
+		);
+		TEST_ASSERT_EQUAL_STRING(slow, fast);
+		TEST_ASSERT_EQUAL(ESPDate::kHttpDateLength, std::strlen(fast));
+		const ESPDate::ParseResult parsed = date.parseHttpDate(fast);
+		TEST_ASSERT_TRUE(parsed.ok);
+		TEST_ASSERT_EQUAL_INT64(seconds, parsed.value.epochSeconds);
+	}
+
+	// The buffer must hold the terminator; years must fit four digits.
+	TEST_ASSERT_FALSE(date.formatHttpDate(DateTime{kRfcExample}, fast, ESPDate::kHttpDateLength));
+	TEST_ASSERT_FALSE(date.formatHttpDate(DateTime{kRfcExample}, nullptr, sizeof(fast)));
+	TEST_ASSERT_TRUE(date.formatHttpDate(DateTime{253402300799LL}, fast, sizeof(fast)));
+	TEST_ASSERT_EQUAL_STRING("Fri, 31 Dec 9999 23:59:59 GMT", fast);
+	TEST_ASSERT_FALSE(date.formatHttpDate(DateTime{253402300800LL}, fast, sizeof(fast)));
+	TEST_ASSERT_TRUE(date.formatHttpDate(DateTime{-62135596800LL}, fast, sizeof(fast)));
+	TEST_ASSERT_EQUAL_STRING("Mon, 01 Jan 0001 00:00:00 GMT", fast);
+	TEST_ASSERT_TRUE(date.formatHttpDate(DateTime{}).size() == ESPDate::kHttpDateLength);
+}
+
+static void test_http_date_parses_all_three_forms() {
+	const char *forms[] = {
+	    "Sun, 06 Nov 1994 08:49:37 GMT",  // IMF-fixdate
+	    "Sunday, 06-Nov-94 08:49:37 GMT", // obsolete RFC 850
+	    "Sun Nov  6 08:49:37 1994",       // ANSI C asctime()
+	};
+	for (const char *form : forms) {
+		const ESPDate::ParseResult parsed = date.parseHttpDate(form);
+		TEST_ASSERT_TRUE_MESSAGE(parsed.ok, form);
+		TEST_ASSERT_EQUAL_INT64(kRfcExample, parsed.value.epochSeconds);
+	}
+	TEST_ASSERT_EQUAL_INT64(
+	    date.fromUtc(2025, 12, 16, 7, 5, 9).epochSeconds,
+	    date.parseHttpDate("Tue Dec 16 07:05:09 2025").value.epochSeconds
+	);
+	TEST_ASSERT_TRUE(date.parseHttpDate("Wednesday, 31-Dec-25 23:59:59 GMT").ok);
+
+	const char *invalid[] = {
+	    "",
+	    "sun, 06 Nov 1994 08:49:37 GMT",  // names are case-sensitive
+	    "Sun, 06 nov 1994 08:49:37 GMT",
+	    "Sun, 6 Nov 1994 08:49:37 GMT",   // IMF-fixdate has a two-digit day
+	    "Sun, 06 Nov 1994 08:49:37 UTC",
+	    "Sun, 06 Nov 1994 08:49:37 GMT ", // trailing text
+	    "Sun, 06 Nov 1994 24:00:00 GMT",
+	    "Sun, 31 Nov 1994 08:49:37 GMT",
+	    "Wed, 29 Feb 2023 08:49:37 GMT",
+	    "Sun, 06 Nov 94 08:49:37 GMT",
+	    "Sun, 06-Nov-94 08:49:37 GMT",    // RFC 850 needs the full weekday
+	    "Sundai, 06-Nov-94 08:49:37 GMT",
+	    "Sun Nov 06 08:49:37 1994 GMT",
+	    "Xyz, 06 Nov 1994 08:49:37 GMT",
+	    "1994-11-06T08:49:37Z",
+	};
+	for (const char *text : invalid) {
+		TEST_ASSERT_FALSE_MESSAGE(date.parseHttpDate(text).ok, text);
+	}
+	TEST_ASSERT_FALSE(date.parseHttpDate(nullptr).ok);
+
+	// Every truncation of every form fails without reading past the terminator.
+	char truncated[40];
+	for (const char *form : forms) {
+		for (size_t length = 0; length < std::strlen(form); ++length) {
+			std::memcpy(truncated, form, length);
+			truncated[length] = '\0';
+			TEST_ASSERT_FALSE_MESSAGE(date.parseHttpDate(truncated).ok, truncated);
+			TEST_ASSERT_FALSE_MESSAGE(date.parseRfc2822(truncated).ok, truncated);
+		}
+	}
+}
+
+static void test_rfc850_years_follow_the_clock() {
+	ESPDateSimulatedTimeSource clock(1792281600LL * 1000000); // 2026-10-18
+	date.setTimeSource(&clock);
+	// 2076 is the latest year the two digits may reach; later ones are last century.
+	TEST_ASSERT_EQUAL_INT64(
+	    kRfcExample, date.parseHttpDate("Sunday, 06-Nov-94 08:49:37 GMT").value.epochSeconds
+	);
+	TEST_ASSERT_EQUAL_INT64(
+	    342348577, date.parseHttpDate("Thursday, 06-Nov-80 08:49:37 GMT").value.epochSeconds
+	);
+	TEST_ASSERT_EQUAL_INT64(
+	    3340255777LL, date.parseHttpDate("Wednesday, 06-Nov-75 08:49:37 GMT").value.epochSeconds
+	);
+
+	// Near the end of a century the window reaches into the next one.
+	clock.setEpochMicros(date.fromUtc(2090, 1, 1, 0, 0, 0).epochSeconds * 1000000);
+	TEST_ASSERT_EQUAL_INT64(
+	    date.fromUtc(2110, 1, 1, 0, 0, 0).epochSeconds,
+	    date.parseHttpDate("Wednesday, 01-Jan-10 00:00:00 GMT").value.epochSeconds
+	);
+	date.setTimeSource(nullptr);
+}
+
+static void test_rfc2822_format() {
+	char text[ESPDate::kRfc2822Length + 1];
+	TEST_ASSERT_TRUE(date.formatRfc2822Utc(DateTime{kRfcExample}, text, sizeof(text)));
+	TEST_ASSERT_EQUAL_STRING("Sun, 06 Nov 1994 08:49:37 +0000", text);
+	TEST_ASSERT_FALSE(date.formatRfc2822Utc(DateTime{kRfcExample}, text, ESPDate::kRfc2822Length));
+
+	const DateTime summer{1751371200}; // 2025-07-01T12:00:00Z
+	ESPDateConfig config{};
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+	TEST_ASSERT_EQUAL_STRING(
+	    "Tue, 01 Jul 2025 14:00:00 +0200", date.formatRfc2822Local(summer).c_str()
+	);
+	TEST_ASSERT_EQUAL_STRING(
+	    "Sat, 01 Nov 2025 01:00:00 +0100",
+	    date.formatRfc2822Local(date.fromUtc(2025, 11, 1, 0, 0, 0)).c_str()
+	);
+	config.timeZone = "NST3:30NDT,M3.2.0,M11.1.0"; // St. John's, -02:30 in summer
+	date.init(config);
+	TEST_ASSERT_EQUAL_STRING(
+	    "Tue, 01 Jul 2025 09:30:00 -0230", date.formatRfc2822Local(summer).c_str()
+	);
+	// Local midnight crossing: the weekday and date are local ones.
+	TEST_ASSERT_EQUAL_STRING(
+	    "Mon, 30 Jun 2025 23:30:00 -0230",
+	    date.formatRfc2822Local(DateTime{summer.epochSeconds - 10 * 3600}).c_str()
+	);
+	date.deinit();
+}
+
+static void test_rfc2822_parse() {
+	struct Case {
+		const char *text;
+		int64_t epochSeconds;
+	} cases[] = {
+	    {"Fri, 21 Nov 1997 09:55:06 -0600", 880127706},
+	    {"21 Nov 1997 15:55:06 +0000", 880127706},
+	    {"fri, 21 nov 1997 09:55:06 cst", 880127706},
+	    {"Fri, 21 Nov 97 15:55:06 GMT", 880127706},
+	    {"Fri , 21  Nov\t1997 16:55:06 +0100 ", 880127706},
+	    {"21 Nov 1997 15:55 UT", 880127706 - 6},
+	    {"Thu, 13 Feb 1969 23:32:54 -0330", -27723426},
+	    {"1 Jan 2000 00:00:00 Z", 946684800},
+	    {"1 Jan 49 00:00:00 -0000", 2493072000LL},
+	    {"Sun, 06 Nov 1994 08:49:37 UTC", kRfcExample},
+	};
+	for (const Case &c : cases) {
+		const ESPDate::ParseResult parsed = date.parseRfc2822(c.text);
+		TEST_ASSERT_TRUE_MESSAGE(parsed.ok, c.text);
+		TEST_ASSERT_EQUAL_INT64_MESSAGE(c.epochSeconds, parsed.value.epochSeconds, c.text);
+	}
+
+	const char *invalid[] = {
+	    "Fri 21 Nov 1997 09:55:06 -0600", // weekday without comma
+	    "Fri, 21 Nov 1997 09:55:06",      // no zone
+	    "Fri, 21 Nov 1997 09:55:06 -060",
+	    "Fri, 21 Nov 1997 09:55:06 CET",
+	    "Fri, 21 Nov 1997 09:55:06 +0000 (UTC)",
+	    "Fri, 121 Nov 1997 09:55:06 +0000",
+	    "Fri, 21 Nov 7 09:55:06 +0000",
+	    "Fri, 21 Nov 19970 09:55:06 +0000",
+	    "Fri, 31 Apr 1997 09:55:06 +0000",
+	    "Fri, 21 Nov 1997 9:55:06 +0000",
+	    "Fri, 21Nov 1997 09:55:06 +0000",
+	};
+	for (const char *text : invalid) {
+		TEST_ASSERT_FALSE_MESSAGE(date.parseRfc2822(text).ok, text);
+	}
+
+	// Round trips through the local form.
+	ESPDateConfig config{};
+	config.timeZone = "EST5EDT,M3.2.0,M11.1.0";
+	date.init(config);
+	char text[ESPDate::kRfc2822Length + 1];
+	const int64_t start = 1700000000; // 2023-11-14, so the range covers both DST changes
+	for (int64_t seconds = start; seconds < start + 400LL * 86400; seconds += 86400 + 1234) {
+		TEST_ASSERT_TRUE(date.formatRfc2822Local(DateTime{seconds}, text, sizeof(text)));
+		TEST_ASSERT_EQUAL_INT64(seconds, date.parseRfc2822(text).value.epochSeconds);
+		TEST_ASSERT_TRUE(date.formatHttpDate(DateTime{seconds}, text, sizeof(text)));
+		TEST_ASSERT_EQUAL_INT64(seconds, date.parseRfc2822(text).value.epochSeconds);
+	}
+	date.deinit();
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_http_date_matches_strftime);
+	RUN_TEST(test_http_date_parses_all_three_forms);
+	RUN_TEST(test_rfc850_years_follow_the_clock);
+	RUN_TEST(test_rfc2822_format);
+	RUN_TEST(test_rfc2822_parse);
+	UNITY_END();
+}
+
+void loop() {
+}
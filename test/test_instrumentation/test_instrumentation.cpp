@@ -0,0 +1,151 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstring>
+
+// Build with -DESPDATE_INSTRUMENTATION=1 to exercise the recording path; the default build
+// checks that the API stays usable and inert.
+
+ESPDate date;
+
+static constexpr const char *kBerlin = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+
+static const ESPDateProbeStats &probe(
+    const ESPDateInstrumentationSnapshot &snapshot, ESPDateProbe which
+) {
+	return snapshot.probes[static_cast<size_t>(which)];
+}
+
+static uint32_t counter(const ESPDateInstrumentationSnapshot &snapshot, ESPDateCounter which) {
+	return snapshot.counters[static_cast<size_t>(which)];
+}
+
+static void exercise_hot_paths() {
+	const DateTime dt = date.fromUtc(2025, 7, 1, 12, 0, 0);
+	char buffer[40];
+	date.toLocal(dt, kBerlin);
+	date.toLocal(dt, kBerlin);
+	date.formatUtc(dt, ESPDateFormat::Iso8601, buffer, sizeof(buffer));
+	date.parseIso8601Utc("2025-07-01T12:00:00Z");
+	date.moonPhase(dt);
+	date.sunrise(52.52f, 13.40f, kBerlin, dt);
+}
+
+static void test_snapshot_reflects_build_flag() {
+	ESPDateInstrumentation::reset();
+	exercise_hot_paths();
+	const ESPDateInstrumentationSnapshot snapshot = ESPDateInstrumentation::snapshot();
+#if ESPDATE_INSTRUMENTATION
+	TEST_ASSERT_TRUE(snapshot.enabled);
+	// sunrise() resolves the local date through toLocal too, so nested calls count.
+	TEST_ASSERT_TRUE(probe(snapshot, ESPDateProbe::ToLocal).calls >= 2);
+	TEST_ASSERT_EQUAL_UINT32(1, probe(snapshot, ESPDateProbe::Format).calls);
+	TEST_ASSERT_EQUAL_UINT32(1, probe(snapshot, ESPDateProbe::Parse).calls);
+	TEST_ASSERT_EQUAL_UINT32(1, probe(snapshot, ESPDateProbe::Moon).calls);
+	TEST_ASSERT_EQUAL_UINT32(1, probe(snapshot, ESPDateProbe::Sun).calls);
+	TEST_ASSERT_EQUAL_UINT32(0, probe(snapshot, ESPDateProbe::NtpDispatch).calls);
+	// POSIX zones convert from parsed rules and never touch the process TZ.
+	TEST_ASSERT_EQUAL_UINT32(0, counter(snapshot, ESPDateCounter::ScopedTzSwap));
+
+	for (size_t i = 0; i < static_cast<size_t>(ESPDateProbe::Count); ++i) {
+		const ESPDateProbeStats &stats = snapshot.probes[i];
+		uint32_t bucketed = 0;
+		for (uint32_t bucket : stats.histogram) {
+			bucketed += bucket;
+		}
+		TEST_ASSERT_EQUAL_UINT32(stats.calls, bucketed);
+		TEST_ASSERT_TRUE(stats.maxTicks <= stats.totalTicks);
+	}
+
+	// Only libc knows a zoneinfo name, so each conversion swaps TZ in and back out.
+	const DateTime dt = date.fromUtc(2025, 7, 1, 12, 0, 0);
+	date.toLocal(dt, "Europe/Budapest");
+	date.toLocal(dt, "Europe/Budapest");
+	const ESPDateInstrumentationSnapshot swapped = ESPDateInstrumentation::snapshot();
+	TEST_ASSERT_EQUAL_UINT32(2, counter(swapped, ESPDateCounter::ScopedTzSwap));
+
+	ESPDateInstrumentation::reset();
+	const ESPDateInstrumentationSnapshot cleared = ESPDateInstrumentation::snapshot();
+	TEST_ASSERT_EQUAL_UINT32(0, probe(cleared, ESPDateProbe::ToLocal).calls);
+	TEST_ASSERT_EQUAL_UINT32(0, counter(cleared, ESPDateCounter::ScopedTzSwap));
+#else
+	TEST_ASSERT_FALSE(snapshot.enabled);
+	TEST_ASSERT_EQUAL_STRING("none", snapshot.clock);
+	for (size_t i = 0; i < static_cast<size_t>(ESPDateProbe::Count); ++i) {
+		TEST_ASSERT_EQUAL_UINT32(0, probe(snapshot, static_cast<ESPDateProbe>(i)).calls);
+	}
+	TEST_ASSERT_EQUAL_UINT32(0, counter(snapshot, ESPDateCounter::ScopedTzSwap));
+	TEST_ASSERT_EQUAL_UINT32(0, counter(snapshot, ESPDateCounter::HeapAllocation));
+#endif
+}
+
+static void test_json_dump() {
+	ESPDateInstrumentation::reset();
+	date.toLocal(date.fromUtc(2025, 1, 1), kBerlin);
+	const ESPDateInstrumentationSnapshot snapshot = ESPDateInstrumentation::snapshot();
+
+	static char json[2048];
+	TEST_ASSERT_TRUE(ESPDateInstrumentation::toJson(snapshot, json, sizeof(json)));
+	const size_t length = strlen(json);
+	TEST_ASSERT_TRUE(json[0] == '{');
+	TEST_ASSERT_EQUAL_STRING("}}", json + length - 2);
+	TEST_ASSERT_NOT_NULL(strstr(json, "\"ntpDispatch\":{\"calls\":0,"));
+	TEST_ASSERT_NOT_NULL(strstr(json, "\"heapAllocations\":"));
+#if ESPDATE_INSTRUMENTATION
+	TEST_ASSERT_NOT_NULL(strstr(json, "{\"enabled\":true,"));
+	TEST_ASSERT_NOT_NULL(strstr(json, "\"toLocal\":{\"calls\":1,"));
+#else
+	TEST_ASSERT_NOT_NULL(strstr(json, "{\"enabled\":false,\"clock\":\"none\","));
+#endif
+
+	int depth = 0;
+	for (size_t i = 0; i < length; ++i) {
+		depth += json[i] == '{' || json[i] == '[';
+		depth -= json[i] == '}' || json[i] == ']';
+		TEST_ASSERT_TRUE(depth >= 0);
+	}
+	TEST_ASSERT_EQUAL_INT(0, depth);
+
+	ESPDateInstrumentationSnapshot saturated;
+	saturated.enabled = true;
+	saturated.clock = "cycles";
+	for (ESPDateProbeStats &stats : saturated.probes) {
+		stats.calls = UINT32_MAX;
+		stats.totalTicks = UINT64_MAX;
+		stats.maxTicks = UINT32_MAX;
+		for (uint32_t &bucket : stats.histogram) {
+			bucket = UINT32_MAX;
+		}
+	}
+	for (uint32_t &value : saturated.counters) {
+		value = UINT32_MAX;
+	}
+	static char worst[ESPDateInstrumentation::kMaxJsonSize];
+	TEST_ASSERT_TRUE(ESPDateInstrumentation::toJson(saturated, worst, sizeof(worst)));
+
+	char small[32];
+	TEST_ASSERT_FALSE(ESPDateInstrumentation::toJson(snapshot, small, sizeof(small)));
+	TEST_ASSERT_TRUE(strlen(small) < sizeof(small));
+	TEST_ASSERT_EQUAL_STRING("toLocal", ESPDateInstrumentation::probeName(ESPDateProbe::ToLocal));
+	TEST_ASSERT_EQUAL_STRING(
+	    "scopedTzSwaps",
+	    ESPDateInstrumentation::counterName(ESPDateCounter::ScopedTzSwap)
+	);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_snapshot_reflects_build_flag);
+	RUN_TEST(test_json_dump);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,237 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstring>
+
+#if defined(__has_include)
+#if __has_include(<ArduinoJson.h>)
+#include <ESPDateJson.h>
+#define ESPDATE_TEST_ARDUINOJSON 1
+#endif
+#endif
+
+ESPDate date;
+
+static const int64_t kRfcExample = 784111777; // 1994-11-06T08:49:37Z
+
+static void test_iso_write_matches_strftime() {
+	char fast[ESPDateIso8601Codec::kUtcLength + 1];
+	char slow[64];
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeUtc(DateTime{kRfcExample}, fast, sizeof(fast)));
+	TEST_ASSERT_EQUAL_STRING("1994-11-06T08:49:37Z", fast);
+
+	const int64_t from = date.fromUtc(1900, 1, 1, 0, 0, 0).epochSeconds;
+	const int64_t to = date.fromUtc(2200, 1, 1, 0, 0, 0).epochSeconds;
+	for (int64_t seconds = from; seconds < to; seconds += 86400 * 3 + 3607) {
+		const DateTime dt{seconds};
+		TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeUtc(dt, fast, sizeof(fast)));
+		TEST_ASSERT_TRUE(date.formatWithPatternUtc(dt, "%Y-%m-%dT%H:%M:%SZ", slow, sizeof(slow)));
+		TEST_ASSERT_EQUAL_STRING(slow, fast);
+		DateTime parsed{};
+		int offsetMinutes = -1;
+		TEST_ASSERT_TRUE(ESPDateIso8601Codec::parse(fast, parsed, offsetMinutes));
+		TEST_ASSERT_EQUAL_INT64(seconds, parsed.epochSeconds);
+		TEST_ASSERT_EQUAL_INT(0, offsetMinutes);
+	}
+
+	// The buffer must hold the terminator; years must fit four digits.
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeUtc(
+	    DateTime{kRfcExample}, fast, ESPDateIso8601Codec::kUtcLength
+	));
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeUtc(DateTime{kRfcExample}, nullptr, sizeof(fast)));
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeUtc(DateTime{253402300799LL}, fast, sizeof(fast)));
+	TEST_ASSERT_EQUAL_STRING("9999-12-31T23:59:59Z", fast);
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeUtc(DateTime{253402300800LL}, fast, sizeof(fast)));
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeUtc(DateTime{-62167219201LL}, fast, sizeof(fast)));
+}
+
+static void test_iso_write_local_keeps_offset() {
+	char text[ESPDateIso8601Codec::kLocalLength + 1];
+	LocalDateTime local = ESPDateIso8601Codec::atOffset(DateTime{kRfcExample}, 60);
+	TEST_ASSERT_TRUE(local.ok);
+	TEST_ASSERT_EQUAL_INT(9, local.hour);
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeLocal(local, text, sizeof(text)));
+	TEST_ASSERT_EQUAL_STRING("1994-11-06T09:49:37+0100", text);
+
+	local = ESPDateIso8601Codec::atOffset(DateTime{kRfcExample}, -(9 * 60 + 30));
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeLocal(local, text, sizeof(text)));
+	TEST_ASSERT_EQUAL_STRING("1994-11-05T23:19:37-0930", text);
+
+	LocalDateTime parsed{};
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::parseLocal(text, parsed));
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, parsed.utc.epochSeconds);
+	TEST_ASSERT_EQUAL_INT(-(9 * 60 + 30), parsed.offsetMinutes);
+	TEST_ASSERT_EQUAL_INT(23, parsed.hour);
+	TEST_ASSERT_EQUAL_INT(5, parsed.day);
+
+	// The zone's own breakdown writes the same text.
+	setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+	tzset();
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::writeLocal(
+	    date.toLocal(DateTime{kRfcExample}), text, sizeof(text)
+	));
+	TEST_ASSERT_EQUAL_STRING("1994-11-06T09:49:37+0100", text);
+	setenv("TZ", "UTC0", 1);
+	tzset();
+
+	TEST_ASSERT_FALSE(
+	    ESPDateIso8601Codec::writeLocal(local, text, ESPDateIso8601Codec::kLocalLength)
+	);
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeLocal(LocalDateTime{}, text, sizeof(text)));
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::writeLocal(
+	    ESPDateIso8601Codec::atOffset(DateTime{kRfcExample}, 100 * 60), text, sizeof(text)
+	));
+}
+
+static void test_iso_parse_accepts_common_forms() {
+	struct Case {
+		const char *text;
+		int64_t seconds;
+		int offsetMinutes;
+	};
+	const Case cases[] = {
+	    {"1994-11-06T08:49:37Z", kRfcExample, 0},
+	    {"1994-11-06t08:49:37z", kRfcExample, 0},
+	    {"1994-11-06 08:49:37Z", kRfcExample, 0},
+	    {"1994-11-06T08:49:37.123456Z", kRfcExample, 0},
+	    {"1994-11-06T08:49:37,5Z", kRfcExample, 0},
+	    {"1994-11-06T09:49:37+0100", kRfcExample, 60},
+	    {"1994-11-06T09:49:37+01:00", kRfcExample, 60},
+	    {"1994-11-06T03:19:37-05:30", kRfcExample, -330},
+	    {"1994-11-06T08:49:37.9-00:00", kRfcExample, 0},
+	    {"2024-02-29T00:00:00Z", 1709164800, 0},
+	};
+	for (const Case &c : cases) {
+		DateTime parsed{};
+		int offsetMinutes = 12345;
+		TEST_ASSERT_TRUE_MESSAGE(
+		    ESPDateIso8601Codec::parse(c.text, parsed, offsetMinutes), c.text
+		);
+		TEST_ASSERT_EQUAL_INT64_MESSAGE(c.seconds, parsed.epochSeconds, c.text);
+		TEST_ASSERT_EQUAL_INT_MESSAGE(c.offsetMinutes, offsetMinutes, c.text);
+	}
+
+	const char *rejected[] = {
+	    "",
+	    "1994-11-06",
+	    "1994-11-06T08:49:37",
+	    "1994-11-06T08:49Z",
+	    "1994-11-06X08:49:37Z",
+	    "1994-13-06T08:49:37Z",
+	    "2023-02-29T08:49:37Z",
+	    "1994-11-06T24:00:00Z",
+	    "1994-11-06T08:49:37.Z",
+	    "1994-11-06T08:49:37+1",
+	    "1994-11-06T08:49:37+01:",
+	    "1994-11-06T08:49:37+0160",
+	    "1994-11-06T08:49:37Z ",
+	    "1994-11-06T08:49:37ZZ",
+	};
+	for (const char *text : rejected) {
+		DateTime parsed{kRfcExample};
+		int offsetMinutes = 0;
+		TEST_ASSERT_FALSE_MESSAGE(ESPDateIso8601Codec::parse(text, parsed, offsetMinutes), text);
+		TEST_ASSERT_EQUAL_INT64(kRfcExample, parsed.epochSeconds);
+	}
+	DateTime parsed{};
+	int offsetMinutes = 0;
+	TEST_ASSERT_FALSE(ESPDateIso8601Codec::parse(nullptr, parsed, offsetMinutes));
+
+	// Every prefix of a valid string fails without reading past its terminator.
+	const char full[] = "1994-11-06T09:49:37.25+01:00";
+	char prefix[sizeof(full)];
+	for (size_t length = 0; length + 1 < sizeof(full); ++length) {
+		std::memcpy(prefix, full, length);
+		prefix[length] = '\0';
+		TEST_ASSERT_FALSE_MESSAGE(
+		    ESPDateIso8601Codec::parse(prefix, parsed, offsetMinutes), prefix
+		);
+	}
+	TEST_ASSERT_TRUE(ESPDateIso8601Codec::parse(full, parsed, offsetMinutes));
+}
+
+#ifdef ESPDATE_TEST_ARDUINOJSON
+static void test_json_converters_round_trip() {
+	ESPDateJson::setFormat(ESPDateJsonFormat::Iso8601);
+	JsonDocument doc;
+	doc["at"] = DateTime{kRfcExample};
+	doc["local"] = ESPDateIso8601Codec::atOffset(DateTime{kRfcExample}, 60);
+	TEST_ASSERT_EQUAL_STRING("1994-11-06T08:49:37Z", doc["at"].as<const char *>());
+	TEST_ASSERT_EQUAL_STRING("1994-11-06T09:49:37+0100", doc["local"].as<const char *>());
+
+	TEST_ASSERT_TRUE(doc["at"].is<DateTime>());
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, doc["at"].as<DateTime>().epochSeconds);
+	const LocalDateTime local = doc["local"].as<LocalDateTime>();
+	TEST_ASSERT_TRUE(local.ok);
+	TEST_ASSERT_EQUAL_INT(9, local.hour);
+	TEST_ASSERT_EQUAL_INT(60, local.offsetMinutes);
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, local.utc.epochSeconds);
+
+	doc["bad"] = "yesterday";
+	TEST_ASSERT_FALSE(doc["bad"].is<DateTime>());
+	TEST_ASSERT_FALSE(doc["bad"].as<LocalDateTime>().ok);
+	TEST_ASSERT_FALSE(doc["missing"].is<DateTime>());
+}
+
+static void test_json_epoch_modes() {
+	JsonDocument doc;
+	ESPDateJson::setFormat(ESPDateJsonFormat::EpochSeconds);
+	doc["at"] = DateTime{kRfcExample};
+	doc["local"] = ESPDateIso8601Codec::atOffset(DateTime{kRfcExample}, 60);
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, doc["at"].as<int64_t>());
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, doc["local"].as<int64_t>());
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, doc["at"].as<DateTime>().epochSeconds);
+
+	ESPDateJson::setFormat(ESPDateJsonFormat::EpochMillis);
+	doc["at"] = DateTime{-1};
+	TEST_ASSERT_EQUAL_INT64(-1000, doc["at"].as<int64_t>());
+	TEST_ASSERT_EQUAL_INT64(-1, doc["at"].as<DateTime>().epochSeconds);
+	doc["at"] = -1;
+	TEST_ASSERT_EQUAL_INT64(-1, doc["at"].as<DateTime>().epochSeconds);
+	// doc["local"] holds seconds from before the switch; the converter now reads milliseconds.
+	LocalDateTime local = doc["local"].as<LocalDateTime>();
+	TEST_ASSERT_TRUE(local.ok);
+	TEST_ASSERT_EQUAL_INT64(kRfcExample / 1000, local.utc.epochSeconds);
+	// Naming the unit the document was written with decodes it whatever format() is.
+	TEST_ASSERT_TRUE(ESPDateJson::read(doc["local"], local, ESPDateJsonFormat::EpochSeconds));
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, local.utc.epochSeconds);
+	TEST_ASSERT_EQUAL_INT(0, local.offsetMinutes);
+	TEST_ASSERT_EQUAL_INT(8, local.hour);
+	TEST_ASSERT_EQUAL_INT(49, local.minute);
+	DateTime at{};
+	TEST_ASSERT_TRUE(ESPDateJson::read(doc["at"], at, ESPDateJsonFormat::EpochSeconds));
+	TEST_ASSERT_EQUAL_INT64(-1, at.epochSeconds);
+	doc["at"] = -1500;
+	TEST_ASSERT_TRUE(ESPDateJson::read(doc["at"], at, ESPDateJsonFormat::EpochMillis));
+	TEST_ASSERT_EQUAL_INT64(-2, at.epochSeconds);
+
+	// Text is read in every mode.
+	doc["at"] = "1994-11-06T09:49:37+01:00";
+	TEST_ASSERT_EQUAL_INT64(kRfcExample, doc["at"].as<DateTime>().epochSeconds);
+	ESPDateJson::setFormat(ESPDateJsonFormat::Iso8601);
+}
+#endif
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_iso_write_matches_strftime);
+	RUN_TEST(test_iso_write_local_keeps_offset);
+	RUN_TEST(test_iso_parse_accepts_common_forms);
+#ifdef ESPDATE_TEST_ARDUINOJSON
+	RUN_TEST(test_json_converters_round_trip);
+	RUN_TEST(test_json_epoch_modes);
+#endif
+	UNITY_END();
+}
+
+void loop() {
+}
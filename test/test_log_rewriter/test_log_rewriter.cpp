@@ -0,0 +1,274 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdio>
+#include <cstring>
+
+ESPDate date;
+
+static const char *kBudapestTz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+
+static ESPDateLogRewriter make_rewriter(ESPDateLogStampStyle style, size_t column = 0) {
+	ESPDateLogRewriterConfig config;
+	config.columns[0] = column;
+	config.timeZone = kBudapestTz;
+	config.style = style;
+	ESPDateLogRewriter rewriter;
+	TEST_ASSERT_TRUE(rewriter.begin(config));
+	return rewriter;
+}
+
+static void test_iso_stamps_go_through_the_buffer() {
+	ESPDateLogRewriter rewriter = make_rewriter(ESPDateLogStampStyle::Iso8601);
+	const char *in = "2025-03-30T00:59:59Z boot\n"
+	                 "2025-03-30T01:00:00.250Z spring forward\n"
+	                 "not a stamp at all\n"
+	                 "2025-10-26T00:30:00Z first 02:30\n"
+	                 "2025-10-26T01:30:00Z second 02:30\n";
+	char out[256];
+	const ESPDateLogRewriter::Result result =
+	    rewriter.rewrite(in, strlen(in), out, sizeof(out), true);
+	TEST_ASSERT_EQUAL(strlen(in), result.consumed);
+	out[result.written] = '\0';
+	TEST_ASSERT_EQUAL_STRING(
+	    "2025-03-30T01:59:59+0100 boot\n"
+	    "2025-03-30T03:00:00.250+0200 spring forward\n"
+	    "not a stamp at all\n"
+	    "2025-10-26T02:30:00+0200 first 02:30\n"
+	    "2025-10-26T02:30:00+0100 second 02:30\n",
+	    out
+	);
+	TEST_ASSERT_EQUAL(5, rewriter.stats().lines);
+	TEST_ASSERT_EQUAL(4, rewriter.stats().stamps);
+
+	// The same call in place refuses to grow the first line.
+	char copy[256];
+	strcpy(copy, in);
+	const ESPDateLogRewriter::Result inPlace =
+	    rewriter.rewrite(copy, strlen(copy), copy, strlen(copy), true);
+	TEST_ASSERT_EQUAL(0, inPlace.consumed);
+	TEST_ASSERT_TRUE(inPlace.needsBuffer);
+	TEST_ASSERT_EQUAL_STRING(in, copy);
+}
+
+static void test_same_length_stamps_rewrite_in_place() {
+	ESPDateLogRewriter rewriter = make_rewriter(ESPDateLogStampStyle::DateTime, 6);
+	char text[] = "INFO  2025-07-01 10:00:00 pump on\n"
+	              "WARN  2025-12-31 23:30:00.5 pump off\n"
+	              "INFO  2025-07-01 10:00:00+02:00 already local\n"
+	              "ERR   2025-02-30 10:00:00 bad date\n"
+	              "INFO  2025-07-01 10:00";
+	const size_t partialStart = strlen(text) - strlen("INFO  2025-07-01 10:00");
+	const ESPDateLogRewriter::Result result =
+	    rewriter.rewrite(text, strlen(text), text, strlen(text));
+	TEST_ASSERT_FALSE(result.needsBuffer);
+	TEST_ASSERT_EQUAL(partialStart, result.consumed); // trailing partial line waits for more
+	TEST_ASSERT_EQUAL(result.consumed, result.written);
+	TEST_ASSERT_EQUAL_STRING(
+	    "INFO  2025-07-01 12:00:00 pump on\n"
+	    "WARN  2026-01-01 00:30:00.5 pump off\n"
+	    "INFO  2025-07-01 10:00:00+02:00 already local\n"
+	    "ERR   2025-02-30 10:00:00 bad date\n"
+	    "INFO  2025-07-01 10:00",
+	    text
+	);
+}
+
+static void test_multiple_columns_and_small_output() {
+	ESPDateLogRewriterConfig config;
+	config.columns[0] = 21;
+	config.columns[1] = 0;
+	config.columnCount = 2;
+	config.timeZone = "<+0545>-5:45";
+	ESPDateLogRewriter rewriter;
+	TEST_ASSERT_TRUE(rewriter.begin(config));
+	const char *in = "2025-01-01T00:00:00Z 2025-01-01T12:15:00Z\n"
+	                 "2025-01-02T00:00:00Z 2025-01-02T12:15:00Z\n";
+	char out[128];
+	// Room for the first rewritten line only.
+	ESPDateLogRewriter::Result result = rewriter.rewrite(in, strlen(in), out, 50);
+	TEST_ASSERT_EQUAL(42, result.consumed);
+	TEST_ASSERT_EQUAL(50, result.written);
+	out[result.written] = '\0';
+	TEST_ASSERT_EQUAL_STRING("2025-01-01T05:45:00+0545 2025-01-01T18:00:00+0545\n", out);
+	result = rewriter.rewrite(in + 42, strlen(in) - 42, out, sizeof(out));
+	TEST_ASSERT_EQUAL(42, result.consumed);
+
+	ESPDateLogRewriterConfig invalid;
+	invalid.timeZone = ":Europe/Budapest";
+	TEST_ASSERT_FALSE(rewriter.begin(invalid));
+	TEST_ASSERT_EQUAL(0, rewriter.rewrite(in, strlen(in), out, sizeof(out)).consumed);
+}
+
+#if !defined(ESP_PLATFORM)
+static void test_rewrite_file_matches_in_memory() {
+	const char *inPath = "test_log_rewriter_in.log";
+	const char *outPath = "test_log_rewriter_out.log";
+	FILE *file = fopen(inPath, "wb");
+	TEST_ASSERT_NOT_NULL(file);
+	const DateTime start = date.fromUtc(2025, 3, 29, 0, 0, 0);
+	for (int i = 0; i < 5000; ++i) {
+		const DateTime stamp = date.addSeconds(start, i * 61);
+		char iso[32];
+		TEST_ASSERT_TRUE(stamp.utcString(iso, sizeof(iso), ESPDateFormat::Iso8601));
+		// Every 1000th line is too long for the 4 KB window and passes through untouched.
+		const int padding = i % 1000 == 999 ? 5000 : i % 7;
+		fprintf(file, "%s sensor=%d %.*s\n", iso, i, padding, "xxxxxxx");
+		if (padding == 5000) {
+			for (int j = 0; j < padding; ++j) {
+				fputc('y', file);
+			}
+			fputc('\n', file);
+		}
+	}
+	fputs("2025-04-02T00:00:00Z no trailing newline", file);
+	fclose(file);
+
+	ESPDateLogRewriter rewriter = make_rewriter(ESPDateLogStampStyle::Iso8601);
+	TEST_ASSERT_TRUE(rewriter.rewriteFile(inPath, outPath, 4096));
+
+	// Compare against the libc path around the spring-forward switch (line 1475).
+	setenv("TZ", kBudapestTz, 1);
+	tzset();
+	file = fopen(outPath, "rb");
+	TEST_ASSERT_NOT_NULL(file);
+	int lines = 0;
+	int passedThrough = 0;
+	static char text[8192];
+	while (fgets(text, sizeof(text), file)) {
+		if (text[0] == 'y') {
+			TEST_ASSERT_EQUAL(5001, strlen(text));
+			++passedThrough;
+			continue;
+		}
+		if (lines >= 1470 && lines < 1480) {
+			char expected[32];
+			const DateTime stamp = date.addSeconds(start, lines * 61);
+			TEST_ASSERT_TRUE(stamp.localString(expected, sizeof(expected), ESPDateFormat::Iso8601));
+			text[strlen(expected)] = '\0';
+			TEST_ASSERT_EQUAL_STRING(expected, text);
+		}
+		++lines;
+	}
+	fclose(file);
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	TEST_ASSERT_EQUAL(5001, lines);
+	TEST_ASSERT_EQUAL(5, passedThrough);
+	TEST_ASSERT_EQUAL(5001, rewriter.stats().stamps);
+	remove(inPath);
+	remove(outPath);
+}
+
+// Writes `text` to path and reads the rewritten file back into out; returns its length.
+static size_t rewrite_through_file(
+    ESPDateLogRewriterConfig config, const char *text, size_t chunkBytes, char *out, size_t capacity
+) {
+	const char *inPath = "test_log_rewriter_chunks_in.log";
+	const char *outPath = "test_log_rewriter_chunks_out.log";
+	FILE *file = fopen(inPath, "wb");
+	TEST_ASSERT_NOT_NULL(file);
+	fputs(text, file);
+	fclose(file);
+
+	ESPDateLogRewriter rewriter;
+	TEST_ASSERT_TRUE(rewriter.begin(config));
+	TEST_ASSERT_TRUE(rewriter.rewriteFile(inPath, outPath, chunkBytes));
+
+	file = fopen(outPath, "rb");
+	TEST_ASSERT_NOT_NULL(file);
+	const size_t length = fread(out, 1, capacity, file);
+	fclose(file);
+	remove(inPath);
+	remove(outPath);
+	return length;
+}
+
+static void test_chunked_file_path_matches_mapped() {
+	// Space-separated stamps keep their length in DateTime style and are rewritten in place;
+	// 'T'/'Z' stamps shrink and go through the buffer, so the windows mix both.
+	static char text[32768];
+	size_t length = 0;
+	const DateTime start = date.fromUtc(2025, 3, 30, 0, 0, 0);
+	for (int i = 0; i < 400; ++i) {
+		const DateTime stamp = date.addSeconds(start, i * 37);
+		char iso[32];
+		TEST_ASSERT_TRUE(stamp.utcString(iso, sizeof(iso), ESPDateFormat::Iso8601));
+		if (i % 2 == 1) {
+			iso[10] = ' ';
+			iso[19] = '\0';
+		}
+		if (i == 150) {
+			length += snprintf(text + length, sizeof(text) - length, "continuation only\n");
+		}
+		length += snprintf(
+		    text + length, sizeof(text) - length, "%s n=%d %.*s", iso, i, i % 9, "zzzzzzzz"
+		);
+		if (i == 200) {
+			memset(text + length, 'w', 280);
+			length += 280;
+		}
+		text[length++] = '\n';
+	}
+	length += snprintf(text + length, sizeof(text) - length, "2025-03-30 05:00:00 tail");
+	TEST_ASSERT_LESS_THAN(sizeof(text), length);
+
+	static char whole[32768];
+	ESPDateLogRewriterConfig config;
+	config.timeZone = kBudapestTz;
+	config.style = ESPDateLogStampStyle::DateTime;
+	ESPDateLogRewriter reference;
+	TEST_ASSERT_TRUE(reference.begin(config));
+	const ESPDateLogRewriter::Result result =
+	    reference.rewrite(text, length, whole, sizeof(whole), true);
+	TEST_ASSERT_EQUAL(length, result.consumed);
+	TEST_ASSERT_EQUAL(401, reference.stats().stamps);
+
+	// 7 is shorter than every line, 64 splits most records and passes the 300-byte line
+	// through, 333 holds that line whole.
+	const size_t chunks[] = {1, 7, 64, 100, 333, 4096};
+	static char mapped[32768];
+	static char chunked[32768];
+	for (size_t chunk : chunks) {
+		config.forceChunked = false;
+		const size_t mappedLength =
+		    rewrite_through_file(config, text, chunk, mapped, sizeof(mapped));
+		config.forceChunked = true;
+		const size_t chunkedLength =
+		    rewrite_through_file(config, text, chunk, chunked, sizeof(chunked));
+		TEST_ASSERT_EQUAL(mappedLength, chunkedLength);
+		TEST_ASSERT_EQUAL_MEMORY(mapped, chunked, mappedLength);
+		if (chunk <= 7) {
+			TEST_ASSERT_EQUAL(length, chunkedLength);
+			TEST_ASSERT_EQUAL_MEMORY(text, chunked, length);
+		} else if (chunk >= 333) {
+			TEST_ASSERT_EQUAL(result.written, chunkedLength);
+			TEST_ASSERT_EQUAL_MEMORY(whole, chunked, result.written);
+		}
+	}
+}
+#endif
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_iso_stamps_go_through_the_buffer);
+	RUN_TEST(test_same_length_stamps_rewrite_in_place);
+	RUN_TEST(test_multiple_columns_and_small_output);
+#if !defined(ESP_PLATFORM)
+	RUN_TEST(test_rewrite_file_matches_in_memory);
+	RUN_TEST(test_chunked_file_path_matches_mapped);
+#endif
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,233 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+
+ESPDate date;
+static const char *kBudapestTz = "CET-1CEST,M3.5.0/2,M10.5.0/3";
+
+static DateTime utc(int year, int month, int day, int hour, int minute, int second = 0) {
+	return date.fromUtc(year, month, day, hour, minute, second);
+}
+
+static void assert_next(
+    const ESPDateRecurrence &rule, const DateTime &from, const DateTime &expected, const char *tz
+) {
+	DateTime out{};
+	TEST_ASSERT_TRUE(rule.next(from, out, tz));
+	TEST_ASSERT_EQUAL_INT64(expected.epochSeconds, out.epochSeconds);
+}
+
+static void test_parse_accepts_cron_subset() {
+	const char *valid[] = {
+	    "* * * * *",
+	    "*/15 8-17 * * MON-FRI",
+	    "0 9 * * 5L",
+	    "0 10 * * mon#2",
+	    "0 0 L * *",
+	    "30 0 12 1,15 JAN-jun ?",
+	    "0 0/20 * * * *",
+	    "5 4 * * 7",
+	    "@hourly",
+	    "@yearly",
+	};
+	for (const char *expression : valid) {
+		ESPDateRecurrence rule;
+		TEST_ASSERT_TRUE_MESSAGE(rule.parse(expression), expression);
+		TEST_ASSERT_TRUE(rule.isValid());
+	}
+
+	const char *invalid[] = {
+	    "",
+	    "* * * *",
+	    "* * * * * * *",
+	    "60 * * * *",
+	    "* 24 * * *",
+	    "*/0 * * * *",
+	    "1,,2 * * * *",
+	    "1, * * * *",
+	    "5-1 * * * *",
+	    "0 0 30 2 *",
+	    "0 0 * * MON#6",
+	    "0 0 * FOO *",
+	    "@sometimes",
+	};
+	for (const char *expression : invalid) {
+		ESPDateRecurrence rule(expression);
+		TEST_ASSERT_FALSE_MESSAGE(rule.isValid(), expression);
+		DateTime out{};
+		TEST_ASSERT_FALSE(rule.next(utc(2025, 1, 1, 0, 0), out, "UTC0"));
+	}
+}
+
+static void test_business_hours_interval_skips_nights_and_weekends() {
+	ESPDateRecurrence rule("*/15 8-17 * * MON-FRI");
+	// Friday 2025-06-13 17:50 CEST (15:50 UTC).
+	DateTime from = utc(2025, 6, 13, 15, 50);
+	DateTime out[3];
+	TEST_ASSERT_EQUAL(3, rule.nextN(from, 3, out, kBudapestTz));
+	// Monday 2025-06-16 08:00, 08:15, 08:30 CEST.
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 6, 16, 6, 0).epochSeconds, out[0].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 6, 16, 6, 15).epochSeconds, out[1].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 6, 16, 6, 30).epochSeconds, out[2].epochSeconds);
+
+	// Last slot of the day is 17:45; next() is strictly after `from`.
+	assert_next(rule, utc(2025, 6, 13, 15, 30), utc(2025, 6, 13, 15, 45), kBudapestTz);
+}
+
+static void test_last_and_nth_weekday_of_month() {
+	ESPDateRecurrence lastFriday("0 9 * * FRIL");
+	DateTime out[3];
+	TEST_ASSERT_EQUAL(3, lastFriday.nextN(utc(2025, 1, 1, 0, 0), 3, out, "UTC0"));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 1, 31, 9, 0).epochSeconds, out[0].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 2, 28, 9, 0).epochSeconds, out[1].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 28, 9, 0).epochSeconds, out[2].epochSeconds);
+
+	ESPDateRecurrence secondMonday("0 10 * * 1#2");
+	assert_next(secondMonday, utc(2025, 2, 1, 0, 0), utc(2025, 2, 10, 10, 0), "UTC0");
+
+	ESPDateRecurrence lastDay("0 0 L * *");
+	assert_next(lastDay, utc(2024, 2, 2, 0, 0), utc(2024, 2, 29, 0, 0), "UTC0");
+	assert_next(lastDay, utc(2024, 2, 29, 0, 0), utc(2024, 3, 31, 0, 0), "UTC0");
+
+	// Both day fields restricted: either one matching is enough (Vixie cron).
+	ESPDateRecurrence either("0 0 13 * FRI");
+	assert_next(either, utc(2025, 6, 1, 0, 0), utc(2025, 6, 6, 0, 0), "UTC0");
+	assert_next(either, utc(2025, 6, 10, 0, 0), utc(2025, 6, 13, 0, 0), "UTC0");
+
+	ESPDateRecurrence leapDay("0 0 29 2 *");
+	assert_next(leapDay, utc(2025, 1, 1, 0, 0), utc(2028, 2, 29, 0, 0), "UTC0");
+}
+
+static void test_spring_forward_fires_skipped_time_at_the_jump() {
+	// 2025-03-30: Budapest clocks jump from 02:00 CET to 03:00 CEST (01:00 UTC).
+	ESPDateRecurrence daily("30 2 * * *");
+	DateTime out[3];
+	TEST_ASSERT_EQUAL(3, daily.nextN(utc(2025, 3, 29, 0, 0), 3, out, kBudapestTz));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 29, 1, 30).epochSeconds, out[0].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 30, 1, 0).epochSeconds, out[1].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 31, 0, 30).epochSeconds, out[2].epochSeconds);
+}
+
+static void test_fall_back_fires_fixed_times_once_and_wildcard_hours_twice() {
+	// 2025-10-26: Budapest clocks fall back from 03:00 CEST to 02:00 CET (01:00 UTC).
+	ESPDateRecurrence daily("30 2 * * *");
+	DateTime out[4];
+	TEST_ASSERT_EQUAL(2, daily.nextN(utc(2025, 10, 25, 12, 0), 2, out, kBudapestTz));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 0, 30).epochSeconds, out[0].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 27, 1, 30).epochSeconds, out[1].epochSeconds);
+
+	ESPDateRecurrence halfHourly("*/30 * * * *");
+	TEST_ASSERT_EQUAL(4, halfHourly.nextN(utc(2025, 10, 26, 0, 0), 4, out, kBudapestTz));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 0, 30).epochSeconds, out[0].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 1, 0).epochSeconds, out[1].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 1, 30).epochSeconds, out[2].epochSeconds);
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 2, 0).epochSeconds, out[3].epochSeconds);
+
+	// Per-second rules stay contiguous in UTC across the repeated hour.
+	ESPDateRecurrence everySecond("* * * * * *");
+	const DateTime beforeFallBack = utc(2025, 10, 26, 0, 59, 58);
+	TEST_ASSERT_EQUAL(4, everySecond.nextN(beforeFallBack, 4, out, kBudapestTz));
+	for (int i = 0; i < 4; ++i) {
+		TEST_ASSERT_EQUAL_INT64(beforeFallBack.epochSeconds + 1 + i, out[i].epochSeconds);
+	}
+}
+
+static void test_dst_policy_resolves_skipped_and_repeated_times() {
+	ESPDateRecurrence daily("30 2 * * *");
+	const DateTime beforeSpring = utc(2025, 3, 29, 12, 0);
+	// 02:30 does not exist on 2025-03-30 in Budapest.
+	assert_next(daily, beforeSpring, utc(2025, 3, 30, 1, 0), kBudapestTz);
+	DateTime out{};
+	TEST_ASSERT_TRUE(daily.next(beforeSpring, out, kBudapestTz, ESPDateDstPolicy::Latest));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 30, 1, 0).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(daily.next(beforeSpring, out, kBudapestTz, ESPDateDstPolicy::ShiftForward));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 30, 1, 30).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(daily.next(beforeSpring, out, kBudapestTz, ESPDateDstPolicy::Skip));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 31, 0, 30).epochSeconds, out.epochSeconds);
+
+	// 02:30 happens twice on 2025-10-26: 00:30 UTC (CEST) and 01:30 UTC (CET).
+	const DateTime beforeFall = utc(2025, 10, 25, 12, 0);
+	TEST_ASSERT_TRUE(daily.next(beforeFall, out, kBudapestTz, ESPDateDstPolicy::Latest));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 1, 30).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(daily.next(beforeFall, out, kBudapestTz, ESPDateDstPolicy::Skip));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 0, 30).epochSeconds, out.epochSeconds);
+	TEST_ASSERT_TRUE(daily.next(beforeFall, out, kBudapestTz, ESPDateDstPolicy::ShiftForward));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 10, 26, 0, 30).epochSeconds, out.epochSeconds);
+
+	// Wildcard hours still run the repeated hour twice.
+	ESPDateRecurrence halfHourly("*/30 * * * *");
+	DateTime runs[4];
+	TEST_ASSERT_EQUAL(
+	    4,
+	    halfHourly.nextN(utc(2025, 10, 26, 0, 0), 4, runs, kBudapestTz, ESPDateDstPolicy::Latest)
+	);
+	const int64_t firstRun = utc(2025, 10, 26, 0, 30).epochSeconds;
+	for (int i = 0; i < 4; ++i) {
+		TEST_ASSERT_EQUAL_INT64(firstRun + i * 1800, runs[i].epochSeconds);
+	}
+
+	// ESPDate passes the policy through in the configured TZ.
+	ESPDateConfig cfg{};
+	cfg.timeZone = kBudapestTz;
+	date.init(cfg);
+	TEST_ASSERT_TRUE(date.nextOccurrence(daily, beforeSpring, out, ESPDateDstPolicy::Skip));
+	TEST_ASSERT_EQUAL_INT64(utc(2025, 3, 31, 0, 30).epochSeconds, out.epochSeconds);
+	date.deinit();
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+
+// Reference: scan UTC minutes until the local wall clock reads hour:minute.
+static DateTime brute_force_next_local(const DateTime &from, int hour, int minute) {
+	int64_t t = (from.epochSeconds / 60 + 1) * 60;
+	for (;; t += 60) {
+		LocalDateTime local = date.toLocal(DateTime{t});
+		if (local.hour == hour && local.minute == minute) {
+			return DateTime{t};
+		}
+	}
+}
+
+static void test_daily_rule_matches_brute_force_across_dst() {
+	ESPDateConfig cfg{};
+	cfg.timeZone = kBudapestTz;
+	date.init(cfg);
+
+	ESPDateRecurrence rule("15 7 * * *");
+	DateTime from = utc(2025, 3, 28, 0, 0);
+	for (int step = 0; step < 60; ++step) {
+		const DateTime probe = date.addMinutes(from, step * 97);
+		DateTime viaRule{};
+		TEST_ASSERT_TRUE(date.nextOccurrence(rule, probe, viaRule));
+		const DateTime expected = brute_force_next_local(probe, 7, 15);
+		TEST_ASSERT_EQUAL_INT64(expected.epochSeconds, viaRule.epochSeconds);
+	}
+	date.deinit();
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_parse_accepts_cron_subset);
+	RUN_TEST(test_business_hours_interval_skips_nights_and_weekends);
+	RUN_TEST(test_last_and_nth_weekday_of_month);
+	RUN_TEST(test_spring_forward_fires_skipped_time_at_the_jump);
+	RUN_TEST(test_fall_back_fires_fixed_times_once_and_wildcard_hours_twice);
+	RUN_TEST(test_dst_policy_resolves_skipped_and_repeated_times);
+	RUN_TEST(test_daily_rule_matches_brute_force_across_dst);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,244 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+
+ESPDate date;
+
+static constexpr int64_t kSecondUs = 1000000;
+
+struct FireLog {
+	static constexpr size_t kMax = 512;
+	int64_t due[kMax];
+	int tag[kMax];
+	size_t count = 0;
+
+	void record(int value, const DateTime &when) {
+		if (count < kMax) {
+			tag[count] = value;
+			due[count] = when.epochSeconds;
+			++count;
+		}
+	}
+};
+
+static ESPDateScheduler::Callback logInto(FireLog &log, int tag) {
+	return [&log, tag](ESPDateScheduler::TaskId, const DateTime &due) { log.record(tag, due); };
+}
+
+static void test_fires_in_deadline_order_with_stable_ties() {
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(8));
+	FireLog log;
+	const DateTime base = date.fromUtc(2025, 6, 1, 12, 0, 0);
+
+	scheduler.scheduleAt(date.addSeconds(base, 30), logInto(log, 3));
+	scheduler.scheduleAt(date.addSeconds(base, 10), logInto(log, 1));
+	scheduler.scheduleAt(date.addSeconds(base, 20), logInto(log, 2));
+	scheduler.scheduleAt(date.addSeconds(base, 10), logInto(log, 11));
+	TEST_ASSERT_EQUAL(4, scheduler.size());
+
+	DateTime next{};
+	TEST_ASSERT_TRUE(scheduler.nextDeadline(next));
+	TEST_ASSERT_EQUAL_INT64(base.epochSeconds + 10, next.epochSeconds);
+
+	TEST_ASSERT_EQUAL(0, scheduler.tick(date.addSeconds(base, 9)));
+	TEST_ASSERT_EQUAL(3, scheduler.tick(date.addSeconds(base, 20)));
+	TEST_ASSERT_EQUAL(3, log.count);
+	TEST_ASSERT_EQUAL(1, log.tag[0]);
+	TEST_ASSERT_EQUAL(11, log.tag[1]);
+	TEST_ASSERT_EQUAL(2, log.tag[2]);
+	TEST_ASSERT_EQUAL_INT64(base.epochSeconds + 20, log.due[2]);
+
+	TEST_ASSERT_EQUAL(1, scheduler.tick(date.addSeconds(base, 60)));
+	TEST_ASSERT_EQUAL(3, log.tag[3]);
+	TEST_ASSERT_EQUAL(0, scheduler.size());
+	TEST_ASSERT_FALSE(scheduler.nextDeadline(next));
+}
+
+static void test_hundreds_of_deadlines_from_simulated_clock() {
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(300));
+	FireLog log;
+	const int64_t baseUs = date.fromUtc(2025, 1, 1).epochSeconds * kSecondUs;
+	srand(7);
+	for (int i = 0; i < 300; ++i) {
+		const int64_t offsetSeconds = rand() % 3600;
+		TEST_ASSERT_NOT_EQUAL(
+		    ESPDateScheduler::kInvalidTaskId,
+		    scheduler.scheduleAtUs(baseUs + offsetSeconds * kSecondUs, logInto(log, i))
+		);
+	}
+	TEST_ASSERT_EQUAL(
+	    ESPDateScheduler::kInvalidTaskId,
+	    scheduler.scheduleAtUs(baseUs, logInto(log, -1))
+	);
+
+	// One simulated minute per loop iteration.
+	for (int64_t t = baseUs; t <= baseUs + 3600 * kSecondUs; t += 60 * kSecondUs) {
+		scheduler.tickUs(t);
+	}
+	TEST_ASSERT_EQUAL(300, log.count);
+	for (size_t i = 1; i < log.count; ++i) {
+		TEST_ASSERT_TRUE(log.due[i - 1] <= log.due[i]);
+	}
+	TEST_ASSERT_EQUAL(0, scheduler.size());
+}
+
+static void test_cancel_including_from_callbacks() {
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(4));
+	FireLog log;
+	const int64_t nowUs = 1000 * kSecondUs;
+
+	const ESPDateScheduler::TaskId doomed = scheduler.scheduleAtUs(nowUs + 2, logInto(log, 2));
+	ESPDateScheduler::TaskId periodic = ESPDateScheduler::kInvalidTaskId;
+	int periodicRuns = 0;
+	scheduler.scheduleAtUs(nowUs + 1, [&](ESPDateScheduler::TaskId, const DateTime &) {
+		TEST_ASSERT_TRUE(scheduler.cancel(doomed));
+	});
+	periodic = scheduler.scheduleEvery(
+	    kSecondUs,
+	    nowUs,
+	    [&](ESPDateScheduler::TaskId id, const DateTime &) {
+		    if (++periodicRuns == 3) {
+			    TEST_ASSERT_TRUE(scheduler.cancel(id));
+			    TEST_ASSERT_FALSE(scheduler.cancel(id));
+		    }
+	    }
+	);
+	TEST_ASSERT_NOT_EQUAL(ESPDateScheduler::kInvalidTaskId, periodic);
+
+	for (int64_t t = nowUs; t <= nowUs + 10 * kSecondUs; t += kSecondUs / 2) {
+		scheduler.tickUs(t);
+	}
+	TEST_ASSERT_EQUAL(0, log.count);
+	TEST_ASSERT_EQUAL(3, periodicRuns);
+	TEST_ASSERT_EQUAL(0, scheduler.size());
+	TEST_ASSERT_FALSE(scheduler.cancel(doomed));
+	TEST_ASSERT_FALSE(scheduler.cancel(periodic));
+
+	// Slots are reused, stale ids are not.
+	const ESPDateScheduler::TaskId reused = scheduler.scheduleAtUs(nowUs, logInto(log, 5));
+	TEST_ASSERT_NOT_EQUAL(doomed, reused);
+	TEST_ASSERT_FALSE(scheduler.cancel(doomed));
+	TEST_ASSERT_TRUE(scheduler.cancel(reused));
+}
+
+static void test_recurrence_fires_each_occurrence_and_coalesces_missed_ones() {
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(4));
+	scheduler.setTimeZone("UTC0");
+	ESPDateRecurrence everyQuarter("*/15 * * * *");
+	FireLog log;
+	const DateTime start = date.fromUtc(2025, 6, 1, 10, 0, 0);
+	TEST_ASSERT_NOT_EQUAL(
+	    ESPDateScheduler::kInvalidTaskId,
+	    scheduler.scheduleRecurring(everyQuarter, start, logInto(log, 0))
+	);
+
+	for (int minute = 1; minute <= 60; ++minute) {
+		scheduler.tick(date.addMinutes(start, minute));
+	}
+	TEST_ASSERT_EQUAL(4, log.count);
+	TEST_ASSERT_EQUAL_INT64(date.fromUtc(2025, 6, 1, 10, 15).epochSeconds, log.due[0]);
+	TEST_ASSERT_EQUAL_INT64(date.fromUtc(2025, 6, 1, 11, 0).epochSeconds, log.due[3]);
+
+	// The loop stalls for three hours: the overdue occurrence runs once, then the rule resumes.
+	TEST_ASSERT_EQUAL(1, scheduler.tick(date.fromUtc(2025, 6, 1, 14, 5)));
+	DateTime next{};
+	TEST_ASSERT_TRUE(scheduler.nextDeadline(next));
+	TEST_ASSERT_EQUAL_INT64(date.fromUtc(2025, 6, 1, 14, 15).epochSeconds, next.epochSeconds);
+}
+
+static void test_clock_step_rekeys_relative_deadlines_only() {
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(4));
+	FireLog log;
+	const int64_t nowUs = date.fromUtc(2025, 6, 1, 12, 0, 0).epochSeconds * kSecondUs;
+	scheduler.scheduleAfter(600 * kSecondUs, nowUs, logInto(log, 1));
+	scheduler.scheduleAtUs(nowUs + 600 * kSecondUs, logInto(log, 2));
+
+	// NTP steps the clock forward by one hour: the absolute deadline is overdue, the
+	// "in 10 minutes" timer is still 10 minutes away.
+	scheduler.onClockStep(3600 * kSecondUs);
+	TEST_ASSERT_EQUAL(1, scheduler.tickUs(nowUs + 3600 * kSecondUs));
+	TEST_ASSERT_EQUAL(2, log.tag[0]);
+	TEST_ASSERT_EQUAL(0, scheduler.tickUs(nowUs + 3600 * kSecondUs + 599 * kSecondUs));
+	TEST_ASSERT_EQUAL(1, scheduler.tickUs(nowUs + 4200 * kSecondUs));
+	TEST_ASSERT_EQUAL(1, log.tag[1]);
+}
+
+static void test_esp_date_forwards_ntp_steps_to_attached_scheduler() {
+	ESPDateConfig cfg{};
+	cfg.timeZone = "UTC0";
+	date.init(cfg);
+	ESPDateSimulatedTimeSource clock(0); // boot time: the wall clock still reads 1970
+	date.setTimeSource(&clock);
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(2));
+	date.attachScheduler(&scheduler);
+	FireLog log;
+	scheduler.scheduleAfter(60 * kSecondUs, clock.epochMicros(), logInto(log, 1));
+	clock.advanceSeconds(10);
+
+	// The first sync steps the clock from 1970 to 2025; the timer still has 50 s to go.
+	const int64_t syncedUs = date.fromUtc(2025, 6, 1, 12, 0, 0).epochSeconds * kSecondUs;
+	clock.setEpochMicros(syncedUs);
+	TEST_ASSERT_TRUE(date.syncFromReference(syncedUs, clock.monotonicMicros(), false));
+	int64_t dueUs = 0;
+	TEST_ASSERT_TRUE(scheduler.nextDeadlineUs(dueUs));
+	TEST_ASSERT_EQUAL_INT64(syncedUs + 50 * kSecondUs, dueUs);
+
+	// Syncs that confirm the clock leave the deadline alone, even though the discipline sees
+	// a residual against its prediction.
+	scheduler.clear();
+	scheduler.scheduleAfter(600 * kSecondUs, clock.epochMicros(), logInto(log, 2));
+	const int64_t expectedUs = clock.epochMicros() + 600 * kSecondUs;
+	for (int i = 0; i < 2; ++i) {
+		clock.advanceSeconds(100);
+		TEST_ASSERT_TRUE(date.syncFromReference(
+		    clock.epochMicros() + 10 * 1000, clock.monotonicMicros(), false
+		));
+		TEST_ASSERT_TRUE(scheduler.nextDeadlineUs(dueUs));
+		TEST_ASSERT_EQUAL_INT64(expectedUs, dueUs);
+	}
+
+	// A day-long step moves the deadline with it.
+	clock.setEpochMicros(clock.epochMicros() + 86400 * kSecondUs);
+	TEST_ASSERT_TRUE(date.syncFromReference(clock.epochMicros(), clock.monotonicMicros(), false));
+	TEST_ASSERT_TRUE(scheduler.nextDeadlineUs(dueUs));
+	TEST_ASSERT_EQUAL_INT64(expectedUs + 86400 * kSecondUs, dueUs);
+
+	// deinit() detaches the scheduler.
+	date.deinit();
+	date.setTimeSource(&clock);
+	clock.setEpochMicros(clock.epochMicros() + 86400 * kSecondUs);
+	TEST_ASSERT_TRUE(date.syncFromReference(clock.epochMicros(), clock.monotonicMicros(), false));
+	TEST_ASSERT_TRUE(scheduler.nextDeadlineUs(dueUs));
+	TEST_ASSERT_EQUAL_INT64(expectedUs + 86400 * kSecondUs, dueUs);
+	date.setTimeSource(nullptr);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	setenv("TZ", "UTC0", 1);
+	tzset();
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_fires_in_deadline_order_with_stable_ties);
+	RUN_TEST(test_hundreds_of_deadlines_from_simulated_clock);
+	RUN_TEST(test_cancel_including_from_callbacks);
+	RUN_TEST(test_recurrence_fires_each_occurrence_and_coalesces_missed_ones);
+	RUN_TEST(test_clock_step_rekeys_relative_deadlines_only);
+	RUN_TEST(test_esp_date_forwards_ntp_steps_to_attached_scheduler);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,161 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <time.h>
+
+ESPDate date;
+
+static constexpr int64_t kMicros = 1000000;
+static constexpr int64_t kJune21Noon = 1750507200; // 2025-06-21T12:00:00Z
+
+static void test_simulated_source_drives_now_helpers() {
+	ESPDateSimulatedTimeSource clock(kJune21Noon * kMicros + 250000);
+	date.setTimeSource(&clock);
+
+	TEST_ASSERT_EQUAL(kJune21Noon, date.now().epochSeconds);
+	TEST_ASSERT_EQUAL(kJune21Noon * kMicros + 250000, date.nowUs().epochMicros);
+	TEST_ASSERT_EQUAL(kJune21Noon + 30 * 86400, date.addDays(30).epochSeconds);
+	TEST_ASSERT_EQUAL(12, date.nowLocal().hour);
+	TEST_ASSERT_TRUE(date.isDay());
+
+	clock.advanceDays(182);
+	clock.advanceSeconds(12 * 3600);
+	const DateTime later = date.now();
+	TEST_ASSERT_EQUAL(kJune21Noon + 182 * 86400 + 12 * 3600, later.epochSeconds);
+	TEST_ASSERT_FALSE(date.isDay()); // midnight UTC at 52.5 N
+	TEST_ASSERT_EQUAL(date.moonPhase(later).angleDegrees, date.moonPhase().angleDegrees);
+	TEST_ASSERT_EQUAL(date.sunrise(later).value.epochSeconds, date.sunrise().value.epochSeconds);
+
+	// A step moves the wall clock only; the monotonic side (and the coarse clock's expiry)
+	// keeps counting elapsed time.
+	const int64_t monotonicUs = clock.monotonicMicros();
+	clock.setEpochSeconds(kJune21Noon);
+	TEST_ASSERT_EQUAL(monotonicUs, clock.monotonicMicros());
+	TEST_ASSERT_EQUAL(kJune21Noon, date.now().epochSeconds);
+	clock.advanceMicros(-kMicros);
+	TEST_ASSERT_EQUAL(monotonicUs, clock.monotonicMicros());
+
+	date.setTimeSource(nullptr);
+}
+
+static void test_coarse_clock_follows_the_source() {
+	ESPDateSimulatedTimeSource clock(kJune21Noon * kMicros);
+	date.setTimeSource(&clock);
+	TEST_ASSERT_EQUAL(kJune21Noon, date.nowCoarse().epochSeconds);
+
+	clock.advanceMicros(999999);
+	TEST_ASSERT_EQUAL(kJune21Noon, date.nowCoarse().epochSeconds);
+	clock.advanceMicros(1);
+	TEST_ASSERT_EQUAL(kJune21Noon + 1, date.nowCoarse().epochSeconds);
+	TEST_ASSERT_EQUAL_STRING("2025-06-21 12:00:01", date.nowUtcStringCached().c_str());
+
+	clock.advanceDays(365);
+	TEST_ASSERT_EQUAL(kJune21Noon + 1 + 365 * 86400, date.nowCoarse().epochSeconds);
+
+	clock.setEpochSeconds(kJune21Noon);
+	date.invalidateCoarseClock();
+	TEST_ASSERT_EQUAL(kJune21Noon, date.nowCoarse().epochSeconds);
+
+	// Switching sources drops the cached second as well.
+	date.setTimeSource(nullptr);
+	TEST_ASSERT_TRUE(date.nowCoarse().epochSeconds > kJune21Noon);
+}
+
+static void test_auto_advance_lets_polling_loops_progress() {
+	ESPDateSimulatedTimeSource clock(kJune21Noon * kMicros);
+	clock.setAutoAdvance(kMicros / 4);
+	date.setTimeSource(&clock);
+
+	const DateTime deadline = date.addMinutes(date.now(), 1);
+	int polls = 0;
+	while (date.isBefore(date.now(), deadline)) {
+		++polls;
+	}
+	TEST_ASSERT_EQUAL(238, polls); // every now() moves 250 ms; 59.75 s of polls after the first
+	date.setTimeSource(nullptr);
+}
+
+static void test_a_year_of_scheduling_runs_in_simulated_time() {
+	ESPDateConfig config{};
+	config.latitude = 52.52f;
+	config.longitude = 13.405f;
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+
+	ESPDateSimulatedTimeSource clock(1735689600LL * kMicros); // 2025-01-01T00:00:00Z
+	date.setTimeSource(&clock);
+
+	static ESPDateRecurrence nightly("30 2 * * *");
+	ESPDateScheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.begin(4));
+	scheduler.setTimeZone(config.timeZone);
+	int nightlyRuns = 0;
+	int checks = 0;
+	scheduler.scheduleRecurring(nightly, date.now(), [&](uint32_t, const DateTime &) {
+		++nightlyRuns;
+	});
+	const int64_t startUs = date.nowUs().epochMicros;
+	scheduler.scheduleEvery(15 * 60 * kMicros, startUs, [&](uint32_t, const DateTime &) {
+		++checks;
+	});
+
+	int daylightTicks = 0;
+	for (int minute = 0; minute < 365 * 24 * 60; minute += 5) {
+		clock.advanceSeconds(300);
+		scheduler.tickUs(date.nowUs().epochMicros);
+		daylightTicks += date.isDay() ? 1 : 0;
+	}
+	TEST_ASSERT_EQUAL(2026, date.getYearLocal(date.now()));
+	// Every night, including 2025-03-30 when 02:30 is skipped and the run moves to 03:00.
+	TEST_ASSERT_EQUAL(365, nightlyRuns);
+	TEST_ASSERT_EQUAL(365 * 24 * 4, checks);
+	// About half the year's 5-minute ticks fall in daylight at 52.5 N.
+	TEST_ASSERT_TRUE(daylightTicks > 48000 && daylightTicks < 57000);
+
+	scheduler.end();
+	date.setTimeSource(nullptr);
+}
+
+static void test_system_and_monotonic_sources() {
+	const int64_t systemSeconds = static_cast<int64_t>(time(nullptr));
+	TEST_ASSERT_TRUE(date.now().epochSeconds - systemSeconds <= 1);
+	TEST_ASSERT_TRUE(&date.timeSource() == &ESPDateSystemTimeSource::instance());
+
+	ESPDateMonotonicTimeSource anchored(kJune21Noon * kMicros);
+	date.setTimeSource(&anchored);
+	const int64_t first = date.nowUs().epochMicros;
+	TEST_ASSERT_TRUE(first >= kJune21Noon * kMicros && first < (kJune21Noon + 1) * kMicros);
+	const int64_t second = date.nowUs().epochMicros;
+	TEST_ASSERT_TRUE(second >= first && second - first < kMicros);
+
+	anchored.anchorToSystemClock();
+	TEST_ASSERT_TRUE(date.now().epochSeconds - systemSeconds <= 1);
+	date.setTimeSource(nullptr);
+}
+
+void setUp() {
+	ESPDateConfig config{};
+	config.latitude = 52.52f;
+	config.longitude = 13.405f;
+	config.timeZone = "UTC0";
+	date.init(config);
+}
+
+void tearDown() {
+	date.setTimeSource(nullptr);
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_simulated_source_drives_now_helpers);
+	RUN_TEST(test_coarse_clock_follows_the_source);
+	RUN_TEST(test_auto_advance_lets_polling_loops_progress);
+	RUN_TEST(test_a_year_of_scheduling_runs_in_simulated_time);
+	RUN_TEST(test_system_and_monotonic_sources);
+	UNITY_END();
+}
+
+void loop() {
+}
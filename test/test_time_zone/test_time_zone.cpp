@@ -0,0 +1,193 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdlib>
+#include <ctime>
+
+ESPDate date;
+
+static const char *const kZones[] = {
+    "UTC0",
+    "GMT0BST,M3.5.0/1,M10.5.0",
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "EET-2EEST,M3.5.0/3,M10.5.0/4",
+    "MSK-3",
+    "<+04>-4",
+    "IST-5:30",
+    "<+0545>-5:45",
+    "CST-8",
+    "JST-9",
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "NZST-12NZDT,M9.5.0,M4.1.0/3",
+    "<-03>3",
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+    "EST5EDT,M3.2.0,M11.1.0",
+    "CST6CDT,M3.2.0,M11.1.0",
+    "MST7",
+    "PST8PDT,M3.2.0,M11.1.0",
+    "HST10",
+    "NST3:30NDT,M3.2.0,M11.1.0",
+    "IST-2IDT,M3.4.4/26,M10.5.0",
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+};
+static constexpr size_t kZoneCount = sizeof(kZones) / sizeof(kZones[0]);
+
+static LocalDateTime libcLocal(const DateTime &dt, const char *tz) {
+	setenv("TZ", tz, 1);
+	tzset();
+	time_t raw = static_cast<time_t>(dt.epochSeconds);
+	tm local{};
+	localtime_r(&raw, &local);
+	LocalDateTime result{};
+	result.ok = true;
+	result.year = local.tm_year + 1900;
+	result.month = local.tm_mon + 1;
+	result.day = local.tm_mday;
+	result.hour = local.tm_hour;
+	result.minute = local.tm_min;
+	result.second = local.tm_sec;
+	return result;
+}
+
+static void assert_same_local(const LocalDateTime &expected, const LocalDateTime &actual) {
+	TEST_ASSERT_TRUE(actual.ok);
+	TEST_ASSERT_EQUAL(expected.year, actual.year);
+	TEST_ASSERT_EQUAL(expected.month, actual.month);
+	TEST_ASSERT_EQUAL(expected.day, actual.day);
+	TEST_ASSERT_EQUAL(expected.hour, actual.hour);
+	TEST_ASSERT_EQUAL(expected.minute, actual.minute);
+	TEST_ASSERT_EQUAL(expected.second, actual.second);
+}
+
+static void test_lru_cache_counts_and_evicts() {
+	ESPDateTimeZoneCache cache;
+	TEST_ASSERT_TRUE(cache.configure(3));
+	ESPDatePosixTz rules;
+
+	TEST_ASSERT_TRUE(cache.lookup(kZones[2], rules));
+	TEST_ASSERT_EQUAL_INT32(3600, rules.standardOffsetSeconds());
+	TEST_ASSERT_TRUE(cache.lookup(kZones[2], rules));
+	TEST_ASSERT_TRUE(cache.lookup(kZones[3], rules));
+	TEST_ASSERT_TRUE(cache.lookup(kZones[4], rules));
+	ESPDateTimeZoneCacheStats stats = cache.stats();
+	TEST_ASSERT_EQUAL_UINT32(1, stats.hits);
+	TEST_ASSERT_EQUAL_UINT32(3, stats.misses);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.evictions);
+	TEST_ASSERT_EQUAL(3, stats.entries);
+	TEST_ASSERT_EQUAL(3, stats.capacity);
+
+	TEST_ASSERT_TRUE(cache.lookup(kZones[3], rules)); // [2] is now the least recently used
+	TEST_ASSERT_TRUE(cache.lookup(kZones[5], rules)); // evicts [2]
+	stats = cache.stats();
+	TEST_ASSERT_EQUAL_UINT32(1, stats.evictions);
+	TEST_ASSERT_TRUE(cache.lookup(kZones[3], rules));
+	TEST_ASSERT_TRUE(cache.lookup(kZones[4], rules));
+	TEST_ASSERT_EQUAL_UINT32(stats.hits + 2, cache.stats().hits);
+	TEST_ASSERT_TRUE(cache.lookup(kZones[2], rules));
+	TEST_ASSERT_EQUAL_UINT32(stats.misses + 1, cache.stats().misses);
+
+	// Strings that are not POSIX rules are cached as failures.
+	const uint32_t missesBefore = cache.stats().misses;
+	TEST_ASSERT_FALSE(cache.lookup("Europe/Budapest", rules));
+	TEST_ASSERT_FALSE(rules.isValid());
+	TEST_ASSERT_FALSE(cache.lookup("Europe/Budapest", rules));
+	TEST_ASSERT_EQUAL_UINT32(missesBefore + 1, cache.stats().misses);
+	TEST_ASSERT_FALSE(cache.lookup(nullptr, rules));
+
+	// Over-long names still parse, they just bypass the cache.
+	const char *longName = "<ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ>-1"
+	                       "<ZZZZZZZZZZZZ>,M3.5.0,M10.5.0/3";
+	TEST_ASSERT_TRUE(cache.lookup(longName, rules));
+	TEST_ASSERT_EQUAL_UINT32(1, cache.stats().uncached);
+
+	cache.clear();
+	stats = cache.stats();
+	TEST_ASSERT_EQUAL(0, stats.entries);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.hits);
+	TEST_ASSERT_EQUAL(3, stats.capacity);
+
+	TEST_ASSERT_TRUE(cache.configure(0));
+	TEST_ASSERT_TRUE(cache.lookup(kZones[2], rules));
+	TEST_ASSERT_EQUAL_UINT32(1, cache.stats().uncached);
+	TEST_ASSERT_FALSE(cache.configure(ESPDateTimeZoneCache::kMaxCapacity + 1));
+}
+
+static void test_handles_match_libc_across_zones() {
+	const DateTime start = date.fromUtc(2024, 1, 1, 0, 0, 0);
+	for (size_t z = 0; z < kZoneCount; ++z) {
+		const ESPDateTimeZone zone = ESPDateTimeZone::fromPosix(kZones[z]);
+		TEST_ASSERT_TRUE(zone.isValid());
+		// Every 7h13m over two years hits both sides of each transition many times.
+		for (int64_t step = 0; step < 2 * 365 * 24 * 60; step += 7 * 60 + 13) {
+			const DateTime dt = date.addMinutes(start, step);
+			const LocalDateTime expected = libcLocal(dt, kZones[z]);
+			const LocalDateTime byHandle = date.toLocal(dt, zone);
+			assert_same_local(expected, byHandle);
+			assert_same_local(expected, date.toLocal(dt, kZones[z]));
+			TEST_ASSERT_EQUAL_INT64(dt.epochSeconds, byHandle.utc.epochSeconds);
+			TEST_ASSERT_EQUAL(date.isDstActive(dt, kZones[z]), date.isDstActive(dt, zone));
+		}
+	}
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+
+static void test_handle_overloads() {
+	const ESPDateTimeZone budapest = ESPDateTimeZone::fromPosix("CET-1CEST,M3.5.0,M10.5.0/3");
+	const DateTime summer = date.fromUtc(2025, 6, 21, 12, 0, 0);
+	TEST_ASSERT_TRUE(date.isDstActive(summer, budapest));
+	TEST_ASSERT_FALSE(date.isDstActive(date.fromUtc(2025, 1, 10, 12, 0, 0), budapest));
+	TEST_ASSERT_EQUAL(120, date.toLocal(summer, budapest).offsetMinutes);
+
+	const SunCycleResult byHandle = date.sunrise(47.4979f, 19.0402f, budapest, summer);
+	const SunCycleResult byString =
+	    date.sunrise(47.4979f, 19.0402f, "CET-1CEST,M3.5.0,M10.5.0/3", summer);
+	TEST_ASSERT_TRUE(byHandle.ok);
+	TEST_ASSERT_EQUAL_INT64(byString.value.epochSeconds, byHandle.value.epochSeconds);
+	const LocalDateTime rise = date.toLocal(byHandle.value, budapest);
+	TEST_ASSERT_EQUAL(4, rise.hour); // about 04:46 CEST at the solstice
+	TEST_ASSERT_TRUE(date.sunset(47.4979f, 19.0402f, budapest, summer).ok);
+
+	const ESPDateTimeZone invalid = ESPDateTimeZone::fromPosix("Europe/Budapest");
+	TEST_ASSERT_FALSE(invalid.isValid());
+	TEST_ASSERT_FALSE(date.toLocal(summer, invalid).ok);
+	TEST_ASSERT_FALSE(date.isDstActive(summer, invalid));
+	TEST_ASSERT_FALSE(date.sunrise(47.4979f, 19.0402f, invalid, summer).ok);
+	TEST_ASSERT_FALSE(ESPDateTimeZone{}.isValid());
+}
+
+static void test_string_overloads_hit_the_shared_cache() {
+	ESPDateTimeZoneCache &cache = ESPDateTimeZoneCache::shared();
+	cache.clear();
+	const DateTime dt = date.fromUtc(2025, 3, 30, 0, 30, 0);
+	for (int round = 0; round < 10; ++round) {
+		for (size_t z = 0; z < kZoneCount; ++z) {
+			TEST_ASSERT_TRUE(date.toLocal(dt, kZones[z]).ok);
+		}
+	}
+	const ESPDateTimeZoneCacheStats stats = cache.stats();
+	TEST_ASSERT_EQUAL_UINT32(kZoneCount, stats.misses);
+	TEST_ASSERT_EQUAL_UINT32(9 * kZoneCount, stats.hits);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.evictions);
+	TEST_ASSERT_EQUAL(kZoneCount, stats.entries);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_lru_cache_counts_and_evicts);
+	RUN_TEST(test_handles_match_libc_across_zones);
+	RUN_TEST(test_handle_overloads);
+	RUN_TEST(test_string_overloads_hit_the_shared_cache);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,207 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include "tzdb_test_zones.h"
+
+#include <cstdlib>
+#include <ctime>
+
+ESPDate date;
+
+// Regenerate with: scripts/generate_tzdb.py --output test/test_tzdb/tzdb_test_zones
+//   --name testTzdb <these zones>
+static const char *const kZones[] = {
+    "America/New_York",
+    "America/Sao_Paulo",
+    "America/Santiago",
+    "Europe/Moscow",
+    "Europe/Budapest",
+    "Europe/Dublin",
+    "Australia/Sydney",
+    "Pacific/Apia",
+    "Asia/Kolkata",
+    "Asia/Tehran",
+    "Africa/Casablanca",
+    "Antarctica/Troll",
+};
+
+static void test_perfect_hash_finds_every_zone() {
+	TEST_ASSERT_EQUAL(sizeof(kZones) / sizeof(kZones[0]), testTzdb.zoneCount);
+	for (const char *name : kZones) {
+		const ESPDateTzdbZone zone = ESPDateTzdbZone::find(testTzdb, name);
+		TEST_ASSERT_TRUE_MESSAGE(zone.isValid(), name);
+		TEST_ASSERT_EQUAL_STRING(name, zone.name());
+	}
+	TEST_ASSERT_FALSE(ESPDateTzdbZone::find(testTzdb, "Europe/Paris").isValid());
+	TEST_ASSERT_FALSE(ESPDateTzdbZone::find(testTzdb, "america/new_york").isValid());
+	TEST_ASSERT_FALSE(ESPDateTzdbZone::find(testTzdb, "").isValid());
+	TEST_ASSERT_FALSE(ESPDateTzdbZone::find(testTzdb, nullptr).isValid());
+	TEST_ASSERT_FALSE(ESPDateTimeZone::fromTzdb(testTzdb, "Mars/Olympus").isValid());
+
+	// Trailing transitions the footer reproduces are not stored.
+	const ESPDateTzdbZone newYork = ESPDateTzdbZone::find(testTzdb, "America/New_York");
+	TEST_ASSERT_TRUE(newYork.footer().hasDst());
+	TEST_ASSERT_TRUE(newYork.transitionCount() < 80);
+	TEST_ASSERT_EQUAL(0, ESPDateTzdbZone::find(testTzdb, "Asia/Kolkata").transitionCount());
+}
+
+static void test_history_differs_from_current_rules() {
+	const ESPDateTimeZone newYork = ESPDateTimeZone::fromTzdb(testTzdb, "America/New_York");
+	const ESPDateTimeZone posixNewYork = ESPDateTimeZone::fromPosix("EST5EDT,M3.2.0,M11.1.0");
+	// Before 2007 US DST started on the first Sunday of April.
+	const DateTime march2006 = date.fromUtc(2006, 3, 20, 12, 0, 0);
+	TEST_ASSERT_EQUAL_INT32(-5 * 3600, newYork.utcOffsetAt(march2006.epochSeconds));
+	TEST_ASSERT_EQUAL_INT32(-4 * 3600, posixNewYork.utcOffsetAt(march2006.epochSeconds));
+	TEST_ASSERT_FALSE(date.isDstActive(march2006, newYork));
+	// After the last stored transition the footer takes over.
+	const DateTime july2040 = date.fromUtc(2040, 7, 1, 12, 0, 0);
+	TEST_ASSERT_EQUAL_INT32(-4 * 3600, newYork.utcOffsetAt(july2040.epochSeconds));
+	TEST_ASSERT_TRUE(date.isDstActive(july2040, newYork));
+
+	// Moscow stayed on UTC+4 from 2011 to 2014; "MSK-3" only knows today's UTC+3.
+	const ESPDateTimeZone moscow = ESPDateTimeZone::fromTzdb(testTzdb, "Europe/Moscow");
+	const LocalDateTime summer2012 = date.toLocal(date.fromUtc(2012, 6, 1, 12, 0, 0), moscow);
+	TEST_ASSERT_TRUE(summer2012.ok);
+	TEST_ASSERT_EQUAL(16, summer2012.hour);
+	TEST_ASSERT_EQUAL(240, summer2012.offsetMinutes);
+	TEST_ASSERT_EQUAL(15, date.toLocal(date.fromUtc(2012, 6, 1, 12, 0, 0), "MSK-3").hour);
+	TEST_ASSERT_EQUAL(15, date.toLocal(date.fromUtc(2020, 6, 1, 12, 0, 0), moscow).hour);
+
+	// Brazil dropped DST in 2019.
+	const ESPDateTimeZone saoPaulo = ESPDateTimeZone::fromTzdb(testTzdb, "America/Sao_Paulo");
+	TEST_ASSERT_EQUAL_INT32(
+	    -2 * 3600,
+	    saoPaulo.utcOffsetAt(date.fromUtc(2018, 1, 15, 12, 0, 0).epochSeconds)
+	);
+	TEST_ASSERT_EQUAL_INT32(
+	    -3 * 3600,
+	    saoPaulo.utcOffsetAt(date.fromUtc(2024, 1, 15, 12, 0, 0).epochSeconds)
+	);
+
+	// Zones without stored transitions behave like their POSIX rule.
+	const ESPDateTimeZone kolkata = ESPDateTimeZone::fromTzdb(testTzdb, "Asia/Kolkata");
+	TEST_ASSERT_EQUAL_INT32(19800, kolkata.utcOffsetAt(0));
+	TEST_ASSERT_EQUAL_INT32(19800, kolkata.utcOffsetAt(date.fromUtc(2030, 1, 1).epochSeconds));
+}
+
+static int64_t wall(int year, int month, int day, int hour, int minute) {
+	return date.fromUtc(year, month, day, hour, minute, 0).epochSeconds;
+}
+
+static void test_local_to_utc_over_history() {
+	const ESPDateTzdbZone newYork = ESPDateTzdbZone::find(testTzdb, "America/New_York");
+	ESPDateLocalTimeKind kind = ESPDateLocalTimeKind::Unique;
+	int64_t utc = 0;
+
+	// 2006-04-02 02:30 did not exist in New York (today's rule would put the gap in March).
+	TEST_ASSERT_TRUE(
+	    newYork.localToUtc(wall(2006, 4, 2, 2, 30), ESPDateDstPolicy::ShiftForward, utc, &kind)
+	);
+	TEST_ASSERT_EQUAL(static_cast<int>(ESPDateLocalTimeKind::Skipped), static_cast<int>(kind));
+	TEST_ASSERT_EQUAL(wall(2006, 4, 2, 7, 30), utc);
+	TEST_ASSERT_TRUE(newYork.localToUtc(wall(2006, 4, 2, 2, 30), ESPDateDstPolicy::Earliest, utc));
+	TEST_ASSERT_EQUAL(wall(2006, 4, 2, 7, 0), utc);
+	TEST_ASSERT_FALSE(newYork.localToUtc(wall(2006, 4, 2, 2, 30), ESPDateDstPolicy::Skip, utc));
+	TEST_ASSERT_TRUE(newYork.localToUtc(wall(2006, 3, 12, 2, 30), ESPDateDstPolicy::Skip, utc));
+	TEST_ASSERT_EQUAL(wall(2006, 3, 12, 7, 30), utc);
+
+	// 2006-10-29 01:30 happened twice.
+	TEST_ASSERT_TRUE(
+	    newYork.localToUtc(wall(2006, 10, 29, 1, 30), ESPDateDstPolicy::Earliest, utc, &kind)
+	);
+	TEST_ASSERT_EQUAL(static_cast<int>(ESPDateLocalTimeKind::Repeated), static_cast<int>(kind));
+	TEST_ASSERT_EQUAL(wall(2006, 10, 29, 5, 30), utc);
+	TEST_ASSERT_TRUE(newYork.localToUtc(wall(2006, 10, 29, 1, 30), ESPDateDstPolicy::Latest, utc));
+	TEST_ASSERT_EQUAL(wall(2006, 10, 29, 6, 30), utc);
+
+	// Samoa skipped 2011-12-30 entirely when it moved across the date line.
+	const ESPDateTzdbZone apia = ESPDateTzdbZone::find(testTzdb, "Pacific/Apia");
+	TEST_ASSERT_TRUE(
+	    apia.localToUtc(wall(2011, 12, 30, 12, 0), ESPDateDstPolicy::Earliest, utc, &kind)
+	);
+	TEST_ASSERT_EQUAL(static_cast<int>(ESPDateLocalTimeKind::Skipped), static_cast<int>(kind));
+	TEST_ASSERT_EQUAL(wall(2011, 12, 30, 10, 0), utc);
+	TEST_ASSERT_TRUE(apia.localToUtc(wall(2011, 12, 31, 12, 0), ESPDateDstPolicy::Skip, utc));
+	TEST_ASSERT_EQUAL(wall(2011, 12, 30, 22, 0), utc);
+
+	// Round trip through the ESPDate overloads.
+	const ESPDateTimeZone sydney = ESPDateTimeZone::fromTzdb(testTzdb, "Australia/Sydney");
+	const DateTime instant = date.fromUtc(2001, 1, 10, 3, 4, 5);
+	const LocalDateTime local = date.toLocal(instant, sydney);
+	TEST_ASSERT_TRUE(
+	    sydney.localToUtc(
+	        wall(local.year, local.month, local.day, local.hour, local.minute) + local.second,
+	        ESPDateDstPolicy::Earliest,
+	        utc
+	    )
+	);
+	TEST_ASSERT_EQUAL(instant.epochSeconds, utc);
+	const SunCycleResult rise = date.sunrise(-33.87f, 151.21f, sydney, instant);
+	TEST_ASSERT_TRUE(rise.ok);
+	TEST_ASSERT_EQUAL(5, date.toLocal(rise.value, sydney).hour);
+}
+
+#if !defined(ESP_PLATFORM)
+static bool libcOffset(const char *zone, int64_t utc, int32_t &offset, bool &isDst) {
+	setenv("TZ", zone, 1);
+	tzset();
+	const time_t raw = static_cast<time_t>(utc);
+	tm local{};
+	if (!localtime_r(&raw, &local)) {
+		return false;
+	}
+	offset = static_cast<int32_t>(local.tm_gmtoff);
+	isDst = local.tm_isdst > 0;
+	return true;
+}
+
+static void test_matches_host_zoneinfo() {
+	const int64_t from = date.fromUtc(1970, 1, 1).epochSeconds;
+	const int64_t until = date.fromUtc(2045, 1, 1).epochSeconds;
+	for (const char *name : kZones) {
+		const ESPDateTzdbZone zone = ESPDateTzdbZone::find(testTzdb, name);
+		int32_t expected = 0;
+		bool expectedDst = false;
+		// Every transition (and the second before it), then a stride through each day.
+		int64_t validFrom = 0;
+		int64_t validUntil = from;
+		while (validUntil < until) {
+			const int64_t at = validUntil;
+			zone.utcOffsetAt(at, validFrom, validUntil);
+			TEST_ASSERT_TRUE(at == from || validFrom == at);
+			for (const int64_t probe : {at - 1, at}) {
+				TEST_ASSERT_TRUE(libcOffset(name, probe, expected, expectedDst));
+				TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, zone.utcOffsetAt(probe), name);
+				TEST_ASSERT_EQUAL_MESSAGE(expectedDst, zone.isDstAt(probe), name);
+			}
+		}
+		for (int64_t probe = from; probe < until; probe += 86400 + 3607) {
+			TEST_ASSERT_TRUE(libcOffset(name, probe, expected, expectedDst));
+			TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, zone.utcOffsetAt(probe), name);
+		}
+	}
+	setenv("TZ", "UTC0", 1);
+	tzset();
+}
+#endif
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_perfect_hash_finds_every_zone);
+	RUN_TEST(test_history_differs_from_current_rules);
+	RUN_TEST(test_local_to_utc_over_history);
+#if !defined(ESP_PLATFORM)
+	RUN_TEST(test_matches_host_zoneinfo);
+#endif
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,238 @@
+// Generated by scripts/generate_tzdb.py from tzdata 2025b; do not edit.
+// 12 zones, history since 1970.
+#include "tzdb_test_zones.h"
+
+namespace {
+const ESPDateTzdbZoneRecord kZones[] = {
+    {1, 18, 0, 0, 74, 0, 2, 60},          // Australia/Sydney
+    {47, 64, 222, 5, 105, 2, 2, 60},      // America/Santiago
+    {96, 110, 537, 12, 63, 4, 5, 60},     // Europe/Moscow
+    {116, 129, 728, 16, 0, 9, 1, 60},     // Asia/Kolkata
+    {138, 155, 728, 16, 75, 10, 2, 60},   // America/New_York
+    {178, 196, 953, 21, 68, 12, 2, 60},   // America/Sao_Paulo
+    {203, 215, 1158, 26, 69, 14, 4, 60},  // Asia/Tehran
+    {228, 244, 1368, 31, 33, 18, 2, 60},  // Europe/Budapest
+    {271, 284, 1468, 34, 23, 20, 4, 60},  // Pacific/Apia
+    {293, 307, 1538, 36, 50, 24, 2, 60},  // Europe/Dublin
+    {334, 352, 1688, 40, 188, 26, 4, 60}, // Africa/Casablanca
+    {360, 377, 2257, 52, 1, 30, 2, 60},   // Antarctica/Troll
+};
+
+const uint16_t kBuckets[] = {
+    6, 12, 10, 3,
+};
+
+const char kStrings[] =
+    "\0"
+    "Australia/Sydney\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "America/Santiago\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "Europe/Moscow\0"
+    "MSK-3\0"
+    "Asia/Kolkata\0"
+    "IST-5:30\0"
+    "America/New_York\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "America/Sao_Paulo\0"
+    "<-03>3\0"
+    "Asia/Tehran\0"
+    "<+0330>-3:30\0"
+    "Europe/Budapest\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Pacific/Apia\0"
+    "<+13>-13\0"
+    "Europe/Dublin\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "Africa/Casablanca\0"
+    "<+01>-1\0"
+    "Antarctica/Troll\0"
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3";
+
+const int32_t kTypes[] = {
+    72000, 79201, -21599, -28800, 21600, 28801, 21601, 14400,
+    28800, 39600, -36000, -28799, -21600, -14399, 25200, 32401,
+    28800, 36001, 7200, 14401, -79200, -71999, 100801, 93600,
+    7200, 1, 0, 7201, 7200, 1, 0, 14401,
+};
+
+const uint8_t kTransitions[] = {
+    0xc1, 0xae, 0x75, 0xc0, 0xf5, 0x14, 0xc1, 0x88, 0x2b, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80,
+    0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0, 0xb0, 0x17, 0x81, 0xeb,
+    0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16,
+    0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0xc0,
+    0xa6, 0x1c, 0x81, 0xf5, 0x24, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb,
+    0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0xce, 0x18, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19,
+    0x81, 0xb0, 0x27, 0xc0, 0xeb, 0x19, 0x81, 0xb0, 0x27, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0x80,
+    0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb,
+    0x29, 0xc0, 0xb0, 0x17, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16, 0x81, 0xeb, 0x29, 0x80, 0x93, 0x16,
+    0x81, 0xeb, 0x29, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80,
+    0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0x81, 0x89,
+    0x1b, 0x80, 0xf5, 0x24, 0xc1, 0x92, 0x26, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b,
+    0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0x80,
+    0x89, 0x1b, 0x81, 0xf5, 0x24, 0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0xc0, 0xa6, 0x1c, 0xa9, 0xa8,
+    0x0f, 0xf8, 0xba, 0x22, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26,
+    0xc9, 0xea, 0x19, 0xb8, 0xd8, 0x23, 0xc9, 0xa5, 0x1c, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8,
+    0x93, 0x26, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88,
+    0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26,
+    0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xf8,
+    0xf5, 0x24, 0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26, 0xc9, 0xea,
+    0x19, 0xb8, 0x93, 0x26, 0x89, 0xfe, 0x1f, 0xf8, 0xff, 0x1f, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24,
+    0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x9d, 0x21, 0xc9, 0xe0, 0x1e, 0xb8,
+    0x93, 0x26, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88,
+    0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26,
+    0x89, 0xc3, 0x1d, 0xf8, 0xba, 0x22, 0x89, 0x88, 0x1b, 0xf8, 0xba, 0x22, 0xc9, 0x9b, 0x21, 0xb8,
+    0x9d, 0x21, 0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26, 0xc9, 0xea,
+    0x19, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8, 0x93, 0x26, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24,
+    0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0x89, 0x88, 0x1b, 0xb8, 0x93, 0x26, 0xc9, 0xea, 0x19, 0xb8,
+    0x93, 0x26, 0x89, 0xc3, 0x1d, 0xf8, 0xba, 0x22, 0x89, 0x88, 0x1b, 0xf8, 0xf5, 0x24, 0xc9, 0xe0,
+    0x1e, 0xb8, 0x9d, 0x21, 0x89, 0xf4, 0x24, 0xb8, 0xbb, 0x12, 0x89, 0xa5, 0x2c, 0xf8, 0x93, 0x16,
+    0x89, 0xea, 0x29, 0xb8, 0xb1, 0x17, 0xc9, 0xcc, 0x28, 0xb8, 0xb1, 0x17, 0x89, 0xa3, 0x6c, 0xb8,
+    0x80, 0x10, 0xc9, 0xfd, 0x2f, 0xb8, 0x80, 0x10, 0xc9, 0xfd, 0x2f, 0xb8, 0x80, 0x10, 0x89, 0xea,
+    0x29, 0xf8, 0x89, 0x1b, 0x89, 0xf4, 0x24, 0xf8, 0x89, 0x1b, 0x89, 0xf4, 0x24, 0xf8, 0x89, 0x1b,
+    0x89, 0xf4, 0x24, 0xb8, 0xa7, 0x1c, 0xc9, 0xd6, 0x23, 0xfd, 0x9b, 0x8d, 0x0e, 0xb4, 0xb3, 0x50,
+    0xed, 0xff, 0x4f, 0xb4, 0xb3, 0x50, 0xed, 0xff, 0x4f, 0xb4, 0xb3, 0x50, 0x8d, 0xb8, 0x50, 0x98,
+    0x82, 0x50, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd,
+    0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f,
+    0xc1, 0xfd, 0x4f, 0xa0, 0x87, 0x53, 0xc2, 0xfd, 0x4f, 0xef, 0xff, 0x4f, 0x80, 0x9c, 0x31, 0x95,
+    0xdf, 0x1e, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd,
+    0x4f, 0xc1, 0xfd, 0x4f, 0xc0, 0xfd, 0x4f, 0xa1, 0x87, 0x53, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43,
+    0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae, 0x5f, 0xe1,
+    0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xc1, 0xd6, 0x43, 0xc0, 0xa4,
+    0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40,
+    0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xe1, 0xcc, 0x40, 0xa0, 0xae, 0x5f, 0xc1,
+    0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xc0, 0xa4, 0x5c, 0xc1, 0xd6, 0x43, 0xa0, 0xae,
+    0x5f, 0xe4, 0xcc, 0x40, 0xf4, 0x9c, 0xbf, 0x04, 0x89, 0xa2, 0x14, 0x88, 0xfe, 0x1f, 0xf9, 0xff,
+    0x1f, 0xc8, 0x9b, 0x21, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f,
+    0xf9, 0xa7, 0x0c, 0x88, 0xd6, 0x33, 0xb9, 0xf6, 0x14, 0xc8, 0x87, 0x2b, 0xf9, 0xff, 0x1f, 0xc8,
+    0x9b, 0x21, 0xb9, 0xe2, 0x1e, 0xc8, 0x9b, 0x21, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff,
+    0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f,
+    0xf9, 0xff, 0x1f, 0xc8, 0x9b, 0x21, 0xb9, 0xe2, 0x1e, 0xc8, 0x9b, 0x21, 0xf9, 0xff, 0x1f, 0x88,
+    0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xf9, 0xff, 0x1f, 0x88, 0xfe, 0x1f, 0xb9, 0xa7,
+    0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24,
+    0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0xc8,
+    0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xf9, 0x89,
+    0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23,
+    0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88,
+    0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xa7, 0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7,
+    0x1c, 0xc8, 0xd6, 0x23, 0xb9, 0xa7, 0x1c, 0x88, 0xf4, 0x24, 0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24,
+    0xf9, 0x89, 0x1b, 0x88, 0xf4, 0x24, 0xb9, 0xb1, 0x17, 0xe9, 0xde, 0xf8, 0x07, 0xc8, 0xaf, 0x17,
+    0xf9, 0xb0, 0x27, 0x88, 0xd7, 0x13, 0xb9, 0xbd, 0x2c, 0xc8, 0xb9, 0x12, 0xf9, 0xa6, 0x2c, 0xc8,
+    0xb9, 0x12, 0xb9, 0xc4, 0x2d, 0xc8, 0xf4, 0x14, 0xf9, 0xa6, 0x2c, 0xc8, 0xf4, 0x14, 0xb9, 0x89,
+    0x2b, 0x88, 0xd7, 0x13, 0xb9, 0xc4, 0x2d, 0x88, 0x9c, 0x11, 0xb9, 0xc4, 0x2d, 0x88, 0x92, 0x16,
+    0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0xc8, 0xf4, 0x14, 0xf9, 0xeb, 0x29, 0xc8,
+    0xaf, 0x17, 0xf9, 0xe4, 0x28, 0x88, 0xd4, 0x19, 0xf9, 0xb0, 0x27, 0xc8, 0xaf, 0x17, 0xf9, 0xb0,
+    0x27, 0xc8, 0xea, 0x19, 0xf9, 0xb0, 0x27, 0xc8, 0xaf, 0x17, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16,
+    0xb9, 0xc4, 0x2d, 0xc8, 0xb9, 0x12, 0xb9, 0x89, 0x2b, 0xc8, 0xf4, 0x14, 0xb9, 0xf1, 0x2d, 0x88,
+    0xaa, 0x13, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xb9, 0xc4, 0x2d, 0x88, 0xd7, 0x13, 0xb9, 0xce,
+    0x28, 0x88, 0x92, 0x16, 0xb9, 0x89, 0x2b, 0xc8, 0xf4, 0x14, 0xb9, 0x89, 0x2b, 0x88, 0x92, 0x16,
+    0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0xc8, 0xaf, 0x17, 0xf9, 0xeb, 0x29, 0xc8,
+    0xf4, 0x14, 0xb9, 0x89, 0x2b, 0xc8, 0xf4, 0x14, 0xb9, 0x89, 0x2b, 0x88, 0x92, 0x16, 0xf9, 0xeb,
+    0x29, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16, 0xf9, 0xeb, 0x29, 0x88, 0x92, 0x16,
+    0xb9, 0xc4, 0x2d, 0xc8, 0xb9, 0x12, 0xc9, 0x80, 0x9f, 0x07, 0x82, 0xf1, 0x4a, 0xfb, 0xbf, 0x36,
+    0x82, 0xe1, 0x2e, 0x80, 0xba, 0x22, 0xf9, 0xa1, 0x45, 0x90, 0xb5, 0x28, 0xf1, 0xd9, 0x40, 0x90,
+    0xb0, 0x41, 0xf1, 0xfb, 0xd1, 0x0a, 0x90, 0xf4, 0x31, 0xf1, 0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1,
+    0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6,
+    0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f,
+    0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1,
+    0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6,
+    0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xa4, 0xc0,
+    0x02, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40,
+    0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90,
+    0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2,
+    0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40,
+    0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0xf1, 0xff, 0x3f, 0x90,
+    0xd6, 0x40, 0xf1, 0xd2, 0x3f, 0x90, 0xd6, 0x40, 0x89, 0xe9, 0x92, 0x05, 0xc0, 0xe1, 0x1e, 0x81,
+    0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff,
+    0x1f, 0xf1, 0x80, 0x20, 0xc0, 0x9c, 0x21, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f,
+    0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81,
+    0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0xc0, 0x9c, 0x21, 0x81, 0xff, 0x1f, 0x80, 0xff,
+    0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f,
+    0x80, 0xff, 0x1f, 0x81, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0xc1, 0x9c, 0x21, 0xd1, 0xda, 0xee, 0x28,
+    0xd0, 0x91, 0x42, 0x81, 0xc3, 0x3d, 0xc2, 0x85, 0x22, 0xc3, 0xb3, 0x20, 0x82, 0xfe, 0x3f, 0x83,
+    0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83, 0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83, 0xb9, 0x42, 0x82, 0xc3,
+    0x3d, 0x83, 0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83, 0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83, 0xb9, 0x42,
+    0x82, 0xfe, 0x3f, 0x83, 0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83, 0xb9, 0x42, 0x82, 0xc3, 0x3d, 0x83,
+    0xb9, 0x42, 0xf1, 0xb7, 0x75, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0x80, 0xce, 0x18, 0x81, 0xb0,
+    0x27, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0xc0, 0xeb, 0x19,
+    0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0xc0, 0xeb, 0x19, 0x81, 0xb0, 0x27, 0x80,
+    0xce, 0x18, 0x81, 0xb0, 0x27, 0x80, 0xce, 0x18, 0x81, 0xb0, 0x27, 0x88, 0x88, 0x1b, 0x81, 0xf5,
+    0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b,
+    0xc1, 0x92, 0x26, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80,
+    0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0xc1, 0x92,
+    0x26, 0xc0, 0xeb, 0x19, 0xc1, 0x92, 0x26, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b,
+    0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80, 0x89, 0x1b, 0x81, 0xf5, 0x24, 0x80,
+    0x89, 0x1b, 0x81, 0xf5, 0x24, 0xc0, 0xa6, 0x1c, 0x81, 0xe7, 0xbe, 0x04, 0x90, 0x9f, 0x18, 0xf1,
+    0xe1, 0xd5, 0x01, 0x90, 0xaa, 0x20, 0xf1, 0xfe, 0x5f, 0x90, 0xdc, 0x34, 0xf1, 0xbf, 0x56, 0x90,
+    0xbe, 0x16, 0xf2, 0x88, 0xd1, 0x05, 0x90, 0xce, 0xe6, 0x01, 0xf1, 0xa0, 0xbe, 0x16, 0x90, 0xaa,
+    0x20, 0xf1, 0xfe, 0x5f, 0x90, 0xbb, 0x1c, 0xf1, 0xa7, 0x59, 0x90, 0xb8, 0x22, 0xf1, 0xd7, 0x53,
+    0x90, 0xe9, 0x29, 0xd1, 0x82, 0x60, 0x80, 0xea, 0x1c, 0x81, 0xf3, 0x0a, 0x80, 0xb5, 0x0e, 0x81,
+    0xea, 0x49, 0x80, 0xce, 0x18, 0x81, 0xfa, 0x0b, 0x80, 0xb6, 0x1b, 0x81, 0x92, 0x36, 0x80, 0xd2,
+    0x1f, 0x81, 0xa7, 0x0c, 0x80, 0xf1, 0x1d, 0x81, 0x92, 0x36, 0x80, 0x89, 0x1b, 0x81, 0xa7, 0x0c,
+    0x80, 0xba, 0x22, 0x81, 0x92, 0x36, 0x80, 0xce, 0x18, 0x81, 0xa7, 0x0c, 0x80, 0xb0, 0x27, 0x81,
+    0xd7, 0x33, 0x80, 0xd8, 0x13, 0x81, 0xe2, 0x0e, 0x80, 0xeb, 0x29, 0x81, 0xd7, 0x33, 0x80, 0x9d,
+    0x11, 0x81, 0xa7, 0x0c, 0x82, 0xe1, 0x2e, 0x83, 0xb9, 0x42, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0x83, 0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83, 0xdf, 0x6e,
+    0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2, 0x0e, 0x83,
+    0xdf, 0x6e, 0x82, 0xa7, 0x0c, 0x83, 0x9a, 0x71, 0x82, 0xa7, 0x0c, 0x83, 0xdf, 0x6e, 0x82, 0xe2,
+    0x0e, 0xb9, 0x91, 0xd6, 0x11,
+};
+
+const uint32_t kCheckpointTimes[] = {
+    57686400, 309888000, 562089600, 814896000, 1067097600, 7527600,
+    258519600, 510721200, 763527600, 1015729200, 1270350000, 1554606000,
+    354920400, 606870000, 846370800, 1099177200, 9961200, 262767600,
+    514969200, 765356400, 1018162800, 499748400, 750826800, 1003028400,
+    1255834800, 1508036400, 227820600, 780175800, 1032636600, 1348169400,
+    1600630200, 323823600, 575427600, 828234000, 1285498800, 1522504800,
+    57722400, 309924000, 562122000, 814323600, 141264000, 1301788800,
+    1437271200, 1587261600, 1832205600, 2077149600, 2322093600, 2567037600,
+    2811981600, 3056925600, 3301869600, 3546813600, 1111885200,
+};
+
+const uint16_t kCheckpointOffsets[] = {
+    0, 48, 96, 144, 192, 0, 48, 96, 144, 192, 240, 288,
+    0, 49, 97, 145, 0, 48, 96, 144, 192, 0, 49, 97,
+    145, 193, 0, 50, 98, 147, 195, 0, 49, 97, 0, 49,
+    0, 48, 96, 144, 0, 53, 101, 149, 197, 245, 293, 341,
+    389, 437, 485, 533, 0,
+};
+
+} // namespace
+
+extern const ESPDateTzdbTable testTzdb = {
+    "2025b",
+    0LL,
+    12,
+    4,
+    kZones,
+    kBuckets,
+    kStrings,
+    kTypes,
+    kTransitions,
+    kCheckpointTimes,
+    kCheckpointOffsets,
+};
@@ -0,0 +1,7 @@
+// Generated by scripts/generate_tzdb.py from tzdata 2025b; do not edit.
+// 12 zones, history since 1970.
+#pragma once
+
+#include <ESPDate.h>
+
+extern const ESPDateTzdbTable testTzdb;
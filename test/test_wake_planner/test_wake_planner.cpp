@@ -0,0 +1,227 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include <cstdio>
+
+ESPDate date;
+
+static constexpr int64_t kMicros = 1000000;
+static constexpr int64_t kMinute = 60 * kMicros;
+static constexpr int64_t kHour = 60 * kMinute;
+static constexpr int64_t kMarch1 = 1740787200LL * kMicros; // 2025-03-01T00:00:00Z
+
+static void configureBerlin() {
+	ESPDateConfig config{};
+	config.latitude = 52.52f;
+	config.longitude = 13.405f;
+	config.timeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
+	date.init(config);
+}
+
+static void test_entries_and_exact_sleep() {
+	ESPDateWakePlanner planner(date);
+	static ESPDateRecurrence weekdayMornings("0 7 * * MON-FRI");
+	const ESPDateWakePlanner::EntryId daily = planner.addDailyLocal(3, 0);
+	const ESPDateWakePlanner::EntryId periodic = planner.addPeriodic(15 * kMinute);
+	const ESPDateWakePlanner::EntryId rule = planner.addRecurrence(weekdayMornings);
+	const ESPDateWakePlanner::EntryId deadline = planner.addDeadline(kMarch1 + 5 * kMinute + 7);
+	const ESPDateWakePlanner::EntryId sunset = planner.addSunset(-15 * 60);
+	TEST_ASSERT_EQUAL(5, planner.size());
+	TEST_ASSERT_EQUAL(ESPDateWakePlanner::kInvalidEntryId, planner.addDailyLocal(24, 0));
+	TEST_ASSERT_EQUAL(ESPDateWakePlanner::kInvalidEntryId, planner.addPeriodic(0));
+
+	int64_t due = 0;
+	TEST_ASSERT_TRUE(planner.nextDue(daily, kMarch1, due));
+	TEST_ASSERT_EQUAL(kMarch1 + 2 * kHour, due); // 03:00 CET
+	TEST_ASSERT_TRUE(planner.nextDue(periodic, kMarch1, due));
+	TEST_ASSERT_EQUAL(kMarch1 + 15 * kMinute, due);
+	TEST_ASSERT_TRUE(planner.nextDue(rule, kMarch1, due));
+	TEST_ASSERT_EQUAL(kMarch1 + 2 * 24 * kHour + 6 * kHour, due); // Monday 07:00 CET
+	TEST_ASSERT_TRUE(planner.nextDue(sunset, kMarch1, due));
+	const SunCycleResult sunsetToday = date.sunset(DateTime{kMarch1 / kMicros + 12 * 3600});
+	TEST_ASSERT_EQUAL((sunsetToday.value.epochSeconds - 15 * 60) * kMicros, due);
+	TEST_ASSERT_TRUE(planner.nextDue(deadline, kMarch1, due));
+	TEST_ASSERT_FALSE(planner.nextDue(deadline, kMarch1 + kHour, due));
+
+	// The deadline comes first and the sleep is exact to the microsecond.
+	const int64_t nowUs = kMarch1 + 123456;
+	ESPDateWakePlan plan = planner.plan(nowUs);
+	TEST_ASSERT_TRUE(plan.ok);
+	TEST_ASSERT_EQUAL(5 * kMinute + 7 - 123456, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(1u << (deadline - 1), plan.dueMask);
+	TEST_ASSERT_EQUAL_UINT32(1u << (deadline - 1), planner.dueMask(nowUs, plan.wakeEpochUs));
+
+	// Occurrences exactly at `now` were served by this wake; the next plan moves on.
+	plan = planner.plan(kMarch1 + 15 * kMinute);
+	TEST_ASSERT_EQUAL(15 * kMinute, plan.sleepUs);
+
+	TEST_ASSERT_TRUE(planner.remove(periodic));
+	TEST_ASSERT_FALSE(planner.remove(periodic));
+	planner.clear();
+	TEST_ASSERT_FALSE(planner.plan(nowUs).ok);
+	planner.setMaxSleep(6 * kHour);
+	plan = planner.plan(nowUs);
+	TEST_ASSERT_TRUE(plan.ok);
+	TEST_ASSERT_EQUAL(6 * kHour, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(0, plan.dueMask);
+}
+
+static void test_tolerance_coalesces_without_running_early() {
+	ESPDateWakePlanner planner(date);
+	const ESPDateWakePlanner::EntryId quarter = planner.addPeriodic(15 * kMinute);
+	const ESPDateWakePlanner::EntryId offset = planner.addPeriodic(15 * kMinute, 4 * kMinute);
+	const ESPDateWakePlanner::EntryId far = planner.addDeadline(kMarch1 + 30 * kMinute);
+
+	ESPDateWakePlan plan = planner.plan(kMarch1);
+	TEST_ASSERT_EQUAL(4 * kMinute, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(1u << (offset - 1), plan.dueMask);
+
+	planner.setTolerance(12 * kMinute);
+	plan = planner.plan(kMarch1);
+	TEST_ASSERT_EQUAL(15 * kMinute, plan.sleepUs); // 00:04 waits for 00:15, not the reverse
+	TEST_ASSERT_EQUAL_UINT32((1u << (quarter - 1)) | (1u << (offset - 1)), plan.dueMask);
+	TEST_ASSERT_EQUAL_UINT32(0, plan.dueMask & (1u << (far - 1)));
+
+	// The sleep cap wins over a distant wake and serves nothing.
+	planner.clear();
+	planner.addDeadline(kMarch1 + 10 * kHour);
+	planner.setMaxSleep(kHour);
+	plan = planner.plan(kMarch1);
+	TEST_ASSERT_EQUAL(kHour, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(0, plan.dueMask);
+}
+
+static void test_ntp_resync_wakes() {
+	ESPDateSimulatedTimeSource clock(kMarch1);
+	date.setTimeSource(&clock);
+	ESPDateWakePlanner planner(date);
+	planner.setNtpResync(6 * kHour);
+	const uint32_t ntpBit = 1u << (ESPDateWakePlanner::kNtpResyncId - 1);
+
+	// Never synced: due right away.
+	ESPDateWakePlan plan = planner.plan();
+	TEST_ASSERT_EQUAL(0, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(ntpBit, plan.dueMask);
+	TEST_ASSERT_EQUAL_UINT32(ntpBit, planner.dueMask(kMarch1 - kMicros, kMarch1));
+
+	// A sync remembered across deep sleep, then a newer one ESPDate has seen.
+	planner.setLastSync(kMarch1 - 2 * kHour);
+	TEST_ASSERT_EQUAL(4 * kHour, planner.plan().sleepUs);
+	date.syncFromReference(kMarch1, clock.monotonicMicros(), false);
+	plan = planner.plan();
+	TEST_ASSERT_EQUAL(6 * kHour, plan.sleepUs);
+	TEST_ASSERT_EQUAL_UINT32(0, planner.dueMask(kMarch1, kMarch1 + kHour));
+	date.setTimeSource(nullptr);
+}
+
+struct MonthResult {
+	int wakes = 0;
+	int served[ESPDateWakePlanner::kMaxEntries + 1] = {};
+	int64_t worstLateUs = 0;
+	bool early = false;
+};
+
+// A battery node through March 2025 (with the DST switch) on a simulated clock: sample on the
+// half hour, a nightly report, lights 15 minutes before sunset and off at sunrise, weekday
+// opening hours, and an SNTP re-sync every 6 hours.
+static MonthResult simulateMonth(int64_t toleranceUs) {
+	ESPDateSimulatedTimeSource clock(kMarch1);
+	date.setTimeSource(&clock);
+	static ESPDateRecurrence opening("30 8 * * MON-FRI");
+	ESPDateWakePlanner planner(date);
+	planner.addPeriodic(30 * kMinute);
+	planner.addDailyLocal(3, 0);
+	planner.addSunset(-15 * 60);
+	planner.addSunrise();
+	planner.addRecurrence(opening);
+	planner.setNtpResync(6 * kHour);
+	planner.setTolerance(toleranceUs);
+
+	MonthResult result;
+	const int64_t endUs = kMarch1 + 31 * 24 * kHour;
+	int64_t lastWakeUs = kMarch1;
+	while (true) {
+		const int64_t nowUs = date.nowUs().epochMicros;
+		const uint32_t due = planner.dueMask(lastWakeUs, nowUs);
+		for (ESPDateWakePlanner::EntryId id = 1; id <= ESPDateWakePlanner::kNtpResyncId; ++id) {
+			if ((due & (1u << (id - 1))) == 0) {
+				continue;
+			}
+			++result.served[id - 1];
+			int64_t dueUs = 0;
+			if (id != ESPDateWakePlanner::kNtpResyncId && planner.nextDue(id, lastWakeUs, dueUs)) {
+				result.worstLateUs = nowUs - dueUs > result.worstLateUs ? nowUs - dueUs
+				                                                        : result.worstLateUs;
+			}
+		}
+		if ((due & (1u << (ESPDateWakePlanner::kNtpResyncId - 1))) != 0) {
+			date.syncFromReference(nowUs, clock.monotonicMicros(), false);
+		}
+		lastWakeUs = nowUs;
+
+		const ESPDateWakePlan plan = planner.plan(nowUs);
+		TEST_ASSERT_TRUE(plan.ok);
+		if (plan.wakeEpochUs > endUs) {
+			break;
+		}
+		// The plan never wakes before what it promised to serve.
+		if (planner.dueMask(nowUs, plan.wakeEpochUs) != plan.dueMask) {
+			result.early = true;
+		}
+		clock.advanceMicros(plan.sleepUs);
+		++result.wakes;
+	}
+	date.setTimeSource(nullptr);
+	return result;
+}
+
+static void test_wakeups_per_simulated_month() {
+	const MonthResult exact = simulateMonth(0);
+	const MonthResult relaxed = simulateMonth(20 * kMinute);
+	char line[160];
+	snprintf(
+	    line,
+	    sizeof(line),
+	    "wakes/month: exact %d, 20 min tolerance %d, fixed 5 min period %d",
+	    exact.wakes,
+	    relaxed.wakes,
+	    31 * 24 * 12
+	);
+	TEST_MESSAGE(line);
+
+	const int expected[] = {31 * 48, 31, 31, 31, 21};
+	for (int i = 0; i < 5; ++i) {
+		TEST_ASSERT_EQUAL(expected[i], exact.served[i]);
+		TEST_ASSERT_EQUAL(expected[i], relaxed.served[i]);
+	}
+	TEST_ASSERT_EQUAL(1 + 31 * 4, exact.served[ESPDateWakePlanner::kMaxEntries]); // first boot
+	TEST_ASSERT_FALSE(exact.early);
+	TEST_ASSERT_FALSE(relaxed.early);
+	TEST_ASSERT_EQUAL(0, exact.worstLateUs);
+	TEST_ASSERT_TRUE(relaxed.worstLateUs <= 20 * kMinute);
+	TEST_ASSERT_TRUE(relaxed.wakes < exact.wakes);
+	TEST_ASSERT_TRUE(exact.wakes < 31 * 24 * 12 / 4);
+}
+
+void setUp() {
+	configureBerlin();
+}
+
+void tearDown() {
+	date.setTimeSource(nullptr);
+	date.deinit();
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_entries_and_exact_sleep);
+	RUN_TEST(test_tolerance_coalesces_without_running_early);
+	RUN_TEST(test_ntp_resync_wakes);
+	RUN_TEST(test_wakeups_per_simulated_month);
+	UNITY_END();
+}
+
+void loop() {
+}
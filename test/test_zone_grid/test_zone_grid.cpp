@@ -0,0 +1,181 @@
+#include <Arduino.h>
+#include <ESPDate.h>
+#include <unity.h>
+
+#include "zone_grid_test_table.h"
+
+#include <math.h>
+
+// Regenerate with: scripts/generate_zone_grid.py --geojson scripts/zone_outlines.geojson
+//   --depth 10 --name testZoneGrid --output test/test_zone_grid/zone_grid_test_table
+// The outlines are simplified, but every city below sits clear of their borders, so each one
+// must come back as its own IANA zone. Chicago, Beijing and Mumbai are the cities the nearest
+// zone.tab city (--points) gets wrong.
+struct ReferencePoint {
+	float latitude;
+	float longitude;
+	const char *name;
+	const char *posix;
+};
+
+static const ReferencePoint kReference[] = {
+    {47.4979f, 19.0402f, "Europe/Budapest", "CET-1CEST,M3.5.0,M10.5.0/3"},         // Budapest
+    {46.2530f, 20.1414f, "Europe/Budapest", "CET-1CEST,M3.5.0,M10.5.0/3"},         // Szeged
+    {48.2082f, 16.3738f, "Europe/Vienna", "CET-1CEST,M3.5.0,M10.5.0/3"},           // Vienna
+    {52.5200f, 13.4050f, "Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3"},           // Berlin
+    {48.1351f, 11.5820f, "Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3"},           // Munich
+    {48.8566f, 2.3522f, "Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3"},             // Paris
+    {43.2965f, 5.3698f, "Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3"},             // Marseille
+    {51.5074f, -0.1278f, "Europe/London", "GMT0BST,M3.5.0/1,M10.5.0"},             // London
+    {53.4808f, -2.2426f, "Europe/London", "GMT0BST,M3.5.0/1,M10.5.0"},             // Manchester
+    {53.3498f, -6.2603f, "Europe/Dublin", "IST-1GMT0,M10.5.0,M3.5.0/1"},           // Dublin
+    {40.4168f, -3.7038f, "Europe/Madrid", "CET-1CEST,M3.5.0,M10.5.0/3"},           // Madrid
+    {38.7223f, -9.1393f, "Europe/Lisbon", "WET0WEST,M3.5.0/1,M10.5.0"},            // Lisbon
+    {41.9028f, 12.4964f, "Europe/Rome", "CET-1CEST,M3.5.0,M10.5.0/3"},             // Rome
+    {45.4642f, 9.1900f, "Europe/Rome", "CET-1CEST,M3.5.0,M10.5.0/3"},              // Milan
+    {60.1699f, 24.9384f, "Europe/Helsinki", "EET-2EEST,M3.5.0/3,M10.5.0/4"},       // Helsinki
+    {55.7558f, 37.6173f, "Europe/Moscow", "MSK-3"},                                // Moscow
+    {50.4501f, 30.5234f, "Europe/Kyiv", "EET-2EEST,M3.5.0/3,M10.5.0/4"},           // Kyiv
+    {37.9838f, 23.7275f, "Europe/Athens", "EET-2EEST,M3.5.0/3,M10.5.0/4"},         // Athens
+    {41.0082f, 28.9784f, "Europe/Istanbul", "<+03>-3"},                            // Istanbul
+    {40.7128f, -74.0060f, "America/New_York", "EST5EDT,M3.2.0,M11.1.0"},           // New York
+    {41.8781f, -87.6298f, "America/Chicago", "CST6CDT,M3.2.0,M11.1.0"},            // Chicago
+    {39.7392f, -104.9903f, "America/Denver", "MST7MDT,M3.2.0,M11.1.0"},            // Denver
+    {34.0522f, -118.2437f, "America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0"},       // Los Angeles
+    {47.6062f, -122.3321f, "America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0"},       // Seattle
+    {33.4484f, -112.0740f, "America/Phoenix", "MST7"},                             // Phoenix
+    {43.6532f, -79.3832f, "America/Toronto", "EST5EDT,M3.2.0,M11.1.0"},            // Toronto
+    {19.4326f, -99.1332f, "America/Mexico_City", "CST6"},                          // Mexico City
+    {-23.5505f, -46.6333f, "America/Sao_Paulo", "<-03>3"},                         // Sao Paulo
+    {-34.6037f, -58.3816f, "America/Argentina/Buenos_Aires", "<-03>3"},            // Buenos Aires
+    {-33.4489f, -70.6693f, "America/Santiago", "<-04>4<-03>,M9.1.6/24,M4.1.6/24"}, // Santiago
+    {4.7110f, -74.0721f, "America/Bogota", "<-05>5"},                              // Bogota
+    {35.6762f, 139.6503f, "Asia/Tokyo", "JST-9"},                                  // Tokyo
+    {37.5665f, 126.9780f, "Asia/Seoul", "KST-9"},                                  // Seoul
+    {31.2304f, 121.4737f, "Asia/Shanghai", "CST-8"},                               // Shanghai
+    {39.9042f, 116.4074f, "Asia/Shanghai", "CST-8"},                               // Beijing
+    {1.3521f, 103.8198f, "Asia/Singapore", "<+08>-8"},                             // Singapore
+    {13.7563f, 100.5018f, "Asia/Bangkok", "<+07>-7"},                              // Bangkok
+    {25.2048f, 55.2708f, "Asia/Dubai", "<+04>-4"},                                 // Dubai
+    {35.6892f, 51.3890f, "Asia/Tehran", "<+0330>-3:30"},                           // Tehran
+    {19.0760f, 72.8777f, "Asia/Kolkata", "IST-5:30"},                              // Mumbai
+    {-33.8688f, 151.2093f, "Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"},    // Sydney
+    {-37.8136f, 144.9631f, "Australia/Melbourne", "AEST-10AEDT,M10.1.0,M4.1.0/3"}, // Melbourne
+    {-27.4698f, 153.0251f, "Australia/Brisbane", "AEST-10"},                       // Brisbane
+    {-31.9505f, 115.8605f, "Australia/Perth", "AWST-8"},                           // Perth
+    {-36.8485f, 174.7633f, "Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3"},     // Auckland
+    {30.0444f, 31.2357f, "Africa/Cairo", "EET-2EEST,M4.5.5/0,M10.5.4/24"},         // Cairo
+    {-1.2921f, 36.8219f, "Africa/Nairobi", "EAT-3"},                               // Nairobi
+    {6.5244f, 3.3792f, "Africa/Lagos", "WAT-1"},                                   // Lagos
+    {33.5731f, -7.5898f, "Africa/Casablanca", "<+01>-1"},                          // Casablanca
+    {21.3069f, -157.8583f, "Pacific/Honolulu", "HST10"},                           // Honolulu
+    {61.2181f, -149.9003f, "America/Anchorage", "AKST9AKDT,M3.2.0,M11.1.0"},       // Anchorage
+};
+
+static void test_reference_points_resolve_to_their_zones() {
+	const ESPDateZoneGrid grid(testZoneGrid);
+	for (const ReferencePoint &point : kReference) {
+		const ESPDateZoneMatch match = grid.lookup(point.latitude, point.longitude);
+		TEST_ASSERT_TRUE_MESSAGE(match.ok, point.name);
+		TEST_ASSERT_EQUAL_STRING(point.name, match.name);
+		TEST_ASSERT_EQUAL_STRING_MESSAGE(point.posix, match.posix, match.name);
+	}
+}
+
+static void test_box_edges_and_invalid_input() {
+	const ESPDateZoneGrid grid(testZoneGrid);
+	// Open sea is inside the box, but the outlines leave it without a zone.
+	const ESPDateZoneMatch sea = grid.lookup(0.0f, -30.0f);
+	TEST_ASSERT_FALSE(sea.ok);
+	TEST_ASSERT_EQUAL_STRING("", sea.name);
+	TEST_ASSERT_FALSE(grid.lookup(90.5f, 0.0f).ok);
+	TEST_ASSERT_FALSE(grid.lookup(0.0f, -180.5f).ok);
+	TEST_ASSERT_FALSE(grid.lookup(NAN, 0.0f).ok);
+	TEST_ASSERT_FALSE(grid.lookup(0.0f, NAN).ok);
+	const ESPDateZoneMatch outside = grid.lookup(0.0f, 200.0f);
+	TEST_ASSERT_EQUAL_STRING("", outside.name);
+	TEST_ASSERT_EQUAL_STRING("", outside.posix);
+}
+
+// Hand-built 4x4 box over [0, 4) x [0, 4): the SW quadrant splits once more, NE is empty.
+static const uint16_t kHandNodes[] = {
+    1,
+    ESPDateZoneGridTable::kLeaf | 1,
+    ESPDateZoneGridTable::kLeaf | 2,
+    ESPDateZoneGridTable::kLeaf | ESPDateZoneGridTable::kNoZone,
+    ESPDateZoneGridTable::kLeaf | 0,
+    ESPDateZoneGridTable::kLeaf | 1,
+    ESPDateZoneGridTable::kLeaf | 2,
+    ESPDateZoneGridTable::kLeaf | 0,
+};
+static const uint32_t kHandZones[] = {0, 2, 4, 6, 8, 10};
+static const char kHandStrings[] = "A\0a\0B\0b\0C\0c";
+static const ESPDateZoneGridTable kHandTable = {
+    0.0f,
+    0.0f,
+    4.0f,
+    4.0f,
+    2,
+    0,
+    3,
+    kHandNodes,
+    kHandZones,
+    kHandStrings,
+};
+
+static void test_quadrant_order() {
+	const ESPDateZoneGrid grid(kHandTable);
+	// Inner SW quadrant, cell by cell: SW, SE, NW, NE.
+	TEST_ASSERT_EQUAL_STRING("A", grid.lookup(0.5f, 0.5f).name);
+	TEST_ASSERT_EQUAL_STRING("B", grid.lookup(0.5f, 1.5f).name);
+	TEST_ASSERT_EQUAL_STRING("C", grid.lookup(1.5f, 0.5f).name);
+	TEST_ASSERT_EQUAL_STRING("a", grid.lookup(1.5f, 1.5f).posix);
+	// Outer quadrants are single leaves.
+	TEST_ASSERT_EQUAL_STRING("B", grid.lookup(0.5f, 3.5f).name);
+	TEST_ASSERT_EQUAL_STRING("C", grid.lookup(3.9f, 0.1f).name);
+	TEST_ASSERT_FALSE(grid.lookup(3.0f, 3.0f).ok);
+	// Corners are inside the box; the last row/column includes the max edge.
+	TEST_ASSERT_EQUAL_STRING("A", grid.lookup(0.0f, 0.0f).name);
+	TEST_ASSERT_EQUAL_STRING("B", grid.lookup(0.0f, 4.0f).name);
+	TEST_ASSERT_EQUAL_STRING("C", grid.lookup(4.0f, 0.0f).name);
+	TEST_ASSERT_FALSE(grid.lookup(4.0f, 4.0f).ok);
+}
+
+static void test_init_takes_zone_from_location() {
+	ESPDate local;
+	ESPDateConfig config{};
+	config.latitude = 47.4979f;
+	config.longitude = 19.0402f;
+	config.zoneGrid = &testZoneGrid;
+	local.init(config);
+	const DateTime summer = local.fromUtc(2025, 7, 1, 10, 0, 0);
+	TEST_ASSERT_EQUAL(12, local.toLocal(summer).hour);
+	TEST_ASSERT_TRUE(local.isDstActive(summer));
+	TEST_ASSERT_EQUAL_STRING("Europe/Budapest", local.zoneForLocation(testZoneGrid).name);
+
+	// An explicit timeZone wins over the grid.
+	config.timeZone = "JST-9";
+	local.init(config);
+	TEST_ASSERT_EQUAL(19, local.toLocal(summer).hour);
+
+	ESPDate unconfigured;
+	TEST_ASSERT_FALSE(unconfigured.zoneForLocation(testZoneGrid).ok);
+}
+
+void setUp() {
+}
+void tearDown() {
+}
+
+void setup() {
+	delay(2000);
+	UNITY_BEGIN();
+	RUN_TEST(test_reference_points_resolve_to_their_zones);
+	RUN_TEST(test_box_edges_and_invalid_input);
+	RUN_TEST(test_quadrant_order);
+	RUN_TEST(test_init_takes_zone_from_location);
+	UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,2104 @@
+// Generated by scripts/generate_zone_grid.py from zone_outlines.geojson; do not edit.
+// 47 zones, depth 10, 5840 nodes.
+#include "zone_grid_test_table.h"
+
+namespace {
+const uint16_t kNodes[] = {
+    0x0001, 0x0002, 0x0003, 0x0004, 0xffff, 0xffff, 0xffff, 0x0005, 0xffff, 0xffff, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+    0xffff, 0xffff, 0x0014, 0xffff, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0xffff, 0x001b,
+    0x001c, 0xffff, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0xffff, 0x0022, 0x0023, 0xffff, 0xffff,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0xffff, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e,
+    0x002f, 0xffff, 0xffff, 0xffff, 0x0030, 0x0031, 0x0032, 0x0033, 0xffff, 0xffff, 0x0034, 0xffff,
+    0x0035, 0x0036, 0x0037, 0xffff, 0x0038, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0039,
+    0xffff, 0x003a, 0xffff, 0x003b, 0x003c, 0x003d, 0x003e, 0xffff, 0xffff, 0x003f, 0xffff, 0xffff,
+    0x0040, 0xffff, 0x0041, 0xffff, 0xffff, 0xffff, 0x0042, 0xffff, 0xffff, 0xffff, 0xffff, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0xffff, 0x004b, 0xffff, 0x004c, 0x004d,
+    0xffff, 0x004e, 0xffff, 0x004f, 0x0050, 0xffff, 0x0051, 0x0052, 0x0053, 0x0054, 0xffff, 0xffff,
+    0x0055, 0x0056, 0xffff, 0xffff, 0x0057, 0x0058, 0x0059, 0x005a, 0xffff, 0x005b, 0xffff, 0x005c,
+    0x005d, 0x005e, 0x005f, 0x0060, 0xffff, 0x0061, 0xffff, 0x0062, 0xffff, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0xffff, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+    0x0071, 0xffff, 0x0072, 0xffff, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0xffff,
+    0x007a, 0x007b, 0xffff, 0xffff, 0x007c, 0xffff, 0xffff, 0xffff, 0x007d, 0x007e, 0xffff, 0xffff,
+    0xffff, 0x007f, 0xffff, 0x0080, 0x0081, 0xffff, 0x0082, 0xffff, 0xffff, 0x0083, 0xffff, 0x0084,
+    0x0085, 0x0086, 0xffff, 0x0087, 0xffff, 0xffff, 0x0088, 0xffff, 0xffff, 0x0089, 0xffff, 0xffff,
+    0xffff, 0x008a, 0xffff, 0x008b, 0xffff, 0xffff, 0xffff, 0x008c, 0x008d, 0xffff, 0x008e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x008f, 0xffff, 0xffff, 0x0090, 0xffff, 0x0091, 0x0092, 0x0093, 0x0094,
+    0xffff, 0xffff, 0x0095, 0x0096, 0xffff, 0x0097, 0xffff, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c,
+    0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0xffff, 0x00a4, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00a5, 0xffff, 0x00a6, 0x00a7, 0x00a8, 0xffff, 0xffff, 0xffff, 0x00a9,
+    0x00aa, 0x00ab, 0x00ac, 0x00ad, 0xffff, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x8007, 0x00b2, 0x00b3,
+    0xffff, 0x00b4, 0xffff, 0x00b5, 0x00b6, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b7, 0xffff, 0xffff,
+    0x00b8, 0xffff, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0xffff, 0xffff, 0x00bf, 0xffff,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0xffff, 0x00c4, 0xffff, 0x00c5, 0xffff, 0xffff, 0xffff, 0x00c6,
+    0xffff, 0x00c7, 0xffff, 0x00c8, 0x00c9, 0x00ca, 0x8004, 0x00cb, 0x00cc, 0x00cd, 0xffff, 0xffff,
+    0x00ce, 0x00cf, 0xffff, 0xffff, 0xffff, 0x00d0, 0xffff, 0xffff, 0x00d1, 0x00d2, 0xffff, 0xffff,
+    0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0xffff, 0x00d8, 0xffff, 0x00d9, 0x00da, 0xffff, 0x00db,
+    0x00dc, 0xffff, 0xffff, 0xffff, 0xffff, 0x00dd, 0xffff, 0x00de, 0xffff, 0x00df, 0xffff, 0xffff,
+    0x00e0, 0xffff, 0x00e1, 0x00e2, 0xffff, 0x00e3, 0xffff, 0xffff, 0x00e4, 0x00e5, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x00e6, 0x00e7, 0xffff, 0xffff, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed,
+    0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9,
+    0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0xffff,
+    0x0105, 0x8017, 0x0106, 0x0107, 0xffff, 0x0108, 0x0109, 0xffff, 0x010a, 0x010b, 0x010c, 0x010d,
+    0xffff, 0xffff, 0x010e, 0xffff, 0x010f, 0x0110, 0x0111, 0x8017, 0x0112, 0xffff, 0x0113, 0x0114,
+    0x8017, 0x8017, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0xffff, 0xffff, 0x011b, 0xffff,
+    0x011c, 0xffff, 0x011d, 0xffff, 0x011e, 0x011f, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125,
+    0xffff, 0x0126, 0xffff, 0x0127, 0x0128, 0x8029, 0x0129, 0x8029, 0x012a, 0xffff, 0x012b, 0xffff,
+    0xffff, 0x012c, 0xffff, 0xffff, 0x012d, 0xffff, 0x012e, 0xffff, 0xffff, 0x012f, 0xffff, 0xffff,
+    0x0130, 0x0131, 0xffff, 0xffff, 0x0132, 0xffff, 0xffff, 0xffff, 0x0133, 0x0134, 0xffff, 0xffff,
+    0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013f, 0x0140,
+    0xffff, 0xffff, 0x0141, 0xffff, 0x0142, 0x0143, 0x0144, 0x0145, 0xffff, 0x0146, 0xffff, 0x0147,
+    0xffff, 0x0148, 0xffff, 0x0149, 0xffff, 0x014a, 0xffff, 0x014b, 0x014c, 0xffff, 0x014d, 0x014e,
+    0x014f, 0x0150, 0x0151, 0x0152, 0xffff, 0xffff, 0x0153, 0xffff, 0xffff, 0x0154, 0xffff, 0x0155,
+    0x0156, 0x800f, 0x0157, 0x800f, 0x0158, 0x0159, 0xffff, 0x015a, 0xffff, 0x015b, 0x015c, 0x015d,
+    0x015e, 0xffff, 0x015f, 0xffff, 0x0160, 0xffff, 0x0161, 0xffff, 0x0162, 0x0163, 0x0164, 0x0165,
+    0xffff, 0xffff, 0x0166, 0x0167, 0x0168, 0x0169, 0x016a, 0x801d, 0x016b, 0xffff, 0x016c, 0xffff,
+    0x016d, 0x801d, 0x016e, 0x801d, 0x016f, 0xffff, 0x0170, 0xffff, 0xffff, 0x0171, 0xffff, 0x0172,
+    0x0173, 0xffff, 0x0174, 0xffff, 0xffff, 0xffff, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017a,
+    0xffff, 0x017b, 0xffff, 0x017c, 0x017d, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183, 0x801b,
+    0x801b, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0xffff, 0x0189, 0x018a, 0xffff, 0x018b, 0xffff,
+    0xffff, 0x018c, 0xffff, 0xffff, 0x018d, 0xffff, 0x018e, 0xffff, 0x018f, 0x801b, 0x0190, 0x0191,
+    0x0192, 0xffff, 0x0193, 0xffff, 0x0194, 0x0195, 0xffff, 0x0196, 0xffff, 0x0197, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0198, 0xffff, 0xffff, 0x0199, 0x019a, 0xffff, 0x019b, 0xffff, 0x019c,
+    0x019d, 0x019e, 0x019f, 0xffff, 0xffff, 0xffff, 0xffff, 0x01a0, 0xffff, 0x01a1, 0xffff, 0x01a2,
+    0x01a3, 0xffff, 0x01a4, 0xffff, 0xffff, 0x01a5, 0x01a6, 0x01a7, 0x01a8, 0x01a9, 0x8007, 0x8007,
+    0x01aa, 0x01ab, 0x01ac, 0x01ad, 0xffff, 0x01ae, 0xffff, 0x01af, 0x800a, 0x01b0, 0x800a, 0x01b1,
+    0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x8008, 0x01b6, 0x8008, 0x8008, 0x8007, 0x8007, 0x01b7, 0x8007,
+    0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x01bc, 0x01bd, 0x01be, 0x01bf, 0xffff, 0xffff, 0x01c0, 0xffff,
+    0x01c1, 0x01c2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x01c3, 0x01c4, 0x01c5, 0x01c6, 0x01c7,
+    0xffff, 0xffff, 0x01c8, 0xffff, 0x01c9, 0x800c, 0x01ca, 0x800c, 0x01cb, 0xffff, 0x01cc, 0xffff,
+    0x01cd, 0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 0x01d4, 0xffff, 0xffff, 0x01d5, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x01d6, 0xffff, 0xffff, 0x01d7, 0xffff, 0xffff, 0x01d8, 0xffff, 0xffff,
+    0x01d9, 0x01da, 0x01db, 0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e0, 0x01e1, 0x8028, 0x01e2, 0x01e3,
+    0xffff, 0xffff, 0xffff, 0x01e4, 0xffff, 0x01e5, 0x01e6, 0x01e7, 0x01e8, 0x8004, 0x01e9, 0x8004,
+    0x01ea, 0xffff, 0x8004, 0x01eb, 0xffff, 0xffff, 0x01ec, 0x01ed, 0x01ee, 0xffff, 0x01ef, 0xffff,
+    0xffff, 0x01f0, 0xffff, 0x01f1, 0x800a, 0x01f2, 0x01f3, 0x01f4, 0x8008, 0x8008, 0x01f5, 0x01f6,
+    0x01f7, 0x01f8, 0x01f9, 0x01fa, 0x01fb, 0x01fc, 0xffff, 0x01fd, 0x8004, 0x01fe, 0x01ff, 0x0200,
+    0x0201, 0xffff, 0xffff, 0xffff, 0x0202, 0x0203, 0x0204, 0x8010, 0x8010, 0x0205, 0x8010, 0x0206,
+    0x0207, 0x0208, 0x0209, 0x020a, 0x020b, 0x8010, 0x020c, 0x8010, 0x020d, 0xffff, 0x020e, 0x020f,
+    0x0210, 0x0211, 0x0212, 0xffff, 0x0213, 0xffff, 0xffff, 0xffff, 0x0214, 0x8010, 0x0215, 0x0216,
+    0x0217, 0xffff, 0xffff, 0xffff, 0x0218, 0xffff, 0x0219, 0xffff, 0xffff, 0x021a, 0xffff, 0x021b,
+    0x021c, 0x021d, 0x021e, 0x021f, 0x0220, 0x0221, 0xffff, 0xffff, 0xffff, 0xffff, 0x0222, 0x0223,
+    0x0224, 0x0225, 0x0226, 0x8002, 0x0227, 0xffff, 0x0228, 0xffff, 0x0229, 0x022a, 0x022b, 0x022c,
+    0x022d, 0x022e, 0xffff, 0xffff, 0x022f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0230, 0x0231,
+    0xffff, 0xffff, 0x0232, 0xffff, 0xffff, 0x0233, 0xffff, 0x0234, 0xffff, 0xffff, 0x0235, 0xffff,
+    0xffff, 0x0236, 0xffff, 0x0237, 0x0238, 0xffff, 0x0239, 0xffff, 0x023a, 0x023b, 0x023c, 0x8014,
+    0x023d, 0x023e, 0x8014, 0x023f, 0x0240, 0x8000, 0x0241, 0x0242, 0x0243, 0xffff, 0x0244, 0xffff,
+    0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0xffff, 0x024a, 0xffff, 0xffff, 0xffff, 0x024b, 0xffff,
+    0xffff, 0xffff, 0x024c, 0x024d, 0x024e, 0xffff, 0x024f, 0x0250, 0x0251, 0x0252, 0x0253, 0xffff,
+    0xffff, 0x0254, 0x0255, 0x8024, 0x0256, 0xffff, 0x0257, 0x0258, 0x0259, 0x025a, 0xffff, 0xffff,
+    0x025b, 0x025c, 0x025d, 0x025e, 0xffff, 0x025f, 0xffff, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264,
+    0x0265, 0x0266, 0x0267, 0x8019, 0x0268, 0x0269, 0x026a, 0x026b, 0x026c, 0x8014, 0x026d, 0x8014,
+    0x8014, 0x026e, 0x026f, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x8017,
+    0x0278, 0x8019, 0x0279, 0x027a, 0x027b, 0xffff, 0x027c, 0xffff, 0x027d, 0xffff, 0x027e, 0xffff,
+    0x027f, 0x0280, 0xffff, 0x0281, 0xffff, 0x0282, 0xffff, 0xffff, 0x0283, 0x8017, 0x0284, 0x8017,
+    0x0285, 0xffff, 0xffff, 0xffff, 0xffff, 0x0286, 0xffff, 0x0287, 0xffff, 0x0288, 0xffff, 0x0289,
+    0x028a, 0xffff, 0x028b, 0xffff, 0xffff, 0x028c, 0xffff, 0x028d, 0x028e, 0xffff, 0x028f, 0x0290,
+    0xffff, 0xffff, 0x0291, 0xffff, 0xffff, 0x0292, 0x0293, 0x0294, 0x0295, 0x8017, 0x8017, 0x8017,
+    0x0296, 0x0297, 0x8017, 0x8017, 0x0298, 0x0299, 0x8017, 0x029a, 0x8017, 0x029b, 0x8017, 0x029c,
+    0xffff, 0xffff, 0xffff, 0x029d, 0x8017, 0x8017, 0x029e, 0x029f, 0x02a0, 0x8017, 0x02a1, 0x02a2,
+    0x8017, 0x02a3, 0x02a4, 0x02a5, 0x02a6, 0x02a7, 0x02a8, 0xffff, 0x8017, 0x02a9, 0x8017, 0x8017,
+    0x02aa, 0x02ab, 0x02ac, 0x02ad, 0xffff, 0xffff, 0x02ae, 0xffff, 0x02af, 0x02b0, 0x02b1, 0x02b2,
+    0x02b3, 0x02b4, 0xffff, 0xffff, 0x802a, 0x02b5, 0x02b6, 0x02b7, 0x02b8, 0x02b9, 0x02ba, 0x02bb,
+    0x02bc, 0x02bd, 0x02be, 0x02bf, 0x02c0, 0xffff, 0x02c1, 0xffff, 0x02c2, 0x02c3, 0x02c4, 0x02c5,
+    0x02c6, 0x8029, 0x02c7, 0x02c8, 0x02c9, 0x02ca, 0xffff, 0x02cb, 0x02cc, 0x8029, 0x8029, 0x8029,
+    0xffff, 0xffff, 0xffff, 0x02cd, 0xffff, 0x02ce, 0xffff, 0xffff, 0x02cf, 0x8029, 0x02d0, 0x02d1,
+    0x02d2, 0x02d3, 0x02d4, 0x02d5, 0x02d6, 0xffff, 0x02d7, 0xffff, 0x02d8, 0xffff, 0x02d9, 0xffff,
+    0x02da, 0x02db, 0xffff, 0x02dc, 0x02dd, 0xffff, 0x02de, 0xffff, 0x02df, 0xffff, 0x02e0, 0xffff,
+    0xffff, 0x02e1, 0xffff, 0xffff, 0x02e2, 0x02e3, 0xffff, 0xffff, 0x02e4, 0x02e5, 0xffff, 0xffff,
+    0x02e6, 0xffff, 0xffff, 0xffff, 0x02e7, 0xffff, 0xffff, 0xffff, 0xffff, 0x02e8, 0xffff, 0xffff,
+    0x02e9, 0x02ea, 0x02eb, 0x02ec, 0x8017, 0x02ed, 0x02ee, 0x02ef, 0xffff, 0x02f0, 0xffff, 0xffff,
+    0x02f1, 0xffff, 0xffff, 0xffff, 0xffff, 0x02f2, 0xffff, 0x02f3, 0x02f4, 0xffff, 0x02f5, 0xffff,
+    0xffff, 0x02f6, 0xffff, 0x02f7, 0x02f8, 0xffff, 0x02f9, 0xffff, 0xffff, 0x02fa, 0xffff, 0x02fb,
+    0x02fc, 0xffff, 0x02fd, 0xffff, 0xffff, 0x02fe, 0xffff, 0xffff, 0x02ff, 0xffff, 0x0300, 0x0301,
+    0xffff, 0x0302, 0xffff, 0x0303, 0xffff, 0x0304, 0xffff, 0x0305, 0x0306, 0x0307, 0x8005, 0x0308,
+    0xffff, 0x0309, 0xffff, 0x030a, 0x8005, 0x030b, 0x030c, 0x030d, 0x030e, 0x030f, 0x0310, 0x0311,
+    0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031a, 0x031b, 0xffff, 0x031c,
+    0xffff, 0xffff, 0xffff, 0x031d, 0xffff, 0x031e, 0xffff, 0x031f, 0x0320, 0x0321, 0x0322, 0x0323,
+    0x800f, 0x0324, 0x0325, 0x800f, 0x0326, 0xffff, 0x0327, 0xffff, 0x0328, 0x800f, 0x0329, 0x800f,
+    0x032a, 0xffff, 0x032b, 0xffff, 0x032c, 0x800f, 0x032d, 0x032e, 0x800f, 0x032f, 0x800f, 0x0330,
+    0xffff, 0xffff, 0x0331, 0xffff, 0xffff, 0x0332, 0xffff, 0x0333, 0xffff, 0x0334, 0xffff, 0xffff,
+    0xffff, 0x0335, 0xffff, 0x0336, 0xffff, 0x0337, 0xffff, 0x0338, 0xffff, 0x0339, 0xffff, 0xffff,
+    0x800f, 0x800f, 0x033a, 0x800f, 0xffff, 0x033b, 0xffff, 0xffff, 0xffff, 0xffff, 0x033c, 0x033d,
+    0xffff, 0x033e, 0xffff, 0x033f, 0x0340, 0x0341, 0x8006, 0x0342, 0x800f, 0x0343, 0x800f, 0x0344,
+    0x800f, 0x0345, 0x800f, 0x0346, 0x800f, 0x0347, 0x0348, 0x0349, 0x034a, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x034b, 0xffff, 0x034c, 0xffff, 0xffff, 0x034d, 0xffff, 0x034e, 0x034f, 0x0350, 0x8003,
+    0x0351, 0xffff, 0x0352, 0xffff, 0xffff, 0xffff, 0x0353, 0x0354, 0xffff, 0xffff, 0x0355, 0x0356,
+    0xffff, 0x801d, 0xffff, 0x0357, 0x801d, 0x0358, 0x801d, 0x801d, 0x0359, 0x801d, 0x035a, 0x801d,
+    0x035b, 0xffff, 0x801d, 0x035c, 0x801d, 0x035d, 0x801d, 0x035e, 0x035f, 0x801d, 0x0360, 0x801d,
+    0x0361, 0x801d, 0x0362, 0x801d, 0x801d, 0x0363, 0x801d, 0x0364, 0x801d, 0x0365, 0x801d, 0x0366,
+    0x0367, 0x0368, 0x0369, 0x801c, 0x036a, 0x036b, 0x036c, 0x801e, 0x036d, 0xffff, 0x036e, 0x036f,
+    0x0370, 0x0371, 0x801e, 0x0372, 0xffff, 0xffff, 0xffff, 0x0373, 0x0374, 0xffff, 0x0375, 0x0376,
+    0xffff, 0x0377, 0xffff, 0x0378, 0x0379, 0x037a, 0x037b, 0x037c, 0xffff, 0x037d, 0xffff, 0x037e,
+    0x037f, 0xffff, 0xffff, 0xffff, 0x0380, 0x801e, 0x0381, 0x801e, 0x0382, 0x801e, 0x0383, 0x0384,
+    0x801e, 0x0385, 0x801e, 0x801e, 0x0386, 0xffff, 0x0387, 0xffff, 0x801e, 0x801e, 0x0388, 0x0389,
+    0x038a, 0xffff, 0x038b, 0xffff, 0xffff, 0xffff, 0xffff, 0x038c, 0x038d, 0x801b, 0x038e, 0x801b,
+    0xffff, 0x038f, 0xffff, 0x0390, 0x0391, 0xffff, 0x0392, 0xffff, 0x801b, 0x0393, 0x801b, 0x0394,
+    0x0395, 0xffff, 0xffff, 0xffff, 0x0396, 0x0397, 0xffff, 0x0398, 0x801d, 0x801d, 0x0399, 0x801d,
+    0x039a, 0x039b, 0xffff, 0x039c, 0x801d, 0x039d, 0x801d, 0x039e, 0x801d, 0x039f, 0x801d, 0x03a0,
+    0xffff, 0x03a1, 0xffff, 0xffff, 0x03a2, 0x03a3, 0x03a4, 0x03a5, 0xffff, 0x03a6, 0xffff, 0xffff,
+    0xffff, 0x03a7, 0xffff, 0x03a8, 0xffff, 0x03a9, 0xffff, 0x03aa, 0x801b, 0x03ab, 0x03ac, 0x03ad,
+    0x03ae, 0x03af, 0x03b0, 0xffff, 0x03b1, 0xffff, 0xffff, 0xffff, 0xffff, 0x03b2, 0xffff, 0xffff,
+    0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0xffff, 0x03b8, 0xffff, 0x03b9, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x03ba, 0xffff, 0xffff, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+    0xffff, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x800b, 0x03c5, 0x800b, 0x03c6, 0x800b, 0x800b, 0x03c7,
+    0x800b, 0x03c8, 0x03c9, 0x03ca, 0x800b, 0x03cb, 0x800b, 0x03cc, 0xffff, 0x03cd, 0x03ce, 0x03cf,
+    0x03d0, 0x800b, 0x03d1, 0x800b, 0x03d2, 0x800b, 0xffff, 0x800b, 0x800b, 0x03d3, 0x800b, 0x03d4,
+    0x800b, 0x03d5, 0x03d6, 0x03d7, 0x03d8, 0x03d9, 0x03da, 0x03db, 0x03dc, 0x03dd, 0x800d, 0x03de,
+    0x03df, 0x03e0, 0x8008, 0x03e1, 0x03e2, 0x03e3, 0x8007, 0x8007, 0x03e4, 0x03e5, 0x8007, 0x8007,
+    0xffff, 0x03e6, 0x03e7, 0x800a, 0x800a, 0x03e8, 0x800a, 0x03e9, 0x03ea, 0x800a, 0x03eb, 0x800a,
+    0x800a, 0x03ec, 0x800a, 0x03ed, 0xffff, 0x03ee, 0xffff, 0x03ef, 0xffff, 0x03f0, 0xffff, 0x03f1,
+    0x800a, 0x03f2, 0x03f3, 0x03f4, 0x03f5, 0x8008, 0x03f6, 0x8008, 0x800d, 0x03f7, 0x800d, 0x03f8,
+    0x8008, 0x03f9, 0x8008, 0x03fa, 0x03fb, 0x03fc, 0x8008, 0x8008, 0x8008, 0x03fd, 0x8008, 0x03fe,
+    0x8008, 0x03ff, 0x8008, 0x0400, 0x8007, 0x8007, 0x0401, 0x8007, 0x0402, 0x0403, 0x0404, 0x8006,
+    0x8006, 0x0405, 0x8006, 0x0406, 0x0407, 0x8006, 0x0408, 0x8006, 0x8006, 0x8006, 0x8006, 0x0409,
+    0x040a, 0x8006, 0x040b, 0x8006, 0x8006, 0x040c, 0x040d, 0xffff, 0x040e, 0x8006, 0xffff, 0x040f,
+    0x0410, 0xffff, 0x0411, 0xffff, 0x0412, 0xffff, 0xffff, 0xffff, 0xffff, 0x0413, 0xffff, 0xffff,
+    0x0414, 0xffff, 0xffff, 0xffff, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0xffff, 0x041a, 0x041b,
+    0x041c, 0x041d, 0x041e, 0x041f, 0x8007, 0x0420, 0x8007, 0x0421, 0x800c, 0x0422, 0x800c, 0x0423,
+    0xffff, 0xffff, 0x0424, 0xffff, 0x8007, 0x0425, 0x8007, 0x0426, 0x8007, 0x0427, 0x0428, 0x0429,
+    0x042a, 0xffff, 0x800c, 0x042b, 0x800c, 0x042c, 0x800c, 0x042d, 0x042e, 0x042f, 0x0430, 0x0431,
+    0x800c, 0x800c, 0x0432, 0x800c, 0x8007, 0x0433, 0x8007, 0x0434, 0x0435, 0x0436, 0x0437, 0x8010,
+    0x800c, 0x0438, 0x800c, 0x800c, 0xffff, 0xffff, 0x0439, 0x043a, 0x043b, 0x800c, 0x043c, 0x043d,
+    0x043e, 0xffff, 0x800c, 0x043f, 0xffff, 0xffff, 0x0440, 0xffff, 0xffff, 0xffff, 0xffff, 0x0441,
+    0xffff, 0xffff, 0x0442, 0xffff, 0xffff, 0x0443, 0xffff, 0xffff, 0x0444, 0x0445, 0x0446, 0x0447,
+    0xffff, 0xffff, 0x0448, 0xffff, 0x0449, 0x8001, 0x044a, 0x044b, 0x044c, 0x044d, 0x8001, 0x044e,
+    0xffff, 0x044f, 0xffff, 0x0450, 0x8001, 0x0451, 0x0452, 0xffff, 0x0453, 0x0454, 0x0455, 0x0456,
+    0x8028, 0x0457, 0x8028, 0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x045d, 0x8028, 0xffff, 0x045e,
+    0x045f, 0x0460, 0xffff, 0x0461, 0xffff, 0xffff, 0x0462, 0x0463, 0x0464, 0x0465, 0xffff, 0x0466,
+    0xffff, 0xffff, 0xffff, 0x0467, 0x0468, 0x0469, 0x8004, 0x8004, 0xffff, 0x046a, 0xffff, 0x046b,
+    0x046c, 0x8004, 0xffff, 0x046d, 0x046e, 0x046f, 0x8004, 0x0470, 0x0471, 0x0472, 0x8004, 0x8004,
+    0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0xffff, 0xffff, 0xffff, 0x8004, 0x0478, 0x8004, 0x0479,
+    0x8004, 0x047a, 0x8004, 0x047b, 0xffff, 0x047c, 0xffff, 0x047d, 0xffff, 0x047e, 0xffff, 0xffff,
+    0x047f, 0x0480, 0x0481, 0x8008, 0x0482, 0x0483, 0xffff, 0xffff, 0x0484, 0x0485, 0xffff, 0xffff,
+    0x0486, 0x0487, 0xffff, 0xffff, 0x0488, 0x0489, 0xffff, 0xffff, 0x048a, 0x8007, 0x8007, 0x8007,
+    0x8007, 0x8007, 0x8007, 0x048b, 0x048c, 0x048d, 0xffff, 0xffff, 0x048e, 0x048f, 0xffff, 0xffff,
+    0x0490, 0x0491, 0xffff, 0x0492, 0x8004, 0x8004, 0x0493, 0x0494, 0xffff, 0x0495, 0xffff, 0xffff,
+    0x8004, 0x8004, 0x8004, 0x0496, 0x0497, 0x0498, 0xffff, 0xffff, 0x0499, 0x049a, 0xffff, 0xffff,
+    0x8004, 0x049b, 0x049c, 0x049d, 0x049e, 0x049f, 0x04a0, 0x04a1, 0x04a2, 0x8010, 0x8010, 0x8010,
+    0x04a3, 0x8010, 0x8010, 0x8010, 0x04a4, 0x800c, 0x8010, 0x04a5, 0x8010, 0x04a6, 0x8010, 0x8010,
+    0x04a7, 0x8010, 0x04a8, 0x8010, 0x8010, 0x04a9, 0x04aa, 0x04ab, 0x04ac, 0x04ad, 0x04ae, 0x04af,
+    0x04b0, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0x04b1, 0x8010, 0x04b2, 0x8010, 0x04b3, 0x8010,
+    0x04b4, 0xffff, 0xffff, 0xffff, 0x04b5, 0xffff, 0x8010, 0x04b6, 0xffff, 0xffff, 0x04b7, 0xffff,
+    0x8010, 0x8010, 0x8010, 0x04b8, 0x8010, 0x04b9, 0x04ba, 0xffff, 0x8010, 0x04bb, 0x8010, 0x04bc,
+    0x04bd, 0xffff, 0xffff, 0xffff, 0x04be, 0x8010, 0x04bf, 0x8010, 0x04c0, 0x8010, 0x04c1, 0x04c2,
+    0x8010, 0x8010, 0x04c3, 0x04c4, 0x04c5, 0x04c6, 0xffff, 0xffff, 0x8010, 0x04c7, 0x8010, 0x04c8,
+    0x04c9, 0x04ca, 0xffff, 0xffff, 0xffff, 0x04cb, 0x04cc, 0x04cd, 0x04ce, 0x04cf, 0x04d0, 0x04d1,
+    0x04d2, 0x04d3, 0x04d4, 0x04d5, 0x04d6, 0x04d7, 0x04d8, 0x8027, 0x04d9, 0x04da, 0xffff, 0x04db,
+    0x04dc, 0x04dd, 0x04de, 0x04df, 0xffff, 0x04e0, 0xffff, 0x04e1, 0x8027, 0x04e2, 0x04e3, 0x04e4,
+    0xffff, 0xffff, 0xffff, 0x04e5, 0xffff, 0xffff, 0x04e6, 0x04e7, 0xffff, 0x04e8, 0xffff, 0x8002,
+    0x8002, 0x04e9, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0x04ea, 0x04eb, 0xffff, 0x04ec, 0xffff,
+    0x04ed, 0xffff, 0x04ee, 0xffff, 0x04ef, 0x8003, 0x04f0, 0x8003, 0x04f1, 0xffff, 0x04f2, 0xffff,
+    0x04f3, 0x8003, 0x04f4, 0x04f5, 0x04f6, 0xffff, 0xffff, 0xffff, 0xffff, 0x04f7, 0xffff, 0x04f8,
+    0x8002, 0x8002, 0x04f9, 0x04fa, 0x8002, 0x04fb, 0x04fc, 0xffff, 0xffff, 0xffff, 0x04fd, 0x04fe,
+    0xffff, 0xffff, 0x04ff, 0x0500, 0xffff, 0xffff, 0x0501, 0x0502, 0xffff, 0xffff, 0xffff, 0x0503,
+    0xffff, 0x0504, 0x0505, 0x0506, 0x0507, 0xffff, 0x0508, 0xffff, 0x0509, 0x8014, 0x050a, 0x8014,
+    0x050b, 0x8014, 0x050c, 0x8014, 0x050d, 0xffff, 0x050e, 0xffff, 0x050f, 0xffff, 0x0510, 0x0511,
+    0xffff, 0x0512, 0xffff, 0x0513, 0x0514, 0x8014, 0x8014, 0x8014, 0xffff, 0x0515, 0x0516, 0x0517,
+    0x8014, 0x0518, 0x8014, 0x0519, 0xffff, 0xffff, 0x051a, 0xffff, 0x051b, 0xffff, 0x051c, 0x051d,
+    0x051e, 0x8000, 0x051f, 0x8000, 0x0520, 0x8000, 0x0521, 0x8000, 0x8000, 0x8000, 0x8000, 0x0522,
+    0x0523, 0xffff, 0x0524, 0xffff, 0x0525, 0xffff, 0xffff, 0xffff, 0x0526, 0x8000, 0x0527, 0x8000,
+    0x8000, 0x0528, 0x8000, 0x8000, 0x0529, 0x052a, 0xffff, 0xffff, 0x052b, 0x052c, 0xffff, 0xffff,
+    0x052d, 0xffff, 0x052e, 0xffff, 0x052f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0530, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0531, 0xffff, 0x0532, 0xffff, 0x0533, 0x0534, 0xffff, 0x0535, 0x0536,
+    0x0537, 0x0538, 0x802a, 0x802a, 0x0539, 0x053a, 0x053b, 0x053c, 0xffff, 0x053d, 0x053e, 0x053f,
+    0x0540, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0xffff, 0xffff, 0xffff, 0x0547, 0x0548,
+    0x0549, 0x054a, 0x054b, 0x054c, 0xffff, 0xffff, 0x054d, 0xffff, 0x054e, 0x054f, 0x8024, 0x8024,
+    0x0550, 0x0551, 0x8024, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x8024, 0x8024, 0x0557, 0x0558,
+    0x8024, 0x8024, 0x0559, 0x055a, 0x8024, 0x055b, 0x055c, 0x055d, 0xffff, 0xffff, 0xffff, 0x055e,
+    0x055f, 0x0560, 0x8029, 0x8029, 0x0561, 0x0562, 0x0563, 0x0564, 0xffff, 0x0565, 0x0566, 0x0567,
+    0xffff, 0xffff, 0xffff, 0x0568, 0xffff, 0xffff, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x8019,
+    0x056e, 0x8013, 0x056f, 0x8013, 0xffff, 0xffff, 0xffff, 0x0570, 0x0571, 0x8019, 0x8019, 0x8019,
+    0x0572, 0x8019, 0x0573, 0x8019, 0x8019, 0x0574, 0x8019, 0x0575, 0x0576, 0x8013, 0x0577, 0x0578,
+    0x8019, 0x0579, 0x8019, 0x057a, 0xffff, 0x057b, 0xffff, 0xffff, 0x057c, 0x8014, 0x057d, 0x057e,
+    0x057f, 0x0580, 0x0581, 0x0582, 0x8014, 0x0583, 0x8014, 0x0584, 0x8014, 0x8014, 0x8014, 0x0585,
+    0x8014, 0x0586, 0x0587, 0x0588, 0x8013, 0x0589, 0x8013, 0x8013, 0x058a, 0x8014, 0x058b, 0x8014,
+    0x058c, 0x8013, 0x058d, 0x8013, 0x058e, 0x8014, 0x058f, 0x8014, 0x0590, 0x0591, 0x0592, 0x0593,
+    0x0594, 0x8017, 0x8017, 0x8017, 0x0595, 0x8017, 0x0596, 0x8017, 0x0597, 0x8019, 0x0598, 0x8019,
+    0x0599, 0x059a, 0x059b, 0x059c, 0x059d, 0x059e, 0xffff, 0xffff, 0x8019, 0x059f, 0x8019, 0x05a0,
+    0x05a1, 0x05a2, 0x05a3, 0xffff, 0x05a4, 0xffff, 0x05a5, 0x05a6, 0x8029, 0x05a7, 0x8029, 0x05a8,
+    0x05a9, 0x05aa, 0xffff, 0x05ab, 0x05ac, 0x05ad, 0x05ae, 0x05af, 0x05b0, 0x8017, 0x05b1, 0x8017,
+    0x05b2, 0x05b3, 0xffff, 0x05b4, 0x8017, 0x8017, 0x05b5, 0x8017, 0x05b6, 0x8017, 0x05b7, 0x8017,
+    0x05b8, 0xffff, 0xffff, 0xffff, 0xffff, 0x05b9, 0xffff, 0x05ba, 0xffff, 0x05bb, 0xffff, 0x05bc,
+    0xffff, 0x05bd, 0xffff, 0x05be, 0x05bf, 0x8011, 0x05c0, 0x8011, 0x05c1, 0xffff, 0x05c2, 0x05c3,
+    0x8011, 0x05c4, 0x8011, 0x05c5, 0x05c6, 0x8011, 0x05c7, 0x05c8, 0xffff, 0x05c9, 0xffff, 0x05ca,
+    0x05cb, 0x05cc, 0x05cd, 0xffff, 0xffff, 0xffff, 0x05ce, 0xffff, 0xffff, 0xffff, 0x05cf, 0x05d0,
+    0xffff, 0xffff, 0x05d1, 0xffff, 0xffff, 0x05d2, 0x05d3, 0x05d4, 0xffff, 0xffff, 0x05d5, 0xffff,
+    0x05d6, 0x8017, 0x05d7, 0x05d8, 0x05d9, 0x05da, 0x8017, 0x8017, 0x8017, 0x05db, 0x8017, 0x8017,
+    0x05dc, 0x8017, 0x8017, 0x8017, 0x05dd, 0x05de, 0x8017, 0x05df, 0xffff, 0xffff, 0x05e0, 0xffff,
+    0x05e1, 0xffff, 0x05e2, 0xffff, 0x8017, 0x05e3, 0x8017, 0x05e4, 0x8017, 0x05e5, 0x05e6, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x05e7, 0x8017, 0x8017, 0x05e8, 0x05e9, 0x05ea, 0x05eb, 0xffff, 0xffff,
+    0x8017, 0x8017, 0x05ec, 0x05ed, 0x05ee, 0xffff, 0xffff, 0xffff, 0x05ef, 0x05f0, 0xffff, 0x05f1,
+    0x05f2, 0xffff, 0x05f3, 0x05f4, 0x8017, 0x8017, 0x8017, 0x05f5, 0x05f6, 0x05f7, 0xffff, 0x05f8,
+    0x05f9, 0x05fa, 0xffff, 0x05fb, 0x05fc, 0x801a, 0x05fd, 0x05fe, 0x05ff, 0x0600, 0x0601, 0x0602,
+    0x0603, 0x0604, 0x8017, 0x8017, 0x0605, 0x0606, 0x0607, 0x0608, 0xffff, 0xffff, 0x0609, 0xffff,
+    0x8017, 0x060a, 0x8017, 0x8017, 0x060b, 0xffff, 0x060c, 0xffff, 0xffff, 0xffff, 0x060d, 0xffff,
+    0x060e, 0x060f, 0x0610, 0x0611, 0xffff, 0xffff, 0x0612, 0xffff, 0x0613, 0x0614, 0xffff, 0x0615,
+    0x0616, 0xffff, 0x0617, 0xffff, 0xffff, 0x0618, 0xffff, 0x0619, 0x061a, 0xffff, 0x061b, 0xffff,
+    0x061c, 0x061d, 0x061e, 0x061f, 0x802a, 0x802a, 0x0620, 0x0621, 0x0622, 0x8020, 0x0623, 0x8020,
+    0x0624, 0xffff, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d, 0xffff,
+    0x062e, 0x062f, 0xffff, 0xffff, 0x0630, 0x0631, 0x0632, 0xffff, 0x0633, 0x8020, 0x0634, 0x8020,
+    0x0635, 0xffff, 0xffff, 0xffff, 0x0636, 0x0637, 0xffff, 0xffff, 0x8020, 0x0638, 0x8020, 0x0639,
+    0x063a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x063b, 0xffff, 0x063c, 0x063d, 0x063e, 0x063f,
+    0x0640, 0x0641, 0x0642, 0x8025, 0x0643, 0x8025, 0x8025, 0x8025, 0x0644, 0x0645, 0x0646, 0x0647,
+    0x8025, 0x8025, 0x8025, 0x0648, 0x0649, 0x8029, 0x064a, 0x8029, 0x064b, 0x064c, 0xffff, 0xffff,
+    0x064d, 0x064e, 0xffff, 0x064f, 0xffff, 0x0650, 0x0651, 0x0652, 0x0653, 0x8029, 0x0654, 0x8029,
+    0xffff, 0x0655, 0xffff, 0x0656, 0xffff, 0x0657, 0xffff, 0x0658, 0xffff, 0x0659, 0xffff, 0x065a,
+    0x065b, 0x065c, 0x8023, 0x065d, 0x8029, 0x8029, 0x065e, 0x8029, 0x8023, 0x8023, 0x065f, 0x8023,
+    0x0660, 0x0661, 0x0662, 0x8029, 0x0663, 0x8023, 0x0664, 0x8023, 0x0665, 0x8029, 0x0666, 0x8029,
+    0x0667, 0xffff, 0x0668, 0xffff, 0x0669, 0xffff, 0x066a, 0xffff, 0x066b, 0x066c, 0x8029, 0x066d,
+    0x8029, 0x066e, 0x8029, 0x066f, 0x0670, 0x0671, 0xffff, 0x0672, 0x8017, 0x8017, 0x0673, 0x0674,
+    0x0675, 0x0676, 0xffff, 0xffff, 0x8029, 0x0677, 0x8029, 0x0678, 0x8029, 0x0679, 0x8029, 0x067a,
+    0x8029, 0x067b, 0x8029, 0x067c, 0x8029, 0x067d, 0x8029, 0x067e, 0xffff, 0x067f, 0xffff, 0x0680,
+    0x0681, 0x8023, 0x0682, 0x0683, 0x0684, 0x8029, 0x0685, 0x0686, 0x0687, 0x0688, 0x0689, 0xffff,
+    0x068a, 0x068b, 0xffff, 0xffff, 0x068c, 0xffff, 0xffff, 0xffff, 0x068d, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x068e, 0xffff, 0xffff, 0x068f, 0x0690, 0xffff, 0x0691, 0x8017, 0x8017, 0x0692, 0x8017,
+    0xffff, 0x0693, 0xffff, 0x0694, 0x8017, 0x8017, 0x0695, 0x8017, 0x8017, 0x0696, 0x8017, 0x0697,
+    0x8017, 0x8017, 0x8017, 0x0698, 0x0699, 0x069a, 0xffff, 0xffff, 0x069b, 0x8017, 0x069c, 0x069d,
+    0x069e, 0x069f, 0x06a0, 0xffff, 0xffff, 0xffff, 0xffff, 0x06a1, 0xffff, 0x06a2, 0xffff, 0x06a3,
+    0xffff, 0xffff, 0x06a4, 0xffff, 0x800e, 0xffff, 0x800e, 0x06a5, 0xffff, 0x06a6, 0xffff, 0x06a7,
+    0xffff, 0x06a8, 0xffff, 0x06a9, 0x800e, 0x06aa, 0x800e, 0x06ab, 0x800e, 0x06ac, 0x800e, 0x06ad,
+    0xffff, 0x06ae, 0xffff, 0x06af, 0xffff, 0x06b0, 0xffff, 0x06b1, 0x800e, 0x06b2, 0x800e, 0x06b3,
+    0x800e, 0x06b4, 0x800e, 0x06b5, 0xffff, 0x06b6, 0xffff, 0xffff, 0x800e, 0x800e, 0x06b7, 0x800e,
+    0x06b8, 0x800e, 0x06b9, 0x800e, 0x06ba, 0xffff, 0x06bb, 0xffff, 0xffff, 0xffff, 0xffff, 0x06bc,
+    0xffff, 0x06bd, 0xffff, 0x06be, 0xffff, 0x06bf, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005,
+    0x06c0, 0xffff, 0x8005, 0x06c1, 0xffff, 0xffff, 0x06c2, 0xffff, 0x8005, 0x06c3, 0x8005, 0x06c4,
+    0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x06c5, 0x8005, 0x06c6, 0x8005, 0x06c7,
+    0x8005, 0x8005, 0x06c8, 0x8005, 0x8005, 0x06c9, 0x06ca, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e,
+    0x06cb, 0xffff, 0x06cc, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0x06cd, 0xffff, 0x06ce, 0xffff,
+    0xffff, 0x800e, 0xffff, 0x06cf, 0x06d0, 0xffff, 0x06d1, 0xffff, 0xffff, 0x06d2, 0xffff, 0x06d3,
+    0x06d4, 0xffff, 0x06d5, 0xffff, 0xffff, 0x06d6, 0xffff, 0x06d7, 0x800e, 0xffff, 0x800e, 0x06d8,
+    0xffff, 0x06d9, 0xffff, 0x06da, 0x800e, 0x06db, 0x800e, 0x06dc, 0xffff, 0x06dd, 0xffff, 0xffff,
+    0x800e, 0x06de, 0x800e, 0x06df, 0x800e, 0x06e0, 0x800e, 0x06e1, 0xffff, 0xffff, 0xffff, 0x06e2,
+    0xffff, 0x06e3, 0xffff, 0x06e4, 0xffff, 0x06e5, 0xffff, 0xffff, 0xffff, 0x06e6, 0xffff, 0x06e7,
+    0x06e8, 0xffff, 0x06e9, 0xffff, 0x06ea, 0x800f, 0x06eb, 0x800f, 0x800f, 0x06ec, 0x800f, 0x06ed,
+    0x800f, 0x06ee, 0x800f, 0x800f, 0x06ef, 0x800f, 0x06f0, 0x800f, 0xffff, 0xffff, 0x06f1, 0xffff,
+    0x06f2, 0xffff, 0x800f, 0x06f3, 0xffff, 0x06f4, 0xffff, 0x06f5, 0xffff, 0x06f6, 0xffff, 0x06f7,
+    0x800f, 0x06f8, 0x800f, 0x06f9, 0x800f, 0x06fa, 0x800f, 0x06fb, 0xffff, 0x06fc, 0xffff, 0x06fd,
+    0xffff, 0x06fe, 0xffff, 0xffff, 0x800f, 0x800f, 0x06ff, 0x800f, 0x0700, 0xffff, 0x800f, 0x0701,
+    0x800f, 0x0702, 0x800f, 0x800f, 0x0703, 0xffff, 0x0704, 0x0705, 0x800e, 0x0706, 0x800e, 0x0707,
+    0x800e, 0x0708, 0x800e, 0x0709, 0x800e, 0xffff, 0x070a, 0xffff, 0x070b, 0x800f, 0x070c, 0x800f,
+    0xffff, 0x070d, 0xffff, 0x070e, 0xffff, 0x070f, 0xffff, 0x0710, 0xffff, 0x0711, 0xffff, 0x0712,
+    0xffff, 0x0713, 0xffff, 0x0714, 0x0715, 0x800f, 0xffff, 0x0716, 0x0717, 0x800f, 0xffff, 0x0718,
+    0xffff, 0x0719, 0xffff, 0x071a, 0x071b, 0xffff, 0x071c, 0xffff, 0xffff, 0xffff, 0xffff, 0x071d,
+    0xffff, 0x071e, 0x071f, 0x8006, 0x0720, 0x8006, 0x8006, 0x8006, 0x0721, 0xffff, 0x0722, 0xffff,
+    0x0723, 0xffff, 0x0724, 0xffff, 0x0725, 0xffff, 0x800f, 0xffff, 0x800f, 0x0726, 0x800f, 0x0727,
+    0x800f, 0x0728, 0x800f, 0x0729, 0x800f, 0x072a, 0x800f, 0x072b, 0x800f, 0x072c, 0x800f, 0x072d,
+    0x800f, 0x800f, 0x800f, 0x072e, 0x072f, 0xffff, 0x0730, 0xffff, 0x0731, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0732, 0xffff, 0x0733, 0x0734, 0x8003, 0x0735, 0xffff, 0x0736, 0xffff,
+    0xffff, 0x0737, 0x0738, 0x0739, 0x073a, 0x8003, 0x8003, 0x8003, 0x073b, 0x8003, 0x073c, 0x8003,
+    0x073d, 0xffff, 0x8003, 0x073e, 0x8003, 0x073f, 0x8003, 0x0740, 0xffff, 0xffff, 0xffff, 0x0741,
+    0x0742, 0x0743, 0x801d, 0x801d, 0x0744, 0xffff, 0x801d, 0x0745, 0xffff, 0xffff, 0x0746, 0xffff,
+    0x0747, 0x801d, 0x0748, 0x801d, 0x0749, 0x074a, 0x801d, 0x801d, 0xffff, 0xffff, 0xffff, 0x074b,
+    0xffff, 0x074c, 0xffff, 0x074d, 0xffff, 0xffff, 0x074e, 0x074f, 0x0750, 0x0751, 0x801d, 0x0752,
+    0x801d, 0x0753, 0x801d, 0x0754, 0x801d, 0x0755, 0x801d, 0x0756, 0xffff, 0x0757, 0xffff, 0x0758,
+    0x0759, 0x801d, 0x075a, 0x801d, 0x075b, 0x801d, 0x075c, 0x801d, 0x075d, 0x801d, 0x075e, 0x801d,
+    0x801d, 0x075f, 0x801d, 0x0760, 0x801d, 0x0761, 0x801d, 0x0762, 0x801d, 0x0763, 0x801d, 0x0764,
+    0x801d, 0x0765, 0x801d, 0x0766, 0xffff, 0xffff, 0x0767, 0x0768, 0xffff, 0x0769, 0x076a, 0x076b,
+    0x076c, 0x801c, 0x076d, 0x801c, 0x076e, 0x801c, 0x076f, 0x801c, 0x801c, 0x801c, 0x0770, 0x0771,
+    0x0772, 0x0773, 0x0774, 0x801e, 0x0775, 0xffff, 0x0776, 0xffff, 0x801c, 0x0777, 0x801c, 0x0778,
+    0x0779, 0xffff, 0x077a, 0xffff, 0x077b, 0x801e, 0x801e, 0x801e, 0x077c, 0xffff, 0x801e, 0xffff,
+    0x801e, 0x077d, 0x801e, 0x077e, 0xffff, 0xffff, 0xffff, 0x077f, 0x0780, 0xffff, 0x0781, 0x0782,
+    0x0783, 0x0784, 0x0785, 0x802d, 0xffff, 0xffff, 0x0786, 0xffff, 0xffff, 0x0787, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0788, 0x802d, 0x802d, 0x0789, 0x802d, 0x078a, 0xffff, 0x078b, 0xffff,
+    0x078c, 0x078d, 0x078e, 0xffff, 0x078f, 0xffff, 0xffff, 0xffff, 0xffff, 0x0790, 0xffff, 0x0791,
+    0x0792, 0x0793, 0xffff, 0xffff, 0x0794, 0xffff, 0xffff, 0xffff, 0x0795, 0x801e, 0x0796, 0x801e,
+    0x0797, 0x801e, 0x0798, 0x801e, 0x0799, 0x801e, 0x079a, 0x801e, 0x079b, 0x079c, 0x079d, 0x801b,
+    0x079e, 0x079f, 0x801b, 0x801b, 0x801e, 0x07a0, 0x801e, 0x801e, 0xffff, 0xffff, 0x07a1, 0xffff,
+    0x07a2, 0xffff, 0x07a3, 0xffff, 0x07a4, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x07a5, 0x07a6,
+    0x07a7, 0xffff, 0x07a8, 0xffff, 0x801e, 0xffff, 0x07a9, 0x07aa, 0xffff, 0xffff, 0x07ab, 0x801b,
+    0x07ac, 0x801b, 0x07ad, 0x801b, 0x07ae, 0x801b, 0x801b, 0x801b, 0x07af, 0x801b, 0x07b0, 0x801b,
+    0x07b1, 0x801b, 0x07b2, 0x801b, 0x801b, 0x07b3, 0x801b, 0x07b4, 0x801b, 0xffff, 0x07b5, 0xffff,
+    0x801b, 0x801b, 0x801b, 0x07b6, 0x801b, 0x07b7, 0x07b8, 0xffff, 0x07b9, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x07ba, 0xffff, 0x07bb, 0x801d, 0x801d, 0x07bc, 0x801d, 0x07bd, 0x07be, 0xffff, 0xffff,
+    0x801d, 0x801d, 0x07bf, 0x07c0, 0xffff, 0x07c1, 0xffff, 0xffff, 0x07c2, 0x801d, 0x07c3, 0x801d,
+    0x07c4, 0x801d, 0xffff, 0x07c5, 0x801d, 0x07c6, 0x801d, 0x07c7, 0x801d, 0x07c8, 0x801d, 0x07c9,
+    0x801d, 0x07ca, 0x801d, 0x07cb, 0x801d, 0x07cc, 0x801d, 0x07cd, 0xffff, 0x07ce, 0xffff, 0x07cf,
+    0x801d, 0x801d, 0x07d0, 0x801d, 0x801d, 0x07d1, 0x801d, 0x07d2, 0x07d3, 0x801d, 0x07d4, 0x07d5,
+    0x801d, 0x07d6, 0x07d7, 0x07d8, 0x07d9, 0xffff, 0xffff, 0xffff, 0x07da, 0x801b, 0x07db, 0x801b,
+    0x07dc, 0x801b, 0x07dd, 0x801b, 0x07de, 0x801b, 0x07df, 0x801b, 0x07e0, 0x801b, 0x07e1, 0x07e2,
+    0x801b, 0x801b, 0x801b, 0x07e3, 0x801b, 0x801b, 0x07e4, 0x801b, 0x801b, 0x07e5, 0x801b, 0x07e6,
+    0x801b, 0x801b, 0x801b, 0x07e7, 0x07e8, 0xffff, 0xffff, 0xffff, 0x801b, 0x07e9, 0x07ea, 0xffff,
+    0x07eb, 0xffff, 0xffff, 0xffff, 0x07ec, 0xffff, 0xffff, 0xffff, 0x07ed, 0x801b, 0x07ee, 0x801b,
+    0x801b, 0x07ef, 0x801b, 0x07f0, 0x07f1, 0x801b, 0x07f2, 0x801b, 0x801b, 0x07f3, 0x07f4, 0xffff,
+    0x07f5, 0x801b, 0x07f6, 0x07f7, 0x07f8, 0x07f9, 0xffff, 0x07fa, 0xffff, 0x07fb, 0xffff, 0xffff,
+    0xffff, 0x07fc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x07fd, 0xffff, 0xffff, 0x07fe, 0x800b,
+    0xffff, 0xffff, 0xffff, 0x07ff, 0x0800, 0xffff, 0x0801, 0xffff, 0xffff, 0x0802, 0x800b, 0x800b,
+    0x0803, 0xffff, 0x800b, 0x0804, 0xffff, 0x0805, 0x0806, 0x0807, 0xffff, 0x0808, 0xffff, 0x0809,
+    0x080a, 0x800b, 0x800b, 0x800b, 0xffff, 0x080b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b,
+    0x080c, 0x800b, 0x800b, 0x800b, 0x800b, 0x080d, 0x800b, 0x080e, 0x800b, 0x080f, 0x0810, 0xffff,
+    0x0811, 0x0812, 0xffff, 0xffff, 0x0813, 0xffff, 0xffff, 0xffff, 0x800b, 0x0814, 0x0815, 0xffff,
+    0x0816, 0xffff, 0x0817, 0xffff, 0xffff, 0xffff, 0xffff, 0x0818, 0x0819, 0x081a, 0x081b, 0x800a,
+    0x081c, 0x800d, 0x081d, 0x800d, 0xffff, 0x800b, 0xffff, 0x081e, 0xffff, 0x081f, 0xffff, 0x0820,
+    0xffff, 0x0821, 0xffff, 0x0822, 0x0823, 0xffff, 0x0824, 0xffff, 0x0825, 0xffff, 0x0826, 0xffff,
+    0x0827, 0xffff, 0x0828, 0xffff, 0x800b, 0x0829, 0x800b, 0x082a, 0x082b, 0xffff, 0x082c, 0xffff,
+    0xffff, 0x082d, 0xffff, 0x082e, 0x800b, 0x800b, 0x082f, 0x0830, 0xffff, 0x0831, 0xffff, 0x0832,
+    0x8007, 0x0833, 0x8007, 0x8007, 0x0834, 0x0835, 0x0836, 0x800d, 0x0837, 0x0838, 0x0839, 0x8008,
+    0x083a, 0x8008, 0x083b, 0x8008, 0x083c, 0x8008, 0x083d, 0x8008, 0x083e, 0x8007, 0x083f, 0x8007,
+    0x0840, 0x8007, 0x0841, 0x8007, 0x0842, 0x8007, 0x0843, 0x8007, 0x8007, 0x0844, 0x8007, 0x8007,
+    0xffff, 0xffff, 0x0845, 0x0846, 0xffff, 0xffff, 0x0847, 0x0848, 0x0849, 0x084a, 0x084b, 0x800a,
+    0xffff, 0x084c, 0xffff, 0x084d, 0x084e, 0x800d, 0x084f, 0x800d, 0x0850, 0x800d, 0x800a, 0x800d,
+    0xffff, 0x0851, 0x0852, 0x800a, 0x0853, 0x800a, 0x0854, 0x800a, 0x800a, 0x0855, 0x800a, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x8008, 0xffff, 0x0856, 0xffff, 0x0857, 0xffff, 0x0858, 0xffff, 0x0859,
+    0xffff, 0x085a, 0xffff, 0x085b, 0xffff, 0x085c, 0xffff, 0x085d, 0x800a, 0x8008, 0x800a, 0x8008,
+    0x800a, 0x800a, 0x085e, 0x085f, 0x800a, 0x8008, 0x0860, 0x8008, 0x0861, 0x8008, 0x0862, 0x8008,
+    0x0863, 0x8008, 0x0864, 0x8008, 0x0865, 0x8008, 0x0866, 0x8008, 0x0867, 0x8008, 0x0868, 0x8008,
+    0x0869, 0x8007, 0x086a, 0x8007, 0x086b, 0x8007, 0x086c, 0x8007, 0x086d, 0x086e, 0x8008, 0x8008,
+    0x086f, 0x8008, 0x8008, 0x8008, 0x8008, 0x0870, 0x8008, 0x0871, 0x8008, 0x0872, 0x8008, 0x0873,
+    0x8008, 0x0874, 0x8008, 0x0875, 0x8008, 0x0876, 0x8008, 0x0877, 0x8007, 0x8007, 0x0878, 0x8007,
+    0xffff, 0x0879, 0x087a, 0x8006, 0x087b, 0x8006, 0x8006, 0x8006, 0x087c, 0x8006, 0x087d, 0x8006,
+    0x087e, 0xffff, 0x087f, 0xffff, 0x8006, 0x0880, 0x8006, 0x0881, 0x0882, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0x0883, 0xffff, 0x8006, 0x0884, 0x8006,
+    0x0885, 0x8006, 0x0886, 0x8006, 0x8006, 0x0887, 0x0888, 0x0889, 0x8006, 0x088a, 0x088b, 0x088c,
+    0xffff, 0x088d, 0xffff, 0x088e, 0x088f, 0x8006, 0x0890, 0x0891, 0x0892, 0xffff, 0x0893, 0xffff,
+    0x0894, 0xffff, 0x0895, 0xffff, 0x0896, 0xffff, 0x0897, 0xffff, 0xffff, 0x0898, 0xffff, 0xffff,
+    0x0899, 0xffff, 0x089a, 0xffff, 0xffff, 0xffff, 0xffff, 0x089b, 0x089c, 0xffff, 0x800c, 0xffff,
+    0xffff, 0x089d, 0xffff, 0x089e, 0x800c, 0xffff, 0x089f, 0xffff, 0xffff, 0xffff, 0x08a0, 0xffff,
+    0x08a1, 0xffff, 0x8007, 0x8007, 0x08a2, 0x08a3, 0x8007, 0x08a4, 0x08a5, 0x800c, 0x08a6, 0x800c,
+    0x08a7, 0xffff, 0x08a8, 0xffff, 0x08a9, 0x800c, 0x800c, 0x800c, 0x08aa, 0xffff, 0x08ab, 0xffff,
+    0x8007, 0x08ac, 0x8007, 0x08ad, 0x8007, 0x08ae, 0x8007, 0x08af, 0x08b0, 0xffff, 0x08b1, 0xffff,
+    0x800c, 0x08b2, 0x800c, 0x08b3, 0xffff, 0xffff, 0x08b4, 0xffff, 0x8007, 0x08b5, 0x8007, 0x08b6,
+    0x8007, 0x08b7, 0x8007, 0x08b8, 0x8007, 0x08b9, 0x08ba, 0x800c, 0x8007, 0x08bb, 0x8007, 0x08bc,
+    0x08bd, 0x08be, 0x8009, 0x08bf, 0x08c0, 0xffff, 0x800c, 0x08c1, 0x08c2, 0xffff, 0x08c3, 0xffff,
+    0xffff, 0xffff, 0x08c4, 0xffff, 0x08c5, 0xffff, 0x08c6, 0xffff, 0x8007, 0x08c7, 0x8007, 0x08c8,
+    0x8009, 0x08c9, 0x8009, 0x08ca, 0x8007, 0x08cb, 0x8007, 0x8007, 0x08cc, 0x08cd, 0x08ce, 0x08cf,
+    0x800c, 0x800c, 0x08d0, 0x08d1, 0x08d2, 0xffff, 0x08d3, 0xffff, 0x08d4, 0xffff, 0x08d5, 0xffff,
+    0xffff, 0x08d6, 0xffff, 0x08d7, 0x8010, 0x08d8, 0x8010, 0x08d9, 0xffff, 0x8010, 0x08da, 0x8010,
+    0x800c, 0x08db, 0x800c, 0x08dc, 0x08dd, 0x08de, 0x800c, 0x800c, 0xffff, 0xffff, 0x08df, 0xffff,
+    0x800c, 0x800c, 0x08e0, 0x08e1, 0x8010, 0x08e2, 0x8010, 0x8010, 0x800c, 0x800c, 0x08e3, 0x800c,
+    0x800c, 0x08e4, 0x800c, 0x08e5, 0x08e6, 0x08e7, 0x800c, 0x08e8, 0xffff, 0xffff, 0x08e9, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x08ea, 0xffff, 0xffff, 0x08eb, 0x08ec, 0xffff, 0x08ed, 0xffff, 0xffff,
+    0x08ee, 0x08ef, 0x08f0, 0x8001, 0xffff, 0xffff, 0x08f1, 0x08f2, 0x08f3, 0x8001, 0xffff, 0x8001,
+    0x8001, 0x08f4, 0x8001, 0x8001, 0x08f5, 0xffff, 0x08f6, 0xffff, 0xffff, 0x8001, 0xffff, 0x08f7,
+    0xffff, 0x08f8, 0xffff, 0x08f9, 0x8001, 0x8001, 0x08fa, 0x8001, 0x8001, 0x08fb, 0x8001, 0x08fc,
+    0xffff, 0xffff, 0x08fd, 0x08fe, 0x8001, 0xffff, 0x8001, 0xffff, 0x08ff, 0x0900, 0xffff, 0x0901,
+    0xffff, 0x0902, 0xffff, 0x0903, 0x0904, 0xffff, 0x0905, 0xffff, 0x0906, 0x0907, 0x0908, 0x0909,
+    0xffff, 0x090a, 0xffff, 0x090b, 0x090c, 0x090d, 0x090e, 0x8028, 0xffff, 0x090f, 0xffff, 0x0910,
+    0x0911, 0x8028, 0x0912, 0x8028, 0x0913, 0xffff, 0x8028, 0x0914, 0x8028, 0x0915, 0x8028, 0x8028,
+    0xffff, 0x0916, 0xffff, 0x0917, 0x0918, 0x8028, 0x8026, 0x0919, 0xffff, 0x091a, 0xffff, 0x091b,
+    0x8026, 0x091c, 0x091d, 0x091e, 0xffff, 0x091f, 0xffff, 0x0920, 0x0921, 0xffff, 0xffff, 0xffff,
+    0x8028, 0x8028, 0x0922, 0x0923, 0x8028, 0x0924, 0x0925, 0x0926, 0x0927, 0x802a, 0xffff, 0x802a,
+    0xffff, 0x0928, 0xffff, 0x0929, 0xffff, 0xffff, 0x092a, 0x092b, 0xffff, 0x092c, 0xffff, 0xffff,
+    0x092d, 0x8004, 0x092e, 0x8004, 0xffff, 0x092f, 0xffff, 0x0930, 0x0931, 0x0932, 0x0933, 0x8004,
+    0xffff, 0x0934, 0x0935, 0x8004, 0x0936, 0x8004, 0x8004, 0x8004, 0x0937, 0x8004, 0xffff, 0x8004,
+    0x0938, 0x8004, 0x0939, 0x8004, 0xffff, 0x093a, 0x093b, 0x093c, 0x093d, 0x093e, 0xffff, 0x093f,
+    0x0940, 0x0941, 0x8004, 0x0942, 0xffff, 0xffff, 0x0943, 0xffff, 0x0944, 0x0945, 0x8004, 0x0946,
+    0x0947, 0x0948, 0x8004, 0x8004, 0xffff, 0xffff, 0x0949, 0x094a, 0xffff, 0xffff, 0xffff, 0x094b,
+    0xffff, 0xffff, 0x094c, 0x094d, 0x094e, 0x8004, 0x8004, 0x8004, 0x8004, 0x094f, 0x8004, 0x0950,
+    0xffff, 0xffff, 0x0951, 0xffff, 0x8004, 0x0952, 0x8004, 0x0953, 0x8004, 0x0954, 0x8004, 0x0955,
+    0x8004, 0x0956, 0x8004, 0x0957, 0x8004, 0x0958, 0x8004, 0x0959, 0xffff, 0x095a, 0xffff, 0x095b,
+    0xffff, 0x095c, 0xffff, 0x095d, 0xffff, 0x095e, 0xffff, 0x095f, 0x0960, 0x0961, 0x800a, 0x800a,
+    0x0962, 0x8008, 0x0963, 0x8008, 0x800a, 0x800a, 0x800a, 0x0964, 0x800a, 0x800a, 0x0965, 0x0966,
+    0x800a, 0x800a, 0x0967, 0x0968, 0x800a, 0x0969, 0x096a, 0x096b, 0x8008, 0x8008, 0x096c, 0x096d,
+    0x8008, 0x8008, 0x096e, 0x096f, 0x8008, 0x8008, 0x0970, 0x0971, 0x8008, 0x8008, 0x0972, 0x0973,
+    0x8008, 0x0974, 0x0975, 0x0976, 0x0977, 0x8007, 0x8007, 0x8007, 0x8007, 0x0978, 0x8007, 0x8007,
+    0x8007, 0x8007, 0x0979, 0x097a, 0x8007, 0x8007, 0x097b, 0x097c, 0x8007, 0x8007, 0x097d, 0x097e,
+    0x097f, 0x0980, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0981, 0x0982, 0x8004, 0x0983, 0x8004,
+    0xffff, 0x0984, 0xffff, 0xffff, 0x0985, 0x8004, 0xffff, 0x0986, 0x8004, 0x8004, 0x0987, 0x8004,
+    0x0988, 0x0989, 0xffff, 0xffff, 0x8004, 0x8004, 0x8004, 0x098a, 0x8004, 0x8004, 0x098b, 0x098c,
+    0x8004, 0x098d, 0xffff, 0xffff, 0x098e, 0x098f, 0xffff, 0xffff, 0x0990, 0xffff, 0xffff, 0xffff,
+    0x8004, 0x0991, 0x8004, 0x0992, 0x8004, 0x8004, 0x0993, 0x0994, 0x8004, 0x0995, 0x0996, 0xffff,
+    0x8007, 0x8007, 0x0997, 0x0998, 0x0999, 0xffff, 0x099a, 0xffff, 0x099b, 0xffff, 0x099c, 0x099d,
+    0x099e, 0x099f, 0x09a0, 0x8010, 0x09a1, 0x8010, 0x09a2, 0x8010, 0x09a3, 0x8010, 0x09a4, 0x8010,
+    0x8010, 0x09a5, 0x8010, 0x09a6, 0x09a7, 0x09a8, 0x09a9, 0x09aa, 0x8010, 0x09ab, 0x8010, 0x8010,
+    0x09ac, 0x8010, 0x09ad, 0x8010, 0x09ae, 0x8010, 0x09af, 0x8010, 0x8010, 0x8010, 0x8010, 0x09b0,
+    0x8010, 0x8010, 0x8010, 0x09b1, 0x09b2, 0x09b3, 0xffff, 0xffff, 0x09b4, 0x8010, 0x09b5, 0x8010,
+    0x8010, 0x8010, 0x8010, 0x09b6, 0x09b7, 0x8010, 0x09b8, 0x09b9, 0x09ba, 0x09bb, 0x09bc, 0xffff,
+    0x09bd, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0x09be, 0x8010, 0x09bf, 0x8010, 0x09c0, 0x8010,
+    0xffff, 0x09c1, 0xffff, 0x09c2, 0x09c3, 0xffff, 0xffff, 0xffff, 0x09c4, 0xffff, 0x09c5, 0x09c6,
+    0x09c7, 0x09c8, 0x8010, 0x8010, 0xffff, 0xffff, 0x09c9, 0x09ca, 0x8010, 0x8010, 0x8010, 0x09cb,
+    0x09cc, 0xffff, 0x09cd, 0x09ce, 0x8010, 0x09cf, 0x09d0, 0xffff, 0x09d1, 0x09d2, 0x09d3, 0xffff,
+    0x09d4, 0xffff, 0x09d5, 0xffff, 0x09d6, 0x09d7, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0x09d8, 0x8010, 0x09d9, 0x8010, 0x09da, 0x8010, 0x09db, 0x8010, 0x09dc, 0x8010,
+    0x8010, 0x8010, 0x8010, 0x09dd, 0x8010, 0x8010, 0x09de, 0x09df, 0x09e0, 0x09e1, 0xffff, 0xffff,
+    0x09e2, 0x09e3, 0xffff, 0xffff, 0x09e4, 0xffff, 0xffff, 0xffff, 0x09e5, 0xffff, 0x09e6, 0xffff,
+    0x09e7, 0xffff, 0x09e8, 0xffff, 0x8010, 0x8010, 0x09e9, 0x09ea, 0x09eb, 0xffff, 0x09ec, 0xffff,
+    0xffff, 0x802a, 0xffff, 0x09ed, 0xffff, 0xffff, 0xffff, 0x09ee, 0x09ef, 0x802a, 0x09f0, 0x802a,
+    0x09f1, 0x802a, 0xffff, 0xffff, 0x802a, 0x802a, 0x09f2, 0x802a, 0xffff, 0xffff, 0x09f3, 0x09f4,
+    0xffff, 0x09f5, 0xffff, 0xffff, 0xffff, 0xffff, 0x09f6, 0x09f7, 0xffff, 0xffff, 0x09f8, 0xffff,
+    0x09f9, 0x8022, 0xffff, 0x09fa, 0x8022, 0x09fb, 0x8022, 0x09fc, 0x09fd, 0x09fe, 0x09ff, 0x0a00,
+    0x0a01, 0x0a02, 0x8027, 0x8027, 0x0a03, 0x8027, 0x0a04, 0x0a05, 0xffff, 0x8022, 0xffff, 0x0a06,
+    0x8022, 0x0a07, 0x0a08, 0x8027, 0x0a09, 0x0a0a, 0xffff, 0x0a0b, 0xffff, 0x0a0c, 0x0a0d, 0x0a0e,
+    0x8027, 0x0a0f, 0x8027, 0x0a10, 0x0a11, 0x8027, 0x8027, 0x8027, 0x0a12, 0xffff, 0x0a13, 0xffff,
+    0xffff, 0x0a14, 0xffff, 0x0a15, 0xffff, 0x0a16, 0xffff, 0xffff, 0x0a17, 0xffff, 0x0a18, 0xffff,
+    0x0a19, 0x8027, 0x0a1a, 0x0a1b, 0x0a1c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0a1d,
+    0x0a1e, 0x0a1f, 0x8002, 0x8002, 0x0a20, 0xffff, 0x0a21, 0xffff, 0x0a22, 0x0a23, 0x8002, 0x8002,
+    0x8002, 0x0a24, 0x8002, 0x0a25, 0x0a26, 0x8002, 0x0a27, 0x8002, 0xffff, 0xffff, 0x0a28, 0xffff,
+    0x0a29, 0xffff, 0x0a2a, 0xffff, 0x8002, 0x0a2b, 0x8002, 0x0a2c, 0x8002, 0x0a2d, 0x8002, 0x0a2e,
+    0x0a2f, 0x8003, 0x0a30, 0x8003, 0x0a31, 0x8003, 0x0a32, 0x8003, 0x8003, 0x0a33, 0x8003, 0x0a34,
+    0x8003, 0x0a35, 0x8003, 0x0a36, 0x0a37, 0x8003, 0xffff, 0x0a38, 0xffff, 0x0a39, 0xffff, 0xffff,
+    0x0a3a, 0x0a3b, 0xffff, 0xffff, 0x8003, 0x0a3c, 0x0a3d, 0x0a3e, 0x0a3f, 0x8002, 0x0a40, 0x8002,
+    0x0a41, 0x0a42, 0xffff, 0x0a43, 0x0a44, 0x0a45, 0xffff, 0xffff, 0x0a46, 0x0a47, 0xffff, 0xffff,
+    0x0a48, 0xffff, 0x0a49, 0xffff, 0x0a4a, 0x0a4b, 0xffff, 0x0a4c, 0xffff, 0xffff, 0xffff, 0x0a4d,
+    0xffff, 0xffff, 0x0a4e, 0x0a4f, 0xffff, 0xffff, 0x0a50, 0x0a51, 0xffff, 0xffff, 0x0a52, 0x0a53,
+    0xffff, 0xffff, 0x0a54, 0x0a55, 0xffff, 0xffff, 0x0a56, 0xffff, 0xffff, 0xffff, 0xffff, 0x0a57,
+    0x0a58, 0x0a59, 0x0a5a, 0x8014, 0xffff, 0xffff, 0xffff, 0x0a5b, 0x0a5c, 0x8014, 0x8014, 0x8014,
+    0xffff, 0xffff, 0x0a5d, 0xffff, 0x0a5e, 0xffff, 0x0a5f, 0xffff, 0xffff, 0x0a60, 0xffff, 0x0a61,
+    0xffff, 0x0a62, 0xffff, 0x8014, 0x0a63, 0x8014, 0x0a64, 0x8014, 0x0a65, 0x8014, 0x0a66, 0x8014,
+    0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0x8014, 0x0a67, 0x8014, 0x0a68, 0xffff, 0xffff, 0x0a69, 0xffff, 0xffff, 0xffff, 0xffff, 0x0a6a,
+    0xffff, 0x0a6b, 0xffff, 0x0a6c, 0x0a6d, 0x8014, 0x8014, 0x8014, 0xffff, 0x0a6e, 0x0a6f, 0x0a70,
+    0xffff, 0x0a71, 0xffff, 0x0a72, 0x8014, 0x0a73, 0x8014, 0x8014, 0x0a74, 0x0a75, 0x8014, 0x0a76,
+    0x8014, 0x0a77, 0x8014, 0x8014, 0xffff, 0xffff, 0x0a78, 0xffff, 0x0a79, 0xffff, 0x8014, 0x0a7a,
+    0x8014, 0x0a7b, 0x8014, 0x8014, 0x0a7c, 0xffff, 0x8014, 0x0a7d, 0xffff, 0x0a7e, 0xffff, 0x0a7f,
+    0xffff, 0x0a80, 0xffff, 0x0a81, 0xffff, 0x0a82, 0xffff, 0x0a83, 0xffff, 0x0a84, 0xffff, 0x0a85,
+    0x8000, 0x0a86, 0x8000, 0x0a87, 0x8000, 0x0a88, 0x8000, 0x0a89, 0x8000, 0x0a8a, 0x0a8b, 0xffff,
+    0x0a8c, 0xffff, 0x0a8d, 0xffff, 0xffff, 0x0a8e, 0xffff, 0x0a8f, 0xffff, 0x0a90, 0xffff, 0x0a91,
+    0x8000, 0x0a92, 0x8000, 0x8000, 0xffff, 0x0a93, 0xffff, 0xffff, 0x0a94, 0x0a95, 0xffff, 0xffff,
+    0xffff, 0x0a96, 0xffff, 0xffff, 0x0a97, 0x0a98, 0xffff, 0xffff, 0x0a99, 0xffff, 0x0a9a, 0xffff,
+    0x0a9b, 0xffff, 0x0a9c, 0xffff, 0x0a9d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0a9e, 0xffff,
+    0xffff, 0x0a9f, 0xffff, 0x0aa0, 0xffff, 0x0aa1, 0xffff, 0x0aa2, 0xffff, 0x0aa3, 0x0aa4, 0x801f,
+    0x0aa5, 0xffff, 0x0aa6, 0xffff, 0x0aa7, 0x0aa8, 0x8028, 0x0aa9, 0xffff, 0xffff, 0x0aaa, 0xffff,
+    0x0aab, 0x0aac, 0x802a, 0x802a, 0x0aad, 0xffff, 0x0aae, 0x0aaf, 0xffff, 0xffff, 0x0ab0, 0xffff,
+    0xffff, 0x0ab1, 0xffff, 0x0ab2, 0x802a, 0x0ab3, 0x0ab4, 0x802b, 0x0ab5, 0x0ab6, 0x802b, 0x802b,
+    0xffff, 0x0ab7, 0x0ab8, 0x802b, 0xffff, 0x0ab9, 0x0aba, 0x802b, 0x802b, 0x0abb, 0x0abc, 0x0abd,
+    0x0abe, 0xffff, 0x0abf, 0xffff, 0x0ac0, 0x801f, 0x0ac1, 0x801f, 0x0ac2, 0xffff, 0xffff, 0xffff,
+    0x0ac3, 0x0ac4, 0xffff, 0xffff, 0x802b, 0x802b, 0x802b, 0x0ac5, 0x0ac6, 0xffff, 0xffff, 0xffff,
+    0x0ac7, 0x0ac8, 0x0ac9, 0xffff, 0xffff, 0xffff, 0x0aca, 0x0acb, 0xffff, 0xffff, 0x0acc, 0x0acd,
+    0x0ace, 0xffff, 0x0acf, 0xffff, 0xffff, 0x0ad0, 0xffff, 0x0ad1, 0x0ad2, 0xffff, 0x0ad3, 0xffff,
+    0xffff, 0x0ad4, 0xffff, 0x8024, 0xffff, 0xffff, 0xffff, 0x0ad5, 0x0ad6, 0x8024, 0x8024, 0x8024,
+    0x0ad7, 0x0ad8, 0x8024, 0x8024, 0x0ad9, 0x0ada, 0x8024, 0x8024, 0x0adb, 0x0adc, 0x8024, 0x0add,
+    0x8024, 0x0ade, 0x8024, 0x0adf, 0x0ae0, 0xffff, 0x0ae1, 0xffff, 0x0ae2, 0x8024, 0x0ae3, 0x8024,
+    0x0ae4, 0x801f, 0xffff, 0x0ae5, 0x0ae6, 0x8024, 0x0ae7, 0x0ae8, 0x0ae9, 0x0aea, 0xffff, 0xffff,
+    0x0aeb, 0x8024, 0x0aec, 0x0aed, 0x8024, 0x0aee, 0x0aef, 0x0af0, 0x0af1, 0x0af2, 0xffff, 0xffff,
+    0x8024, 0x0af3, 0x8024, 0x0af4, 0x0af5, 0x0af6, 0xffff, 0xffff, 0x0af7, 0x0af8, 0xffff, 0xffff,
+    0xffff, 0x0af9, 0xffff, 0x0afa, 0xffff, 0xffff, 0x0afb, 0x0afc, 0x0afd, 0x0afe, 0x8029, 0x8029,
+    0xffff, 0x0aff, 0x0b00, 0x0b01, 0x0b02, 0x0b03, 0x8012, 0x0b04, 0x0b05, 0x0b06, 0xffff, 0xffff,
+    0x0b07, 0x0b08, 0x0b09, 0x0b0a, 0xffff, 0x0b0b, 0x0b0c, 0xffff, 0xffff, 0x0b0d, 0x0b0e, 0x8019,
+    0x8019, 0x0b0f, 0x8019, 0x8019, 0xffff, 0xffff, 0xffff, 0x0b10, 0xffff, 0xffff, 0x0b11, 0xffff,
+    0xffff, 0x0b12, 0xffff, 0x0b13, 0x0b14, 0x0b15, 0x0b16, 0x8019, 0x0b17, 0x8019, 0x8019, 0x8019,
+    0x0b18, 0x8019, 0x8019, 0x8019, 0x0b19, 0x8013, 0x0b1a, 0x8013, 0x0b1b, 0x8013, 0x0b1c, 0x8013,
+    0x0b1d, 0x0b1e, 0x0b1f, 0x8019, 0x0b20, 0x8019, 0x8019, 0x8019, 0xffff, 0x0b21, 0xffff, 0x0b22,
+    0x0b23, 0x0b24, 0x0b25, 0x8019, 0x8019, 0x8019, 0x8019, 0x0b26, 0x8019, 0x0b27, 0x8019, 0x0b28,
+    0x0b29, 0x8013, 0x8013, 0x8013, 0xffff, 0x0b2a, 0xffff, 0xffff, 0x0b2b, 0x0b2c, 0xffff, 0x0b2d,
+    0x8019, 0x0b2e, 0x8019, 0x0b2f, 0x8019, 0x0b30, 0x8019, 0x0b31, 0xffff, 0x0b32, 0xffff, 0xffff,
+    0x0b33, 0x8014, 0x0b34, 0x0b35, 0x0b36, 0x0b37, 0x8013, 0x8013, 0x0b38, 0x8014, 0x0b39, 0x8014,
+    0x8013, 0x8013, 0x8013, 0x0b3a, 0x0b3b, 0x8014, 0x8014, 0x8014, 0x8013, 0x0b3c, 0x8013, 0x0b3d,
+    0x8014, 0x8014, 0x0b3e, 0x0b3f, 0x8014, 0xffff, 0x0b40, 0xffff, 0x0b41, 0xffff, 0x0b42, 0xffff,
+    0x8014, 0x8014, 0x0b43, 0x0b44, 0x0b45, 0xffff, 0x0b46, 0xffff, 0x0b47, 0x0b48, 0xffff, 0x0b49,
+    0xffff, 0xffff, 0x0b4a, 0x0b4b, 0x8013, 0x0b4c, 0x8013, 0x0b4d, 0x8014, 0x8014, 0x0b4e, 0x8014,
+    0x0b4f, 0x8014, 0x0b50, 0x8014, 0x0b51, 0x8013, 0x0b52, 0x0b53, 0xffff, 0x0b54, 0xffff, 0x0b55,
+    0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x0b56, 0x8014, 0x8014, 0x0b57, 0x8014, 0x0b58,
+    0xffff, 0xffff, 0xffff, 0x0b59, 0x8014, 0x0b5a, 0x0b5b, 0x0b5c, 0x0b5d, 0x8017, 0x8017, 0x8017,
+    0x0b5e, 0x8017, 0x0b5f, 0x8017, 0x8017, 0x8017, 0x0b60, 0x8017, 0x0b61, 0x8017, 0x8017, 0x8017,
+    0x0b62, 0x8019, 0x0b63, 0x8019, 0x0b64, 0x8019, 0x0b65, 0x8019, 0x0b66, 0x8019, 0x8019, 0x8019,
+    0x8019, 0x0b67, 0x0b68, 0x0b69, 0x8019, 0x8019, 0x0b6a, 0x0b6b, 0x0b6c, 0xffff, 0x0b6d, 0xffff,
+    0x0b6e, 0x0b6f, 0xffff, 0xffff, 0x0b70, 0x8019, 0x0b71, 0x0b72, 0x8019, 0x0b73, 0x8019, 0x0b74,
+    0x8019, 0x0b75, 0x8019, 0x0b76, 0x8019, 0x8019, 0x8019, 0x0b77, 0x0b78, 0x0b79, 0x0b7a, 0xffff,
+    0x0b7b, 0xffff, 0xffff, 0xffff, 0x0b7c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0b7d, 0x0b7e,
+    0xffff, 0xffff, 0x0b7f, 0xffff, 0x0b80, 0xffff, 0x0b81, 0xffff, 0x0b82, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0b83, 0xffff, 0xffff, 0x8013, 0x8013, 0x0b84, 0x8013, 0x0b85, 0x8013, 0xffff, 0x0b86,
+    0x0b87, 0x8014, 0x0b88, 0x8014, 0x8014, 0x0b89, 0x8014, 0x0b8a, 0x8013, 0x0b8b, 0x8013, 0x0b8c,
+    0x8014, 0x0b8d, 0x0b8e, 0x8017, 0x0b8f, 0x0b90, 0x0b91, 0x8017, 0x0b92, 0x8017, 0x0b93, 0x8017,
+    0x0b94, 0x8017, 0xffff, 0x0b95, 0x8017, 0x8017, 0x0b96, 0x8017, 0x0b97, 0x0b98, 0xffff, 0xffff,
+    0x8017, 0x8017, 0x0b99, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017,
+    0xffff, 0xffff, 0xffff, 0x0b9a, 0xffff, 0xffff, 0x0b9b, 0x0b9c, 0x0b9d, 0x0b9e, 0x8011, 0x0b9f,
+    0x8011, 0x0ba0, 0x0ba1, 0xffff, 0x0ba2, 0xffff, 0x0ba3, 0xffff, 0x0ba4, 0xffff, 0x0ba5, 0x0ba6,
+    0x0ba7, 0x0ba8, 0x0ba9, 0x8011, 0xffff, 0xffff, 0xffff, 0x0baa, 0xffff, 0x0bab, 0xffff, 0x0bac,
+    0xffff, 0xffff, 0x0bad, 0xffff, 0x8011, 0x0bae, 0x8011, 0x0baf, 0xffff, 0xffff, 0x0bb0, 0xffff,
+    0x0bb1, 0xffff, 0x0bb2, 0xffff, 0x8011, 0xffff, 0x0bb3, 0xffff, 0xffff, 0x0bb4, 0xffff, 0x0bb5,
+    0xffff, 0x0bb6, 0xffff, 0x0bb7, 0x8011, 0x8011, 0x8011, 0x0bb8, 0x0bb9, 0x0bba, 0xffff, 0xffff,
+    0xffff, 0x0bbb, 0xffff, 0x8017, 0x8011, 0x8011, 0x0bbc, 0x0bbd, 0x0bbe, 0xffff, 0xffff, 0xffff,
+    0x0bbf, 0xffff, 0x0bc0, 0xffff, 0x0bc1, 0xffff, 0x0bc2, 0xffff, 0x0bc3, 0x0bc4, 0x0bc5, 0x8017,
+    0x0bc6, 0x0bc7, 0x8017, 0x8017, 0xffff, 0xffff, 0x0bc8, 0x0bc9, 0x0bca, 0x8017, 0x0bcb, 0x8017,
+    0xffff, 0x0bcc, 0xffff, 0x0bcd, 0x0bce, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0x0bcf, 0x0bd0,
+    0xffff, 0x0bd1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0bd2, 0x0bd3, 0x8017, 0x0bd4, 0x8017,
+    0x8017, 0x0bd5, 0x8017, 0x8017, 0x0bd6, 0x0bd7, 0x8017, 0x8017, 0x0bd8, 0xffff, 0x8017, 0x0bd9,
+    0x0bda, 0x0bdb, 0x0bdc, 0x8017, 0x8017, 0x0bdd, 0x8017, 0x8017, 0x0bde, 0xffff, 0x8017, 0x0bdf,
+    0x8017, 0x0be0, 0x8017, 0x8017, 0x0be1, 0xffff, 0x0be2, 0xffff, 0x0be3, 0x0be4, 0x8017, 0x0be5,
+    0x8017, 0x0be6, 0x8017, 0x0be7, 0x0be8, 0xffff, 0x0be9, 0xffff, 0x0bea, 0xffff, 0x0beb, 0xffff,
+    0x0bec, 0xffff, 0x0bed, 0xffff, 0x8017, 0x8017, 0x8017, 0x0bee, 0xffff, 0xffff, 0x0bef, 0x0bf0,
+    0x8017, 0x8017, 0x8017, 0x0bf1, 0x8017, 0x0bf2, 0x0bf3, 0x0bf4, 0x0bf5, 0x0bf6, 0x0bf7, 0xffff,
+    0x0bf8, 0x0bf9, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0x0bfa, 0x8017, 0x8017, 0x0bfb, 0x0bfc,
+    0x0bfd, 0xffff, 0xffff, 0xffff, 0x0bfe, 0x0bff, 0xffff, 0xffff, 0x0c00, 0x8017, 0x0c01, 0x0c02,
+    0xffff, 0x0c03, 0xffff, 0x0c04, 0x8017, 0x0c05, 0x8017, 0x0c06, 0x8017, 0x0c07, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x0c08, 0xffff, 0x8017, 0x0c09, 0x8017, 0x0c0a, 0x8017, 0x8017, 0x0c0b, 0xffff,
+    0x0c0c, 0xffff, 0x0c0d, 0xffff, 0xffff, 0xffff, 0x0c0e, 0x0c0f, 0xffff, 0xffff, 0xffff, 0x0c10,
+    0xffff, 0xffff, 0x0c11, 0x0c12, 0x8016, 0x0c13, 0x8016, 0x8016, 0xffff, 0x0c14, 0xffff, 0x0c15,
+    0xffff, 0x0c16, 0xffff, 0xffff, 0x0c17, 0x0c18, 0xffff, 0xffff, 0xffff, 0xffff, 0x0c19, 0x0c1a,
+    0x8016, 0x8016, 0x8016, 0x0c1b, 0x0c1c, 0x8015, 0xffff, 0x8015, 0x0c1d, 0x0c1e, 0x0c1f, 0x0c20,
+    0x0c21, 0x0c22, 0x8017, 0x0c23, 0x0c24, 0x0c25, 0x0c26, 0x8017, 0x0c27, 0x8015, 0x0c28, 0x0c29,
+    0x0c2a, 0x0c2b, 0x8015, 0x0c2c, 0x8017, 0x0c2d, 0x8017, 0x8017, 0x8015, 0x8015, 0x0c2e, 0x0c2f,
+    0x0c30, 0xffff, 0x0c31, 0xffff, 0x8017, 0x0c32, 0x8017, 0x8017, 0x0c33, 0xffff, 0x8017, 0x0c34,
+    0x8017, 0x0c35, 0x8017, 0x0c36, 0xffff, 0xffff, 0x0c37, 0xffff, 0x0c38, 0xffff, 0x801a, 0x0c39,
+    0xffff, 0xffff, 0x0c3a, 0x0c3b, 0x0c3c, 0x801a, 0x0c3d, 0x801a, 0x801a, 0x0c3e, 0x801a, 0x801a,
+    0x0c3f, 0xffff, 0x0c40, 0xffff, 0x0c41, 0x0c42, 0xffff, 0x0c43, 0x801a, 0x801a, 0x0c44, 0x801a,
+    0x0c45, 0x801a, 0xffff, 0x0c46, 0x0c47, 0xffff, 0x0c48, 0xffff, 0x0c49, 0xffff, 0x0c4a, 0xffff,
+    0xffff, 0x0c4b, 0xffff, 0x0c4c, 0xffff, 0x0c4d, 0xffff, 0xffff, 0x801a, 0xffff, 0x0c4e, 0xffff,
+    0x0c4f, 0xffff, 0xffff, 0xffff, 0x0c50, 0x802b, 0x0c51, 0x0c52, 0x802b, 0x802b, 0x0c53, 0x802b,
+    0x0c54, 0xffff, 0x0c55, 0x0c56, 0x0c57, 0x0c58, 0x0c59, 0x0c5a, 0x802a, 0x802a, 0x0c5b, 0x802a,
+    0x802a, 0x0c5c, 0x0c5d, 0x0c5e, 0x802a, 0x0c5f, 0x802a, 0x0c60, 0x0c61, 0x8020, 0x0c62, 0x8020,
+    0x0c63, 0x0c64, 0x802b, 0x0c65, 0x0c66, 0x0c67, 0x0c68, 0x0c69, 0x0c6a, 0x0c6b, 0x802c, 0x0c6c,
+    0xffff, 0xffff, 0x0c6d, 0x0c6e, 0xffff, 0xffff, 0x0c6f, 0xffff, 0x8021, 0x8021, 0x0c70, 0x8021,
+    0x8021, 0x0c71, 0x8021, 0x0c72, 0x8020, 0x0c73, 0x8020, 0x0c74, 0x802c, 0x802c, 0x0c75, 0x0c76,
+    0x8020, 0x0c77, 0x0c78, 0x0c79, 0x0c7a, 0x0c7b, 0xffff, 0xffff, 0x0c7c, 0x0c7d, 0xffff, 0x0c7e,
+    0x0c7f, 0x0c80, 0x8027, 0xffff, 0x0c81, 0xffff, 0xffff, 0xffff, 0x8027, 0x0c82, 0x0c83, 0xffff,
+    0x0c84, 0x8020, 0x0c85, 0x8020, 0x0c86, 0x8020, 0xffff, 0x0c87, 0x0c88, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x0c89, 0xffff, 0xffff, 0x8020, 0x0c8a, 0x8020, 0x0c8b, 0x0c8c, 0xffff, 0x0c8d, 0xffff,
+    0x0c8e, 0xffff, 0x0c8f, 0xffff, 0x0c90, 0x0c91, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0c92,
+    0xffff, 0xffff, 0xffff, 0x0c93, 0xffff, 0xffff, 0xffff, 0x0c94, 0xffff, 0x0c95, 0x0c96, 0x8025,
+    0x0c97, 0x8025, 0x8025, 0x8025, 0x0c98, 0x8025, 0x8025, 0x8025, 0x0c99, 0x0c9a, 0x8025, 0x8025,
+    0x0c9b, 0x8025, 0x0c9c, 0x8025, 0x0c9d, 0x8025, 0x8025, 0x8025, 0xffff, 0xffff, 0x0c9e, 0xffff,
+    0xffff, 0x8029, 0xffff, 0x8029, 0x8025, 0x0c9f, 0x8025, 0x8025, 0x0ca0, 0x0ca1, 0x8025, 0x0ca2,
+    0x8025, 0x0ca3, 0x0ca4, 0x0ca5, 0x0ca6, 0x8029, 0x0ca7, 0x8029, 0x0ca8, 0x8029, 0x8029, 0x8029,
+    0x0ca9, 0x8025, 0x0caa, 0x0cab, 0x8025, 0x8025, 0x0cac, 0x0cad, 0x8025, 0x8025, 0x0cae, 0x0caf,
+    0x8025, 0x8025, 0x0cb0, 0x8025, 0x0cb1, 0x0cb2, 0xffff, 0x0cb3, 0x0cb4, 0x8029, 0x0cb5, 0x8029,
+    0xffff, 0xffff, 0x0cb6, 0x0cb7, 0x0cb8, 0x8029, 0x8029, 0x8029, 0x8025, 0x0cb9, 0x0cba, 0x8029,
+    0x0cbb, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x0cbc, 0xffff, 0x0cbd, 0xffff, 0x0cbe,
+    0xffff, 0x0cbf, 0xffff, 0x0cc0, 0xffff, 0x0cc1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0cc2,
+    0xffff, 0x0cc3, 0xffff, 0x0cc4, 0xffff, 0xffff, 0x0cc5, 0x0cc6, 0xffff, 0xffff, 0x0cc7, 0x0cc8,
+    0x8023, 0x0cc9, 0x8023, 0x8023, 0x0cca, 0x8029, 0x0ccb, 0x0ccc, 0x8023, 0x8023, 0x0ccd, 0x8023,
+    0x8023, 0x0cce, 0x8023, 0x8023, 0x8029, 0x8029, 0x0ccf, 0x8029, 0x8023, 0x0cd0, 0x8023, 0x0cd1,
+    0xffff, 0x0cd2, 0xffff, 0x0cd3, 0xffff, 0x8023, 0x0cd4, 0x8023, 0x8023, 0x0cd5, 0x8023, 0x0cd6,
+    0x0cd7, 0x8029, 0x0cd8, 0x8029, 0x8029, 0x0cd9, 0x8029, 0x0cda, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x0cdb, 0xffff, 0x0cdc, 0xffff, 0x0cdd, 0xffff, 0x8029, 0x0cde, 0x8029, 0x0cdf, 0x8029, 0x8029,
+    0x0ce0, 0xffff, 0x0ce1, 0xffff, 0x0ce2, 0xffff, 0x0ce3, 0xffff, 0x0ce4, 0xffff, 0x0ce5, 0xffff,
+    0x0ce6, 0xffff, 0x0ce7, 0xffff, 0xffff, 0x0ce8, 0xffff, 0xffff, 0x0ce9, 0x8017, 0x0cea, 0x8017,
+    0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x0ceb, 0x0cec, 0x8017, 0x0ced, 0x8017, 0x0cee,
+    0xffff, 0x0cef, 0xffff, 0x0cf0, 0x0cf1, 0xffff, 0x0cf2, 0xffff, 0x0cf3, 0xffff, 0x0cf4, 0xffff,
+    0x0cf5, 0xffff, 0x0cf6, 0xffff, 0x0cf7, 0xffff, 0x0cf8, 0xffff, 0x0cf9, 0xffff, 0x0cfa, 0xffff,
+    0x0cfb, 0xffff, 0x0cfc, 0xffff, 0x0cfd, 0xffff, 0x0cfe, 0xffff, 0x0cff, 0xffff, 0x0d00, 0xffff,
+    0x0d01, 0xffff, 0x0d02, 0xffff, 0xffff, 0xffff, 0xffff, 0x0d03, 0xffff, 0x0d04, 0xffff, 0xffff,
+    0x0d05, 0x8023, 0x0d06, 0x8023, 0x0d07, 0x0d08, 0xffff, 0xffff, 0x0d09, 0x8023, 0xffff, 0x0d0a,
+    0x8023, 0x0d0b, 0x0d0c, 0x8029, 0x0d0d, 0x8029, 0x0d0e, 0x0d0f, 0x8029, 0x0d10, 0x0d11, 0xffff,
+    0x8029, 0x8029, 0x8029, 0x0d12, 0x8029, 0x0d13, 0x0d14, 0xffff, 0x0d15, 0xffff, 0xffff, 0xffff,
+    0x0d16, 0x0d17, 0xffff, 0xffff, 0x0d18, 0x8029, 0x0d19, 0x0d1a, 0x0d1b, 0x0d1c, 0xffff, 0xffff,
+    0x0d1d, 0x0d1e, 0x0d1f, 0xffff, 0xffff, 0x0d20, 0xffff, 0xffff, 0x0d21, 0x0d22, 0xffff, 0x0d23,
+    0x8017, 0x8017, 0x0d24, 0x8017, 0xffff, 0x0d25, 0xffff, 0xffff, 0x0d26, 0x8017, 0x0d27, 0x8017,
+    0xffff, 0x0d28, 0xffff, 0x0d29, 0xffff, 0x0d2a, 0xffff, 0xffff, 0x8017, 0x8017, 0x0d2b, 0x0d2c,
+    0x0d2d, 0xffff, 0x8017, 0xffff, 0x8017, 0x0d2e, 0x8017, 0x0d2f, 0x0d30, 0x0d31, 0x0d32, 0xffff,
+    0x8017, 0xffff, 0x0d33, 0xffff, 0x0d34, 0x0d35, 0xffff, 0xffff, 0xffff, 0x0d36, 0xffff, 0x0d37,
+    0xffff, 0x0d38, 0xffff, 0xffff, 0x8017, 0x8017, 0x0d39, 0x0d3a, 0x8017, 0x8017, 0x8017, 0x0d3b,
+    0x0d3c, 0xffff, 0xffff, 0xffff, 0x8017, 0x0d3d, 0x0d3e, 0xffff, 0xffff, 0xffff, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0x800e,
+    0x0d3f, 0xffff, 0x0d40, 0xffff, 0xffff, 0x800e, 0xffff, 0x0d41, 0xffff, 0x0d42, 0xffff, 0x0d43,
+    0xffff, 0x0d44, 0xffff, 0x0d45, 0xffff, 0x0d46, 0xffff, 0x0d47, 0x0d48, 0xffff, 0x0d49, 0xffff,
+    0x0d4a, 0xffff, 0x0d4b, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0xffff, 0x0d4c, 0xffff, 0x0d4d, 0xffff, 0x0d4e, 0xffff, 0x0d4f, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x0d50, 0x800e, 0xffff, 0x800e, 0x0d51, 0x800e, 0x0d52, 0x800e, 0x0d53,
+    0x800e, 0x0d54, 0x800e, 0x0d55, 0x800e, 0x0d56, 0x800e, 0x0d57, 0xffff, 0x0d58, 0xffff, 0xffff,
+    0x0d59, 0x800e, 0x0d5a, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x0d5b, 0xffff, 0x0d5c,
+    0xffff, 0xffff, 0x0d5d, 0xffff, 0x0d5e, 0xffff, 0x0d5f, 0xffff, 0xffff, 0xffff, 0x0d60, 0xffff,
+    0x8005, 0x0d61, 0x8005, 0x0d62, 0x8005, 0x0d63, 0x8005, 0x0d64, 0x8005, 0x0d65, 0x8005, 0x8005,
+    0xffff, 0xffff, 0x0d66, 0x0d67, 0x0d68, 0x0d69, 0x8005, 0x8005, 0xffff, 0xffff, 0x0d6a, 0x0d6b,
+    0x0d6c, 0xffff, 0x0d6d, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0x8005, 0x0d6e, 0x0d6f,
+    0x8005, 0x0d70, 0x8005, 0xffff, 0x8005, 0xffff, 0x0d71, 0xffff, 0x8005, 0x8005, 0x0d72, 0x0d73,
+    0x0d74, 0xffff, 0xffff, 0xffff, 0x8005, 0x0d75, 0x8005, 0xffff, 0x0d76, 0xffff, 0x0d77, 0xffff,
+    0x0d78, 0xffff, 0x0d79, 0xffff, 0x0d7a, 0xffff, 0x0d7b, 0xffff, 0x0d7c, 0xffff, 0x0d7d, 0xffff,
+    0x800e, 0x800e, 0x0d7e, 0x800e, 0x0d7f, 0xffff, 0x0d80, 0xffff, 0x0d81, 0xffff, 0x0d82, 0xffff,
+    0x0d83, 0x800e, 0x0d84, 0x800e, 0x0d85, 0x800e, 0x0d86, 0x800e, 0x800e, 0xffff, 0x800e, 0x0d87,
+    0x800e, 0x0d88, 0x800e, 0x0d89, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0x0d8a, 0xffff, 0x0d8b, 0xffff, 0xffff, 0x0d8c, 0xffff, 0x0d8d, 0xffff, 0x0d8e, 0xffff, 0x0d8f,
+    0x0d90, 0xffff, 0x0d91, 0xffff, 0x0d92, 0xffff, 0x0d93, 0xffff, 0xffff, 0x0d94, 0xffff, 0x0d95,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0x0d96, 0x800e, 0xffff, 0xffff, 0xffff, 0xffff, 0x0d97, 0xffff, 0x800f, 0x0d98, 0x800f,
+    0x0d99, 0x800f, 0xffff, 0x800f, 0xffff, 0x0d9a, 0xffff, 0xffff, 0xffff, 0x0d9b, 0xffff, 0x0d9c,
+    0x0d9d, 0x800f, 0x800f, 0x800f, 0x0d9e, 0xffff, 0x0d9f, 0xffff, 0x800f, 0xffff, 0x800f, 0x0da0,
+    0xffff, 0x0da1, 0x0da2, 0x800f, 0x0da3, 0x800f, 0x800f, 0x800f, 0xffff, 0xffff, 0x0da4, 0xffff,
+    0x0da5, 0xffff, 0x800f, 0x0da6, 0x800f, 0x0da7, 0x800f, 0x800f, 0x800f, 0x800f, 0x0da8, 0x800f,
+    0x0da9, 0x800f, 0xffff, 0x0daa, 0x0dab, 0xffff, 0x800f, 0xffff, 0x800f, 0x0dac, 0x800f, 0x0dad,
+    0x0dae, 0xffff, 0x0daf, 0xffff, 0x0db0, 0x800f, 0x0db1, 0x800f, 0xffff, 0x0db2, 0xffff, 0x0db3,
+    0xffff, 0x800f, 0x0db4, 0x800f, 0x0db5, 0x800f, 0x0db6, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0x0db7, 0x800f, 0x0db8, 0x800f, 0x0db9, 0x800f, 0x0dba, 0x800f, 0x0dbb, 0x800f, 0x0dbc,
+    0x0dbd, 0x800f, 0xffff, 0x800f, 0xffff, 0x0dbe, 0xffff, 0x0dbf, 0xffff, 0x0dc0, 0xffff, 0xffff,
+    0x0dc1, 0x800f, 0x0dc2, 0x800f, 0x0dc3, 0xffff, 0x800f, 0x0dc4, 0x0dc5, 0xffff, 0x800f, 0xffff,
+    0x800f, 0x0dc6, 0x800f, 0x800f, 0xffff, 0xffff, 0x0dc7, 0xffff, 0x800f, 0x0dc8, 0x800f, 0x800f,
+    0xffff, 0xffff, 0x0dc9, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x0dca, 0xffff,
+    0x0dcb, 0xffff, 0x0dcc, 0xffff, 0x0dcd, 0xffff, 0xffff, 0xffff, 0x800e, 0x0dce, 0x0dcf, 0xffff,
+    0x0dd0, 0x800f, 0xffff, 0x800f, 0xffff, 0x0dd1, 0xffff, 0x0dd2, 0x800f, 0x800f, 0x0dd3, 0x800f,
+    0x0dd4, 0x800f, 0xffff, 0x800f, 0xffff, 0x0dd5, 0xffff, 0x0dd6, 0xffff, 0x0dd7, 0xffff, 0x0dd8,
+    0xffff, 0x0dd9, 0xffff, 0x0dda, 0xffff, 0x0ddb, 0xffff, 0x0ddc, 0xffff, 0x0ddd, 0xffff, 0x0dde,
+    0xffff, 0x0ddf, 0xffff, 0x0de0, 0x0de1, 0x800f, 0xffff, 0x0de2, 0x0de3, 0x800f, 0xffff, 0x0de4,
+    0x0de5, 0x800f, 0xffff, 0x0de6, 0x0de7, 0x0de8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0de9,
+    0x0dea, 0x8006, 0x0deb, 0x8006, 0x0dec, 0xffff, 0x0ded, 0xffff, 0x0dee, 0xffff, 0x8006, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0def, 0x0df0, 0x8006, 0x0df1, 0x8006, 0xffff, 0x0df2, 0xffff, 0x8006,
+    0xffff, 0x0df3, 0x0df4, 0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff,
+    0x8006, 0x0df5, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x0df6, 0xffff, 0x800f, 0x0df7,
+    0x0df8, 0xffff, 0x0df9, 0xffff, 0x0dfa, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x0dfb,
+    0x800f, 0x0dfc, 0x800f, 0x0dfd, 0x800f, 0x0dfe, 0x800f, 0x0dff, 0x800f, 0x0e00, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x0e01, 0xffff, 0x0e02, 0xffff, 0xffff, 0xffff, 0x800f, 0x800f, 0x0e03, 0x0e04,
+    0x800f, 0x800f, 0x800f, 0x0e05, 0x0e06, 0xffff, 0xffff, 0xffff, 0x800f, 0x0e07, 0x0e08, 0xffff,
+    0xffff, 0x0e09, 0xffff, 0x0e0a, 0xffff, 0x8003, 0x0e0b, 0x8003, 0xffff, 0xffff, 0xffff, 0x0e0c,
+    0x0e0d, 0xffff, 0x0e0e, 0xffff, 0x8003, 0xffff, 0x8003, 0x0e0f, 0xffff, 0xffff, 0xffff, 0x0e10,
+    0xffff, 0xffff, 0xffff, 0x0e11, 0x0e12, 0x8003, 0x8003, 0x8003, 0x0e13, 0x8003, 0x8003, 0x8003,
+    0x0e14, 0x8003, 0x8003, 0x8003, 0x0e15, 0x8003, 0x0e16, 0x8003, 0x8003, 0x0e17, 0x8003, 0x0e18,
+    0xffff, 0xffff, 0x0e19, 0xffff, 0x0e1a, 0xffff, 0x0e1b, 0xffff, 0x0e1c, 0xffff, 0x0e1d, 0xffff,
+    0xffff, 0x0e1e, 0xffff, 0x0e1f, 0xffff, 0xffff, 0xffff, 0x0e20, 0xffff, 0x0e21, 0x801d, 0x801d,
+    0x0e22, 0xffff, 0x801d, 0x0e23, 0x0e24, 0x0e25, 0x801d, 0x801d, 0xffff, 0xffff, 0x0e26, 0xffff,
+    0x0e27, 0x801d, 0x0e28, 0x801d, 0x0e29, 0x801d, 0x801d, 0x801d, 0x801d, 0x0e2a, 0x801d, 0x801d,
+    0x0e2b, 0xffff, 0x801d, 0x0e2c, 0xffff, 0x0e2d, 0xffff, 0x0e2e, 0xffff, 0x0e2f, 0xffff, 0x0e30,
+    0xffff, 0x801d, 0xffff, 0x801d, 0x0e31, 0x0e32, 0x801d, 0x801d, 0xffff, 0xffff, 0x0e33, 0x0e34,
+    0x0e35, 0x0e36, 0x801d, 0x801d, 0xffff, 0xffff, 0x0e37, 0x0e38, 0x801d, 0x0e39, 0x801d, 0x0e3a,
+    0x801d, 0x0e3b, 0x801d, 0x0e3c, 0x801d, 0x0e3d, 0x801d, 0x0e3e, 0x801d, 0x0e3f, 0x801d, 0x0e40,
+    0x801d, 0x0e41, 0x801d, 0x0e42, 0x0e43, 0x801d, 0x0e44, 0x801d, 0x0e45, 0x801d, 0x801d, 0x801d,
+    0xffff, 0x0e46, 0xffff, 0x0e47, 0xffff, 0x0e48, 0xffff, 0x0e49, 0xffff, 0x0e4a, 0xffff, 0x0e4b,
+    0xffff, 0x0e4c, 0xffff, 0x0e4d, 0xffff, 0x0e4e, 0xffff, 0x0e4f, 0xffff, 0x0e50, 0xffff, 0x0e51,
+    0x801d, 0x0e52, 0x801d, 0x0e53, 0x801d, 0x0e54, 0x801d, 0x0e55, 0x801d, 0x0e56, 0x801d, 0x0e57,
+    0x801d, 0x0e58, 0x801d, 0x0e59, 0x801d, 0x0e5a, 0x801d, 0x0e5b, 0x801d, 0x0e5c, 0x801d, 0x0e5d,
+    0x801d, 0x0e5e, 0x801d, 0x0e5f, 0x801d, 0x0e60, 0x801d, 0x0e61, 0xffff, 0xffff, 0x0e62, 0x801c,
+    0x0e63, 0x801c, 0x801c, 0x801c, 0xffff, 0xffff, 0xffff, 0x0e64, 0x0e65, 0xffff, 0x801c, 0x801c,
+    0x0e66, 0x801c, 0x801c, 0x801c, 0x0e67, 0x801c, 0x0e68, 0x801c, 0x0e69, 0x801c, 0x0e6a, 0x801c,
+    0x0e6b, 0x801c, 0x0e6c, 0x801c, 0x0e6d, 0x801c, 0x0e6e, 0x801c, 0x801c, 0x801c, 0x801c, 0x0e6f,
+    0x801c, 0x0e70, 0x801e, 0x801e, 0x0e71, 0x801c, 0x0e72, 0x801c, 0x801c, 0x0e73, 0x0e74, 0x801e,
+    0x0e75, 0x0e76, 0x0e77, 0x801e, 0xffff, 0xffff, 0x0e78, 0xffff, 0x801c, 0xffff, 0x801c, 0x0e79,
+    0x0e7a, 0x0e7b, 0x801c, 0x801c, 0x801c, 0x0e7c, 0x0e7d, 0x801e, 0xffff, 0xffff, 0x801c, 0x0e7e,
+    0x801e, 0x0e7f, 0x801e, 0x0e80, 0x801c, 0x0e81, 0x801c, 0x0e82, 0x801e, 0x0e83, 0x801e, 0x0e84,
+    0x0e85, 0xffff, 0x0e86, 0xffff, 0x801e, 0xffff, 0x801e, 0x0e87, 0xffff, 0xffff, 0xffff, 0x0e88,
+    0xffff, 0xffff, 0xffff, 0x0e89, 0x0e8a, 0x0e8b, 0x0e8c, 0x802d, 0xffff, 0xffff, 0x0e8d, 0xffff,
+    0x0e8e, 0x802d, 0x0e8f, 0x802d, 0x0e90, 0xffff, 0x802d, 0x0e91, 0x0e92, 0x802d, 0x802d, 0x802d,
+    0xffff, 0xffff, 0x0e93, 0xffff, 0xffff, 0x0e94, 0xffff, 0x0e95, 0xffff, 0xffff, 0xffff, 0x0e96,
+    0x802d, 0x802d, 0x0e97, 0x802d, 0x802d, 0xffff, 0x802d, 0x0e98, 0x802d, 0x0e99, 0x802d, 0x0e9a,
+    0x0e9b, 0x802d, 0x0e9c, 0x802d, 0x802d, 0x802d, 0x0e9d, 0x0e9e, 0x802d, 0x0e9f, 0x802d, 0x0ea0,
+    0x802d, 0x802d, 0x0ea1, 0xffff, 0xffff, 0x0ea2, 0x0ea3, 0x802d, 0x0ea4, 0x0ea5, 0x802d, 0x0ea6,
+    0xffff, 0xffff, 0xffff, 0x0ea7, 0x0ea8, 0xffff, 0xffff, 0xffff, 0x0ea9, 0xffff, 0x0eaa, 0xffff,
+    0x0eab, 0x801e, 0x0eac, 0x801e, 0x0ead, 0x801e, 0x0eae, 0x801e, 0x0eaf, 0x801e, 0x0eb0, 0x801e,
+    0x0eb1, 0x801e, 0x0eb2, 0x801e, 0x0eb3, 0x801e, 0x0eb4, 0x801e, 0x0eb5, 0x801e, 0x0eb6, 0x801e,
+    0x0eb7, 0x801e, 0x0eb8, 0x0eb9, 0x801e, 0x801e, 0x0eba, 0x0ebb, 0x0ebc, 0x801b, 0x0ebd, 0x801b,
+    0x801e, 0x801e, 0x0ebe, 0x0ebf, 0x801e, 0x801e, 0x0ec0, 0x0ec1, 0x801e, 0x0ec2, 0x801e, 0x801e,
+    0x0ec3, 0xffff, 0x0ec4, 0xffff, 0x0ec5, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0x0ec6,
+    0x801e, 0x801e, 0x0ec7, 0x0ec8, 0x801b, 0x0ec9, 0x801b, 0x801b, 0x0eca, 0x801e, 0x801b, 0x801b,
+    0x801e, 0x0ecb, 0x801e, 0x0ecc, 0x801e, 0x0ecd, 0x801e, 0x801e, 0x801e, 0x801e, 0x0ece, 0x0ecf,
+    0x0ed0, 0xffff, 0x0ed1, 0xffff, 0x0ed2, 0x801b, 0x0ed3, 0x801b, 0x0ed4, 0x801b, 0x0ed5, 0x801b,
+    0x0ed6, 0x801b, 0x0ed7, 0x801b, 0x0ed8, 0x801b, 0x0ed9, 0x801b, 0x0eda, 0x801b, 0x0edb, 0x801b,
+    0x0edc, 0x801b, 0x0edd, 0x801b, 0x0ede, 0x801b, 0x0edf, 0x801b, 0x0ee0, 0x801b, 0x0ee1, 0x801b,
+    0x0ee2, 0xffff, 0x0ee3, 0xffff, 0x0ee4, 0xffff, 0x0ee5, 0xffff, 0x801b, 0x0ee6, 0x801b, 0x0ee7,
+    0x801b, 0x801b, 0x801b, 0x0ee8, 0x801b, 0xffff, 0x0ee9, 0xffff, 0x801b, 0x801b, 0x801b, 0x0eea,
+    0x801b, 0xffff, 0x0eeb, 0xffff, 0x0eec, 0x801d, 0xffff, 0x801d, 0xffff, 0x0eed, 0xffff, 0xffff,
+    0x801d, 0x801d, 0x0eee, 0x801d, 0xffff, 0x0eef, 0xffff, 0xffff, 0x801d, 0x801d, 0x0ef0, 0x801d,
+    0x0ef1, 0x801d, 0xffff, 0xffff, 0x801d, 0x801d, 0x0ef2, 0x801d, 0xffff, 0x0ef3, 0xffff, 0xffff,
+    0x801d, 0x801d, 0x0ef4, 0x801d, 0x0ef5, 0x801d, 0xffff, 0x801d, 0xffff, 0x0ef6, 0xffff, 0x0ef7,
+    0x801d, 0x801d, 0x0ef8, 0x801d, 0x801d, 0x0ef9, 0x801d, 0x0efa, 0x801d, 0x0efb, 0x801d, 0x0efc,
+    0x801d, 0x0efd, 0x801d, 0x0efe, 0x801d, 0x0eff, 0x801d, 0x0f00, 0x801d, 0x0f01, 0x801d, 0x0f02,
+    0x801d, 0x0f03, 0x801d, 0x0f04, 0x801d, 0x0f05, 0x801d, 0x0f06, 0x801d, 0x0f07, 0x801d, 0x0f08,
+    0x0f09, 0x801d, 0xffff, 0x0f0a, 0xffff, 0x0f0b, 0xffff, 0xffff, 0x801d, 0x801d, 0x0f0c, 0x801d,
+    0x801d, 0x0f0d, 0x801d, 0x0f0e, 0x801d, 0x0f0f, 0x801d, 0x0f10, 0x0f11, 0x801d, 0xffff, 0x0f12,
+    0xffff, 0x0f13, 0xffff, 0xffff, 0x801d, 0x801d, 0x0f14, 0x801d, 0x801d, 0x0f15, 0x801d, 0x0f16,
+    0x801d, 0x801d, 0x801d, 0x0f17, 0x0f18, 0xffff, 0xffff, 0xffff, 0x0f19, 0xffff, 0xffff, 0xffff,
+    0x0f1a, 0x801b, 0x0f1b, 0x801b, 0x0f1c, 0x801b, 0x0f1d, 0x801b, 0x0f1e, 0x801b, 0x0f1f, 0x801b,
+    0x0f20, 0x801b, 0x0f21, 0x801b, 0x0f22, 0x801b, 0x0f23, 0x801b, 0x0f24, 0x801b, 0x0f25, 0x801b,
+    0x0f26, 0x801b, 0x0f27, 0x801b, 0x0f28, 0x801b, 0x0f29, 0x0f2a, 0x0f2b, 0x0f2c, 0xffff, 0xffff,
+    0x801b, 0x801b, 0x801b, 0x0f2d, 0x801b, 0x801b, 0x0f2e, 0x801b, 0x801b, 0x0f2f, 0x801b, 0x0f30,
+    0x801b, 0x0f31, 0x801b, 0x0f32, 0x801b, 0x801b, 0x801b, 0x0f33, 0x801b, 0xffff, 0x0f34, 0xffff,
+    0x801b, 0xffff, 0x0f35, 0xffff, 0x801b, 0x801b, 0x801b, 0x0f36, 0x801b, 0xffff, 0x0f37, 0xffff,
+    0x0f38, 0xffff, 0xffff, 0xffff, 0x0f39, 0x801b, 0xffff, 0x0f3a, 0xffff, 0x0f3b, 0xffff, 0x0f3c,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0x0f3d, 0xffff, 0x0f3e,
+    0xffff, 0x0f3f, 0xffff, 0x0f40, 0x801b, 0xffff, 0x0f41, 0xffff, 0x801b, 0x0f42, 0x0f43, 0xffff,
+    0xffff, 0x0f44, 0xffff, 0x0f45, 0xffff, 0x0f46, 0xffff, 0x0f47, 0x801b, 0x0f48, 0x801b, 0x0f49,
+    0xffff, 0x0f4a, 0xffff, 0xffff, 0x801b, 0x0f4b, 0x801b, 0x0f4c, 0x801b, 0xffff, 0x0f4d, 0xffff,
+    0x0f4e, 0xffff, 0xffff, 0xffff, 0xffff, 0x0f4f, 0xffff, 0x0f50, 0xffff, 0x0f51, 0x0f52, 0x800b,
+    0x0f53, 0x800b, 0x800b, 0x800b, 0xffff, 0xffff, 0xffff, 0x0f54, 0xffff, 0xffff, 0x0f55, 0xffff,
+    0x800b, 0xffff, 0x800b, 0x0f56, 0x0f57, 0x800b, 0x800b, 0x800b, 0x800b, 0x0f58, 0x800b, 0x800b,
+    0xffff, 0xffff, 0x0f59, 0xffff, 0xffff, 0xffff, 0xffff, 0x0f5a, 0xffff, 0xffff, 0xffff, 0x0f5b,
+    0x0f5c, 0x800b, 0x800b, 0x800b, 0xffff, 0xffff, 0xffff, 0x0f5d, 0xffff, 0x0f5e, 0xffff, 0x800b,
+    0x0f5f, 0x800b, 0x800b, 0x800b, 0x0f60, 0x800b, 0x0f61, 0x800b, 0x0f62, 0x0f63, 0x800b, 0x800b,
+    0x800b, 0x800b, 0x800b, 0x0f64, 0x800b, 0x0f65, 0x800b, 0xffff, 0x0f66, 0xffff, 0x0f67, 0xffff,
+    0x800b, 0x800b, 0x800b, 0x0f68, 0x0f69, 0xffff, 0xffff, 0xffff, 0xffff, 0x0f6a, 0xffff, 0xffff,
+    0x0f6b, 0x0f6c, 0xffff, 0xffff, 0x0f6d, 0xffff, 0x0f6e, 0xffff, 0x800b, 0x800b, 0x800b, 0x0f6f,
+    0x800b, 0x0f70, 0x800b, 0x0f71, 0x800b, 0x0f72, 0x800b, 0x0f73, 0xffff, 0x0f74, 0x0f75, 0x800d,
+    0xffff, 0x0f76, 0xffff, 0x800a, 0x0f77, 0x0f78, 0x800a, 0x800a, 0x0f79, 0x800a, 0x0f7a, 0x800a,
+    0x0f7b, 0x800d, 0x800a, 0x800d, 0x800a, 0x800d, 0x800a, 0x800d, 0x800b, 0x800b, 0x0f7c, 0x800b,
+    0x0f7d, 0x800b, 0x0f7e, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x0f7f, 0xffff, 0x0f80,
+    0xffff, 0x0f81, 0xffff, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x0f82, 0x800b, 0x0f83, 0x800b, 0x0f84, 0x800b, 0x0f85,
+    0x800b, 0x0f86, 0x0f87, 0x0f88, 0x800b, 0x0f89, 0x800b, 0x8007, 0x0f8a, 0x8007, 0x8007, 0x8007,
+    0x8007, 0x0f8b, 0x8007, 0x0f8c, 0x8007, 0x0f8d, 0x8007, 0x0f8e, 0xffff, 0x0f8f, 0xffff, 0x0f90,
+    0xffff, 0x0f91, 0xffff, 0x0f92, 0x800b, 0x0f93, 0x0f94, 0x8007, 0x800b, 0x800b, 0x0f95, 0x800b,
+    0xffff, 0x0f96, 0xffff, 0x8007, 0xffff, 0x8007, 0x0f97, 0x0f98, 0x8007, 0x0f99, 0x8007, 0x8007,
+    0xffff, 0xffff, 0xffff, 0x0f9a, 0xffff, 0xffff, 0x800d, 0x800d, 0x0f9b, 0x800d, 0x800d, 0x800d,
+    0xffff, 0xffff, 0x800d, 0x8008, 0xffff, 0xffff, 0x0f9c, 0x0f9d, 0x800d, 0x8008, 0x800d, 0x8008,
+    0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008, 0xffff, 0x0f9e, 0xffff, 0x0f9f,
+    0x0fa0, 0x8008, 0x8008, 0x8008, 0x8007, 0x8007, 0x0fa1, 0x8007, 0x8008, 0x0fa2, 0x8008, 0x0fa3,
+    0x8008, 0x0fa4, 0x8008, 0x0fa5, 0x8008, 0x0fa6, 0x8008, 0x0fa7, 0x800b, 0x0fa8, 0x800b, 0x8007,
+    0x0fa9, 0x8007, 0x0faa, 0x8007, 0x0fab, 0xffff, 0x8007, 0x0fac, 0x0fad, 0xffff, 0x8007, 0x0fae,
+    0xffff, 0xffff, 0x0faf, 0x0fb0, 0xffff, 0xffff, 0x0fb1, 0x8007, 0xffff, 0x0fb2, 0x8007, 0x8007,
+    0xffff, 0xffff, 0xffff, 0x0fb3, 0xffff, 0x0fb4, 0x800a, 0x800a, 0x0fb5, 0x800a, 0x800a, 0x800a,
+    0xffff, 0x0fb6, 0xffff, 0x0fb7, 0xffff, 0x800a, 0x0fb8, 0x800a, 0x800a, 0x800d, 0x800a, 0x800d,
+    0x800a, 0x800d, 0x800a, 0x800d, 0x800a, 0x0fb9, 0x800a, 0x0fba, 0x0fbb, 0x800a, 0x0fbc, 0x800a,
+    0xffff, 0xffff, 0xffff, 0x0fbd, 0xffff, 0x0fbe, 0xffff, 0x800a, 0x0fbf, 0x800a, 0x0fc0, 0x800a,
+    0x800d, 0x800d, 0x8008, 0x8008, 0xffff, 0xffff, 0xffff, 0x0fc1, 0xffff, 0x0fc2, 0xffff, 0x0fc3,
+    0xffff, 0x0fc4, 0xffff, 0x0fc5, 0xffff, 0x0fc6, 0xffff, 0x0fc7, 0xffff, 0x0fc8, 0xffff, 0x0fc9,
+    0xffff, 0x0fca, 0xffff, 0x0fcb, 0xffff, 0x0fcc, 0xffff, 0x0fcd, 0xffff, 0x0fce, 0xffff, 0x0fcf,
+    0x800a, 0x800a, 0x800a, 0x0fd0, 0x800a, 0x800a, 0x0fd1, 0x0fd2, 0x800a, 0x800a, 0x0fd3, 0x0fd4,
+    0x800a, 0x0fd5, 0x800a, 0x0fd6, 0x800a, 0x0fd7, 0x800a, 0x0fd8, 0x800a, 0x0fd9, 0x800a, 0x0fda,
+    0x800a, 0x0fdb, 0x800a, 0x0fdc, 0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008,
+    0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008, 0x800d, 0x8008, 0x8008, 0x0fdd, 0x8008, 0x0fde,
+    0x8008, 0x0fdf, 0x8008, 0x0fe0, 0x8008, 0x0fe1, 0x8008, 0x0fe2, 0x8008, 0x0fe3, 0x8008, 0x0fe4,
+    0x800d, 0x800d, 0x8008, 0x8008, 0x800d, 0x800d, 0x8008, 0x8008, 0x800d, 0x8008, 0x8008, 0x8008,
+    0x0fe5, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x0fe6, 0x8008, 0x0fe7, 0x8008, 0x0fe8, 0x8008, 0x0fe9, 0x8008, 0x0fea, 0x8008, 0x0feb,
+    0x8008, 0x0fec, 0x8008, 0x0fed, 0x8008, 0x0fee, 0x8008, 0x8008, 0x0fef, 0x8007, 0x0ff0, 0x8007,
+    0xffff, 0xffff, 0x0ff1, 0x8006, 0xffff, 0x0ff2, 0x0ff3, 0x8006, 0x0ff4, 0x8006, 0x8006, 0x8006,
+    0x8006, 0x8006, 0x0ff5, 0x8006, 0x0ff6, 0x8006, 0xffff, 0x8006, 0x8006, 0xffff, 0x0ff7, 0xffff,
+    0x0ff8, 0xffff, 0x0ff9, 0x0ffa, 0x0ffb, 0xffff, 0x8006, 0x0ffc, 0x8006, 0x0ffd, 0x8006, 0x8006,
+    0xffff, 0x0ffe, 0xffff, 0x0fff, 0x8006, 0x8006, 0x8006, 0x1000, 0xffff, 0xffff, 0xffff, 0x1001,
+    0xffff, 0x1002, 0xffff, 0x1003, 0xffff, 0x1004, 0xffff, 0x1005, 0x8006, 0x1006, 0x8006, 0x1007,
+    0x8006, 0x8006, 0x1008, 0x1009, 0x100a, 0xffff, 0xffff, 0xffff, 0x8006, 0x100b, 0x8006, 0xffff,
+    0x8006, 0x8006, 0x8006, 0x100c, 0x100d, 0xffff, 0xffff, 0xffff, 0x8006, 0x8006, 0x100e, 0x8006,
+    0x100f, 0x8006, 0xffff, 0x1010, 0x8006, 0x8006, 0x1011, 0x8006, 0xffff, 0x1012, 0xffff, 0xffff,
+    0x8006, 0x8006, 0x1013, 0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff,
+    0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x1014, 0xffff,
+    0x1015, 0xffff, 0xffff, 0xffff, 0xffff, 0x1016, 0xffff, 0x1017, 0x8006, 0xffff, 0x8006, 0x1018,
+    0x1019, 0x101a, 0xffff, 0xffff, 0xffff, 0x101b, 0xffff, 0x101c, 0xffff, 0x101d, 0x101e, 0x800c,
+    0xffff, 0x800c, 0x101f, 0x800c, 0x1020, 0x800c, 0x1021, 0x800c, 0x800c, 0x1022, 0x800c, 0x1023,
+    0xffff, 0xffff, 0x1024, 0xffff, 0x1025, 0xffff, 0x8007, 0x1026, 0xffff, 0xffff, 0x1027, 0x1028,
+    0x1029, 0x102a, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0xffff, 0xffff, 0xffff, 0x102b,
+    0xffff, 0x102c, 0xffff, 0x102d, 0x800c, 0x102e, 0x800c, 0xffff, 0x800c, 0xffff, 0x102f, 0xffff,
+    0xffff, 0x800c, 0x800c, 0x800c, 0x1030, 0xffff, 0x1031, 0xffff, 0x1032, 0xffff, 0x1033, 0xffff,
+    0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x1034, 0x800c,
+    0x1035, 0x800c, 0x1036, 0x800c, 0x1037, 0xffff, 0x800c, 0xffff, 0x800c, 0x1038, 0x800c, 0x800c,
+    0x1039, 0xffff, 0x800c, 0xffff, 0x800c, 0x103a, 0x800c, 0x800c, 0xffff, 0xffff, 0x103b, 0xffff,
+    0x103c, 0x800c, 0x103d, 0x800c, 0x103e, 0x800c, 0x103f, 0x800c, 0x1040, 0x800c, 0x1041, 0x800c,
+    0x1042, 0x800c, 0x1043, 0x800c, 0x1044, 0x800c, 0x800c, 0x800c, 0x8007, 0x1045, 0x8007, 0x800c,
+    0x8007, 0x8007, 0x8007, 0x1046, 0x8007, 0x1047, 0x8007, 0x1048, 0x1049, 0x104a, 0x8009, 0x8009,
+    0x800c, 0x800c, 0x104b, 0x800c, 0x104c, 0x800c, 0x8009, 0x104d, 0x800c, 0x104e, 0x800c, 0x800c,
+    0x104f, 0xffff, 0x800c, 0x1050, 0x1051, 0xffff, 0x1052, 0xffff, 0x1053, 0xffff, 0x1054, 0xffff,
+    0x1055, 0xffff, 0x1056, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x1057, 0x800c, 0x1058,
+    0x8007, 0x1059, 0x8007, 0x105a, 0x8007, 0x105b, 0x8007, 0x105c, 0x8009, 0x105d, 0x8009, 0x105e,
+    0x8009, 0x105f, 0x8009, 0x1060, 0x8007, 0x1061, 0x8007, 0x8007, 0x1062, 0x8009, 0x1063, 0x8009,
+    0x8009, 0x1064, 0x8009, 0x1065, 0x1066, 0x1067, 0x1068, 0xffff, 0x1069, 0x106a, 0xffff, 0xffff,
+    0x106b, 0x106c, 0xffff, 0xffff, 0x800c, 0x800c, 0x106d, 0x106e, 0x106f, 0xffff, 0x1070, 0xffff,
+    0x1071, 0xffff, 0x1072, 0xffff, 0x1073, 0xffff, 0x1074, 0xffff, 0x1075, 0xffff, 0x1076, 0xffff,
+    0x1077, 0x8010, 0xffff, 0x8010, 0x1078, 0x8010, 0x1079, 0x8010, 0x107a, 0x800c, 0x8010, 0x800c,
+    0x8010, 0x107b, 0x8010, 0x8010, 0xffff, 0x107c, 0xffff, 0x107d, 0x107e, 0xffff, 0x107f, 0xffff,
+    0x800c, 0xffff, 0x800c, 0x1080, 0x800c, 0x1081, 0x800c, 0x800c, 0xffff, 0xffff, 0x1082, 0xffff,
+    0x1083, 0xffff, 0x1084, 0xffff, 0x800c, 0x800c, 0x1085, 0x1086, 0x800c, 0x800c, 0x1087, 0x800c,
+    0x8010, 0x1088, 0x8010, 0x1089, 0x108a, 0x800c, 0x8010, 0x108b, 0x800c, 0x108c, 0x800c, 0x108d,
+    0x800c, 0x108e, 0x800c, 0x800c, 0x108f, 0xffff, 0x800c, 0x1090, 0xffff, 0xffff, 0x1091, 0xffff,
+    0x800c, 0x1092, 0x800c, 0x800c, 0xffff, 0xffff, 0x1093, 0xffff, 0xffff, 0xffff, 0x1094, 0x8001,
+    0xffff, 0xffff, 0x8001, 0x8001, 0xffff, 0xffff, 0x8001, 0x1095, 0xffff, 0x1096, 0xffff, 0xffff,
+    0x8001, 0x8001, 0x1097, 0x8001, 0x8001, 0x1098, 0x8001, 0x1099, 0x109a, 0x8001, 0xffff, 0x109b,
+    0x109c, 0xffff, 0x8001, 0x109d, 0xffff, 0xffff, 0x109e, 0xffff, 0xffff, 0x109f, 0xffff, 0xffff,
+    0x8001, 0x10a0, 0x8001, 0x8001, 0xffff, 0xffff, 0x10a1, 0xffff, 0x8001, 0xffff, 0x8001, 0x10a2,
+    0x10a3, 0x8001, 0x10a4, 0x8001, 0xffff, 0x8001, 0xffff, 0x10a5, 0xffff, 0x10a6, 0xffff, 0xffff,
+    0x8001, 0x8001, 0x10a7, 0x8001, 0xffff, 0xffff, 0x10a8, 0xffff, 0x8001, 0x10a9, 0x8001, 0x8001,
+    0x10aa, 0xffff, 0x8001, 0x8001, 0xffff, 0xffff, 0x10ab, 0xffff, 0xffff, 0x10ac, 0xffff, 0xffff,
+    0x8001, 0x8001, 0x10ad, 0x8001, 0x10ae, 0x8001, 0xffff, 0x8001, 0xffff, 0x10af, 0xffff, 0x10b0,
+    0xffff, 0x10b1, 0x10b2, 0x8028, 0x8001, 0x8001, 0x8001, 0x10b3, 0x8001, 0x10b4, 0x8001, 0x10b5,
+    0x8001, 0x8001, 0x10b6, 0xffff, 0x10b7, 0x10b8, 0xffff, 0xffff, 0x10b9, 0xffff, 0x8028, 0x8028,
+    0xffff, 0xffff, 0x10ba, 0x10bb, 0xffff, 0xffff, 0x10bc, 0x10bd, 0x10be, 0x8026, 0x10bf, 0x8026,
+    0xffff, 0xffff, 0x10c0, 0x10c1, 0x10c2, 0x8028, 0x8028, 0x8028, 0x8026, 0x10c3, 0x8026, 0x10c4,
+    0x10c5, 0x8026, 0x10c6, 0x8026, 0x10c7, 0x8026, 0x10c8, 0x8026, 0x8026, 0x10c9, 0x8026, 0x10ca,
+    0x8026, 0x8026, 0x8026, 0x10cb, 0x8028, 0x10cc, 0x8028, 0x10cd, 0x10ce, 0xffff, 0x8028, 0xffff,
+    0x8028, 0x10cf, 0x8028, 0x8028, 0x10d0, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026,
+    0x8026, 0x10d1, 0x8026, 0x10d2, 0x8028, 0x8028, 0x10d3, 0x8028, 0xffff, 0x8026, 0xffff, 0x8026,
+    0xffff, 0x10d4, 0xffff, 0x10d5, 0x10d6, 0x8028, 0x10d7, 0x8028, 0x8026, 0x8026, 0x10d8, 0x10d9,
+    0x10da, 0x8028, 0x8028, 0x8028, 0xffff, 0x10db, 0xffff, 0x10dc, 0xffff, 0x8028, 0xffff, 0x10dd,
+    0x10de, 0xffff, 0xffff, 0xffff, 0x8028, 0x8028, 0x8028, 0x10df, 0x8028, 0x8028, 0x10e0, 0x10e1,
+    0x8028, 0x8028, 0x8028, 0x10e2, 0x8028, 0x8028, 0x10e3, 0x10e4, 0x10e5, 0x802a, 0x802a, 0x802a,
+    0xffff, 0x10e6, 0xffff, 0xffff, 0xffff, 0xffff, 0x10e7, 0x10e8, 0x10e9, 0x8004, 0xffff, 0x10ea,
+    0x10eb, 0x10ec, 0x8004, 0x8004, 0xffff, 0xffff, 0x10ed, 0xffff, 0xffff, 0x10ee, 0xffff, 0xffff,
+    0x8004, 0x8004, 0x10ef, 0x8004, 0xffff, 0x8004, 0xffff, 0x10f0, 0x8004, 0x8004, 0x10f1, 0x8004,
+    0xffff, 0x8004, 0x10f2, 0x8004, 0xffff, 0xffff, 0xffff, 0x10f3, 0x10f4, 0x8004, 0x8004, 0x8004,
+    0xffff, 0x10f5, 0xffff, 0x10f6, 0xffff, 0xffff, 0xffff, 0x10f7, 0xffff, 0x10f8, 0x10f9, 0x8004,
+    0x10fa, 0x8004, 0x8004, 0x8004, 0xffff, 0x10fb, 0xffff, 0xffff, 0xffff, 0x10fc, 0xffff, 0x8004,
+    0x10fd, 0x8004, 0x8004, 0x8004, 0xffff, 0x10fe, 0x10ff, 0x8004, 0xffff, 0x1100, 0xffff, 0xffff,
+    0x8004, 0x8004, 0x1101, 0x8004, 0x1102, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0x1103, 0x8004,
+    0xffff, 0x1104, 0x1105, 0x1106, 0x1107, 0xffff, 0x8004, 0x1108, 0xffff, 0xffff, 0x1109, 0xffff,
+    0x8004, 0x110a, 0x8004, 0x8004, 0xffff, 0xffff, 0x110b, 0xffff, 0x8004, 0x110c, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x110d, 0xffff, 0x110e, 0xffff, 0x8004, 0x110f, 0x1110, 0x1111, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x8004, 0x1112, 0x8004, 0x1113, 0x8004, 0x8004, 0xffff, 0xffff, 0x1114, 0x1115,
+    0xffff, 0xffff, 0x1116, 0x1117, 0xffff, 0xffff, 0x8004, 0x8004, 0x1118, 0x1119, 0x8004, 0x111a,
+    0x111b, 0x8004, 0x8004, 0x8004, 0x8004, 0x111c, 0x8004, 0x111d, 0x8004, 0x111e, 0x8004, 0x111f,
+    0x1120, 0xffff, 0xffff, 0xffff, 0x8004, 0x1121, 0x8004, 0x1122, 0x8004, 0x1123, 0x8004, 0x1124,
+    0x8004, 0x1125, 0x8004, 0x1126, 0x8004, 0x1127, 0x8004, 0x1128, 0x8004, 0x1129, 0x8004, 0x112a,
+    0x8004, 0x112b, 0x8004, 0x112c, 0x8004, 0x112d, 0x8004, 0x112e, 0x8004, 0x112f, 0x8004, 0x1130,
+    0xffff, 0x1131, 0xffff, 0x1132, 0xffff, 0x1133, 0xffff, 0x1134, 0xffff, 0x1135, 0xffff, 0x1136,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x1137, 0x800a, 0xffff, 0x1138, 0xffff, 0xffff,
+    0x800a, 0x1139, 0x800a, 0x113a, 0x8008, 0x8008, 0x113b, 0x113c, 0x8008, 0x8008, 0x113d, 0x8008,
+    0x113e, 0x8008, 0x8008, 0x8008, 0x800a, 0x113f, 0x800a, 0x1140, 0x800a, 0x800a, 0x1141, 0x1142,
+    0x800a, 0x800a, 0x1143, 0x1144, 0x800a, 0x800a, 0x1145, 0x1146, 0x800a, 0x800a, 0x1147, 0x1148,
+    0x800a, 0x1149, 0x800a, 0x114a, 0x800a, 0x800a, 0x114b, 0x114c, 0x800a, 0x8008, 0x114d, 0x114e,
+    0x8008, 0x8008, 0x114f, 0x1150, 0x8008, 0x8008, 0x1151, 0x1152, 0x8008, 0x8008, 0x1153, 0x1154,
+    0x8008, 0x8008, 0x1155, 0x1156, 0x8008, 0x8008, 0x1157, 0x1158, 0x8008, 0x8008, 0x1159, 0x115a,
+    0x8008, 0x8008, 0x115b, 0x115c, 0x8008, 0x8008, 0x115d, 0x115e, 0x8008, 0x8008, 0x8008, 0x115f,
+    0x8008, 0x8008, 0x1160, 0x1161, 0x8008, 0x1162, 0x1163, 0x1164, 0x1165, 0x8007, 0x1166, 0x8007,
+    0x8007, 0x1167, 0x8007, 0x1168, 0x8007, 0x8007, 0x1169, 0x116a, 0x8007, 0x8007, 0x116b, 0x116c,
+    0x8007, 0x8007, 0x116d, 0x116e, 0x8007, 0x8007, 0x116f, 0x1170, 0x8007, 0x8007, 0x1171, 0xffff,
+    0x1172, 0x1173, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0x1174, 0x8007, 0x8007, 0x1175, 0xffff,
+    0xffff, 0x1176, 0xffff, 0xffff, 0xffff, 0x1177, 0x1178, 0x8004, 0x8004, 0x8004, 0xffff, 0x1179,
+    0x117a, 0x117b, 0xffff, 0xffff, 0x8004, 0x8004, 0x117c, 0x8004, 0x117d, 0x8004, 0xffff, 0x117e,
+    0x8004, 0x8004, 0x117f, 0x8004, 0xffff, 0x1180, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x1181,
+    0x8004, 0x8004, 0x8004, 0x1182, 0x1183, 0x1184, 0xffff, 0xffff, 0x1185, 0x1186, 0xffff, 0xffff,
+    0x8004, 0x8004, 0x1187, 0x1188, 0x8004, 0x8004, 0x1189, 0xffff, 0x8004, 0x118a, 0xffff, 0xffff,
+    0x118b, 0xffff, 0xffff, 0xffff, 0x8004, 0x118c, 0x8004, 0x118d, 0x8004, 0x118e, 0x8004, 0x118f,
+    0x8004, 0x8004, 0x1190, 0x1191, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x1192, 0x8004, 0x1193,
+    0x1194, 0x1195, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0x1196, 0x8007, 0x8007, 0x1197, 0xffff,
+    0x1198, 0xffff, 0x1199, 0xffff, 0x119a, 0xffff, 0xffff, 0xffff, 0x119b, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x119c, 0xffff, 0xffff, 0x119d, 0x119e, 0x8010, 0xffff, 0xffff, 0xffff, 0x119f,
+    0xffff, 0x11a0, 0x8010, 0x8010, 0x11a1, 0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0x11a2, 0x8010,
+    0x11a3, 0x8010, 0x8010, 0x8010, 0x11a4, 0x8010, 0x11a5, 0x8010, 0x11a6, 0x8010, 0x11a7, 0x8010,
+    0x11a8, 0x800c, 0x8010, 0x800c, 0x8010, 0x11a9, 0x8010, 0x8010, 0x11aa, 0x800c, 0x8010, 0x800c,
+    0x800c, 0x800c, 0x800c, 0x11ab, 0x8010, 0x11ac, 0x8010, 0x8010, 0x11ad, 0xffff, 0x11ae, 0xffff,
+    0x8010, 0x11af, 0x8010, 0x8010, 0x8010, 0x8010, 0x11b0, 0x8010, 0x11b1, 0x8010, 0x11b2, 0x8010,
+    0x11b3, 0x8010, 0x11b4, 0x8010, 0x11b5, 0x8010, 0x11b6, 0x8010, 0x11b7, 0x8010, 0x11b8, 0x11b9,
+    0x8010, 0x11ba, 0x11bb, 0xffff, 0x8010, 0x11bc, 0x11bd, 0xffff, 0xffff, 0x11be, 0xffff, 0xffff,
+    0x11bf, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0x11c0, 0x8010, 0xffff,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x11c1, 0x8010, 0x8010, 0x8010, 0x11c2,
+    0x8010, 0x8010, 0x8010, 0x11c3, 0x11c4, 0xffff, 0xffff, 0xffff, 0x11c5, 0xffff, 0xffff, 0xffff,
+    0x8010, 0x11c6, 0x11c7, 0xffff, 0x11c8, 0x8010, 0x11c9, 0x8010, 0xffff, 0x8010, 0xffff, 0x11ca,
+    0xffff, 0x11cb, 0xffff, 0xffff, 0x11cc, 0x8010, 0x11cd, 0x8010, 0x11ce, 0x8010, 0x11cf, 0x8010,
+    0x11d0, 0xffff, 0x11d1, 0xffff, 0xffff, 0xffff, 0x11d2, 0xffff, 0x8010, 0x11d3, 0x8010, 0x8010,
+    0xffff, 0xffff, 0x11d4, 0xffff, 0x11d5, 0x11d6, 0x8010, 0x8010, 0xffff, 0xffff, 0x11d7, 0x11d8,
+    0x8010, 0x11d9, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0x11da, 0x8010, 0x8010, 0x8010, 0x11db,
+    0x11dc, 0xffff, 0x8010, 0x11dd, 0x8010, 0x8010, 0x11de, 0x11df, 0x11e0, 0xffff, 0xffff, 0xffff,
+    0x8010, 0x11e1, 0x11e2, 0xffff, 0x8010, 0x11e3, 0xffff, 0xffff, 0x8010, 0x8010, 0x8010, 0x11e4,
+    0x11e5, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff,
+    0x8010, 0xffff, 0x11e6, 0xffff, 0xffff, 0x11e7, 0xffff, 0xffff, 0x11e8, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x11e9, 0xffff, 0x11ea, 0xffff, 0x11eb, 0xffff, 0x11ec, 0xffff, 0x11ed,
+    0xffff, 0x11ee, 0xffff, 0x11ef, 0xffff, 0x11f0, 0xffff, 0x8010, 0x8010, 0x8010, 0x11f1, 0x11f2,
+    0x8010, 0x11f3, 0xffff, 0xffff, 0x11f4, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0x11f5, 0x11f6,
+    0x11f7, 0x11f8, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x11f9, 0x8010, 0x8010, 0x11fa, 0xffff,
+    0x11fb, 0xffff, 0xffff, 0xffff, 0x11fc, 0xffff, 0x11fd, 0xffff, 0x11fe, 0xffff, 0x11ff, 0xffff,
+    0x1200, 0xffff, 0x1201, 0xffff, 0x1202, 0xffff, 0x1203, 0xffff, 0x8010, 0x8010, 0x8010, 0x1204,
+    0x8010, 0x8010, 0x1205, 0xffff, 0x1206, 0xffff, 0x1207, 0xffff, 0x1208, 0xffff, 0xffff, 0xffff,
+    0x1209, 0x802a, 0x120a, 0x802a, 0xffff, 0xffff, 0x120b, 0x802a, 0xffff, 0x120c, 0xffff, 0x802a,
+    0x120d, 0x802a, 0x802a, 0x802a, 0xffff, 0x120e, 0xffff, 0x120f, 0x1210, 0x1211, 0xffff, 0x1212,
+    0x1213, 0xffff, 0x1214, 0x8027, 0xffff, 0xffff, 0x1215, 0x1216, 0x802a, 0x802a, 0x1217, 0x1218,
+    0xffff, 0xffff, 0xffff, 0x1219, 0xffff, 0xffff, 0x8022, 0x8022, 0xffff, 0xffff, 0x121a, 0x121b,
+    0xffff, 0x121c, 0xffff, 0xffff, 0x121d, 0x8022, 0x121e, 0x8022, 0x121f, 0xffff, 0x8022, 0x1220,
+    0x8022, 0x1221, 0x8022, 0x1222, 0xffff, 0x1223, 0xffff, 0xffff, 0x8027, 0x8027, 0x1224, 0x8027,
+    0xffff, 0xffff, 0xffff, 0x8027, 0x1225, 0x1226, 0x8027, 0x8027, 0x8027, 0x1227, 0x8027, 0x8027,
+    0x1228, 0xffff, 0x8027, 0x8027, 0xffff, 0x1229, 0xffff, 0xffff, 0xffff, 0x122a, 0xffff, 0x122b,
+    0x8027, 0x8027, 0x122c, 0x122d, 0x122e, 0x8022, 0xffff, 0x122f, 0x8022, 0x1230, 0x1231, 0x1232,
+    0x1233, 0x8027, 0x1234, 0x8027, 0x8022, 0x1235, 0xffff, 0xffff, 0x8027, 0x1236, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x1237, 0xffff, 0x1238, 0xffff, 0x1239, 0xffff, 0xffff, 0x123a, 0x123b,
+    0x123c, 0x8027, 0x8027, 0x8027, 0x8027, 0x8027, 0x8027, 0x123d, 0x8027, 0xffff, 0x123e, 0xffff,
+    0x123f, 0x8027, 0x8027, 0x8027, 0x8027, 0x8027, 0x8027, 0x1240, 0x8027, 0x1241, 0x8027, 0xffff,
+    0xffff, 0x1242, 0xffff, 0x1243, 0xffff, 0x1244, 0xffff, 0x1245, 0xffff, 0x1246, 0xffff, 0xffff,
+    0x8027, 0x1247, 0x8027, 0x1248, 0x8027, 0x1249, 0x8027, 0x124a, 0x8027, 0x8027, 0x124b, 0x8027,
+    0x124c, 0x124d, 0xffff, 0xffff, 0x124e, 0x124f, 0xffff, 0xffff, 0x8027, 0xffff, 0x1250, 0xffff,
+    0xffff, 0x1251, 0xffff, 0x1252, 0x1253, 0x1254, 0x8002, 0x8002, 0x1255, 0x1256, 0x8002, 0x8002,
+    0xffff, 0xffff, 0x1257, 0xffff, 0x1258, 0xffff, 0x8002, 0x1259, 0xffff, 0xffff, 0x125a, 0x125b,
+    0x125c, 0x8002, 0x125d, 0x8002, 0x125e, 0xffff, 0x125f, 0xffff, 0x8002, 0x1260, 0x8002, 0x8002,
+    0x1261, 0x8002, 0x1262, 0x8002, 0x1263, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0x1264, 0xffff,
+    0x8002, 0xffff, 0x8002, 0x1265, 0x8002, 0x1266, 0x8002, 0x1267, 0xffff, 0xffff, 0x1268, 0xffff,
+    0x1269, 0xffff, 0x8002, 0xffff, 0x8002, 0x126a, 0x8002, 0x126b, 0x8002, 0x126c, 0x8002, 0x8002,
+    0x126d, 0x8003, 0x126e, 0x8003, 0x126f, 0x8003, 0x1270, 0x8003, 0x1271, 0x8003, 0xffff, 0x8003,
+    0xffff, 0x1272, 0xffff, 0x1273, 0x1274, 0xffff, 0x1275, 0xffff, 0x1276, 0xffff, 0x1277, 0xffff,
+    0x1278, 0xffff, 0x1279, 0xffff, 0x127a, 0xffff, 0x127b, 0xffff, 0xffff, 0x127c, 0xffff, 0xffff,
+    0x127d, 0x8003, 0x127e, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff, 0x127f, 0x1280, 0xffff, 0xffff,
+    0x1281, 0xffff, 0xffff, 0xffff, 0x1282, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003, 0x1283,
+    0x8003, 0x1284, 0x1285, 0x1286, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x1287, 0xffff, 0x1288,
+    0xffff, 0x1289, 0xffff, 0x128a, 0x8002, 0x8002, 0x8002, 0x128b, 0x128c, 0xffff, 0xffff, 0xffff,
+    0x8002, 0x8002, 0x128d, 0xffff, 0x8002, 0x128e, 0xffff, 0xffff, 0x128f, 0x1290, 0xffff, 0xffff,
+    0x1291, 0x8002, 0xffff, 0xffff, 0x1292, 0xffff, 0x1293, 0xffff, 0x1294, 0xffff, 0x1295, 0xffff,
+    0x8002, 0x8002, 0x1296, 0x1297, 0x8002, 0x8002, 0x8002, 0x1298, 0x1299, 0x129a, 0xffff, 0xffff,
+    0xffff, 0x129b, 0xffff, 0x129c, 0x129d, 0x129e, 0x8000, 0x8000, 0x129f, 0x12a0, 0x8000, 0x8000,
+    0x12a1, 0x12a2, 0x8000, 0x8000, 0x12a3, 0x12a4, 0x8000, 0x8000, 0x12a5, 0x12a6, 0x8000, 0x8000,
+    0x12a7, 0x12a8, 0x8000, 0x8000, 0x12a9, 0x12aa, 0x8000, 0x8000, 0x12ab, 0x12ac, 0x8000, 0x8000,
+    0x12ad, 0xffff, 0x12ae, 0xffff, 0xffff, 0xffff, 0x12af, 0xffff, 0xffff, 0x12b0, 0xffff, 0x12b1,
+    0x8014, 0xffff, 0x8014, 0x12b2, 0xffff, 0x8014, 0x12b3, 0x8014, 0xffff, 0xffff, 0xffff, 0x12b4,
+    0x12b5, 0x8014, 0x8014, 0x8014, 0xffff, 0xffff, 0x12b6, 0xffff, 0x8014, 0x12b7, 0x8014, 0x12b8,
+    0x8014, 0x12b9, 0x8014, 0x8014, 0xffff, 0x12ba, 0xffff, 0x12bb, 0xffff, 0x8014, 0xffff, 0x8014,
+    0x12bc, 0x8014, 0x12bd, 0x8014, 0xffff, 0x12be, 0xffff, 0x12bf, 0xffff, 0x12c0, 0xffff, 0x8014,
+    0xffff, 0x8014, 0x12c1, 0x8014, 0x12c2, 0x8014, 0x12c3, 0x8014, 0xffff, 0xffff, 0x12c4, 0xffff,
+    0x8014, 0x12c5, 0x8014, 0x8014, 0x12c6, 0xffff, 0x8014, 0x12c7, 0xffff, 0xffff, 0xffff, 0x12c8,
+    0xffff, 0x12c9, 0xffff, 0x12ca, 0xffff, 0x8014, 0xffff, 0x8014, 0x12cb, 0x8014, 0x8014, 0x8014,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0x12cc, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x12cd, 0xffff, 0x8014, 0x12ce, 0x8014, 0x8014, 0x8014, 0x8014, 0x12cf, 0x8014, 0x8014,
+    0x8014, 0x12d0, 0x8014, 0x8014, 0xffff, 0xffff, 0x12d1, 0xffff, 0x12d2, 0xffff, 0x8014, 0xffff,
+    0x8014, 0x12d3, 0x8014, 0x8014, 0x12d4, 0xffff, 0x8014, 0xffff, 0x8014, 0x12d5, 0x8014, 0x8014,
+    0x12d6, 0xffff, 0x8014, 0xffff, 0x8014, 0x12d7, 0x8014, 0x8014, 0xffff, 0xffff, 0x12d8, 0x12d9,
+    0x12da, 0xffff, 0x12db, 0xffff, 0xffff, 0x12dc, 0xffff, 0x12dd, 0xffff, 0x12de, 0xffff, 0x12df,
+    0xffff, 0x12e0, 0xffff, 0x12e1, 0xffff, 0x12e2, 0xffff, 0x12e3, 0xffff, 0x12e4, 0xffff, 0x12e5,
+    0xffff, 0x12e6, 0xffff, 0x12e7, 0xffff, 0x12e8, 0xffff, 0x12e9, 0xffff, 0x12ea, 0xffff, 0x12eb,
+    0x8000, 0x8000, 0x8000, 0x12ec, 0x8000, 0x12ed, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0x12ee,
+    0x8000, 0x12ef, 0x8000, 0xffff, 0x12f0, 0xffff, 0x12f1, 0xffff, 0x8000, 0x8000, 0x8000, 0x12f2,
+    0x8000, 0x12f3, 0x8000, 0xffff, 0x12f4, 0xffff, 0x12f5, 0xffff, 0xffff, 0x12f6, 0xffff, 0x12f7,
+    0xffff, 0x12f8, 0xffff, 0x12f9, 0xffff, 0x12fa, 0xffff, 0x12fb, 0xffff, 0x12fc, 0xffff, 0x12fd,
+    0x8000, 0x12fe, 0x8000, 0x8000, 0xffff, 0x12ff, 0xffff, 0x1300, 0x8000, 0x8000, 0x1301, 0x1302,
+    0x8000, 0x1303, 0xffff, 0xffff, 0x1304, 0x8000, 0xffff, 0x1305, 0x8000, 0x8000, 0x1306, 0x1307,
+    0x8000, 0x8000, 0xffff, 0xffff, 0xffff, 0xffff, 0x1308, 0xffff, 0x1309, 0xffff, 0x8000, 0x130a,
+    0x8000, 0x130b, 0x8000, 0x130c, 0x8000, 0xffff, 0x8000, 0xffff, 0x130d, 0xffff, 0xffff, 0xffff,
+    0x130e, 0xffff, 0x130f, 0xffff, 0x1310, 0xffff, 0x802b, 0x1311, 0x802b, 0x1312, 0x1313, 0x802b,
+    0xffff, 0x1314, 0x1315, 0x801f, 0x1316, 0x801f, 0x801f, 0x801f, 0x1317, 0x801f, 0x1318, 0x801f,
+    0xffff, 0x1319, 0xffff, 0x801f, 0x131a, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff,
+    0x8028, 0x131b, 0x8028, 0x8028, 0xffff, 0xffff, 0x131c, 0xffff, 0x8028, 0x131d, 0x8028, 0x8028,
+    0xffff, 0xffff, 0x131e, 0xffff, 0x8028, 0x8028, 0x131f, 0x802a, 0x8028, 0x8028, 0x802a, 0x802a,
+    0x1320, 0xffff, 0x802a, 0x1321, 0x802a, 0x1322, 0x802a, 0x802a, 0xffff, 0xffff, 0x1323, 0x802a,
+    0x1324, 0x1325, 0x802a, 0x1326, 0xffff, 0x1327, 0xffff, 0x1328, 0xffff, 0x802b, 0x1329, 0x802b,
+    0x132a, 0xffff, 0x132b, 0x132c, 0x802a, 0x132d, 0x802a, 0x132e, 0xffff, 0xffff, 0xffff, 0x132f,
+    0x1330, 0x802b, 0x802b, 0x802b, 0x1331, 0x802b, 0x1332, 0x802b, 0xffff, 0x1333, 0x1334, 0x802b,
+    0xffff, 0x1335, 0x1336, 0x802b, 0xffff, 0x1337, 0x1338, 0x802b, 0x802b, 0x802b, 0x802b, 0x1339,
+    0x802b, 0x802b, 0x802b, 0x133a, 0x133b, 0xffff, 0xffff, 0xffff, 0x133c, 0xffff, 0x802b, 0x133d,
+    0x802b, 0x802b, 0x802b, 0x133e, 0x133f, 0x801f, 0x1340, 0x801f, 0xffff, 0x801f, 0xffff, 0x1341,
+    0x1342, 0xffff, 0xffff, 0xffff, 0xffff, 0x1343, 0xffff, 0xffff, 0x1344, 0x801f, 0xffff, 0xffff,
+    0x802b, 0x1345, 0x802b, 0x1346, 0x1347, 0xffff, 0x1348, 0xffff, 0x802b, 0x802b, 0x802b, 0x1349,
+    0x134a, 0xffff, 0xffff, 0xffff, 0x802b, 0x134b, 0x802b, 0x134c, 0xffff, 0xffff, 0xffff, 0x134d,
+    0xffff, 0xffff, 0x134e, 0x134f, 0xffff, 0xffff, 0x8024, 0x8024, 0x1350, 0xffff, 0x8024, 0x1351,
+    0xffff, 0xffff, 0x1352, 0xffff, 0x1353, 0xffff, 0x801f, 0x1354, 0xffff, 0x1355, 0xffff, 0x8024,
+    0xffff, 0x8024, 0x1356, 0x8024, 0x801f, 0x801f, 0x1357, 0xffff, 0x1358, 0xffff, 0x801f, 0xffff,
+    0x1359, 0x8024, 0x135a, 0x8024, 0xffff, 0x135b, 0x135c, 0x135d, 0x135e, 0x135f, 0x8024, 0x8024,
+    0x1360, 0x1361, 0x8024, 0x8024, 0x1362, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x1363, 0x1364,
+    0xffff, 0xffff, 0x1365, 0x1366, 0xffff, 0xffff, 0x1367, 0x1368, 0xffff, 0xffff, 0x1369, 0x136a,
+    0x8024, 0x136b, 0x8024, 0x136c, 0x8024, 0x8019, 0x8024, 0x8019, 0x8024, 0x8019, 0x8024, 0x136d,
+    0x136e, 0xffff, 0x136f, 0xffff, 0x1370, 0xffff, 0x801f, 0x1371, 0xffff, 0x1372, 0xffff, 0x1373,
+    0xffff, 0x8024, 0xffff, 0x8024, 0x801f, 0x801f, 0x1374, 0x1375, 0xffff, 0x1376, 0xffff, 0xffff,
+    0x801f, 0x8024, 0x801f, 0x1377, 0x1378, 0x1379, 0xffff, 0xffff, 0x8024, 0x8024, 0x137a, 0x137b,
+    0x8024, 0x8024, 0x137c, 0x137d, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0x137e, 0x8024,
+    0xffff, 0x137f, 0xffff, 0xffff, 0x8024, 0x8024, 0x1380, 0x1381, 0x8024, 0x8024, 0x8024, 0x1382,
+    0x8024, 0x8024, 0x1383, 0x1384, 0x1385, 0xffff, 0xffff, 0xffff, 0x8024, 0x8024, 0x1386, 0xffff,
+    0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x1387, 0x8024, 0x1388, 0x8024, 0xffff, 0x1389, 0xffff,
+    0x138a, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0x138b, 0x8024, 0x8024, 0x8024, 0x8024, 0x138c,
+    0x138d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x138e, 0x138f, 0x8029, 0x8029, 0x8029,
+    0xffff, 0xffff, 0x1390, 0x1391, 0x1392, 0x1393, 0x8029, 0x8029, 0xffff, 0xffff, 0x1394, 0x1395,
+    0xffff, 0x1396, 0x8029, 0x8029, 0xffff, 0xffff, 0x1397, 0x8012, 0xffff, 0xffff, 0xffff, 0x1398,
+    0x1399, 0x8012, 0x8012, 0x8012, 0xffff, 0x139a, 0x8012, 0x8012, 0x139b, 0xffff, 0x139c, 0xffff,
+    0x8012, 0xffff, 0x8012, 0x139d, 0xffff, 0x139e, 0xffff, 0xffff, 0x8012, 0x8012, 0xffff, 0xffff,
+    0x8012, 0x8012, 0xffff, 0x139f, 0x8012, 0x13a0, 0x8012, 0x8012, 0xffff, 0x13a1, 0xffff, 0xffff,
+    0x8012, 0x8012, 0x13a2, 0x8012, 0xffff, 0x8012, 0xffff, 0x13a3, 0xffff, 0xffff, 0x13a4, 0xffff,
+    0xffff, 0x13a5, 0x13a6, 0x8019, 0xffff, 0x13a7, 0xffff, 0x8019, 0x13a8, 0x13a9, 0x8019, 0x8019,
+    0xffff, 0xffff, 0xffff, 0x13aa, 0xffff, 0xffff, 0x13ab, 0xffff, 0xffff, 0xffff, 0xffff, 0x13ac,
+    0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0xffff, 0xffff, 0x13ad, 0xffff, 0xffff, 0x8019, 0x8019,
+    0xffff, 0x8019, 0x13ae, 0x8019, 0x13af, 0x13b0, 0x8019, 0x8019, 0x13b1, 0x8019, 0x8019, 0x8019,
+    0x8013, 0x8013, 0x13b2, 0x8013, 0x8019, 0x8013, 0x8019, 0x13b3, 0x8019, 0x8019, 0x8019, 0x13b4,
+    0x8019, 0x13b5, 0x8019, 0x13b6, 0xffff, 0xffff, 0xffff, 0x13b7, 0xffff, 0x13b8, 0x13b9, 0x13ba,
+    0x13bb, 0x8019, 0x8019, 0x8019, 0x13bc, 0x8019, 0x13bd, 0x8019, 0xffff, 0xffff, 0xffff, 0x13be,
+    0xffff, 0x13bf, 0x13c0, 0x8019, 0xffff, 0xffff, 0xffff, 0x13c1, 0x13c2, 0x8019, 0x8019, 0x8019,
+    0xffff, 0x13c3, 0xffff, 0x8019, 0x8019, 0x13c4, 0x13c5, 0x13c6, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0x13c7, 0x8019, 0x13c8, 0x8019, 0x8013, 0x13c9, 0x8013, 0x13ca, 0x13cb, 0xffff, 0xffff,
+    0x13cc, 0x8013, 0xffff, 0xffff, 0x8013, 0x8013, 0x13cd, 0x8013, 0x13ce, 0x8013, 0x13cf, 0x8013,
+    0x8019, 0x13d0, 0x13d1, 0xffff, 0x13d2, 0xffff, 0x13d3, 0xffff, 0x13d4, 0xffff, 0x13d5, 0xffff,
+    0x13d6, 0xffff, 0x13d7, 0xffff, 0x13d8, 0x8013, 0xffff, 0x13d9, 0xffff, 0x13da, 0xffff, 0x13db,
+    0xffff, 0x13dc, 0xffff, 0x13dd, 0x8014, 0x8014, 0x13de, 0x8014, 0x13df, 0x8013, 0x8013, 0x8013,
+    0x8013, 0x13e0, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8013, 0x8013, 0x8013, 0x13e1, 0x13e2, 0x8014, 0x13e3, 0x8014, 0x8013, 0x13e4, 0x8013, 0x8014,
+    0x8013, 0x13e5, 0x8013, 0x8013, 0x8014, 0x8014, 0x13e6, 0x13e7, 0x8014, 0x8014, 0x13e8, 0x8014,
+    0x8014, 0x13e9, 0x8014, 0x13ea, 0x8014, 0x13eb, 0x8014, 0xffff, 0x8014, 0x13ec, 0x8014, 0x13ed,
+    0x8014, 0x8014, 0x8014, 0x13ee, 0x13ef, 0xffff, 0xffff, 0xffff, 0x8014, 0x13f0, 0x8014, 0x13f1,
+    0x8014, 0x13f2, 0x8014, 0x13f3, 0x8014, 0x8014, 0x13f4, 0xffff, 0x13f5, 0x13f6, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x13f7, 0x13f8, 0xffff, 0xffff, 0x13f9, 0x13fa, 0xffff, 0xffff, 0x13fb, 0x13fc,
+    0x13fd, 0x8014, 0x8013, 0x13fe, 0x8013, 0x13ff, 0x8013, 0x8013, 0x8014, 0x8014, 0x1400, 0x8014,
+    0x1401, 0x8014, 0x8013, 0x8014, 0x8013, 0x1402, 0x8013, 0x1403, 0x8013, 0x8013, 0x1404, 0x8013,
+    0xffff, 0x1405, 0xffff, 0xffff, 0x1406, 0x8013, 0x1407, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013,
+    0xffff, 0x8013, 0xffff, 0x1408, 0x8013, 0x8013, 0x8013, 0x1409, 0x8014, 0x140a, 0x140b, 0xffff,
+    0xffff, 0xffff, 0x140c, 0xffff, 0xffff, 0xffff, 0xffff, 0x140d, 0x140e, 0xffff, 0x8014, 0x140f,
+    0x8014, 0x8014, 0x1410, 0x1411, 0x1412, 0x8017, 0x8017, 0x8017, 0xffff, 0x1413, 0x1414, 0x8017,
+    0xffff, 0x1415, 0x1416, 0x8017, 0x1417, 0x8017, 0x8017, 0x8017, 0x8017, 0x8017, 0x1418, 0x8017,
+    0x1419, 0x8017, 0x8017, 0x8017, 0x141a, 0x8019, 0x141b, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019,
+    0xffff, 0x8019, 0xffff, 0x141c, 0xffff, 0x8019, 0x141d, 0x8019, 0x141e, 0x8019, 0x8019, 0x8019,
+    0x8019, 0x8019, 0x8019, 0x141f, 0x8019, 0x1420, 0x8019, 0x1421, 0x1422, 0xffff, 0xffff, 0xffff,
+    0x8019, 0x8019, 0x8019, 0x1423, 0x8019, 0x1424, 0xffff, 0xffff, 0x8019, 0x1425, 0x8019, 0x1426,
+    0x1427, 0xffff, 0xffff, 0xffff, 0x8019, 0x8019, 0x1428, 0x1429, 0x8019, 0x8019, 0xffff, 0xffff,
+    0x8019, 0x8019, 0x142a, 0x8019, 0xffff, 0x142b, 0xffff, 0xffff, 0x8019, 0x8019, 0x142c, 0x8019,
+    0x142d, 0xffff, 0x142e, 0xffff, 0x142f, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0x1430, 0x8019, 0x8019, 0x8019, 0x1431,
+    0x1432, 0xffff, 0xffff, 0xffff, 0x1433, 0xffff, 0xffff, 0xffff, 0x1434, 0x1435, 0xffff, 0xffff,
+    0x1436, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1437, 0xffff, 0xffff, 0x8029, 0x1438,
+    0xffff, 0xffff, 0x1439, 0xffff, 0x8029, 0xffff, 0x143a, 0xffff, 0x143b, 0xffff, 0x143c, 0xffff,
+    0x143d, 0xffff, 0xffff, 0xffff, 0xffff, 0x143e, 0xffff, 0xffff, 0x143f, 0x8013, 0x1440, 0x8013,
+    0xffff, 0x8013, 0xffff, 0x1441, 0x1442, 0x8013, 0xffff, 0x1443, 0x8013, 0x1444, 0x8013, 0x1445,
+    0x8013, 0x1446, 0x8013, 0x1447, 0x8014, 0x1448, 0x8014, 0x1449, 0x8014, 0x144a, 0x8014, 0x8017,
+    0x8014, 0x8014, 0x144b, 0x8014, 0x144c, 0x8014, 0x8013, 0x144d, 0x144e, 0x8017, 0x144f, 0x8017,
+    0x1450, 0x8017, 0x8017, 0x8017, 0x1451, 0x8013, 0xffff, 0x8017, 0x1452, 0x8017, 0x8017, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x1453, 0x8017,
+    0x1454, 0x8017, 0xffff, 0x1455, 0x1456, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x1457, 0x8017,
+    0xffff, 0x1458, 0xffff, 0xffff, 0x1459, 0x8017, 0xffff, 0x145a, 0x145b, 0x8017, 0xffff, 0x145c,
+    0xffff, 0xffff, 0xffff, 0x145d, 0xffff, 0xffff, 0xffff, 0x145e, 0x145f, 0xffff, 0x8011, 0x1460,
+    0xffff, 0x8011, 0x1461, 0x8011, 0x8011, 0x1462, 0x8011, 0x1463, 0x8011, 0xffff, 0x1464, 0xffff,
+    0x1465, 0xffff, 0xffff, 0xffff, 0x8011, 0x1466, 0x8011, 0x1467, 0x1468, 0xffff, 0x1469, 0x146a,
+    0x146b, 0x146c, 0x146d, 0x146e, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011,
+    0xffff, 0xffff, 0xffff, 0x146f, 0x1470, 0x8011, 0x1471, 0x8011, 0xffff, 0x1472, 0xffff, 0x1473,
+    0x1474, 0x8011, 0x8011, 0x8011, 0xffff, 0x1475, 0xffff, 0x1476, 0xffff, 0x1477, 0xffff, 0x1478,
+    0xffff, 0x1479, 0xffff, 0x8011, 0xffff, 0x147a, 0x8011, 0x8011, 0x147b, 0xffff, 0x8011, 0x147c,
+    0x8011, 0x147d, 0x8011, 0x8011, 0xffff, 0xffff, 0x147e, 0xffff, 0x8011, 0x147f, 0x8011, 0x1480,
+    0x8011, 0x1481, 0x8011, 0x8011, 0x8011, 0x1482, 0x8011, 0x1483, 0xffff, 0x8011, 0xffff, 0x8011,
+    0x1484, 0x8011, 0x1485, 0x8011, 0x1486, 0x8011, 0x1487, 0x8011, 0xffff, 0x8011, 0xffff, 0x1488,
+    0x8011, 0x8011, 0x8011, 0x1489, 0x148a, 0x8011, 0xffff, 0x148b, 0x148c, 0xffff, 0x148d, 0xffff,
+    0xffff, 0xffff, 0x148e, 0x8017, 0x8011, 0x8011, 0x8011, 0x148f, 0x8011, 0x1490, 0xffff, 0xffff,
+    0x8011, 0x1491, 0x8011, 0xffff, 0x8011, 0xffff, 0x1492, 0xffff, 0x1493, 0xffff, 0xffff, 0xffff,
+    0x1494, 0xffff, 0x8017, 0xffff, 0x8017, 0x1495, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x1496,
+    0xffff, 0x1497, 0x8017, 0x8017, 0xffff, 0x8017, 0x1498, 0x8017, 0x1499, 0x149a, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x149b, 0x149c, 0x149d, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x149e, 0xffff,
+    0xffff, 0x149f, 0xffff, 0x14a0, 0xffff, 0x8017, 0x14a1, 0x8017, 0xffff, 0x14a2, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x14a3, 0x14a4, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0x14a5, 0x14a6,
+    0xffff, 0xffff, 0x8017, 0x14a7, 0xffff, 0x14a8, 0xffff, 0x14a9, 0xffff, 0xffff, 0xffff, 0x14aa,
+    0x8017, 0x8017, 0x14ab, 0x8017, 0x14ac, 0x8017, 0x8017, 0x8017, 0x14ad, 0x14ae, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x14af, 0xffff, 0xffff, 0xffff, 0x14b0, 0x8017, 0x14b1, 0xffff, 0x8017, 0x14b2,
+    0x8017, 0x14b3, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x14b4, 0x14b5, 0x8017, 0x8017, 0x8017,
+    0xffff, 0x14b6, 0x14b7, 0x8017, 0x8017, 0x14b8, 0x8017, 0x8017, 0xffff, 0xffff, 0x14b9, 0xffff,
+    0x14ba, 0xffff, 0x8017, 0x14bb, 0x8017, 0x14bc, 0x8017, 0x8017, 0xffff, 0xffff, 0x14bd, 0xffff,
+    0x14be, 0xffff, 0x8017, 0x14bf, 0x8017, 0x14c0, 0x8017, 0x8017, 0xffff, 0xffff, 0x14c1, 0xffff,
+    0x14c2, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x14c3, 0x8017, 0x14c4, 0x8017, 0x8017,
+    0x14c5, 0xffff, 0x14c6, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x14c7, 0x8017, 0x14c8,
+    0x14c9, 0xffff, 0x14ca, 0xffff, 0x8017, 0x14cb, 0x8017, 0x14cc, 0x8017, 0x14cd, 0x14ce, 0xffff,
+    0x8017, 0x14cf, 0x8017, 0x14d0, 0xffff, 0xffff, 0xffff, 0x14d1, 0xffff, 0xffff, 0x14d2, 0x14d3,
+    0x8017, 0x8017, 0x8017, 0x14d4, 0x8017, 0x14d5, 0x8017, 0x14d6, 0x8017, 0x14d7, 0x14d8, 0xffff,
+    0x14d9, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0x14da, 0x8017, 0x8017, 0x14db, 0x14dc,
+    0x14dd, 0xffff, 0x14de, 0xffff, 0x8017, 0x8017, 0x14df, 0x14e0, 0x8017, 0x8017, 0x14e1, 0x14e2,
+    0x8017, 0x8017, 0x14e3, 0x14e4, 0x14e5, 0x14e6, 0xffff, 0xffff, 0x8017, 0x8017, 0x14e7, 0x14e8,
+    0x14e9, 0x14ea, 0xffff, 0xffff, 0x14eb, 0x14ec, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x14ed,
+    0x8017, 0x8017, 0x14ee, 0x8017, 0xffff, 0x14ef, 0xffff, 0xffff, 0x8017, 0x8017, 0x14f0, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x14f1, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x14f2, 0xffff, 0x8017, 0x14f3, 0x8017, 0x14f4, 0x14f5, 0xffff, 0x14f6, 0xffff,
+    0x8017, 0x8017, 0x8017, 0x14f7, 0x8017, 0x14f8, 0x8017, 0x8017, 0x8017, 0xffff, 0x14f9, 0xffff,
+    0x8017, 0x14fa, 0x8017, 0x14fb, 0x14fc, 0x14fd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x14fe,
+    0xffff, 0xffff, 0x14ff, 0xffff, 0xffff, 0x1500, 0xffff, 0xffff, 0x8016, 0x1501, 0x8016, 0x8016,
+    0xffff, 0xffff, 0x8016, 0x1502, 0x8016, 0x1503, 0x8016, 0x8016, 0x1504, 0x1505, 0x1506, 0x801a,
+    0x1507, 0x801a, 0xffff, 0x1508, 0xffff, 0x1509, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0xffff,
+    0x801a, 0x801a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x150a, 0xffff, 0xffff, 0x150b, 0x150c,
+    0x8016, 0x150d, 0x8016, 0x150e, 0xffff, 0x150f, 0xffff, 0x1510, 0x1511, 0x8016, 0x8015, 0x1512,
+    0x8016, 0xffff, 0x1513, 0xffff, 0x8015, 0x8015, 0x8015, 0x1514, 0x1515, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x1516, 0x8017, 0x8017, 0xffff, 0xffff, 0x1517, 0xffff, 0x1518, 0xffff, 0x8017, 0x1519,
+    0xffff, 0x8017, 0x151a, 0x8017, 0x8017, 0x151b, 0x8017, 0x8017, 0x151c, 0x8017, 0x151d, 0x8017,
+    0xffff, 0x151e, 0x151f, 0x8015, 0x8017, 0x1520, 0x8017, 0x8017, 0x8015, 0x8015, 0x1521, 0x8015,
+    0x8015, 0x1522, 0x8015, 0x8015, 0xffff, 0xffff, 0x1523, 0xffff, 0x8015, 0x1524, 0x8015, 0x1525,
+    0x1526, 0x8015, 0x8017, 0x1527, 0x1528, 0x8015, 0x8017, 0x1529, 0x8015, 0x8015, 0x152a, 0x8015,
+    0x152b, 0xffff, 0x152c, 0xffff, 0x8015, 0x152d, 0x8015, 0x152e, 0x8017, 0x152f, 0x8017, 0x8017,
+    0x1530, 0x1531, 0x8017, 0x1532, 0x1533, 0xffff, 0x1534, 0xffff, 0x1535, 0xffff, 0x1536, 0xffff,
+    0x1537, 0xffff, 0x1538, 0xffff, 0xffff, 0xffff, 0x1539, 0xffff, 0x801a, 0x153a, 0x801a, 0x801a,
+    0x153b, 0x153c, 0x801a, 0x801a, 0x153d, 0x153e, 0x801a, 0x801a, 0xffff, 0xffff, 0x153f, 0xffff,
+    0x801a, 0x801a, 0x1540, 0x801a, 0xffff, 0x801a, 0xffff, 0x1541, 0x801a, 0x1542, 0x801a, 0x801a,
+    0xffff, 0xffff, 0x1543, 0xffff, 0x1544, 0xffff, 0x1545, 0xffff, 0xffff, 0x1546, 0xffff, 0xffff,
+    0x801a, 0x801a, 0x1547, 0x801a, 0x1548, 0x1549, 0xffff, 0xffff, 0x801a, 0x801a, 0x154a, 0x801a,
+    0xffff, 0x154b, 0xffff, 0x154c, 0x801a, 0x801a, 0x154d, 0x801a, 0x154e, 0xffff, 0x154f, 0xffff,
+    0x1550, 0xffff, 0x1551, 0xffff, 0x1552, 0xffff, 0x1553, 0xffff, 0x801a, 0x1554, 0x801a, 0x1555,
+    0x1556, 0x801a, 0x1557, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x1558,
+    0x801a, 0x1559, 0x801a, 0x155a, 0x801a, 0x155b, 0x155c, 0x155d, 0x802a, 0x155e, 0x802a, 0x155f,
+    0x802a, 0x1560, 0x1561, 0xffff, 0x802b, 0x802b, 0xffff, 0x1562, 0x1563, 0x802b, 0x1564, 0x802b,
+    0x1565, 0xffff, 0x802a, 0x1566, 0x802a, 0x1567, 0x802a, 0x802a, 0xffff, 0xffff, 0x1568, 0x1569,
+    0xffff, 0x156a, 0xffff, 0x156b, 0x802b, 0x802b, 0x156c, 0x156d, 0xffff, 0x156e, 0x156f, 0x1570,
+    0x802c, 0x802c, 0x1571, 0x1572, 0xffff, 0x1573, 0xffff, 0xffff, 0x802a, 0x802a, 0x802a, 0x1574,
+    0x802a, 0x802a, 0x802a, 0x1575, 0x1576, 0xffff, 0xffff, 0xffff, 0x802a, 0x8020, 0x802a, 0x1577,
+    0x802a, 0x1578, 0x802a, 0x1579, 0x802a, 0x157a, 0x157b, 0x8020, 0xffff, 0x8020, 0x157c, 0x8020,
+    0x802b, 0x157d, 0x802b, 0x802b, 0xffff, 0xffff, 0x157e, 0xffff, 0x802b, 0x157f, 0x802b, 0x1580,
+    0x802b, 0x802b, 0x1581, 0x1582, 0x802b, 0x1583, 0x802c, 0x802c, 0x802c, 0x802c, 0x1584, 0x1585,
+    0x802c, 0x802c, 0x1586, 0x802c, 0x802c, 0x1587, 0x802c, 0x802c, 0x1588, 0x1589, 0x802c, 0x8021,
+    0x802c, 0x158a, 0x802c, 0x802c, 0x158b, 0x158c, 0x8021, 0x8021, 0x158d, 0x158e, 0x8021, 0x8021,
+    0xffff, 0xffff, 0x8021, 0x158f, 0x8021, 0x8021, 0x1590, 0x8021, 0x1591, 0xffff, 0x1592, 0xffff,
+    0x8021, 0x1593, 0x8021, 0x1594, 0x1595, 0x802c, 0x1596, 0x802c, 0x8020, 0x1597, 0x8020, 0xffff,
+    0x1598, 0x802c, 0xffff, 0x1599, 0x802c, 0x159a, 0xffff, 0xffff, 0x159b, 0xffff, 0xffff, 0xffff,
+    0x8020, 0x159c, 0x8020, 0x159d, 0xffff, 0xffff, 0x159e, 0xffff, 0x159f, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x15a0, 0xffff, 0xffff, 0x8021, 0x8021, 0xffff, 0x15a1, 0x8021, 0x8021, 0x15a2, 0x15a3,
+    0xffff, 0x15a4, 0xffff, 0xffff, 0xffff, 0xffff, 0x15a5, 0x15a6, 0x15a7, 0x802a, 0xffff, 0xffff,
+    0x15a8, 0xffff, 0xffff, 0xffff, 0x15a9, 0xffff, 0x15aa, 0xffff, 0x8027, 0x15ab, 0x8027, 0xffff,
+    0x15ac, 0x8020, 0x15ad, 0x8020, 0xffff, 0x8020, 0xffff, 0x15ae, 0xffff, 0x15af, 0xffff, 0xffff,
+    0x8020, 0x8020, 0x15b0, 0x8020, 0x15b1, 0xffff, 0xffff, 0xffff, 0xffff, 0x15b2, 0xffff, 0xffff,
+    0x8020, 0x8020, 0x8020, 0x15b3, 0x8020, 0xffff, 0x15b4, 0xffff, 0x15b5, 0xffff, 0x8020, 0xffff,
+    0x15b6, 0xffff, 0x15b7, 0xffff, 0x15b8, 0xffff, 0x15b9, 0xffff, 0x15ba, 0xffff, 0xffff, 0xffff,
+    0x8020, 0x8020, 0x15bb, 0x15bc, 0x8020, 0x8020, 0x15bd, 0x15be, 0xffff, 0xffff, 0xffff, 0x15bf,
+    0x15c0, 0xffff, 0x15c1, 0x15c2, 0xffff, 0xffff, 0x15c3, 0x8025, 0x15c4, 0x15c5, 0x15c6, 0x8025,
+    0xffff, 0xffff, 0xffff, 0x15c7, 0x15c8, 0x15c9, 0x8025, 0x8025, 0x15ca, 0x15cb, 0x8025, 0x8025,
+    0x15cc, 0xffff, 0x8025, 0x15cd, 0xffff, 0xffff, 0x15ce, 0x15cf, 0x15d0, 0x8025, 0xffff, 0x15d1,
+    0xffff, 0x15d2, 0xffff, 0xffff, 0xffff, 0x15d3, 0x15d4, 0x8025, 0xffff, 0xffff, 0x15d5, 0x15d6,
+    0x8025, 0x15d7, 0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0x15d8, 0x8029, 0x8029, 0x15d9, 0x8029,
+    0x15da, 0x8029, 0x8025, 0x15db, 0x8025, 0x8025, 0x8025, 0x15dc, 0x8025, 0x15dd, 0x15de, 0x8029,
+    0x15df, 0x8029, 0x8029, 0x8029, 0x15e0, 0x8029, 0x15e1, 0x8029, 0x15e2, 0x8029, 0x8025, 0x8029,
+    0x8025, 0x8029, 0x15e3, 0x8029, 0xffff, 0xffff, 0xffff, 0x15e4, 0xffff, 0x15e5, 0xffff, 0xffff,
+    0x8025, 0x8025, 0xffff, 0x15e6, 0x8025, 0x8025, 0x15e7, 0x15e8, 0x8025, 0x15e9, 0xffff, 0xffff,
+    0x15ea, 0x15eb, 0xffff, 0xffff, 0xffff, 0x15ec, 0xffff, 0xffff, 0x8025, 0x8025, 0x15ed, 0x8025,
+    0xffff, 0x15ee, 0xffff, 0xffff, 0x8025, 0x8025, 0x8029, 0x8029, 0x15ef, 0x8029, 0x15f0, 0x8029,
+    0xffff, 0xffff, 0xffff, 0x15f1, 0xffff, 0x15f2, 0xffff, 0x8029, 0xffff, 0xffff, 0x15f3, 0x15f4,
+    0x15f5, 0x15f6, 0x8029, 0x8029, 0x15f7, 0x8029, 0x8029, 0x8029, 0x8025, 0x15f8, 0x8029, 0x8029,
+    0x8025, 0x15f9, 0x8025, 0x8029, 0x15fa, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x15fb,
+    0xffff, 0x8023, 0x15fc, 0x8023, 0x15fd, 0x8023, 0x15fe, 0x8023, 0x15ff, 0x8023, 0x1600, 0x8023,
+    0x1601, 0x8023, 0x1602, 0x8023, 0x1603, 0x8023, 0xffff, 0x1604, 0xffff, 0x1605, 0xffff, 0x1606,
+    0xffff, 0x1607, 0xffff, 0x1608, 0xffff, 0x1609, 0xffff, 0x160a, 0x160b, 0x160c, 0x8023, 0x8023,
+    0x160d, 0x160e, 0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x160f, 0xffff, 0x1610, 0x1611, 0x1612,
+    0x8023, 0x1613, 0x8023, 0x8023, 0x8029, 0x8029, 0x1614, 0x8029, 0x8023, 0x1615, 0x8023, 0x8023,
+    0x8029, 0x8029, 0x1616, 0x8029, 0x1617, 0x8023, 0xffff, 0x1618, 0x8023, 0x1619, 0x8023, 0x161a,
+    0x161b, 0x8029, 0x161c, 0x8029, 0x8023, 0x161d, 0x161e, 0x8029, 0x161f, 0x8029, 0x1620, 0x8029,
+    0x1621, 0x8023, 0xffff, 0x1622, 0xffff, 0x1623, 0x1624, 0x8023, 0xffff, 0xffff, 0xffff, 0x1625,
+    0x1626, 0x8029, 0x1627, 0x8029, 0x1628, 0x8029, 0x1629, 0x8029, 0x8023, 0x8023, 0x8023, 0x162a,
+    0x8023, 0x162b, 0x8023, 0x8023, 0x8029, 0x162c, 0x8029, 0x162d, 0x162e, 0xffff, 0xffff, 0xffff,
+    0x8029, 0x162f, 0x8029, 0x1630, 0x8029, 0x1631, 0x8029, 0x1632, 0x8029, 0x1633, 0x8029, 0x1634,
+    0x1635, 0xffff, 0x8029, 0x1636, 0x8029, 0x1637, 0x8029, 0x8029, 0xffff, 0xffff, 0x1638, 0xffff,
+    0x1639, 0xffff, 0x163a, 0xffff, 0x163b, 0xffff, 0x163c, 0xffff, 0x163d, 0xffff, 0x163e, 0xffff,
+    0x163f, 0xffff, 0x1640, 0xffff, 0x1641, 0xffff, 0x1642, 0xffff, 0x1643, 0xffff, 0x1644, 0xffff,
+    0x1645, 0xffff, 0x1646, 0xffff, 0xffff, 0x1647, 0xffff, 0xffff, 0x1648, 0x8017, 0xffff, 0x1649,
+    0xffff, 0x164a, 0xffff, 0x164b, 0xffff, 0x164c, 0xffff, 0xffff, 0x8017, 0x8017, 0x164d, 0x8017,
+    0x8017, 0x164e, 0x8017, 0x164f, 0x1650, 0xffff, 0x1651, 0xffff, 0x1652, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x1653, 0xffff, 0x1654, 0x8017, 0x8017, 0x8017, 0x1655, 0x1656, 0xffff, 0xffff, 0xffff,
+    0x1657, 0xffff, 0x1658, 0xffff, 0x1659, 0xffff, 0x165a, 0xffff, 0x165b, 0xffff, 0x165c, 0xffff,
+    0x165d, 0xffff, 0x165e, 0xffff, 0x165f, 0xffff, 0x1660, 0xffff, 0x1661, 0xffff, 0x1662, 0xffff,
+    0x1663, 0xffff, 0x1664, 0xffff, 0x1665, 0xffff, 0x1666, 0xffff, 0x1667, 0xffff, 0x1668, 0xffff,
+    0x1669, 0xffff, 0x166a, 0xffff, 0x166b, 0xffff, 0x166c, 0xffff, 0x166d, 0xffff, 0x166e, 0xffff,
+    0x166f, 0xffff, 0x1670, 0xffff, 0x1671, 0xffff, 0x1672, 0xffff, 0x1673, 0xffff, 0x1674, 0xffff,
+    0x1675, 0xffff, 0x1676, 0xffff, 0xffff, 0xffff, 0xffff, 0x1677, 0x1678, 0x1679, 0xffff, 0xffff,
+    0xffff, 0x167a, 0xffff, 0x167b, 0x167c, 0x8023, 0x8023, 0x8023, 0x167d, 0x167e, 0xffff, 0xffff,
+    0x167f, 0x1680, 0xffff, 0xffff, 0x1681, 0x8023, 0xffff, 0x1682, 0x8023, 0x1683, 0xffff, 0xffff,
+    0x1684, 0x8029, 0x8029, 0x8029, 0x8023, 0x1685, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029,
+    0x1686, 0x1687, 0xffff, 0xffff, 0x1688, 0x1689, 0xffff, 0xffff, 0x8029, 0x8029, 0x168a, 0x168b,
+    0x168c, 0xffff, 0xffff, 0xffff, 0x8029, 0x8029, 0x168d, 0x168e, 0x8029, 0x8029, 0x168f, 0x1690,
+    0x1691, 0x1692, 0xffff, 0xffff, 0x1693, 0x1694, 0xffff, 0xffff, 0x1695, 0x1696, 0xffff, 0xffff,
+    0x1697, 0x1698, 0xffff, 0xffff, 0x8029, 0x8029, 0x1699, 0x8029, 0xffff, 0x169a, 0xffff, 0xffff,
+    0x169b, 0x169c, 0xffff, 0xffff, 0x8029, 0x8029, 0x8029, 0x169d, 0x8029, 0x169e, 0xffff, 0xffff,
+    0x8017, 0x169f, 0x8017, 0xffff, 0x16a0, 0xffff, 0xffff, 0xffff, 0x16a1, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x16a2, 0xffff, 0xffff, 0x16a3, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x16a4, 0x8017,
+    0xffff, 0x16a5, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x16a6, 0xffff, 0x16a7, 0xffff, 0xffff,
+    0x16a8, 0x16a9, 0xffff, 0xffff, 0xffff, 0x16aa, 0x16ab, 0x8017, 0xffff, 0x16ac, 0xffff, 0x16ad,
+    0xffff, 0x16ae, 0xffff, 0x16af, 0xffff, 0x8017, 0xffff, 0x16b0, 0xffff, 0x16b1, 0xffff, 0xffff,
+    0x8017, 0x8017, 0x16b2, 0x8017, 0x8017, 0x16b3, 0x8017, 0x16b4, 0x16b5, 0xffff, 0x16b6, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x16b7, 0x8017, 0x16b8, 0xffff, 0xffff,
+    0x8017, 0xffff, 0x16b9, 0xffff, 0x8017, 0x8017, 0x16ba, 0x16bb, 0x16bc, 0x16bd, 0xffff, 0xffff,
+    0x8017, 0x16be, 0xffff, 0x16bf, 0x16c0, 0x8017, 0x16c1, 0x8017, 0xffff, 0x8017, 0xffff, 0x16c2,
+    0xffff, 0x16c3, 0xffff, 0xffff, 0x16c4, 0x8017, 0x16c5, 0x16c6, 0x8017, 0x8017, 0x16c7, 0x16c8,
+    0x8017, 0x16c9, 0x8017, 0x16ca, 0x16cb, 0xffff, 0xffff, 0xffff, 0x16cc, 0xffff, 0x16cd, 0xffff,
+    0x8017, 0x8017, 0x16ce, 0x16cf, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0xffff,
+    0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0x8005, 0xffff, 0xffff, 0xffff, 0x8005, 0xffff,
+    0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff,
+    0x8005, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0xffff,
+    0x8005, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0x8005,
+    0xffff, 0xffff, 0x8005, 0x8005, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff,
+    0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff,
+    0x8005, 0xffff, 0x8005, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff, 0x8005, 0x8005, 0xffff, 0xffff,
+    0x8005, 0xffff, 0xffff, 0xffff, 0x8005, 0xffff, 0x8005, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e,
+    0xffff, 0x800e, 0xffff, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff,
+    0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f,
+    0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff, 0x800f, 0xffff,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff, 0x800e, 0xffff,
+    0x800e, 0xffff, 0xffff, 0xffff, 0x800e, 0xffff, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0xffff,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f,
+    0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f,
+    0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f,
+    0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006,
+    0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff,
+    0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006,
+    0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006,
+    0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0xffff, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff,
+    0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0xffff, 0x800f, 0x800f, 0x800f, 0xffff,
+    0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0xffff, 0xffff, 0x800f, 0xffff, 0xffff, 0xffff,
+    0x800f, 0x800f, 0x800f, 0xffff, 0x800f, 0x800f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8003,
+    0xffff, 0x8003, 0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003,
+    0xffff, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0x8003,
+    0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0x8003, 0x8003, 0x8003, 0xffff, 0x8003,
+    0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003,
+    0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff,
+    0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0x801d, 0x801d,
+    0xffff, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0x801d, 0x801d, 0xffff, 0x801d, 0x801d,
+    0xffff, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d, 0x801d, 0x801d, 0xffff, 0x801d, 0x801d,
+    0xffff, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d,
+    0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d, 0x801d,
+    0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0xffff, 0x801c, 0xffff, 0xffff, 0x801c, 0x801c,
+    0xffff, 0xffff, 0xffff, 0x801c, 0x801c, 0xffff, 0x801c, 0x801c, 0xffff, 0xffff, 0xffff, 0x801c,
+    0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c,
+    0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c,
+    0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0x801c, 0x801c, 0x801e, 0x801e,
+    0x801c, 0x801c, 0x801e, 0x801e, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c,
+    0x801c, 0x801c, 0x801e, 0x801e, 0x801c, 0x801e, 0x801e, 0x801e, 0xffff, 0x801c, 0xffff, 0x801c,
+    0x801c, 0x801e, 0x801e, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0x801c, 0xffff, 0x801c, 0xffff,
+    0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0xffff, 0x801c, 0x801c, 0xffff, 0xffff, 0x801c, 0x801c,
+    0x801c, 0x801c, 0x801c, 0x801e, 0x801c, 0x801c, 0x801c, 0x801e, 0xffff, 0xffff, 0x801e, 0xffff,
+    0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801c, 0x801c, 0x801c, 0x801e,
+    0x801c, 0x801e, 0x801e, 0x801e, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff,
+    0xffff, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d,
+    0x802d, 0xffff, 0x802d, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff,
+    0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d, 0x802d,
+    0xffff, 0xffff, 0x802d, 0xffff, 0xffff, 0xffff, 0xffff, 0x802d, 0x802d, 0xffff, 0x802d, 0xffff,
+    0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0xffff, 0x802d,
+    0x802d, 0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff,
+    0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d, 0xffff, 0x802d, 0x802d, 0x802d,
+    0x802d, 0x802d, 0x802d, 0xffff, 0x802d, 0x802d, 0xffff, 0xffff, 0x802d, 0x802d, 0x802d, 0xffff,
+    0x802d, 0xffff, 0xffff, 0xffff, 0x802d, 0xffff, 0xffff, 0xffff, 0xffff, 0x802d, 0x802d, 0x802d,
+    0xffff, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d, 0x802d, 0x802d, 0x802d, 0x802d, 0x802d, 0xffff,
+    0x802d, 0xffff, 0xffff, 0xffff, 0xffff, 0x802d, 0xffff, 0x802d, 0x802d, 0x802d, 0x802d, 0xffff,
+    0x802d, 0x802d, 0x802d, 0xffff, 0x802d, 0xffff, 0xffff, 0xffff, 0xffff, 0x801e, 0xffff, 0x801e,
+    0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e,
+    0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e,
+    0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e,
+    0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e,
+    0xffff, 0x801e, 0xffff, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b,
+    0x801e, 0x801e, 0x801b, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b,
+    0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0xffff, 0x801e, 0x801e, 0xffff, 0xffff, 0x801e, 0xffff,
+    0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0x801e, 0xffff, 0xffff, 0x801e, 0xffff,
+    0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b, 0x801b, 0x801e, 0x801b, 0x801b,
+    0x801e, 0x801e, 0x801b, 0x801b, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff,
+    0x801e, 0xffff, 0x801e, 0x801e, 0x801b, 0x801e, 0x801b, 0x801b, 0x801e, 0x801e, 0x801b, 0x801b,
+    0xffff, 0xffff, 0x801e, 0xffff, 0x801e, 0xffff, 0x801b, 0xffff, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0xffff, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff,
+    0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0xffff,
+    0x801d, 0x801d, 0xffff, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff,
+    0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d,
+    0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0xffff, 0x801d, 0xffff, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff,
+    0x801d, 0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff, 0x801d, 0xffff, 0xffff,
+    0x801d, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0xffff, 0xffff, 0x801d, 0xffff, 0xffff,
+    0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0xffff, 0x801d, 0x801d, 0x801d, 0xffff,
+    0x801d, 0x801d, 0x801d, 0xffff, 0x801d, 0x801d, 0xffff, 0xffff, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0x801b, 0x801b, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0xffff, 0xffff, 0x801b, 0xffff, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0x801b, 0xffff, 0x801b, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0x801b, 0xffff, 0xffff,
+    0xffff, 0x801b, 0xffff, 0xffff, 0x801b, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0x801b, 0x801b, 0x801b, 0xffff,
+    0x801b, 0x801b, 0x801b, 0xffff, 0x801b, 0x801b, 0x801b, 0xffff, 0xffff, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b,
+    0x801b, 0x801b, 0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0x801b, 0xffff, 0x801b,
+    0x801b, 0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0xffff, 0x801b, 0x801b, 0xffff, 0x801b,
+    0xffff, 0x801b, 0xffff, 0x801b, 0xffff, 0xffff, 0x802e, 0x802e, 0x802e, 0x802e, 0x802e, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b,
+    0xffff, 0x800b, 0x800b, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b,
+    0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b,
+    0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x800b, 0x800b, 0xffff, 0xffff, 0xffff, 0x800b,
+    0xffff, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff,
+    0x800b, 0x800b, 0x800b, 0xffff, 0x800b, 0x800b, 0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b,
+    0x800b, 0xffff, 0xffff, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0xffff, 0xffff, 0xffff, 0x800d,
+    0xffff, 0x800d, 0x800d, 0x800d, 0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a,
+    0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a,
+    0xffff, 0xffff, 0x800a, 0x800d, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b,
+    0xffff, 0x800b, 0xffff, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b,
+    0xffff, 0x800b, 0xffff, 0x800b, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff,
+    0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0x8007, 0x800b, 0xffff, 0x8007, 0xffff,
+    0x800b, 0x8007, 0x800b, 0x8007, 0x8007, 0xffff, 0x8007, 0xffff, 0x800b, 0x800b, 0x800b, 0x8007,
+    0x800b, 0x8007, 0x800b, 0x8007, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0xffff, 0x800b,
+    0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b, 0xffff, 0x800b,
+    0x800b, 0x800b, 0x8007, 0x8007, 0x800b, 0x8007, 0x8007, 0x8007, 0x800b, 0x800b, 0x8007, 0x800b,
+    0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8008, 0x8008, 0x8008, 0x8007, 0x8007, 0x8008, 0x8007,
+    0x800b, 0x800b, 0x8007, 0x8007, 0xffff, 0xffff, 0x800d, 0x800d, 0xffff, 0x800d, 0x800d, 0x800d,
+    0x8008, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0xffff, 0xffff, 0xffff, 0xffff, 0x8008,
+    0xffff, 0x8008, 0x8008, 0x8008, 0xffff, 0x8008, 0x8008, 0x8008, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8007, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x800b, 0x8007, 0x800b, 0x8007, 0x800b, 0x8007, 0x800b, 0x8007, 0x800b, 0x8007, 0x8007, 0x8007,
+    0x8007, 0xffff, 0x8007, 0x8007, 0x8007, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0xffff,
+    0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007,
+    0xffff, 0x8007, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x800a, 0x800a,
+    0xffff, 0x800a, 0x800a, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a, 0x800d, 0x800d, 0x800a, 0x800d,
+    0x800a, 0x800d, 0x800a, 0x800d, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a,
+    0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0x800a, 0x800a, 0x800a, 0x8008, 0x800a, 0x800a, 0x8008, 0x8008,
+    0x800a, 0x800a, 0x8008, 0x8008, 0x800a, 0x800a, 0x8008, 0x8008, 0x800a, 0x800a, 0x8008, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8007, 0x8007, 0x8008, 0x8007, 0x8007, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8008, 0x8007, 0x8007, 0x8008, 0x8007,
+    0x8008, 0x8007, 0x8008, 0x8007, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006,
+    0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff,
+    0x8006, 0xffff, 0x8006, 0x8006, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff,
+    0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0x8006, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff,
+    0x8006, 0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff,
+    0x8006, 0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff,
+    0x8006, 0x8006, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0x8006, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006, 0x8006, 0x8006, 0xffff, 0x8006,
+    0xffff, 0xffff, 0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0x8006, 0x8006, 0xffff, 0x8006,
+    0xffff, 0x8006, 0xffff, 0xffff, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff, 0x8006, 0xffff, 0xffff,
+    0x8006, 0xffff, 0x8006, 0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c, 0x800c,
+    0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0x800c, 0x800c, 0x800c, 0xffff, 0xffff, 0xffff, 0x800c,
+    0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0xffff,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0x8007,
+    0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0x8007, 0x8007, 0x8007,
+    0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0xffff, 0x800c,
+    0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0xffff,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x8007, 0x800c, 0x8007, 0x800c,
+    0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff,
+    0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c,
+    0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c,
+    0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c,
+    0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x800c, 0x8007, 0x8007, 0x8007, 0x8009,
+    0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009,
+    0x8009, 0x800c, 0x8009, 0x800c, 0x800c, 0x800c, 0x8009, 0x800c, 0x8009, 0x800c, 0x8009, 0x8009,
+    0x8009, 0x800c, 0x8009, 0x800c, 0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c,
+    0x800c, 0xffff, 0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x800c, 0xffff,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c,
+    0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009,
+    0x8007, 0x8009, 0x8007, 0x8009, 0x8009, 0x800c, 0x8009, 0x800c, 0x8009, 0x800c, 0x8009, 0x800c,
+    0x8009, 0x800c, 0x8009, 0x800c, 0x8009, 0x800c, 0x8009, 0x800c, 0x8007, 0x8009, 0x8007, 0x8007,
+    0x8009, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8007, 0x8009, 0x8009, 0x800c, 0x8009, 0x800c,
+    0x8009, 0x800c, 0x8009, 0x800c, 0x8007, 0x8009, 0x8007, 0x8007, 0x8009, 0x8009, 0x8009, 0xffff,
+    0x8007, 0xffff, 0x8007, 0xffff, 0x8009, 0x8009, 0xffff, 0xffff, 0x8009, 0x800c, 0xffff, 0xffff,
+    0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff, 0x8010,
+    0x800c, 0x800c, 0x8010, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0x800c, 0x800c, 0x8010, 0x800c, 0x8010, 0x800c, 0x8010, 0x800c, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0x8010, 0x8010, 0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff,
+    0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c,
+    0xffff, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff, 0x800c, 0x800c, 0x8010, 0x8010,
+    0x800c, 0x800c, 0x8010, 0x8010, 0x800c, 0x800c, 0x8010, 0x8010, 0x8010, 0x800c, 0x8010, 0x800c,
+    0x8010, 0x800c, 0x8010, 0x8010, 0x800c, 0x800c, 0x8010, 0x800c, 0x800c, 0x800c, 0x8010, 0x800c,
+    0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0x800c,
+    0x800c, 0xffff, 0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0x800c, 0xffff, 0xffff, 0x800c, 0xffff,
+    0xffff, 0xffff, 0x800c, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff, 0x8001, 0x8001, 0xffff, 0x8001,
+    0x8001, 0xffff, 0x8001, 0xffff, 0xffff, 0x8001, 0xffff, 0xffff, 0x8001, 0x8001, 0xffff, 0x8001,
+    0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0x8001, 0xffff, 0x8001, 0xffff, 0xffff,
+    0x8001, 0x8001, 0xffff, 0x8001, 0x8001, 0xffff, 0x8001, 0x8001, 0x8001, 0xffff, 0x8001, 0x8001,
+    0xffff, 0xffff, 0x8001, 0xffff, 0xffff, 0x8001, 0xffff, 0xffff, 0xffff, 0xffff, 0x8001, 0xffff,
+    0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0xffff, 0x8001, 0xffff, 0x8001,
+    0xffff, 0x8001, 0xffff, 0x8001, 0x8001, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001,
+    0x8001, 0x8001, 0xffff, 0x8001, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0x8001,
+    0xffff, 0xffff, 0x8001, 0x8001, 0xffff, 0xffff, 0x8001, 0xffff, 0x8001, 0x8001, 0xffff, 0xffff,
+    0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0x8001, 0x8001, 0xffff, 0x8001,
+    0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0xffff, 0xffff, 0x8028, 0xffff, 0xffff, 0xffff, 0x8028,
+    0x8001, 0x8001, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0x8001, 0xffff, 0xffff, 0xffff,
+    0x8001, 0x8001, 0xffff, 0xffff, 0x8001, 0x8001, 0x8001, 0xffff, 0x8001, 0x8001, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8028, 0xffff, 0xffff, 0xffff, 0x8028, 0x8028, 0xffff, 0xffff, 0x8028, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8026, 0xffff, 0xffff, 0x8026, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026,
+    0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0xffff, 0x8026, 0x8026, 0xffff, 0xffff, 0xffff, 0x8028,
+    0xffff, 0x8028, 0x8028, 0x8028, 0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8028,
+    0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026,
+    0xffff, 0x8026, 0xffff, 0x8026, 0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8026,
+    0x8026, 0x8026, 0x8026, 0x8028, 0xffff, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0x8028,
+    0xffff, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0xffff, 0x8026, 0xffff, 0x8026,
+    0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8028, 0x8026, 0x8026, 0x8028, 0x8028, 0x8026, 0x8028,
+    0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0x8026, 0xffff, 0xffff, 0x8026, 0x8028, 0x8026, 0x8028,
+    0x8026, 0x8028, 0x8026, 0x8026, 0x8026, 0x8026, 0xffff, 0x8028, 0x8026, 0x8028, 0x8028, 0x8028,
+    0x8026, 0x8026, 0x8026, 0x8028, 0xffff, 0xffff, 0xffff, 0x8028, 0xffff, 0x8028, 0x8028, 0x8028,
+    0xffff, 0x8028, 0xffff, 0xffff, 0xffff, 0x8028, 0xffff, 0xffff, 0x8028, 0x8028, 0x8028, 0xffff,
+    0x8028, 0x8028, 0xffff, 0xffff, 0x8028, 0x8028, 0xffff, 0xffff, 0x8028, 0x8028, 0x8028, 0x802a,
+    0x8028, 0x8028, 0xffff, 0xffff, 0x8028, 0x802a, 0xffff, 0x802a, 0x8028, 0x8028, 0x802a, 0x802a,
+    0xffff, 0x802a, 0xffff, 0x802a, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004,
+    0xffff, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff,
+    0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff,
+    0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004,
+    0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004,
+    0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004,
+    0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004,
+    0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004,
+    0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff,
+    0xffff, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff,
+    0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff,
+    0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004,
+    0xffff, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004,
+    0xffff, 0x8004, 0x8004, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004, 0x8004,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a,
+    0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x8008, 0x800a, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x800a, 0x8008, 0x8008, 0x800a, 0x800a, 0x8008, 0x8008, 0x800a, 0x800a,
+    0x8008, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x800a, 0x800a, 0x8008,
+    0x800a, 0x8008, 0x800a, 0x8008, 0xffff, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff,
+    0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff,
+    0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff,
+    0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x8008, 0x800a, 0x800a, 0xffff, 0xffff,
+    0x800a, 0x800a, 0xffff, 0xffff, 0x800a, 0x800a, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8008, 0x8008, 0x8007, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8008, 0xffff, 0xffff, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8008, 0xffff, 0xffff,
+    0x8008, 0x8007, 0xffff, 0xffff, 0x8008, 0x8007, 0x8008, 0x8007, 0x8008, 0x8007, 0x8007, 0x8007,
+    0x8007, 0x8007, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0x8007, 0x8007, 0x8007, 0xffff, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff,
+    0x8004, 0x8004, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004,
+    0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0xffff,
+    0x8004, 0x8004, 0xffff, 0x8004, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0x8004,
+    0x8004, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff,
+    0x8004, 0xffff, 0xffff, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff, 0x8004, 0xffff,
+    0x8004, 0x8004, 0xffff, 0xffff, 0x8004, 0x8004, 0xffff, 0xffff, 0x8007, 0x8007, 0x8007, 0xffff,
+    0x8007, 0x8007, 0xffff, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0x8007, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff, 0xffff, 0xffff, 0x8007, 0xffff, 0x8007, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010,
+    0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0x8007, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0x800c, 0x8010, 0x800c,
+    0x8010, 0x800c, 0x8010, 0x800c, 0x8010, 0x800c, 0x8010, 0x800c, 0x800c, 0xffff, 0x800c, 0xffff,
+    0x8010, 0x800c, 0x8010, 0x800c, 0x800c, 0x800c, 0xffff, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff,
+    0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0x8010, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0x8010, 0xffff,
+    0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff,
+    0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff,
+    0x8010, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0x800c, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff,
+    0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0x8010,
+    0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff,
+    0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff,
+    0xffff, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0x8010, 0x8010, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010,
+    0x8010, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010,
+    0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff,
+    0x8010, 0xffff, 0xffff, 0xffff, 0x8010, 0x8010, 0xffff, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff,
+    0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff,
+    0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff,
+    0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0x8010, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0x8010, 0xffff, 0xffff, 0xffff,
+    0x802a, 0x802a, 0xffff, 0x802a, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0xffff, 0xffff, 0x802a,
+    0xffff, 0xffff, 0xffff, 0x802a, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0xffff, 0xffff, 0x802a,
+    0xffff, 0x802a, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0xffff, 0x802a, 0x802a, 0xffff, 0x802a,
+    0xffff, 0x802a, 0xffff, 0x802a, 0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027,
+    0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0xffff, 0xffff, 0x802a, 0xffff, 0xffff,
+    0x802a, 0x802a, 0xffff, 0x802a, 0xffff, 0xffff, 0xffff, 0x8022, 0x8022, 0xffff, 0x8022, 0x8022,
+    0xffff, 0xffff, 0x8022, 0xffff, 0xffff, 0x8022, 0xffff, 0xffff, 0x8022, 0x8022, 0xffff, 0x8022,
+    0xffff, 0x8022, 0xffff, 0x8022, 0x8022, 0xffff, 0x8022, 0x8022, 0xffff, 0xffff, 0x8022, 0xffff,
+    0x8022, 0xffff, 0x8022, 0xffff, 0x8022, 0xffff, 0x8022, 0xffff, 0x8027, 0x8027, 0xffff, 0x8027,
+    0x8027, 0x8027, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8027, 0xffff, 0x8027, 0x8027, 0x8027,
+    0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0xffff, 0xffff, 0x8027, 0xffff, 0xffff,
+    0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff,
+    0x8027, 0x8027, 0xffff, 0x8027, 0x8022, 0x8022, 0xffff, 0x8022, 0xffff, 0x8022, 0xffff, 0xffff,
+    0x8022, 0xffff, 0x8022, 0xffff, 0x8022, 0x8022, 0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0xffff,
+    0x8022, 0x8022, 0x8022, 0x8027, 0x8022, 0x8027, 0x8022, 0x8022, 0x8027, 0x8027, 0x8022, 0x8027,
+    0x8027, 0x8027, 0x8027, 0xffff, 0xffff, 0xffff, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027,
+    0xffff, 0x8027, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff, 0xffff, 0xffff, 0x8027, 0x8027, 0x8027,
+    0xffff, 0xffff, 0x8027, 0x8027, 0x8027, 0x8027, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027,
+    0x8027, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0xffff, 0xffff, 0xffff, 0x8027, 0xffff,
+    0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff,
+    0x8027, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff,
+    0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff,
+    0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0x8002, 0xffff, 0xffff, 0xffff, 0x8002,
+    0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002,
+    0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0xffff, 0xffff, 0x8002,
+    0xffff, 0x8002, 0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002,
+    0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002,
+    0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0xffff, 0x8002, 0xffff,
+    0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff,
+    0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff,
+    0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003,
+    0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0xffff, 0x8003, 0xffff,
+    0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff,
+    0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff,
+    0x8003, 0xffff, 0x8003, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff, 0x8003, 0xffff, 0x8003,
+    0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003, 0x8003, 0xffff, 0x8003, 0x8003, 0xffff, 0xffff,
+    0x8003, 0x8003, 0xffff, 0xffff, 0x8003, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0x8003, 0xffff,
+    0xffff, 0xffff, 0x8003, 0xffff, 0x8003, 0x8003, 0xffff, 0xffff, 0x8003, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002,
+    0xffff, 0x8002, 0xffff, 0x8002, 0x8002, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0x8002, 0xffff, 0x8002, 0x8002, 0xffff, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0x8002, 0xffff,
+    0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0x8002, 0xffff, 0x8002, 0x8002, 0x8002, 0x8002, 0xffff,
+    0x8002, 0x8002, 0xffff, 0xffff, 0x8002, 0xffff, 0x8002, 0xffff, 0xffff, 0xffff, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000,
+    0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000,
+    0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000,
+    0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000,
+    0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000,
+    0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0xffff,
+    0x8000, 0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff, 0xffff, 0x8014,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0x8014, 0xffff,
+    0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8014, 0x8014, 0x8014, 0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0x8014,
+    0xffff, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0x8014, 0x8014,
+    0xffff, 0xffff, 0x8014, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8014, 0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff,
+    0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff, 0x8014, 0xffff,
+    0x8014, 0xffff, 0xffff, 0xffff, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0x8000, 0xffff,
+    0x8000, 0xffff, 0xffff, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff,
+    0x8000, 0x8000, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0xffff,
+    0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0xffff, 0x8000, 0xffff,
+    0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0xffff, 0xffff,
+    0x8000, 0xffff, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0xffff, 0x8000,
+    0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0x8000, 0x8000, 0xffff, 0x8000, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0xffff, 0xffff, 0x8000, 0xffff,
+    0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0xffff, 0x8000, 0x8000, 0x8000, 0xffff,
+    0xffff, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0xffff, 0x802b, 0xffff, 0x802b,
+    0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b,
+    0xffff, 0x801f, 0x801f, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0x801f, 0x801f,
+    0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0x801f, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f,
+    0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0x8028, 0x8028, 0xffff, 0x8028, 0x8028,
+    0x8028, 0xffff, 0x8028, 0x8028, 0x8028, 0xffff, 0x8028, 0xffff, 0x8028, 0x8028, 0x802a, 0x802a,
+    0x8028, 0xffff, 0x802a, 0xffff, 0xffff, 0xffff, 0x802a, 0xffff, 0x802a, 0xffff, 0x802a, 0x802a,
+    0x802a, 0xffff, 0x802a, 0x802a, 0xffff, 0xffff, 0xffff, 0x802a, 0xffff, 0xffff, 0x802a, 0xffff,
+    0x802a, 0xffff, 0x802a, 0x802a, 0xffff, 0xffff, 0xffff, 0x802b, 0xffff, 0x802b, 0x802b, 0x802b,
+    0xffff, 0xffff, 0xffff, 0x802b, 0x802a, 0xffff, 0x802a, 0x802b, 0x802a, 0x802b, 0x802b, 0x802b,
+    0x802b, 0xffff, 0x802b, 0x802b, 0x802a, 0x802a, 0x802a, 0x802b, 0x802a, 0x802b, 0x802a, 0x802b,
+    0xffff, 0xffff, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b,
+    0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0xffff, 0xffff, 0x802b, 0xffff, 0xffff, 0xffff, 0x802b,
+    0xffff, 0xffff, 0x802b, 0x802b, 0xffff, 0x802b, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b,
+    0xffff, 0xffff, 0xffff, 0x802b, 0x802b, 0xffff, 0xffff, 0xffff, 0x802b, 0xffff, 0xffff, 0xffff,
+    0x802b, 0xffff, 0xffff, 0xffff, 0x802b, 0xffff, 0x802b, 0x802b, 0x802b, 0xffff, 0x802b, 0x802b,
+    0x802b, 0xffff, 0xffff, 0xffff, 0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f,
+    0x801f, 0x801f, 0xffff, 0x801f, 0x802b, 0xffff, 0xffff, 0xffff, 0xffff, 0x801f, 0xffff, 0xffff,
+    0x801f, 0x801f, 0xffff, 0x801f, 0x802b, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff,
+    0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0xffff, 0xffff, 0x802b, 0x802b, 0x802b, 0xffff,
+    0x802b, 0x802b, 0xffff, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0x8024, 0x8024, 0x8024,
+    0xffff, 0xffff, 0x8024, 0xffff, 0xffff, 0xffff, 0x8024, 0x8024, 0x801f, 0xffff, 0x801f, 0xffff,
+    0x801f, 0xffff, 0x801f, 0xffff, 0xffff, 0x801f, 0x801f, 0x801f, 0xffff, 0x8024, 0xffff, 0x8024,
+    0xffff, 0x8024, 0xffff, 0x8024, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0x801f,
+    0xffff, 0x8024, 0xffff, 0x8024, 0xffff, 0x8024, 0xffff, 0x8024, 0xffff, 0xffff, 0x8024, 0xffff,
+    0xffff, 0x8024, 0x8024, 0x8024, 0x8024, 0xffff, 0x8024, 0x8024, 0x8024, 0xffff, 0x8024, 0x8024,
+    0xffff, 0x8024, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024,
+    0xffff, 0xffff, 0x8024, 0xffff, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024,
+    0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024,
+    0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0xffff, 0x8019,
+    0x8024, 0x8019, 0x8024, 0x8019, 0x8024, 0x8019, 0x8024, 0x8019, 0x8019, 0x8019, 0x8024, 0x8019,
+    0x801f, 0x801f, 0x801f, 0xffff, 0x801f, 0xffff, 0xffff, 0xffff, 0x801f, 0xffff, 0x801f, 0x801f,
+    0x801f, 0xffff, 0x801f, 0x801f, 0xffff, 0xffff, 0xffff, 0x8024, 0xffff, 0x8024, 0xffff, 0x8024,
+    0x801f, 0x801f, 0xffff, 0xffff, 0x801f, 0x801f, 0xffff, 0x801f, 0xffff, 0x801f, 0xffff, 0xffff,
+    0x801f, 0x8024, 0x801f, 0x8024, 0x801f, 0x801f, 0xffff, 0xffff, 0x801f, 0x801f, 0xffff, 0xffff,
+    0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0x8024, 0xffff,
+    0x8024, 0xffff, 0xffff, 0xffff, 0xffff, 0x8024, 0xffff, 0xffff, 0xffff, 0x8024, 0xffff, 0xffff,
+    0xffff, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0x8024, 0xffff,
+    0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0x8024, 0xffff,
+    0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8019, 0x8024, 0x8019, 0x8024, 0xffff, 0xffff, 0xffff,
+    0x8024, 0xffff, 0x8024, 0xffff, 0x8024, 0x8024, 0xffff, 0xffff, 0x8024, 0x8024, 0xffff, 0x8024,
+    0x8024, 0xffff, 0xffff, 0xffff, 0x8024, 0xffff, 0xffff, 0xffff, 0xffff, 0x8029, 0x8029, 0x8029,
+    0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029,
+    0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029,
+    0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8012,
+    0xffff, 0xffff, 0xffff, 0x8012, 0xffff, 0x8012, 0x8012, 0x8012, 0xffff, 0xffff, 0xffff, 0x8012,
+    0xffff, 0xffff, 0x8012, 0xffff, 0x8012, 0xffff, 0x8012, 0x8012, 0x8012, 0xffff, 0x8012, 0xffff,
+    0xffff, 0x8012, 0xffff, 0x8012, 0x8012, 0x8012, 0xffff, 0x8012, 0x8012, 0xffff, 0x8012, 0x8012,
+    0xffff, 0x8012, 0xffff, 0xffff, 0x8012, 0x8012, 0xffff, 0x8012, 0xffff, 0x8012, 0xffff, 0x8012,
+    0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019,
+    0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8013, 0xffff, 0xffff, 0x8013, 0xffff, 0xffff, 0xffff, 0xffff, 0x8013,
+    0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019,
+    0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0x8019, 0x8013, 0x8019, 0x8013,
+    0x8019, 0x8013, 0x8019, 0x8019, 0x8019, 0x8019, 0x8019, 0x8013, 0x8019, 0x8013, 0x8019, 0x8013,
+    0x8019, 0x8013, 0x8013, 0x8013, 0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019,
+    0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019,
+    0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019,
+    0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019,
+    0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0x8019, 0x8013, 0x8019, 0x8013,
+    0x8019, 0x8019, 0x8019, 0xffff, 0x8013, 0x8013, 0xffff, 0x8013, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0xffff, 0xffff,
+    0x8013, 0x8013, 0xffff, 0xffff, 0x8013, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013,
+    0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0x8019, 0x8019, 0xffff, 0xffff,
+    0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014,
+    0xffff, 0x8013, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8014, 0xffff, 0xffff, 0xffff, 0x8013,
+    0x8013, 0x8014, 0x8013, 0x8013, 0x8013, 0x8013, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8014, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8014, 0x8014, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8014,
+    0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff,
+    0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0x8014, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff, 0xffff, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff,
+    0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x8013, 0x8014, 0x8013, 0x8013,
+    0x8014, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8014,
+    0x8013, 0x8014, 0x8013, 0x8013, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8013,
+    0x8013, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0xffff, 0x8013, 0x8013, 0xffff, 0x8013,
+    0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0xffff, 0x8013, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8014, 0x8014, 0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff, 0x8014, 0xffff, 0x8014, 0xffff,
+    0xffff, 0x8017, 0x8017, 0x8017, 0x8014, 0xffff, 0x8014, 0x8014, 0xffff, 0xffff, 0xffff, 0x8017,
+    0x8014, 0x8014, 0x8014, 0x8017, 0x8014, 0x8017, 0x8017, 0x8017, 0x8014, 0x8017, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017,
+    0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0x8017, 0x8014, 0x8017,
+    0x8014, 0x8017, 0x8014, 0x8017, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019,
+    0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019,
+    0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff,
+    0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff,
+    0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0xffff, 0xffff, 0x8019, 0xffff, 0x8019,
+    0x8019, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff,
+    0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff,
+    0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff, 0x8019, 0x8019, 0x8019, 0xffff,
+    0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0x8019, 0xffff, 0xffff, 0x8019, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0xffff, 0xffff, 0xffff, 0x8013, 0xffff, 0x8013, 0x8013, 0x8013, 0xffff, 0x8013,
+    0xffff, 0x8013, 0xffff, 0xffff, 0xffff, 0x8013, 0xffff, 0x8013, 0x8013, 0x8013, 0xffff, 0x8013,
+    0x8013, 0x8013, 0xffff, 0x8013, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8013, 0x8014, 0x8014, 0x8014, 0x8014, 0x8017,
+    0x8014, 0x8017, 0x8014, 0x8017, 0x8014, 0x8017, 0x8014, 0x8017, 0x8013, 0x8014, 0x8013, 0x8014,
+    0x8013, 0x8014, 0x8013, 0x8013, 0x8014, 0x8014, 0x8013, 0x8017, 0x8014, 0x8014, 0x8014, 0x8017,
+    0x8014, 0x8017, 0x8017, 0x8017, 0x8014, 0x8014, 0x8014, 0x8017, 0x8013, 0x8013, 0xffff, 0x8013,
+    0x8013, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff,
+    0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff,
+    0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017,
+    0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8018,
+    0xffff, 0xffff, 0xffff, 0x8011, 0xffff, 0xffff, 0xffff, 0x8011, 0x8011, 0xffff, 0x8011, 0x8011,
+    0xffff, 0x8011, 0x8011, 0x8011, 0x8011, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff,
+    0x8011, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0x8011, 0xffff,
+    0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011,
+    0xffff, 0xffff, 0x8011, 0xffff, 0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff,
+    0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0xffff, 0xffff, 0xffff, 0x8011,
+    0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011,
+    0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011,
+    0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011,
+    0xffff, 0x8011, 0x8011, 0x8011, 0xffff, 0xffff, 0x8011, 0xffff, 0xffff, 0xffff, 0x8011, 0xffff,
+    0xffff, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff,
+    0xffff, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0x8011,
+    0x8011, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0xffff, 0xffff, 0xffff, 0x8011,
+    0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0xffff,
+    0xffff, 0x8011, 0xffff, 0x8011, 0x8011, 0x8011, 0xffff, 0xffff, 0x8011, 0x8011, 0xffff, 0x8011,
+    0xffff, 0x8011, 0xffff, 0xffff, 0x8011, 0x8011, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8017, 0x8011, 0x8011, 0xffff, 0xffff, 0x8011, 0x8011, 0xffff, 0xffff,
+    0x8011, 0xffff, 0xffff, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0x8011, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017,
+    0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017,
+    0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017,
+    0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017,
+    0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017,
+    0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a,
+    0xffff, 0xffff, 0x801a, 0x801a, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff,
+    0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017,
+    0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff,
+    0xffff, 0x8016, 0xffff, 0x8016, 0xffff, 0xffff, 0x8016, 0x8016, 0xffff, 0xffff, 0x8016, 0xffff,
+    0x8016, 0xffff, 0x8016, 0x8016, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0x801a, 0x801a, 0x801a,
+    0x801a, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0x801a,
+    0xffff, 0x801a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8015, 0xffff, 0xffff, 0x8015, 0x8015,
+    0xffff, 0xffff, 0x8015, 0x8015, 0x8016, 0xffff, 0x8016, 0xffff, 0x8016, 0xffff, 0x8016, 0xffff,
+    0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0x8015, 0x8016, 0x8015, 0x8016,
+    0x8015, 0x8016, 0x8015, 0x8015, 0x8016, 0x8016, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff,
+    0x8015, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017,
+    0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017,
+    0xffff, 0xffff, 0xffff, 0x8015, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8015, 0x8017, 0x8015,
+    0x8015, 0x8015, 0x8017, 0x8015, 0x8015, 0xffff, 0x8015, 0x8015, 0x8015, 0xffff, 0x8015, 0xffff,
+    0xffff, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0x8015, 0x8017, 0x8015, 0x8017, 0x8017,
+    0x8017, 0x8015, 0x8017, 0x8015, 0x8015, 0x8015, 0x8017, 0x8015, 0x8017, 0x8015, 0x8017, 0x8017,
+    0x8015, 0x8015, 0x8017, 0x8015, 0xffff, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0x8015,
+    0xffff, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8015, 0xffff, 0x8017, 0x8015, 0x8017, 0x8017,
+    0x8015, 0x8015, 0x8017, 0x8017, 0x8015, 0x8015, 0x8015, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0xffff, 0xffff, 0x801a, 0xffff, 0xffff, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0x801a,
+    0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a,
+    0x801a, 0xffff, 0x801a, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0x801a, 0x801a, 0xffff, 0x801a,
+    0x801a, 0xffff, 0x801a, 0x801a, 0xffff, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff,
+    0x801a, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0x801a,
+    0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0x801a, 0xffff, 0x801a, 0x801a, 0x801a, 0xffff, 0xffff,
+    0x801a, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0x801a, 0x801a, 0xffff, 0x801a,
+    0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff,
+    0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0x801a,
+    0xffff, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0xffff, 0x801a,
+    0xffff, 0x801a, 0xffff, 0xffff, 0xffff, 0x801a, 0xffff, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff,
+    0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0xffff, 0x801a, 0x801a, 0xffff, 0xffff,
+    0x801a, 0xffff, 0xffff, 0xffff, 0x802a, 0x802b, 0x802a, 0x802b, 0x802a, 0x802b, 0x802a, 0x802a,
+    0x802a, 0x802a, 0x802a, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0x802b, 0x802b, 0xffff, 0x802b,
+    0x802b, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0xffff, 0xffff, 0x802a, 0xffff, 0x802a, 0x802a,
+    0xffff, 0xffff, 0x802a, 0xffff, 0x802a, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0x802a, 0x802a,
+    0xffff, 0xffff, 0x8020, 0x8020, 0x802b, 0x802b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x802c,
+    0xffff, 0xffff, 0x802c, 0x802c, 0x802b, 0x802b, 0x802c, 0x802c, 0xffff, 0x802c, 0xffff, 0x802c,
+    0xffff, 0xffff, 0x8020, 0x8020, 0xffff, 0x802c, 0x8020, 0x8020, 0x802c, 0x802c, 0x8020, 0x8020,
+    0x802c, 0x802c, 0x8020, 0x8020, 0xffff, 0x802a, 0xffff, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff,
+    0x802a, 0x802a, 0xffff, 0xffff, 0x802a, 0x802a, 0x802a, 0xffff, 0x8020, 0x8020, 0x802a, 0x8020,
+    0x802a, 0x8020, 0x802a, 0x8020, 0x802a, 0x8020, 0x8020, 0x8020, 0x802a, 0x802a, 0x8020, 0x8020,
+    0x802a, 0xffff, 0xffff, 0xffff, 0xffff, 0x8020, 0xffff, 0x8020, 0x802b, 0xffff, 0x802b, 0xffff,
+    0x802b, 0xffff, 0x802b, 0x802b, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff, 0x802b, 0xffff,
+    0x802b, 0x802b, 0x802c, 0x802c, 0x802b, 0x802b, 0x802c, 0x802c, 0x802b, 0x802c, 0x802c, 0x802c,
+    0x802c, 0x802c, 0x8020, 0x8020, 0x802c, 0x802c, 0x8020, 0x8020, 0x8020, 0x802c, 0x8020, 0x802c,
+    0x802c, 0xffff, 0x802c, 0x802c, 0xffff, 0xffff, 0x802c, 0xffff, 0xffff, 0x8021, 0x8021, 0x8021,
+    0x802c, 0x8021, 0x802c, 0x8021, 0xffff, 0xffff, 0xffff, 0x8021, 0xffff, 0xffff, 0x8021, 0x8021,
+    0xffff, 0xffff, 0x8021, 0x8021, 0xffff, 0xffff, 0x8021, 0xffff, 0xffff, 0xffff, 0x8021, 0x8021,
+    0x8021, 0x8021, 0x802c, 0xffff, 0xffff, 0xffff, 0x8021, 0xffff, 0x8021, 0xffff, 0x8021, 0x8021,
+    0xffff, 0xffff, 0x8021, 0xffff, 0x8021, 0xffff, 0x8021, 0x8021, 0x8020, 0x802c, 0x8020, 0x802c,
+    0x8020, 0x802c, 0x8020, 0x8020, 0x8020, 0xffff, 0x8020, 0xffff, 0x802c, 0x802c, 0xffff, 0x802c,
+    0x802c, 0xffff, 0xffff, 0xffff, 0x802c, 0x802c, 0xffff, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff,
+    0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0x8020, 0xffff, 0xffff, 0x8020, 0xffff,
+    0x802c, 0xffff, 0x802c, 0xffff, 0x8021, 0x8021, 0xffff, 0xffff, 0x8021, 0x8021, 0xffff, 0xffff,
+    0x8021, 0x8021, 0xffff, 0xffff, 0x8021, 0x8021, 0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0xffff,
+    0x8027, 0xffff, 0x8027, 0x8027, 0xffff, 0xffff, 0x8027, 0x8027, 0x802a, 0x802a, 0xffff, 0x802a,
+    0x802a, 0xffff, 0xffff, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff, 0x8027, 0xffff,
+    0x8027, 0x8027, 0x8027, 0xffff, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020,
+    0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0x8020, 0x8020, 0xffff, 0x8020,
+    0x8027, 0xffff, 0xffff, 0xffff, 0x8020, 0x8020, 0xffff, 0x8020, 0x8020, 0x8020, 0x8020, 0xffff,
+    0x8020, 0xffff, 0x8020, 0xffff, 0xffff, 0xffff, 0x8020, 0x8020, 0x8020, 0xffff, 0x8020, 0xffff,
+    0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0xffff,
+    0x8020, 0xffff, 0x8020, 0xffff, 0x8020, 0x8020, 0xffff, 0xffff, 0x8020, 0x8020, 0xffff, 0xffff,
+    0x8020, 0x8020, 0xffff, 0xffff, 0x8020, 0x8020, 0xffff, 0xffff, 0xffff, 0xffff, 0x8025, 0xffff,
+    0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0xffff, 0x8025, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0x8025, 0x8025, 0xffff, 0x8025, 0x8025,
+    0xffff, 0x8025, 0x8025, 0x8025, 0xffff, 0xffff, 0xffff, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025,
+    0xffff, 0x8025, 0x8025, 0x8025, 0x8021, 0xffff, 0x8021, 0x8025, 0xffff, 0x8025, 0x8025, 0x8025,
+    0xffff, 0xffff, 0x8025, 0x8025, 0x8025, 0xffff, 0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025,
+    0xffff, 0xffff, 0x8025, 0x8025, 0xffff, 0x8025, 0xffff, 0x8025, 0x8025, 0x8025, 0xffff, 0x8025,
+    0xffff, 0x8025, 0xffff, 0xffff, 0xffff, 0x8025, 0x8025, 0x8025, 0xffff, 0x8025, 0x8025, 0x8025,
+    0x8025, 0xffff, 0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025,
+    0xffff, 0xffff, 0x8025, 0x8025, 0x8029, 0x8029, 0xffff, 0x8029, 0x8025, 0x8029, 0x8025, 0x8025,
+    0x8025, 0x8029, 0x8025, 0x8025, 0x8025, 0x8025, 0x8025, 0x8029, 0x8025, 0x8025, 0x8025, 0x8029,
+    0x8025, 0x8025, 0x8029, 0x8029, 0x8025, 0x8029, 0x8029, 0x8029, 0x8025, 0x8029, 0x8025, 0x8029,
+    0x8025, 0x8029, 0x8025, 0x8029, 0x8025, 0x8029, 0x8025, 0x8025, 0x8025, 0x8029, 0x8029, 0x8029,
+    0xffff, 0xffff, 0xffff, 0x8025, 0xffff, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025, 0xffff, 0xffff,
+    0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0xffff, 0xffff, 0xffff, 0x8025, 0x8025, 0x8025, 0xffff,
+    0x8025, 0x8025, 0xffff, 0xffff, 0x8025, 0x8025, 0xffff, 0xffff, 0xffff, 0x8025, 0xffff, 0xffff,
+    0xffff, 0x8025, 0xffff, 0xffff, 0xffff, 0x8025, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0x8029,
+    0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029,
+    0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029,
+    0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0x8025, 0x8029, 0x8029, 0x8029,
+    0x8025, 0x8029, 0x8025, 0x8029, 0x8025, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8023,
+    0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023,
+    0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023,
+    0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0xffff,
+    0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029,
+    0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029,
+    0xffff, 0x8023, 0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x8023,
+    0xffff, 0xffff, 0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x8023, 0xffff, 0x8029, 0xffff, 0x8029,
+    0xffff, 0xffff, 0x8023, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0x8023, 0x8029, 0x8023, 0x8023,
+    0x8023, 0x8029, 0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8029,
+    0xffff, 0x8023, 0xffff, 0xffff, 0xffff, 0x8023, 0xffff, 0xffff, 0x8029, 0x8029, 0x8023, 0x8029,
+    0x8023, 0x8029, 0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029, 0x8029, 0x8029,
+    0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8029, 0x8029, 0x8029,
+    0x8029, 0x8029, 0x8023, 0x8029, 0xffff, 0x8023, 0xffff, 0xffff, 0xffff, 0x8023, 0xffff, 0x8023,
+    0xffff, 0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023,
+    0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8023,
+    0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8023, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029,
+    0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0x8029,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017,
+    0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0x8017, 0x8017, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff, 0x8029, 0xffff,
+    0xffff, 0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0x8023, 0x8023, 0x8023, 0x8023, 0xffff, 0xffff,
+    0xffff, 0x8023, 0xffff, 0x8023, 0xffff, 0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0x8023, 0x8023,
+    0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x8023, 0xffff, 0xffff,
+    0x8023, 0x8023, 0xffff, 0xffff, 0x8023, 0x8023, 0xffff, 0xffff, 0xffff, 0x8023, 0xffff, 0x8023,
+    0x8023, 0x8023, 0x8023, 0xffff, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029, 0x8023, 0x8029,
+    0x8023, 0x8023, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff,
+    0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff,
+    0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff,
+    0x8029, 0x8029, 0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff,
+    0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0x8029, 0xffff, 0xffff, 0xffff,
+    0x8029, 0x8029, 0x8029, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0xffff,
+    0x8029, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0xffff, 0x8029, 0xffff, 0xffff,
+    0x8029, 0x8029, 0xffff, 0x8029, 0x8029, 0x8029, 0xffff, 0xffff, 0x8029, 0x8029, 0xffff, 0xffff,
+    0x8029, 0x8029, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017,
+    0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017,
+    0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0xffff, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff,
+    0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017,
+    0xffff, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff, 0xffff, 0xffff,
+    0x8017, 0xffff, 0xffff, 0xffff, 0x8017, 0x8017, 0x8017, 0xffff, 0x8017, 0xffff, 0x8017, 0xffff,
+    0x8017, 0x8017, 0xffff, 0xffff, 0x8017, 0x8017, 0xffff, 0xffff,
+};
+
+const uint32_t kZones[] = {
+    1, 14,      // Africa/Cairo
+    44, 62,     // Africa/Casablanca
+    70, 83,     // Africa/Lagos
+    89, 104,    // Africa/Nairobi
+    110, 128,   // America/Anchorage
+    153, 184,   // America/Argentina/Buenos_Aires
+    191, 206,   // America/Bogota
+    213, 229,   // America/Chicago
+    252, 267,   // America/Denver
+    290, 319,   // America/Indiana/Indianapolis
+    342, 362,   // America/Los_Angeles
+    385, 405,   // America/Mexico_City
+    410, 319,   // America/New_York
+    427, 443,   // America/Phoenix
+    448, 465,   // America/Santiago
+    497, 184,   // America/Sao_Paulo
+    515, 319,   // America/Toronto
+    531, 544,   // Asia/Bangkok
+    552, 563,   // Asia/Dubai
+    571, 584,   // Asia/Karachi
+    590, 603,   // Asia/Kolkata
+    612, 627,   // Asia/Pyongyang
+    633, 627,   // Asia/Seoul
+    644, 658,   // Asia/Shanghai
+    664, 679,   // Asia/Singapore
+    687, 699,   // Asia/Tehran
+    712, 723,   // Asia/Tokyo
+    729, 748,   // Australia/Brisbane
+    756, 776,   // Australia/Melbourne
+    805, 821,   // Australia/Perth
+    828, 776,   // Australia/Sydney
+    845, 859,   // Europe/Athens
+    888, 902,   // Europe/Berlin
+    929, 902,   // Europe/Budapest
+    945, 959,   // Europe/Dublin
+    986, 859,   // Europe/Helsinki
+    1002, 1018, // Europe/Istanbul
+    1026, 859,  // Europe/Kyiv
+    1038, 1052, // Europe/Lisbon
+    1078, 1092, // Europe/London
+    1117, 902,  // Europe/Madrid
+    1131, 1145, // Europe/Moscow
+    1151, 902,  // Europe/Paris
+    1164, 902,  // Europe/Rome
+    1176, 902,  // Europe/Vienna
+    1190, 1207, // Pacific/Auckland
+    1235, 1252, // Pacific/Honolulu
+};
+
+const char kStrings[] =
+    "\0"
+    "Africa/Cairo\0"
+    "EET-2EEST,M4.5.5/0,M10.5.4/24\0"
+    "Africa/Casablanca\0"
+    "<+01>-1\0"
+    "Africa/Lagos\0"
+    "WAT-1\0"
+    "Africa/Nairobi\0"
+    "EAT-3\0"
+    "America/Anchorage\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "America/Argentina/Buenos_Aires\0"
+    "<-03>3\0"
+    "America/Bogota\0"
+    "<-05>5\0"
+    "America/Chicago\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "America/Denver\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "America/Indiana/Indianapolis\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "America/Los_Angeles\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "America/Mexico_City\0"
+    "CST6\0"
+    "America/New_York\0"
+    "America/Phoenix\0"
+    "MST7\0"
+    "America/Santiago\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "America/Sao_Paulo\0"
+    "America/Toronto\0"
+    "Asia/Bangkok\0"
+    "<+07>-7\0"
+    "Asia/Dubai\0"
+    "<+04>-4\0"
+    "Asia/Karachi\0"
+    "PKT-5\0"
+    "Asia/Kolkata\0"
+    "IST-5:30\0"
+    "Asia/Pyongyang\0"
+    "KST-9\0"
+    "Asia/Seoul\0"
+    "Asia/Shanghai\0"
+    "CST-8\0"
+    "Asia/Singapore\0"
+    "<+08>-8\0"
+    "Asia/Tehran\0"
+    "<+0330>-3:30\0"
+    "Asia/Tokyo\0"
+    "JST-9\0"
+    "Australia/Brisbane\0"
+    "AEST-10\0"
+    "Australia/Melbourne\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "Australia/Perth\0"
+    "AWST-8\0"
+    "Australia/Sydney\0"
+    "Europe/Athens\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "Europe/Berlin\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Europe/Budapest\0"
+    "Europe/Dublin\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "Europe/Helsinki\0"
+    "Europe/Istanbul\0"
+    "<+03>-3\0"
+    "Europe/Kyiv\0"
+    "Europe/Lisbon\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "Europe/London\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "Europe/Madrid\0"
+    "Europe/Moscow\0"
+    "MSK-3\0"
+    "Europe/Paris\0"
+    "Europe/Rome\0"
+    "Europe/Vienna\0"
+    "Pacific/Auckland\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "Pacific/Honolulu\0"
+    "HST10";
+
+} // namespace
+
+extern const ESPDateZoneGridTable testZoneGrid = {
+    -90.0f,
+    -180.0f,
+    90.0f,
+    180.0f,
+    10,
+    0x0000,
+    47,
+    kNodes,
+    kZones,
+    kStrings,
+};
@@ -0,0 +1,7 @@
+// Generated by scripts/generate_zone_grid.py from zone_outlines.geojson; do not edit.
+// 47 zones, depth 10, 5840 nodes.
+#pragma once
+
+#include <ESPDate.h>
+
+extern const ESPDateZoneGridTable testZoneGrid;